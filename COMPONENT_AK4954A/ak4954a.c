@@ -40,8 +40,24 @@
 
 #define I2C_WRITE_OPERATION        (0x00)
 
+/* Power Management 1 with the ADC, DAC and filters running */
+#define AK4954A_PWR_MGMT1_ACTIVE   (AK4954A_PWR_MGMT1_PMDAC | AK4954A_PWR_MGMT1_PMVCM | \
+                                    AK4954A_PWR_MGMT1_PMADL | AK4954A_PWR_MGMT1_PMADR | \
+                                    AK4954A_PWR_MGMT1_PMPFIL)
+
 ak4954a_transmit_callback   ak4954a_transmit;
 
+/* Shadow of the codec control registers, and mask of the entries known to
+ * match the codec. Writes of unchanged registers are skipped. Both are only
+ * accessed by the writing task; other tasks request an invalidation, which
+ * the next write applies before it looks at the shadow. */
+uint8_t  ak4954a_shadow[AK4954A_REG_COUNT];
+uint32_t ak4954a_shadow_valid;
+volatile bool ak4954a_invalidate_pending;
+
+uint32_t ak4954a_write(uint8_t reg_addr, uint8_t data);
+uint32_t ak4954a_write_regs(uint8_t reg_addr, const uint8_t *data, uint32_t length);
+
 /*******************************************************************************
 * Function Name: ak4954a_init
 ********************************************************************************
@@ -58,41 +74,40 @@ ak4954a_transmit_callback   ak4954a_transmit;
 uint32_t ak4954a_init(ak4954a_transmit_callback callback)
 {
     uint32_t ret;
+    const uint8_t zero = 0x00;
+    const uint8_t mode[] = {AK4954A_DEF_DATA_ALIGNMENT,
+                            AK4954A_DEF_SAMPLING_RATE | AK4954A_MODE_CTRL2_FS_48kHz};
+    const uint8_t in_vol[] = {0x00, 0x00};
     
     ak4954a_transmit = callback;
+    ak4954a_shadow_valid = 0;
+    ak4954a_invalidate_pending = false;
    
-    /* Clear Power Managament 1 register (dummy write) */
-    ret = ak4954a_transmit(AK4954A_REG_PWR_MGMT1, 0x00);
+    /* Clear Power Managament 1 register (dummy write, not cached) */
+    ret = ak4954a_transmit(AK4954A_REG_PWR_MGMT1, &zero, 1u);
     if (ret) return ret;
 
     /* Clear Power Managament 1 register */
-    ret = ak4954a_transmit(AK4954A_REG_PWR_MGMT1, 0x00);
-    if (ret) return ret;
-    
-    /* Set the data alignment */
-    ret = ak4954a_transmit(AK4954A_REG_MODE_CTRL1, AK4954A_DEF_DATA_ALIGNMENT);
+    ret = ak4954a_write(AK4954A_REG_PWR_MGMT1, 0x00);
     if (ret) return ret;
     
-    /* Set sample rate */
-    ret = ak4954a_transmit(AK4954A_REG_MODE_CTRL2, AK4954A_DEF_SAMPLING_RATE |
-                                                   AK4954A_MODE_CTRL2_FS_48kHz);
+    /* Set the data alignment and the sample rate */
+    ret = ak4954a_write_regs(AK4954A_REG_MODE_CTRL1, mode, sizeof(mode));
     if (ret) return ret;
     
     /* Set MPWR pin Power Management */
-    ret = ak4954a_transmit(AK4954A_REG_SIG_SEL1, AK4954A_SIG_SEL1_PMMP |
-                                                 AK4954A_SIG_SEL1_MGAIN_0dB);
+    ret = ak4954a_write(AK4954A_REG_SIG_SEL1, AK4954A_SIG_SEL1_PMMP |
+                                              AK4954A_SIG_SEL1_MGAIN_0dB);
     if (ret) return ret;
     
     /* Clear Digital Filter Mode register */
-    ret = ak4954a_transmit(AK4954A_REG_DIG_FILT_MODE, 0x00);
+    ret = ak4954a_write(AK4954A_REG_DIG_FILT_MODE, 0x00);
     if (ret) return ret;
 
     /* Mute right channel [Not used] */
-    ret = ak4954a_transmit(AK4954A_REG_MODE_CTRL3, 0x00);
+    ret = ak4954a_write(AK4954A_REG_MODE_CTRL3, 0x00);
     if (ret) return ret;
-    ret = ak4954a_transmit(AK4954A_REG_RCH_IN_VOL, 0x00);
-    if (ret) return ret;
-    ret = ak4954a_transmit(AK4954A_REG_LCH_IN_VOL, 0x00);
+    ret = ak4954a_write_regs(AK4954A_REG_LCH_IN_VOL, in_vol, sizeof(in_vol));
 
     return ret;  
 }
@@ -101,12 +116,12 @@ uint32_t ak4954a_init(ak4954a_transmit_callback callback)
 * Function Name: ak4954a_adjust_volume
 ********************************************************************************
 * Summary:
-*   This function updates the volume of both the left and right channels of the
-*     headphone output.
+*   This function updates the volume of the left and right channels of the
+*     headphone output, in a single transaction.
 *
 *
 * Parameters:  
-*    volume - Steps of 0.5dB, where:
+*    left, right - Steps of 0.5dB, where:
 *            Minimum volume: -65.5dB (0x8F)
 *            Maximum volume:  +6.0dB (0x00)
 *            Mute: (0x90~0xFF)
@@ -115,13 +130,11 @@ uint32_t ak4954a_init(ak4954a_transmit_callback callback)
 *   uint32_t - I2C master transaction error status
 *
 *******************************************************************************/
-uint32_t ak4954a_adjust_volume(uint8_t volume)
+uint32_t ak4954a_adjust_volume(uint8_t left, uint8_t right)
 {
-    uint32_t ret;
-        
-    ret = ak4954a_transmit(AK4954A_REG_LCH_DIG_VOL, volume);
-    if (ret) return ret;
-    return ak4954a_transmit(AK4954A_REG_RCH_DIG_VOL, volume);
+    const uint8_t data[] = {left, right};
+
+    return ak4954a_write_regs(AK4954A_REG_LCH_DIG_VOL, data, sizeof(data));
 }
 
 /*******************************************************************************
@@ -140,19 +153,11 @@ uint32_t ak4954a_adjust_volume(uint8_t volume)
 *******************************************************************************/
 uint32_t ak4954a_activate(void)
 {
-    uint32_t ret;
-    
-    /* Enable Power Management DAC */
-    ret = ak4954a_transmit(AK4954A_REG_PWR_MGMT1,
-                           AK4954A_PWR_MGMT1_PMDAC | AK4954A_PWR_MGMT1_PMVCM |
-                           AK4954A_PWR_MGMT1_PMADL | AK4954A_PWR_MGMT1_PMADR |
-                           AK4954A_PWR_MGMT1_PMPFIL);
-    if (ret) return ret;
-    
-    /* Enable Left/Right Channels */
-    ret = ak4954a_transmit(AK4954A_REG_PWR_MGMT2, 
-                           AK4954A_PWR_MGMT2_PMHPL | AK4954A_PWR_MGMT2_PMHPR);
-    return ret;
+    /* Enable Power Management DAC, then Left/Right Channels */
+    const uint8_t data[] = {AK4954A_PWR_MGMT1_ACTIVE,
+                            AK4954A_PWR_MGMT2_PMHPL | AK4954A_PWR_MGMT2_PMHPR};
+
+    return ak4954a_write_regs(AK4954A_REG_PWR_MGMT1, data, sizeof(data));
 }
 
 /*******************************************************************************
@@ -174,11 +179,171 @@ uint32_t ak4954a_deactivate(void)
 {
     uint32_t ret;
    
-    /* Disable Left/Right Channels */
-    ret = ak4954a_transmit(AK4954A_REG_PWR_MGMT2, 0x00);
+    /* Disable Left/Right Channels (before the DAC, so not in a burst) */
+    ret = ak4954a_write(AK4954A_REG_PWR_MGMT2, 0x00);
+    if (ret) return ret;
     
     /* Disable Power Management DAC */
-    ret = ak4954a_transmit(AK4954A_REG_PWR_MGMT1, AK4954A_PWR_MGMT1_PMVCM);
+    ret = ak4954a_write(AK4954A_REG_PWR_MGMT1, AK4954A_PWR_MGMT1_PMVCM);
+    return ret;
+}
+
+/*******************************************************************************
+* Function Name: ak4954a_set_sample_rate
+********************************************************************************
+* Summary:
+*   Sets the sampling rate and the MCKI ratio of the codec. The MCKI is 384fs
+*   up to 48kHz and 256fs for 88.2kHz and 96kHz. The FS and CM bits may only
+*   change while the ADC, the DAC and the programmable filter are powered
+*   down, so the codec should be deactivated while changing the rate.
+*
+* Parameters:
+*    sample_rate - Sampling rate in Hz
+*
+* Return:
+*   uint32_t - I2C master transaction error status
+*
+*******************************************************************************/
+uint32_t ak4954a_set_sample_rate(uint32_t sample_rate)
+{
+    uint8_t mode;
+
+    switch (sample_rate)
+    {
+        case 96000:
+            mode = AK4954A_MODE_CTRL2_CM_256fs | AK4954A_MODE_CTRL2_FS_96kHz;
+            break;
+        case 88200:
+            mode = AK4954A_MODE_CTRL2_CM_256fs | AK4954A_MODE_CTRL2_FS_88k2Hz;
+            break;
+        case 44100:
+            mode = AK4954A_DEF_SAMPLING_RATE | AK4954A_MODE_CTRL2_FS_44k1Hz;
+            break;
+        default:
+            mode = AK4954A_DEF_SAMPLING_RATE | AK4954A_MODE_CTRL2_FS_48kHz;
+            break;
+    }
+
+    return ak4954a_write(AK4954A_REG_MODE_CTRL2, mode);
+}
+
+/*******************************************************************************
+* Function Name: ak4954a_invalidate
+********************************************************************************
+* Summary:
+*   Discards the shadow map, for instance after a failed transaction. The next
+*   writes are all sent to the codec. May be called from any task: the map is
+*   discarded by the next write, so an invalidation cannot be lost in the
+*   middle of a shadow update.
+*
+* Parameters:
+*    None
+*
+* Return:
+*   None
+*
+*******************************************************************************/
+void ak4954a_invalidate(void)
+{
+    ak4954a_invalidate_pending = true;
+}
+
+/*******************************************************************************
+* Function Name: ak4954a_write
+********************************************************************************
+* Summary:
+*   Writes a single register through the shadow map.
+*
+* Parameters:
+*    reg_addr - Register address
+*    data - Register value
+*
+* Return:
+*   uint32_t - I2C master transaction error status
+*
+*******************************************************************************/
+uint32_t ak4954a_write(uint8_t reg_addr, uint8_t data)
+{
+    return ak4954a_write_regs(reg_addr, &data, 1u);
+}
+
+/*******************************************************************************
+* Function Name: ak4954a_write_regs
+********************************************************************************
+* Summary:
+*   Writes contiguous registers through the shadow map. The registers that
+*   already hold their value at both ends of the range are trimmed, and the
+*   rest is sent as one auto-increment burst; nothing is sent if no register
+*   changes. The shadow entries are invalidated if the transaction fails.
+*
+* Parameters:
+*    reg_addr - Address of the first register
+*    data - Register values
+*    length - Number of registers, up to AK4954A_BURST_SIZE
+*
+* Return:
+*   uint32_t - I2C master transaction error status
+*
+*******************************************************************************/
+uint32_t ak4954a_write_regs(uint8_t reg_addr, const uint8_t *data, uint32_t length)
+{
+    uint32_t first = 0;
+    uint32_t last = length;
+    uint32_t mask;
+    uint32_t ret;
+    uint32_t i;
+
+    /* Apply an invalidation requested since the last write. One requested
+       between the test and the clear is covered by this one. */
+    if (ak4954a_invalidate_pending)
+    {
+        ak4954a_invalidate_pending = false;
+        ak4954a_shadow_valid = 0;
+    }
+
+    /* Registers outside the shadow map are always written */
+    if ((reg_addr + length) <= AK4954A_REG_COUNT)
+    {
+        while ((first < last) &&
+               (0u != (ak4954a_shadow_valid & (1u << (reg_addr + first)))) &&
+               (ak4954a_shadow[reg_addr + first] == data[first]))
+        {
+            first++;
+        }
+
+        while ((last > first) &&
+               (0u != (ak4954a_shadow_valid & (1u << (reg_addr + last - 1u)))) &&
+               (ak4954a_shadow[reg_addr + last - 1u] == data[last - 1u]))
+        {
+            last--;
+        }
+    }
+
+    if (first == last)
+    {
+        return 0;
+    }
+
+    ret = ak4954a_transmit(reg_addr + first, &data[first], last - first);
+
+    if ((reg_addr + length) <= AK4954A_REG_COUNT)
+    {
+        for (i = first; i < last; i++)
+        {
+            mask = 1u << (reg_addr + i);
+
+            if (ret == 0)
+            {
+                ak4954a_shadow[reg_addr + i] = data[i];
+                ak4954a_shadow_valid |= mask;
+            }
+            else
+            {
+                ak4954a_shadow_valid &= ~mask;
+            }
+        }
+    }
+
     return ret;
 }
 
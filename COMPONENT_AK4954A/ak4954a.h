@@ -45,11 +45,18 @@
 
     #define AK4954A_PACKET_SIZE         (0x02u)
 
+    /* Maximum number of registers written in one auto-increment burst */
+    #define AK4954A_BURST_SIZE          (0x08u)
+
+    /* Number of control registers mirrored in the shadow map */
+    #define AK4954A_REG_COUNT           (0x20u)
+
     /* Timeout in Milliseconds for I2C commands */
     #define AK4954A_I2C_TIMEOUT_MS      (50u)
     
-    /* I2C Callback typedef */
-    typedef uint32_t (*ak4954a_transmit_callback)(uint8_t reg_addr, uint8_t data);
+    /* I2C Callback typedef, writes length registers from reg_addr with the
+     * codec address auto-increment */
+    typedef uint32_t (*ak4954a_transmit_callback)(uint8_t reg_addr, const uint8_t *data, uint32_t length);
 
     /**************************************************************************************************
     * Register Addresses for AK4954A I2C Interface
@@ -69,7 +76,7 @@
     #define AK4954A_REG_RCH_IN_VOL      (0x0E)  /* Right Channel Input Volume Control */
     #define AK4954A_REG_HI_OUT_CTRL     (0x12)  /* High Pass Filter Output Control */
     #define AK4954A_REG_LCH_DIG_VOL     (0x13)  /* Left Channel Digital Volume Control */
-    #define AK4954A_REG_RCH_DIG_VOL     (0x14)  /* Left Channel Digital Volume Control */
+    #define AK4954A_REG_RCH_DIG_VOL     (0x14)  /* Right Channel Digital Volume Control */
     #define AK4954A_REG_BEEP_FREQ       (0x15)  /* BEEP Frequency */
     #define AK4954A_REG_BEEP_ON_TIME    (0x16)  /* BEEP ON Time */
     #define AK4954A_REG_BEEP_OFF_TIME   (0x17)  /* BEEP OFF Time */
@@ -194,9 +201,11 @@
     #define AK4954A_DEF_DATA_ALIGNMENT              AK4954A_MODE_CTRL1_DIF_24_16_I2S
 
     uint32_t ak4954a_init(ak4954a_transmit_callback callback);
-    uint32_t ak4954a_adjust_volume(uint8_t volume);
+    uint32_t ak4954a_adjust_volume(uint8_t left, uint8_t right);
     uint32_t ak4954a_activate(void);
     uint32_t ak4954a_deactivate(void);
+    uint32_t ak4954a_set_sample_rate(uint32_t sample_rate);
+    void     ak4954a_invalidate(void);
 
 #endif /* #ifndef AK4954A_H */
 
@@ -41,13 +41,17 @@
 /*******************************************************************************
 * Constants from USB Audio Descriptor
 *******************************************************************************/
-#define AUDIO_OUT_ENDPOINT_SIZE         (294U)
-#define AUDIO_IN_ENDPOINT_SIZE          (294U)
+#define AUDIO_OUT_ENDPOINT_SIZE         (582U)
+#define AUDIO_IN_ENDPOINT_SIZE          (582U)
 #define AUDIO_FEEDBACK_ENDPOINT_SIZE    (3U)
 
-#define AUDIO_FRAME_DATA_SIZE           (96u)
+#define AUDIO_FRAME_DATA_SIZE           (96u)   /* Words per frame at 48 kHz */
+#define AUDIO_MAX_FRAME_DATA_SIZE       (192u)  /* Words per frame at 96 kHz */
 #define AUDIO_DELTA_VALUE               (2u)
-#define AUDIO_MAX_DATA_SIZE             (AUDIO_FRAME_DATA_SIZE + AUDIO_DELTA_VALUE)
+#define AUDIO_MAX_DATA_SIZE             (AUDIO_MAX_FRAME_DATA_SIZE + AUDIO_DELTA_VALUE)
+
+/* Words per frame (1 ms) of stereo data at the given sample rate */
+#define AUDIO_FRAME_WORDS(rate)         (2u * ((rate) / 1000u))
 
 #define AUDIO_CONTROL_INTERFACE         (0x00U)
 #define AUDIO_CONTROL_IN_ENDPOINT       (6U)
@@ -56,8 +60,10 @@
 
 #define AUDIO_STREAMING_OUT_INTERFACE   (1U)
 #define AUDIO_STREAMING_OUT_ALTERNATE   (1U)
+#define AUDIO_STREAMING_OUT_ALTERNATE_16BIT (2U)
 #define AUDIO_STREAMING_IN_INTERFACE    (2U)
 #define AUDIO_STREAMING_IN_ALTERNATE    (1U)
+#define AUDIO_STREAMING_IN_ALTERNATE_16BIT  (2U)
 
 #define AUDIO_STREAMING_OUT_ENDPOINT    (1U)
 #define AUDIO_STREAMING_IN_ENDPOINT     (2U)
@@ -72,8 +78,12 @@
 #define AUDIO_STREAMING_EPS_NUMBER          (0x2U)
 #define AUDIO_SAMPLE_FREQ_SIZE              (3U)
 #define AUDIO_SAMPLE_DATA_SIZE              (3U)
+#define AUDIO_SAMPLE_DATA_SIZE_16BIT        (2U)
 
 #define AUDIO_FEATURE_UNIT_MASTER_CHANNEL   (0U)
+#define AUDIO_FEATURE_UNIT_LEFT_CHANNEL     (1U)
+#define AUDIO_FEATURE_UNIT_RIGHT_CHANNEL    (2U)
+#define AUDIO_FEATURE_UNIT_CHANNELS         (3U)    /* Master, left and right */
 
 #define AUDIO_HID_ENDPOINT                  (0x4u)
 #define AUDIO_HID_REPORT_SIZE               (1u)
@@ -87,6 +97,8 @@
 #define AUDIO_VOL_RES_MSB   (0x00u)
 #define AUDIO_VOL_RES_LSB   (0x01u)
 
+#define AUDIO_SAMPLING_RATE_96KHZ   (96000U)
+#define AUDIO_SAMPLING_RATE_88KHZ   (88200U)
 #define AUDIO_SAMPLING_RATE_48KHZ   (48000U)
 #define AUDIO_SAMPLING_RATE_44KHZ   (44100U)
 #define AUDIO_SAMPLING_RATE_32KHZ   (32000U)
@@ -46,13 +46,46 @@
 *******************************************************************************/
 #define AUDIO_APP_MCLK_PIN          P5_0
 
-#define PC_VOLUME_MSB_CODEC_OFFSET  64
-#define PC_VOLUME_CODEC_COEFF       4096
+#define AUDIO_APP_I2S_PRIORITY      (4u)
+
+/* Set to 1 to keep the PLL, the I2S and the codec at AUDIO_APP_FIXED_RATE_HZ
+ * and convert both host streams with the on-device sample-rate converter, or
+ * to 0 to retune the PLL to the playback rate and only convert capture when
+ * it runs at another rate. The playback converter is only built when set */
+#define AUDIO_APP_FIXED_RATE        (0u)
+#define AUDIO_APP_FIXED_RATE_HZ     (AUDIO_SAMPLING_RATE_48KHZ)
+
+/* Maximum time a stage of a sample rate switch waits (in ms) */
+#define AUDIO_APP_SWITCH_TIMEOUT_MS (20u)
+
+/*******************************************************************************
+* Structures
+*******************************************************************************/
+/* Stages of a sample rate switch */
+typedef enum
+{
+    AUDIO_APP_SWITCH_IDLE,
+    AUDIO_APP_SWITCH_FADE_OUT,  /* Fade the playback out to silence */
+    AUDIO_APP_SWITCH_DRAIN,     /* Play the buffered frames out */
+    AUDIO_APP_SWITCH_CLOCK,     /* Retune the clocks and the codec */
+    AUDIO_APP_SWITCH_PRIME,     /* Prime the new stream with silence */
+    AUDIO_APP_SWITCH_FADE_IN,   /* Fade the new stream in */
+} audio_app_switch_state_t;
+
+/* Statistics of the sample rate switches */
+typedef struct
+{
+    uint32_t count;             /* Number of switches */
+    uint32_t last_ms;           /* Duration of the last switch */
+    uint32_t max_ms;            /* Longest switch */
+    uint32_t timeouts;          /* Stages cut short by the timeout */
+} audio_app_switch_stats_t;
 
 /*******************************************************************************
 * Externs
 *******************************************************************************/
 extern cyhal_i2s_t i2s;
+extern audio_app_switch_stats_t audio_app_switch_stats;
 
 /*******************************************************************************
 * Functions
@@ -0,0 +1,82 @@
+/*******************************************************************************
+* File Name: audio_codec.h
+*
+* Description: This file contains the interface between the audio application
+*  and the audio codec. Each codec backend, selected by a COMPONENT in the
+*  Makefile, defines the audio_codec operations table.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef AUDIO_CODEC_H
+#define AUDIO_CODEC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Audio Codec Constants
+*******************************************************************************/
+/* Output channels with their own volume and mute: 0 is left, 1 is right */
+#define AUDIO_CODEC_CHANNELS    (2u)
+
+/*******************************************************************************
+* Audio Codec Structures
+*******************************************************************************/
+/* Operations of an audio codec. The functions are called from the audio app
+ * task and return 0 on success. The volume is in 1/256 dB, as set by the
+ * host, limited to the range below. */
+typedef struct
+{
+    uint32_t (*init)(void);
+    uint32_t (*activate)(void);
+    uint32_t (*deactivate)(void);
+    uint32_t (*begin_rate)(void);  /* Stop the codec before the clocks change */
+    uint32_t (*set_rate)(uint32_t sample_rate); /* Program and restart it */
+    uint32_t (*set_volume)(uint32_t channel, int16_t volume);
+    uint32_t (*set_mute)(uint32_t channel, bool mute);
+    uint32_t (*sync)(void);     /* Wait for the codec to be updated */
+
+    int16_t  volume_min;        /* Volume range reported to the host */
+    int16_t  volume_max;
+    int16_t  volume_res;
+    bool     is_tx_slave;       /* I2S TX clocked by the RX, which then runs
+                                   while playing */
+} audio_codec_t;
+
+/*******************************************************************************
+* Audio Codec Extern Variables
+*******************************************************************************/
+extern const audio_codec_t audio_codec;
+
+#endif /* AUDIO_CODEC_H */
+
+/* [] END OF FILE */
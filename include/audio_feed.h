@@ -39,6 +39,44 @@
 #define AUDIO_FEED_H
 
 #include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Audio Feedback Constants
+*******************************************************************************/
+/* Nominal feedback value of a sample rate in Hz. The value is the number of
+ * samples per frame (1 ms) in 10.14 fixed point, rounded to the nearest. */
+#define AUDIO_FEED_RATE_TO_FEEDBACK(rate)   \
+    ((uint32_t) ((((uint64_t) (rate) << 14) + 500u) / 1000u))
+
+/* Feedback modes:
+ * - LEVEL: PI controller on the fill level of the jitter buffer
+ * - MEASURED: ratio between the audio clock and the USB SOF, measured with
+ *   a free-running TCPWM counter read on each SOF over
+ *   2^AUDIO_FEED_MEASURE_SHIFT frames. The counter runs from the peripheral
+ *   clock, like the MCLK PWM, so its count is locked to the audio samples,
+ *   and it keeps counting while the CPU sleeps in the idle hook. It needs a
+ *   32-bit counter (TCPWM0, which the HAL allocates first). */
+#define AUDIO_FEED_MODE_LEVEL       (0u)
+#define AUDIO_FEED_MODE_MEASURED    (1u)
+
+#define AUDIO_FEED_MODE             AUDIO_FEED_MODE_LEVEL
+
+/* The rate is measured over 2^N frames */
+#define AUDIO_FEED_MEASURE_SHIFT    (7u)
+
+/* Gains of the feedback PI controller, as fractions of 2^AUDIO_FEED_GAIN_SHIFT.
+ * The error is the deviation of the jitter buffer level from its target, in
+ * 1/256 of a word, and the output is added to the nominal 10.14 rate. */
+#define AUDIO_FEED_GAIN_SHIFT       (16u)
+#define AUDIO_FEED_KP               (32768)
+#define AUDIO_FEED_KI               (128)
+
+/* The jitter buffer level is low-pass filtered over 2^N frames */
+#define AUDIO_FEED_FILTER_SHIFT     (4u)
+
+/* Maximum deviation of the feedback value from the nominal rate (10.14) */
+#define AUDIO_FEED_MAX_DEVIATION    (2 * (int32_t) AUDIO_FEED_SINGLE_SAMPLE)
 
 /*******************************************************************************
 * Audio Feedback Functions
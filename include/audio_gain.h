@@ -0,0 +1,83 @@
+/*******************************************************************************
+* File Name: audio_gain.h
+*
+* Description: This file contains the declarations of the software gain
+*  stage applied to the audio OUT stream when no codec handles the volume.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef AUDIO_GAIN_H
+#define AUDIO_GAIN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Audio Gain Constants
+*******************************************************************************/
+/* Unity gain in Q31 (0 dB) */
+#define AUDIO_GAIN_UNITY            (0x7FFFFFFFL)
+
+/* Attenuation (in dB) at and below which the output is silenced */
+#define AUDIO_GAIN_MIN_DB           (128)
+
+/* Interleaved channels, each with its own gain: left, then right */
+#define AUDIO_GAIN_CHANNELS         (2u)
+
+/*******************************************************************************
+* Audio Gain Structures
+*******************************************************************************/
+/* Gain applied to interleaved 24-bit samples stored in 32-bit words, one gain
+ * per channel. A new target is reached with a linear ramp over the next
+ * frame, to avoid zipper noise. */
+typedef struct
+{
+    volatile int32_t target[AUDIO_GAIN_CHANNELS]; /* Requested gain, Q31 */
+    int32_t  current[AUDIO_GAIN_CHANNELS];  /* Gain applied to the last sample, Q31 */
+    int32_t  step[AUDIO_GAIN_CHANNELS];     /* Gain increment per sample while ramping */
+    int32_t  end[AUDIO_GAIN_CHANNELS];      /* Gain reached at the end of the ramp */
+    uint32_t ramp;              /* Samples left in the ramp, all channels */
+    uint32_t channel;           /* Channel of the next sample */
+} audio_gain_t;
+
+/*******************************************************************************
+* Audio Gain Functions
+*******************************************************************************/
+void    audio_gain_init(audio_gain_t *gain);
+int32_t audio_gain_from_volume(int16_t volume, bool mute);
+void    audio_gain_set_target(audio_gain_t *gain, uint32_t channel, int32_t target);
+void    audio_gain_start_frame(audio_gain_t *gain, uint32_t length);
+void    audio_gain_process(audio_gain_t *gain, uint32_t *samples, uint32_t length);
+
+#endif /* AUDIO_GAIN_H */
+
+/* [] END OF FILE */
@@ -39,6 +39,53 @@
 #define AUDIO_IN_H
 
 #include <stdint.h>
+#include <stdbool.h>
+
+#include "cyhal.h"
+#include "audio.h"
+#include "audio_ring.h"
+
+/*******************************************************************************
+* Audio In Constants
+*******************************************************************************/
+/* Depth of the capture buffer between the I2S RX and the IN endpoint (in ms) */
+#define AUDIO_IN_BUFFER_MS          (4u)
+
+/* Size of the capture buffer in words (one word is kept free by the ring) */
+#define AUDIO_IN_BUFFER_SIZE        ((AUDIO_IN_BUFFER_MS * AUDIO_MAX_DATA_SIZE) + 1u)
+
+/* Fill level the capture buffer is kept around, half of the buffer depth at
+ * the given sample rate */
+#define AUDIO_IN_BUFFER_TARGET(rate)    ((AUDIO_IN_BUFFER_MS * AUDIO_FRAME_WORDS(rate)) / 2u)
+
+/* Number of words in each half of the DMA ping-pong buffer */
+#define AUDIO_IN_DMA_HALF_SIZE      (32u)
+
+/* Number of USB frames per second */
+#define AUDIO_IN_FRAMES_PER_SEC     (1000u)
+
+/* Number of interleaved channels (stereo): words per sample */
+#define AUDIO_IN_CHANNELS           (2u)
+
+/*******************************************************************************
+* Audio In Structures
+*******************************************************************************/
+/* Drift counters of a recording session, in stereo samples. The packets carry
+ * the nominal rate on average; added - removed is the drift between the I2S
+ * clock and the USB SOF that had to be absorbed. */
+typedef struct
+{
+    uint32_t packets;       /* Packets sent since the recording started */
+    uint32_t long_packets;  /* Packets carrying the fractional extra sample */
+    uint32_t added;         /* Samples added because the capture ran ahead */
+    uint32_t removed;       /* Samples removed because the capture fell behind */
+} audio_in_drift_t;
+
+/*******************************************************************************
+* Audio In Extern Variables
+*******************************************************************************/
+extern audio_ring_t audio_in_ring;
+extern volatile audio_in_drift_t audio_in_drift;
 
 /*******************************************************************************
 * Audio In Functions
@@ -47,7 +94,8 @@ void audio_in_init(void);
 void audio_in_enable(void);
 void audio_in_disable(void);
 void audio_in_process(void *arg);
-void audio_in_update_sample_rate(uint32_t sample_rate);
+void audio_in_update_sample_rate(uint32_t usb_rate, uint32_t i2s_rate);
+void audio_in_i2s_event(cyhal_i2s_event_t event);
 
 #endif /* AUDIO_IN_H */
 
@@ -38,13 +38,62 @@
 #ifndef AUDIO_OUT_H
 #define AUDIO_OUT_H
 
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "cyhal.h"
+#include "audio.h"
+#include "audio_ring.h"
+
+/*******************************************************************************
+* Audio Out Constants
+*******************************************************************************/
+/* Depth of the jitter buffer between the OUT endpoint and the I2S TX (in ms) */
+#define AUDIO_OUT_BUFFER_MS         (4u)
+
+/* Size of the jitter buffer in words (one word is kept free by the ring) */
+#define AUDIO_OUT_BUFFER_SIZE       ((AUDIO_OUT_BUFFER_MS * AUDIO_MAX_DATA_SIZE) + 1u)
+
+/* Fill level to reach before starting the I2S TX, half of the buffer depth at
+ * the given sample rate */
+#define AUDIO_OUT_BUFFER_PRIME(rate)    ((AUDIO_OUT_BUFFER_MS * AUDIO_FRAME_WORDS(rate)) / 2u)
+
+/* Set to 1 to feed the I2S TX FIFO with DMA from ping-pong buffers, or to 0
+ * to feed it from the I2S TX half-empty interrupt */
+#define AUDIO_OUT_DMA_ENABLE        (1u)
+
+/* Number of words in each half of the DMA ping-pong buffer */
+#define AUDIO_OUT_DMA_HALF_SIZE     (64u)
+
+/* Number of silence words written at once when the jitter buffer runs dry */
+#define AUDIO_OUT_SILENCE_SIZE      (16u)
+
+/* Number of interleaved channels (stereo): words per sample */
+#define AUDIO_OUT_CHANNELS          (2u)
+
+/*******************************************************************************
+* Audio Out Extern Variables
+*******************************************************************************/
+extern audio_ring_t  audio_out_ring;
+extern volatile bool audio_out_is_playing;
+extern volatile uint32_t audio_out_prime;
+
 /*******************************************************************************
 * Audio Out Functions
 *******************************************************************************/
-void audio_out_init(void);
-void audio_out_enable(void);
-void audio_out_disable(void);
-void audio_out_process(void *arg);
+void     audio_out_init(void);
+void     audio_out_enable(void);
+void     audio_out_disable(void);
+void     audio_out_flush(void);
+void     audio_out_update_sample_rate(uint32_t usb_rate, uint32_t i2s_rate);
+void     audio_out_update_volume(uint32_t channel, int16_t volume, bool mute);
+void     audio_out_fade(bool fade_out);
+bool     audio_out_is_faded(void);
+void     audio_out_set_hold(bool hold);
+void     audio_out_prime_silence(void);
+void     audio_out_process(void *arg);
+void     audio_out_i2s_event(cyhal_i2s_event_t event);
+uint32_t audio_out_get_level(void);
 
 #endif /* AUDIO_OUT_H */
 
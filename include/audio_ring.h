@@ -0,0 +1,76 @@
+/*******************************************************************************
+* File Name: audio_ring.h
+*
+* Description: This file contains the declarations of the
+*  single-producer/single-consumer PCM ring buffer used between the USB
+*  endpoints and the I2S block.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef AUDIO_RING_H
+#define AUDIO_RING_H
+
+#include <stdint.h>
+
+/*******************************************************************************
+* Audio Ring Structures
+*******************************************************************************/
+/* Lock-free ring of 32-bit PCM words. The write index is only updated by the
+ * producer and the read index only by the consumer, so one ISR can fill the
+ * ring while another one drains it without any critical section. */
+typedef struct
+{
+    uint32_t          *buffer;      /* Storage for the PCM words */
+    uint32_t           size;        /* Number of words in the storage */
+    volatile uint32_t  write_idx;   /* Next word to be written (producer) */
+    volatile uint32_t  read_idx;    /* Next word to be read (consumer) */
+    volatile uint32_t  overruns;    /* Words dropped because the ring was full */
+    volatile uint32_t  underruns;   /* Words missing when the consumer read */
+} audio_ring_t;
+
+/*******************************************************************************
+* Audio Ring Functions
+*******************************************************************************/
+void      audio_ring_init(audio_ring_t *ring, uint32_t *buffer, uint32_t size);
+void      audio_ring_flush(audio_ring_t *ring);
+uint32_t  audio_ring_get_level(audio_ring_t *ring);
+uint32_t  audio_ring_get_space(audio_ring_t *ring);
+uint32_t  audio_ring_write(audio_ring_t *ring, const uint32_t *src, uint32_t length);
+uint32_t  audio_ring_read(audio_ring_t *ring, uint32_t *dst, uint32_t length);
+uint32_t *audio_ring_get_write_block(audio_ring_t *ring, uint32_t *length);
+void      audio_ring_commit_write(audio_ring_t *ring, uint32_t length);
+uint32_t *audio_ring_get_read_block(audio_ring_t *ring, uint32_t *length);
+void      audio_ring_commit_read(audio_ring_t *ring, uint32_t length);
+
+#endif /* AUDIO_RING_H */
+
+/* [] END OF FILE */
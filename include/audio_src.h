@@ -0,0 +1,122 @@
+/*******************************************************************************
+* File Name: audio_src.h
+*
+* Description: This file contains the declarations of the polyphase
+*  sample-rate converter used to stream host rates that differ from the
+*  fixed I2S rate.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef AUDIO_SRC_H
+#define AUDIO_SRC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "audio.h"
+
+/*******************************************************************************
+* Audio SRC Constants
+*******************************************************************************/
+/* Number of taps of each polyphase branch, without decimation */
+#define AUDIO_SRC_TAPS              (24u)
+
+/* Maximum interpolation factor, 320 covers 44.1 kHz to 96 kHz. The tables
+ * of a ratio hold at most AUDIO_SRC_MAX_PHASES x AUDIO_SRC_TAPS taps */
+#define AUDIO_SRC_MAX_PHASES        (320u)
+
+/* Maximum number of taps of a branch. Decimating by L/M uses branches of
+ * ceil(M/L) x AUDIO_SRC_TAPS taps, as long as they fit the coefficient
+ * table, so the transition band stays as narrow relative to the output rate
+ * as without decimation. */
+#define AUDIO_SRC_MAX_TAPS          (96u)
+
+/* Number of interleaved channels */
+#define AUDIO_SRC_CHANNELS          (2u)
+
+/* Size in words of a buffer holding one USB frame at the highest rate, with
+ * margin for the samples the conversion adds to a frame */
+#define AUDIO_SRC_BUFFER_SIZE       (((AUDIO_MAX_DATA_SIZE * 9u) / 8u) + 4u)
+
+/* Fraction of the lowest Nyquist frequency kept by the anti-aliasing filter */
+#define AUDIO_SRC_BANDWIDTH         (0.90f)
+
+/*******************************************************************************
+* Audio SRC Structures
+*******************************************************************************/
+/* Coefficients of the L branches of a reduced ratio L/M, in Q15. The tables
+ * are designed offline for the ratios of the Audio OUT and Audio IN streams
+ * (audio_src_coef.c, printed by test/gen_audio_src_coef.c). */
+typedef struct
+{
+    uint32_t       up;      /* Interpolation factor L, number of branches */
+    uint32_t       down;    /* Decimation factor M */
+    uint32_t       taps;    /* Number of taps of each branch */
+    const int16_t *coef;    /* Branches one after the other, or the first half
+                               of the single symmetric branch when L is 1 */
+} audio_src_ratio_t;
+
+/* Rational L/M resampler of interleaved 24-bit samples stored in 32-bit words.
+ * Configuring the converter selects the coefficient table of the ratio, so
+ * the pairs of rates whose reduced ratio has a table are supported. When L
+ * is 1 (e.g. 48 kHz to 16 kHz), the converter is a plain decimating FIR:
+ * only the kept outputs are computed, and the symmetry of the single branch
+ * is used to halve the multiplications. */
+typedef struct
+{
+    uint32_t       up;      /* Interpolation factor L, number of branches */
+    uint32_t       down;    /* Decimation factor M */
+    uint32_t       taps;    /* Number of taps of each branch */
+    uint32_t       phase;   /* Branch of the next output, >= up when an input is needed */
+    uint32_t       pos;     /* Position of the newest sample in the history */
+    const int16_t *coef;    /* Coefficient table of the ratio */
+    int32_t        history[AUDIO_SRC_CHANNELS][2u * AUDIO_SRC_MAX_TAPS];
+} audio_src_t;
+
+/*******************************************************************************
+* Audio SRC Extern Variables
+*******************************************************************************/
+extern const audio_src_ratio_t audio_src_ratios[];
+extern const uint32_t          audio_src_ratios_number;
+
+/*******************************************************************************
+* Audio SRC Functions
+*******************************************************************************/
+bool     audio_src_init(audio_src_t *src, uint32_t in_rate, uint32_t out_rate);
+void     audio_src_reset(audio_src_t *src);
+uint32_t audio_src_get_input_frames(audio_src_t *src, uint32_t out_frames);
+uint32_t audio_src_process(audio_src_t *src, const uint32_t *in, uint32_t in_frames,
+                           uint32_t *out, uint32_t out_frames);
+
+#endif /* AUDIO_SRC_H */
+
+/* [] END OF FILE */
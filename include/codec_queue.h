@@ -0,0 +1,98 @@
+/*******************************************************************************
+* File Name: codec_queue.h
+*
+* Description: This file contains the declarations of the asynchronous
+*  codec command queue.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef CODEC_QUEUE_H
+#define CODEC_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Codec Queue Constants
+*******************************************************************************/
+/* Number of commands that can wait for the codec task */
+#define CODEC_QUEUE_SIZE            (16u)
+
+/* Maximum number of registers written in one transfer */
+#define CODEC_QUEUE_BURST_SIZE      (8u)
+
+/* Maximum number of transfers sent in one batch */
+#define CODEC_QUEUE_BATCH_SIZE      (8u)
+
+/* Time allowed for one transfer to complete (in ms) */
+#define CODEC_QUEUE_TIMEOUT_MS      (10u)
+
+/* Wait forever for a command in codec_queue_service() */
+#define CODEC_QUEUE_WAIT_FOREVER    (0xFFFFFFFFu)
+
+/* Status of the commands */
+#define CODEC_QUEUE_SUCCESS         (0u)
+#define CODEC_QUEUE_ERROR_FULL      (1u)
+#define CODEC_QUEUE_ERROR_TIMEOUT   (2u)
+#define CODEC_QUEUE_ERROR_TRANSFER  (3u)
+
+/*******************************************************************************
+* Codec Queue Types
+*******************************************************************************/
+/* Completion callback of a command, called from the codec task */
+typedef void (*codec_queue_callback_t)(uint32_t status, void *arg);
+
+/* Transport of the queue. start() begins writing the buffer (register address
+ * followed by the data) and returns without waiting; the end of the transfer
+ * is reported with codec_queue_complete(). abort() cancels a transfer that
+ * did not complete in time. */
+typedef struct
+{
+    uint32_t (*start)(const uint8_t *buffer, uint32_t length);
+    void     (*abort)(void);
+} codec_queue_transport_t;
+
+/*******************************************************************************
+* Codec Queue Functions
+*******************************************************************************/
+void     codec_queue_init(void);
+void     codec_queue_register_transport(const codec_queue_transport_t *transport);
+uint32_t codec_queue_write(uint8_t reg_addr, const uint8_t *data, uint32_t length,
+                           codec_queue_callback_t callback, void *arg);
+uint32_t codec_queue_flush(uint32_t timeout_ms);
+void     codec_queue_complete(uint32_t status);
+bool     codec_queue_service(uint32_t timeout_ms);
+void     codec_queue_process(void *arg);
+
+#endif /* CODEC_QUEUE_H */
+
+/* [] END OF FILE */
@@ -68,6 +68,7 @@ extern TaskHandle_t rtos_audio_app_task;
 extern TaskHandle_t rtos_audio_in_task;
 extern TaskHandle_t rtos_audio_out_task;
 extern TaskHandle_t rtos_touch_task;
+extern TaskHandle_t rtos_codec_task;
 
 #endif
 
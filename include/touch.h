@@ -74,6 +74,8 @@ void touch_update_baseline(void);
 void touch_process(void *arg);
 void touch_start_scan(void);
 void touch_stop_scan(void);
+bool touch_pause(uint32_t timeout_ms);
+void touch_resume(void);
 void touch_get_state(touch_status_t *sensors);
 void touch_register_callback(touch_callback_t callback);
 void touch_enable_event(touch_event_t event, bool enable);
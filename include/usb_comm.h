@@ -61,18 +61,50 @@ typedef struct
     usb_comm_interface_function_t disable_in;
 } usb_comm_interface_t;
 
+/* Audio class requests allowed on a control (usb_comm_control_t.requests) */
+#define USB_COMM_RQST_SET_CUR       (0x01U)
+#define USB_COMM_RQST_SET_MIN       (0x02U)
+#define USB_COMM_RQST_SET_MAX       (0x04U)
+#define USB_COMM_RQST_SET_RES       (0x08U)
+#define USB_COMM_RQST_GET_CUR       (0x10U)
+#define USB_COMM_RQST_GET_MIN       (0x20U)
+#define USB_COMM_RQST_GET_MAX       (0x40U)
+#define USB_COMM_RQST_GET_RES       (0x80U)
+
+/* Attributes of a control: current, minimum, maximum and resolution */
+#define USB_COMM_CONTROL_ATTRIBUTES (4U)
+
+/* Control row that applies to every channel of its entity */
+#define USB_COMM_CONTROL_ANY_CHANNEL (0xFFU)
+
+typedef void (* usb_comm_control_hook_t)(void);
+
+typedef struct
+{
+    uint16_t entity;    /* wIndex: unit ID and interface, or endpoint address */
+    uint8_t  selector;  /* Control selector, high byte of wValue */
+    uint8_t  channel;   /* Channel number, low byte of wValue */
+    uint8_t  size;      /* Size of each attribute, in bytes */
+    uint8_t  requests;  /* Allowed requests, USB_COMM_RQST_* */
+    uint8_t *data[USB_COMM_CONTROL_ATTRIBUTES]; /* Storage of each attribute */
+    usb_comm_control_hook_t on_change;          /* Called after a SET request */
+} usb_comm_control_t;
+
 /*******************************************************************************
 * USB Communication Extern Global Variables
 *******************************************************************************/
-extern uint8_t usb_comm_mute;
-extern uint8_t usb_comm_cur_volume[AUDIO_VOLUME_SIZE];
+extern uint8_t usb_comm_mute[AUDIO_FEATURE_UNIT_CHANNELS];
+extern uint8_t usb_comm_cur_volume[AUDIO_FEATURE_UNIT_CHANNELS][AUDIO_VOLUME_SIZE];
 extern uint8_t usb_comm_min_volume[AUDIO_VOLUME_SIZE];
 extern uint8_t usb_comm_max_volume[AUDIO_VOLUME_SIZE];
 extern uint8_t usb_comm_res_volume[AUDIO_VOLUME_SIZE];
 
-extern volatile uint32_t usb_comm_new_sample_rate;
+extern volatile uint32_t usb_comm_new_out_sample_rate;
+extern volatile uint32_t usb_comm_new_in_sample_rate;
 extern volatile bool     usb_comm_enable_out_streaming;
 extern volatile bool     usb_comm_enable_in_streaming;
+extern volatile uint32_t usb_comm_out_subframe_size;
+extern volatile uint32_t usb_comm_in_subframe_size;
 extern volatile bool     usb_comm_out_streaming_start;
 extern volatile bool     usb_comm_in_streaming_start;
 extern volatile bool     usb_comm_out_streaming_stop;
@@ -94,6 +126,8 @@ bool     usb_comm_is_ready(void);
 void     usb_comm_register_interface(usb_comm_interface_t *interface);
 void     usb_comm_register_usb_callbacks(void);
 uint32_t usb_comm_get_sample_rate(uint32_t endpoint);
+int16_t  usb_comm_get_volume(const uint8_t *volume);
+void     usb_comm_set_volume(uint8_t *volume, int16_t value);
 
 #endif /* USB_COMM_H */
 
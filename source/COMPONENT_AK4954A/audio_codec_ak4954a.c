@@ -0,0 +1,431 @@
+/*******************************************************************************
+* File Name: audio_codec_ak4954a.c
+*
+* Description: This file contains the audio codec backend of the AK4954A.
+*  The codec is configured through the I2C Master; the register writes are
+*  sent by the codec command queue.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio_codec.h"
+#include "codec_queue.h"
+#include "ak4954a.h"
+
+#include "cyhal.h"
+#include "cybsp.h"
+
+/*******************************************************************************
+* Macros
+********************************************************************************/
+#define MI2C_PRIORITY       6u
+#define CODEC_FLUSH_MS      100u        /* in ms */
+#define CODEC_VOLUME_SHIFT  7u          /* 0.5 dB in 1/256 dB */
+
+/* Volume range and resolution reported to the host, in 1/256 dB. The digital
+ * volume goes from +6 dB to -65.5 dB in 0.5 dB steps. */
+#define CODEC_VOLUME_MIN    (-16768)
+#define CODEC_VOLUME_MAX    (1536)
+#define CODEC_VOLUME_RES    (128)
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+uint32_t audio_codec_ak4954a_init(void);
+uint32_t audio_codec_ak4954a_begin_rate(void);
+uint32_t audio_codec_ak4954a_set_rate(uint32_t sample_rate);
+uint32_t audio_codec_ak4954a_set_volume(uint32_t channel, int16_t volume);
+uint32_t audio_codec_ak4954a_set_mute(uint32_t channel, bool mute);
+uint32_t audio_codec_ak4954a_update_volume(void);
+uint32_t audio_codec_ak4954a_sync(void);
+uint32_t audio_codec_ak4954a_write(uint8_t reg_addr, const uint8_t *data, uint32_t length);
+void     audio_codec_ak4954a_done(uint32_t status, void *arg);
+void     mi2c_configure(void);
+uint32_t mi2c_start(const uint8_t *buffer, uint32_t length);
+void     mi2c_abort(void);
+void     mi2c_events(void *arg, cyhal_i2c_event_t event);
+
+/*******************************************************************************
+* Audio Codec AK4954A Variables
+*******************************************************************************/
+/* Master I2C variables */
+cyhal_i2c_t mi2c;
+
+const cyhal_i2c_cfg_t mi2c_cfg = {
+    .is_slave        = false,
+    .address         = 0,
+    .frequencyhal_hz = 400000
+};
+
+/* Transport of the codec command queue */
+const codec_queue_transport_t mi2c_transport = {
+    .start = mi2c_start,
+    .abort = mi2c_abort
+};
+
+/* Headphone volume register and mute state of each channel */
+uint8_t audio_codec_ak4954a_volume[AUDIO_CODEC_CHANNELS] = {AK4954A_HP_DEFAULT_VOLUME, AK4954A_HP_DEFAULT_VOLUME};
+bool    audio_codec_ak4954a_mute[AUDIO_CODEC_CHANNELS];
+
+const audio_codec_t audio_codec =
+{
+    .init        = audio_codec_ak4954a_init,
+    .activate    = ak4954a_activate,
+    .deactivate  = ak4954a_deactivate,
+    .begin_rate  = audio_codec_ak4954a_begin_rate,
+    .set_rate    = audio_codec_ak4954a_set_rate,
+    .set_volume  = audio_codec_ak4954a_set_volume,
+    .set_mute    = audio_codec_ak4954a_set_mute,
+    .sync        = audio_codec_ak4954a_sync,
+    .volume_min  = CODEC_VOLUME_MIN,
+    .volume_max  = CODEC_VOLUME_MAX,
+    .volume_res  = CODEC_VOLUME_RES,
+    .is_tx_slave = true,
+};
+
+/*******************************************************************************
+* Function Name: audio_codec_ak4954a_init
+********************************************************************************
+* Summary:
+*   Initialize the I2C Master, then configure the codec and enable it.
+*
+* Return:
+*   0 if the codec is configured.
+*
+*******************************************************************************/
+uint32_t audio_codec_ak4954a_init(void)
+{
+    /* Initialize the I2C Master */
+    cyhal_i2c_init(&mi2c, CYBSP_I2C_SDA, CYBSP_I2C_SCL, NULL);
+    mi2c_configure();
+
+    /* The codec writes are sent by the codec task */
+    codec_queue_register_transport(&mi2c_transport);
+
+    /* Configure the AK494A codec and enable it */
+    ak4954a_init(audio_codec_ak4954a_write);
+    ak4954a_activate();
+    audio_codec_ak4954a_update_volume();
+
+    return codec_queue_flush(CODEC_FLUSH_MS);
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_ak4954a_begin_rate
+********************************************************************************
+* Summary:
+*   Silence the headphone output with the digital volume, then deactivate the
+*   codec before the MCKI changes. The datasheet requires MCKI, BICK and LRCK
+*   to run whenever the ADC or the DAC is powered (PMADL, PMADR or PMDAC set),
+*   the internal logic being dynamically refreshed, and the FS and CM bits to
+*   change only with these blocks and the programmable filter powered down.
+*   The PLL relock stops the MCKI, so all of them must be off: this is all
+*   ak4954a_deactivate() clears, VCOM stays powered and no other register is
+*   written. The headphone amplifiers are turned off before the DAC, the
+*   power-down order the datasheet gives against pop noise; the muted volume
+*   keeps the output quiet while they power down.
+*
+* Return:
+*   0 if the writes are enqueued.
+*
+*******************************************************************************/
+uint32_t audio_codec_ak4954a_begin_rate(void)
+{
+    uint32_t ret;
+
+    ret = ak4954a_adjust_volume(AK4954A_HP_MUTE_VALUE, AK4954A_HP_MUTE_VALUE);
+    if (ret) return ret;
+
+    return ak4954a_deactivate();
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_ak4954a_set_rate
+********************************************************************************
+* Summary:
+*   Program the sampling rate and the MCKI ratio (MODE_CTRL2 only), then
+*   power up again the blocks begin_rate turned off, once the MCKI is stable:
+*   the DAC before the headphone amplifiers, as the datasheet power-up order
+*   requires. The volume is restored once the output runs at the new rate.
+*   The I2C Master runs from the peripheral clock, which follows the PLL, so
+*   its data rate is set again first; no write is pending after begin_rate
+*   and the sync that follows it.
+*
+* Parameters:
+*   sample_rate: new sample rate, the MCKI already runs at this rate
+*
+* Return:
+*   0 if the writes are enqueued.
+*
+*******************************************************************************/
+uint32_t audio_codec_ak4954a_set_rate(uint32_t sample_rate)
+{
+    uint32_t ret;
+
+    mi2c_configure();
+
+    ret = ak4954a_set_sample_rate(sample_rate);
+    if (ret) return ret;
+
+    ret = ak4954a_activate();
+    if (ret) return ret;
+
+    return audio_codec_ak4954a_update_volume();
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_ak4954a_set_volume
+********************************************************************************
+* Summary:
+*   Update the headphone volume of one channel. The USB volume is rounded to
+*   the 0.5 dB steps of the codec: a register step is 128 USB units, so the
+*   mapping is a shift, with no division. The codec is only written when the
+*   channel is not muted.
+*
+* Parameters:
+*   channel: 0 for the left channel, 1 for the right channel
+*   volume: volume in 1/256 dB
+*
+* Return:
+*   0 if the write is enqueued.
+*
+*******************************************************************************/
+uint32_t audio_codec_ak4954a_set_volume(uint32_t channel, int16_t volume)
+{
+    int32_t step;
+    uint32_t ret = 0;
+
+    /* The register is the attenuation from +6 dB, rounded to 0.5 dB */
+    step = (int32_t) AK4954A_HP_DEFAULT_VOLUME -
+           (((int32_t) volume + (CODEC_VOLUME_RES / 2)) >> CODEC_VOLUME_SHIFT);
+
+    if (step < AK4954A_HP_VOLUME_MAX)
+    {
+        step = AK4954A_HP_VOLUME_MAX;
+    }
+    if (step > AK4954A_HP_VOLUME_MIN)
+    {
+        step = AK4954A_HP_VOLUME_MIN;
+    }
+
+    audio_codec_ak4954a_volume[channel] = (uint8_t) step;
+
+    if (audio_codec_ak4954a_mute[channel] == false)
+    {
+        ret = audio_codec_ak4954a_update_volume();
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_ak4954a_set_mute
+********************************************************************************
+* Summary:
+*   Mute one channel of the headphone output, or restore its current volume.
+*
+* Parameters:
+*   channel: 0 for the left channel, 1 for the right channel
+*   mute: true to silence the channel
+*
+* Return:
+*   0 if the write is enqueued.
+*
+*******************************************************************************/
+uint32_t audio_codec_ak4954a_set_mute(uint32_t channel, bool mute)
+{
+    audio_codec_ak4954a_mute[channel] = mute;
+
+    return audio_codec_ak4954a_update_volume();
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_ak4954a_update_volume
+********************************************************************************
+* Summary:
+*   Write the left and right digital volume registers in a single burst, with
+*   the mute value for the channels muted.
+*
+* Return:
+*   0 if the write is enqueued.
+*
+*******************************************************************************/
+uint32_t audio_codec_ak4954a_update_volume(void)
+{
+    uint8_t volume[AUDIO_CODEC_CHANNELS];
+
+    for (uint32_t channel = 0; channel < AUDIO_CODEC_CHANNELS; channel++)
+    {
+        volume[channel] = audio_codec_ak4954a_mute[channel] ? AK4954A_HP_MUTE_VALUE :
+                                                              audio_codec_ak4954a_volume[channel];
+    }
+
+    return ak4954a_adjust_volume(volume[0], volume[1]);
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_ak4954a_sync
+********************************************************************************
+* Summary:
+*   Wait for the register writes enqueued to be sent to the codec.
+*
+* Return:
+*   0 if all the writes since the last sync succeeded.
+*
+*******************************************************************************/
+uint32_t audio_codec_ak4954a_sync(void)
+{
+    return codec_queue_flush(CODEC_FLUSH_MS);
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_ak4954a_write
+********************************************************************************
+* Summary:
+*  Transmit callback of the codec driver. Enqueue the write of consecutive
+*  registers without waiting for the transfer.
+*
+* Parameters:
+*  reg_addr: address of the first register to be updated
+*  data: 8-bit data to be written in the registers
+*  length: number of registers, up to AK4954A_BURST_SIZE
+*
+* Return:
+*  uint32_t - 0 if the write is enqueued.
+*
+*******************************************************************************/
+uint32_t audio_codec_ak4954a_write(uint8_t reg_addr, const uint8_t *data, uint32_t length)
+{
+    return codec_queue_write(reg_addr, data, length, audio_codec_ak4954a_done, NULL);
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_ak4954a_done
+********************************************************************************
+* Summary:
+*  Completion callback of the codec writes. A failed write leaves the codec
+*  registers unknown, so the driver shadow map is discarded.
+*
+* Parameters:
+*  status: CODEC_QUEUE_SUCCESS or an error
+*  arg: not used
+*
+*******************************************************************************/
+void audio_codec_ak4954a_done(uint32_t status, void *arg)
+{
+    (void) arg;
+
+    if (status != CODEC_QUEUE_SUCCESS)
+    {
+        ak4954a_invalidate();
+    }
+}
+
+/*******************************************************************************
+* Function Name: mi2c_configure
+********************************************************************************
+* Summary:
+*   Configure the I2C Master for 400 kHz from the current peripheral clock,
+*   and enable the transfer events.
+*
+*******************************************************************************/
+void mi2c_configure(void)
+{
+    cyhal_i2c_configure(&mi2c, &mi2c_cfg);
+    cyhal_i2c_register_callback(&mi2c, mi2c_events, NULL);
+    cyhal_i2c_enable_event(&mi2c, (cyhal_i2c_event_t) (CYHAL_I2C_MASTER_WR_CMPLT_EVENT |
+                                                       CYHAL_I2C_MASTER_ERR_EVENT),
+                           MI2C_PRIORITY, true);
+}
+
+/*******************************************************************************
+* Function Name: mi2c_start
+********************************************************************************
+* Summary:
+*  Start an interrupt-driven write to the codec. The end of the transfer is
+*  reported by mi2c_events().
+*
+* Parameters:
+*  buffer: register address followed by the register values
+*  length: number of bytes in the buffer
+*
+* Return:
+*  uint32_t - 0 if the transfer started.
+*
+*******************************************************************************/
+uint32_t mi2c_start(const uint8_t *buffer, uint32_t length)
+{
+    cy_rslt_t result;
+
+    result = cyhal_i2c_master_transfer_async(&mi2c, AK4954A_I2C_ADDR, buffer, length, NULL, 0);
+
+    return (result == CY_RSLT_SUCCESS) ? 0u : 1u;
+}
+
+/*******************************************************************************
+* Function Name: mi2c_abort
+********************************************************************************
+* Summary:
+*  Abort a write to the codec that did not complete in time.
+*
+*******************************************************************************/
+void mi2c_abort(void)
+{
+    cyhal_i2c_abort_async(&mi2c);
+}
+
+/*******************************************************************************
+* Function Name: mi2c_events
+********************************************************************************
+* Summary:
+*  I2C Master interrupt callback. Reports the end of the write to the codec
+*  queue.
+*
+* Parameters:
+*  arg: not used
+*  event: event that occurred
+*
+*******************************************************************************/
+void mi2c_events(void *arg, cyhal_i2c_event_t event)
+{
+    (void) arg;
+
+    if (0u != (event & CYHAL_I2C_MASTER_ERR_EVENT))
+    {
+        codec_queue_complete(CODEC_QUEUE_ERROR_TRANSFER);
+    }
+    else if (0u != (event & CYHAL_I2C_MASTER_WR_CMPLT_EVENT))
+    {
+        codec_queue_complete(CODEC_QUEUE_SUCCESS);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,175 @@
+/*******************************************************************************
+* File Name: audio_codec_null.c
+*
+* Description: This file contains the audio codec backend of the kits without
+*  a configurable codec, such as the PMod I2S2. There is nothing to program;
+*  the volume and mute are applied to the Audio OUT stream in software.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio_codec.h"
+#include "audio_out.h"
+#include "codec_queue.h"
+
+#include "cy_usb_dev_audio.h"
+
+/*******************************************************************************
+* Constants
+*******************************************************************************/
+#define CODEC_FLUSH_MS      100u        /* in ms */
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+uint32_t audio_codec_null_none(void);
+uint32_t audio_codec_null_set_rate(uint32_t sample_rate);
+uint32_t audio_codec_null_set_volume(uint32_t channel, int16_t volume);
+uint32_t audio_codec_null_set_mute(uint32_t channel, bool mute);
+uint32_t audio_codec_null_sync(void);
+
+/*******************************************************************************
+* Audio Codec Null Variables
+*******************************************************************************/
+int16_t audio_codec_null_volume[AUDIO_CODEC_CHANNELS];
+bool    audio_codec_null_mute[AUDIO_CODEC_CHANNELS];
+
+const audio_codec_t audio_codec =
+{
+    .init        = audio_codec_null_none,
+    .activate    = audio_codec_null_none,
+    .deactivate  = audio_codec_null_none,
+    .begin_rate  = audio_codec_null_none,
+    .set_rate    = audio_codec_null_set_rate,
+    .set_volume  = audio_codec_null_set_volume,
+    .set_mute    = audio_codec_null_set_mute,
+    .sync        = audio_codec_null_sync,
+    .volume_min  = (int16_t) CY_USB_DEV_AUDIO_VOLUME_MIN,
+    .volume_max  = (int16_t) CY_USB_DEV_AUDIO_VOLUME_MAX,
+    .volume_res  = 1,
+    .is_tx_slave = false,
+};
+
+/*******************************************************************************
+* Function Name: audio_codec_null_none
+********************************************************************************
+* Summary:
+*   Operation with nothing to do.
+*
+* Return:
+*   Always 0.
+*
+*******************************************************************************/
+uint32_t audio_codec_null_none(void)
+{
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_null_set_rate
+********************************************************************************
+* Summary:
+*   The converters follow the I2S clocks, nothing to do.
+*
+* Return:
+*   Always 0.
+*
+*******************************************************************************/
+uint32_t audio_codec_null_set_rate(uint32_t sample_rate)
+{
+    (void) sample_rate;
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_null_set_volume
+********************************************************************************
+* Summary:
+*   Apply the volume to one channel of the Audio OUT stream.
+*
+* Parameters:
+*   channel: 0 for the left channel, 1 for the right channel
+*   volume: volume in 1/256 dB
+*
+* Return:
+*   Always 0.
+*
+*******************************************************************************/
+uint32_t audio_codec_null_set_volume(uint32_t channel, int16_t volume)
+{
+    audio_codec_null_volume[channel] = volume;
+
+    audio_out_update_volume(channel, audio_codec_null_volume[channel], audio_codec_null_mute[channel]);
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_null_set_mute
+********************************************************************************
+* Summary:
+*   Silence or restore one channel of the Audio OUT stream.
+*
+* Parameters:
+*   channel: 0 for the left channel, 1 for the right channel
+*   mute: true to silence the channel
+*
+* Return:
+*   Always 0.
+*
+*******************************************************************************/
+uint32_t audio_codec_null_set_mute(uint32_t channel, bool mute)
+{
+    audio_codec_null_mute[channel] = mute;
+
+    audio_out_update_volume(channel, audio_codec_null_volume[channel], audio_codec_null_mute[channel]);
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: audio_codec_null_sync
+********************************************************************************
+* Summary:
+*   Nothing is written to the converters. The barrier still goes through the
+*   codec task, so this build takes the same path as a codec with registers.
+*
+* Return:
+*   0 once the codec task has handled the commands enqueued before.
+*
+*******************************************************************************/
+uint32_t audio_codec_null_sync(void)
+{
+    return codec_queue_flush(CODEC_FLUSH_MS);
+}
+
+/* [] END OF FILE */
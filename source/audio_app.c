@@ -39,10 +39,8 @@
 #include "audio_feed.h"
 #include "audio_in.h"
 #include "audio_out.h"
+#include "audio_codec.h"
 #include "usb_comm.h"
-#ifdef COMPONENT_AK4954A
-    #include "ak4954a.h"
-#endif
 #include "touch.h"
 
 #include "cyhal.h"
@@ -51,27 +49,35 @@
 
 #include "rtos.h"
 
+
 /*******************************************************************************
 * Macros
 ********************************************************************************/
-#define MI2C_TIMEOUT_MS     10u         /* in ms */
 #define MCLK_CODEC_DELAY_MS 10u         /* in ms */
 #define MCLK_FREQ_HZ        18432000u   /* in Hz */
 #define MCLK_DUTY_CYCLE     50.0f       /* in %  */
 #define USB_CLK_RESET_HZ    100000      /* in Hz */
 #define PLL_TIMEOUT_US      12000u      /* in us */
+#define PLL_FREQ_FOR_96KHZ  73728000    /* in Hz */
+#define PLL_FREQ_FOR_88KHZ  67737600    /* in Hz */
 #define PLL_FREQ_FOR_48KHZ  55296000    /* in Hz */
 #define PLL_FREQ_FOR_44KHZ  50803200    /* in Hz */
+#define I2S_CLK_PER_SAMPLE  384u        /* 8 x SCK, with 48-bit frames */
+#define CSD_CLK_DIV_MAX     256u        /* The CSD clock uses an 8-bit divider */
 
 
 /*******************************************************************************
 * Global Variables
 ********************************************************************************/
 uint8_t  audio_app_control_report;
-uint32_t audio_app_current_sample_rate;
-int8_t   audio_app_volume;
-int8_t   audio_app_prev_volume;
-bool     audio_app_mute;
+uint32_t audio_app_out_sample_rate;
+uint32_t audio_app_in_sample_rate;
+uint32_t audio_app_i2s_sample_rate;
+uint32_t audio_app_csd_clock_hz;
+audio_app_switch_state_t audio_app_switch_state = AUDIO_APP_SWITCH_IDLE;
+audio_app_switch_stats_t audio_app_switch_stats;
+int16_t  audio_app_volume[AUDIO_CODEC_CHANNELS];
+bool     audio_app_mute[AUDIO_CODEC_CHANNELS];
 
 const cyhal_i2s_pins_t i2s_tx_pins = {
     .sck  = P5_1,
@@ -85,12 +91,8 @@ const cyhal_i2s_pins_t i2s_rx_pins = {
     .data = P5_6,
 };
 
-const cyhal_i2s_config_t i2s_config = {
-#ifdef COMPONENT_AK4954A
-    .is_tx_slave    = true,     /* TX is Slave */
-#else
-    .is_tx_slave    = false,    /* TX is Master */
-#endif
+cyhal_i2s_config_t i2s_config = {
+    .is_tx_slave    = false,    /* Set by the codec backend */
     .is_rx_slave    = false,    /* RX is Master */
     .mclk_hz        = 0,        /* External MCLK not used */
     .channel_length = 24,       /* In bits */
@@ -98,21 +100,12 @@ const cyhal_i2s_config_t i2s_config = {
     .sample_rate_hz = 48000,    /* In Hz */
 };
 
-#ifdef COMPONENT_AK4954A
-    /* Master I2C variables */
-    cyhal_i2c_t mi2c;
-
-    const cyhal_i2c_cfg_t mi2c_cfg = {
-        .is_slave        = false,
-        .address         = 0,
-        .frequencyhal_hz = 400000
-    };
-#endif
 
 /* HAL Objects */
 cyhal_i2s_t i2s;
 cyhal_clock_t pll_clock;
 cyhal_clock_t usb_rst_clock;
+cyhal_clock_t csd_clock;
 cyhal_pwm_t mclk_pwm;
 
 /* Tolerance Values */
@@ -124,13 +117,20 @@ const cyhal_clock_tolerance_t tolerance_1_p = {CYHAL_TOLERANCE_PERCENT, 1};
 ********************************************************************************/
 void audio_app_clock_init(void);
 void audio_app_set_clock(uint32_t sample_rate);
-void audio_app_update_codec_volume(void);
+void audio_app_update_core_clock(void);
+void audio_app_update_peri_clocks(void);
+void audio_app_update_volume(void);
 void audio_app_update_sample_rate(void);
+void audio_app_switch_sample_rate(uint32_t out_rate, uint32_t in_rate, uint32_t i2s_rate);
+bool audio_app_switch_wait(bool (*is_done)(void));
+bool audio_app_out_is_drained(void);
+uint32_t audio_app_get_i2s_rate(uint32_t sample_rate);
 void audio_app_touch_events(uint32_t widget, touch_event_t event, uint32_t value);
+void audio_app_i2s_events(void *arg, cyhal_i2s_event_t event);
+
+/* Tick timer setup of the FreeRTOS port, which reads configCPU_CLOCK_HZ */
+void vPortSetupTimerInterrupt(void);
 
-#ifdef COMPONENT_AK4954A
-    cy_rslt_t mi2c_transmit(uint8_t reg_adrr, uint8_t data);
-#endif
 
 /*******************************************************************************
 * Function Name: audio_app_usb_delay
@@ -181,27 +181,27 @@ void audio_app_init(void)
     /* Wait for the MCLK to clock the audio codec */
     cyhal_system_delay_ms(MCLK_CODEC_DELAY_MS);
     
-#ifdef COMPONENT_AK4954A
-    /* Initialize the I2C Master */
-    cyhal_i2c_init(&mi2c, CYBSP_I2C_SDA, CYBSP_I2C_SCL, NULL);
-    cyhal_i2c_configure(&mi2c, &mi2c_cfg);
-
-    /* Configure the AK494A codec and enable it */
-    if (ak4954a_init(mi2c_transmit) != 0)
+    /* Configure the audio codec and enable it */
+    if (audio_codec.init() != 0)
     {
         /* If failed, reset the device */
         NVIC_SystemReset();
     }
-    ak4954a_activate();
-    ak4954a_adjust_volume(AK4954A_HP_DEFAULT_VOLUME);
-#endif
+
+    /* Report the codec volume range and steps to the host */
+    usb_comm_set_volume(usb_comm_min_volume, audio_codec.volume_min);
+    usb_comm_set_volume(usb_comm_max_volume, audio_codec.volume_max);
+    usb_comm_set_volume(usb_comm_res_volume, audio_codec.volume_res);
 
     usb_comm_init();
     usb_comm_register_interface(&interface);
     usb_comm_register_usb_callbacks();
 
     /* Initialize the I2S block */
+    i2s_config.is_tx_slave = audio_codec.is_tx_slave;
     cyhal_i2s_init(&i2s, &i2s_tx_pins, &i2s_rx_pins, NC, &i2s_config, NULL);
+    cyhal_i2s_register_callback(&i2s, audio_app_i2s_events, NULL);
+    cyhal_i2s_set_async_mode(&i2s, CYHAL_ASYNC_DMA, CYHAL_DMA_PRIORITY_DEFAULT);
 
     /* Init the audio endpoints */
     audio_in_init();
@@ -245,10 +245,8 @@ void audio_app_process(void *arg)
             /* Update the sample rate */
             audio_app_update_sample_rate();
 
-#ifdef COMPONENT_AK4954A
-            /* Convert to Codec Volume */
-            audio_app_update_codec_volume();
-#endif
+            /* Update the codec volume and mute */
+            audio_app_update_volume();
 
             /* Set sync bit */
             xEventGroupSetBits(rtos_events, RTOS_EVENT_SYNC);
@@ -271,120 +269,357 @@ void audio_app_clock_init(void)
 
     /* Get the reset USB clock */
     cyhal_clock_get(&usb_rst_clock, &CYBSP_USB_CLK_DIV_obj);
+
+    /* Get the CapSense clock, and keep its frequency at the PLL rate of the
+       design, which the CapSense configuration was tuned for */
+    cyhal_clock_get(&csd_clock, &CYBSP_CSD_CLK_DIV_obj);
+    audio_app_csd_clock_hz = cyhal_clock_get_frequency(&csd_clock);
 }
 
-#ifdef COMPONENT_AK4954A
 /*******************************************************************************
-* Function Name: audio_app_update_codec_volume
+* Function Name: audio_app_update_volume
 ********************************************************************************
 * Summary:
-*   Update the audio codec volume by sending an I2C message.
+*   Update the audio codec volume and mute of each channel when the host
+*   changes them. The master and channel controls of the feature unit are
+*   cascaded: the volumes (1/256 dB) add up, limited to the minimum and
+*   maximum set for the host, and either mute silences the channel.
 *
 *******************************************************************************/
-void audio_app_update_codec_volume(void)
+void audio_app_update_volume(void)
 {
-    int8_t  vol_usb = (((int8_t) usb_comm_cur_volume[1])/2) + PC_VOLUME_MSB_CODEC_OFFSET;
+    int16_t volume_min = usb_comm_get_volume(usb_comm_min_volume);
+    int16_t volume_max = usb_comm_get_volume(usb_comm_max_volume);
+    int32_t master = usb_comm_get_volume(usb_comm_cur_volume[AUDIO_FEATURE_UNIT_MASTER_CHANNEL]);
+    bool master_mute = (usb_comm_mute[AUDIO_FEATURE_UNIT_MASTER_CHANNEL] != 0u);
 
-    /* If the volume is negative, set to minimum volume */
-    if (vol_usb <= 0)
-    {
-        audio_app_volume = AK4954A_HP_VOLUME_MIN;
-    }
-    else
+    for (uint32_t channel = 0; channel < AUDIO_CODEC_CHANNELS; channel++)
     {
-        /* Use the formula: Volume = COEFF / (VOL/2 + OFFSET) */
-        audio_app_volume = (PC_VOLUME_CODEC_COEFF / ((uint16_t) vol_usb));
-    }
+        /* Codec channels map to the feature unit channels after the master */
+        uint32_t usb_channel = channel + AUDIO_FEATURE_UNIT_LEFT_CHANNEL;
+        int32_t volume = master + usb_comm_get_volume(usb_comm_cur_volume[usb_channel]);
+        bool mute = master_mute || (usb_comm_mute[usb_channel] != 0u);
 
-    /* Check if the volume changed */
-    if (audio_app_volume != audio_app_prev_volume)
-    {
-        ak4954a_adjust_volume(audio_app_volume);
+        if (volume < volume_min)
+        {
+            volume = volume_min;
+        }
+        if (volume > volume_max)
+        {
+            volume = volume_max;
+        }
 
-        audio_app_prev_volume = audio_app_volume;
+        /* Check if the volume changed */
+        if (volume != audio_app_volume[channel])
+        {
+            audio_app_volume[channel] = (int16_t) volume;
+
+            audio_codec.set_volume(channel, audio_app_volume[channel]);
+        }
+
+        /* Check if mute settings changed */
+        if (mute != audio_app_mute[channel])
+        {
+            audio_app_mute[channel] = mute;
+
+            audio_codec.set_mute(channel, audio_app_mute[channel]);
+        }
     }
+}
+
+/*******************************************************************************
+* Function Name: audio_app_update_sample_rate
+********************************************************************************
+* Summary:
+*   Update the sample rates of the audio streaming. Playback and capture can
+*   run at different rates: the I2S runs at the playback rate (or at the
+*   fixed rate) and the other direction is converted in software. A change of
+*   the playback or I2S rate goes through the switch pipeline; a change of
+*   the capture rate alone only reconfigures its converter.
+*
+*******************************************************************************/
+void audio_app_update_sample_rate(void)
+{
+    uint32_t out_rate = usb_comm_new_out_sample_rate;
+    uint32_t in_rate  = usb_comm_new_in_sample_rate;
+    uint32_t i2s_rate;
+    bool     out_changed = (out_rate != audio_app_out_sample_rate);
 
-    /* Check if mute settings changed */
-    if (usb_comm_mute != audio_app_mute)
+    /* Check if need to change sample rate. */
+    if (out_changed || (in_rate != audio_app_in_sample_rate))
     {
-        /* Store current mute settings */
-        audio_app_mute = usb_comm_mute;
+        /* Capture the new sample rates */
+        audio_app_out_sample_rate = out_rate;
+        audio_app_in_sample_rate  = in_rate;
 
-        /* If mute is non-zero, then mute is active */
-        if (audio_app_mute != 0)
+#if (AUDIO_APP_FIXED_RATE == 1u)
+        i2s_rate = AUDIO_APP_FIXED_RATE_HZ;
+#else
+        /* The I2S follows the playback rate, so the feedback reports the
+           audio clock itself; capture follows when playback is not set */
+        i2s_rate = (out_rate != 0u) ? out_rate : audio_app_get_i2s_rate(in_rate);
+#endif
+
+        /* A direction not set by the host yet runs at the I2S rate */
+        if (out_rate == 0u)
+        {
+            out_rate = i2s_rate;
+        }
+        if (in_rate == 0u)
         {
-            ak4954a_adjust_volume(AK4954A_HP_MUTE_VALUE);
+            in_rate = i2s_rate;
+        }
+
+        if ((i2s_rate != audio_app_i2s_sample_rate) || out_changed)
+        {
+            audio_app_switch_sample_rate(out_rate, in_rate, i2s_rate);
         }
         else
         {
-            /* Otherwise, update with current volume */
-            ak4954a_adjust_volume(audio_app_volume);
+            /* Update Audio In sample rate */
+            audio_in_update_sample_rate(in_rate, i2s_rate);
         }
+
+        /* Update feedback sample rate, once the PLL runs at the new rate */
+        audio_feed_update_sample_rate(out_rate);
     }
+
+    usb_comm_enable_feedback = true;
 }
-#endif
 
 /*******************************************************************************
-* Function Name: audio_app_update_sample_rate
+* Function Name: audio_app_switch_sample_rate
 ********************************************************************************
 * Summary:
-*   Update the sample rate of the audio streaming.
+*   Switch the playback and I2S rates in stages: the playback is faded out
+*   and the buffered frames are played, then the clocks and the codec are
+*   retuned, and the new stream is primed with silence and faded in. Each
+*   wait is bounded by AUDIO_APP_SWITCH_TIMEOUT_MS, and the switch duration is
+*   recorded in audio_app_switch_stats.
+*
+* Parameters:
+*   out_rate: sample rate of the OUT endpoint in Hz
+*   in_rate: sample rate of the IN endpoint in Hz
+*   i2s_rate: new sample rate of the I2S in Hz
 *
 *******************************************************************************/
-void audio_app_update_sample_rate(void)
+void audio_app_switch_sample_rate(uint32_t out_rate, uint32_t in_rate, uint32_t i2s_rate)
 {
-    /* Check if need to change sample rate. */
-    if ((usb_comm_new_sample_rate != 0) &&
-        (usb_comm_new_sample_rate != audio_app_current_sample_rate))
+    TickType_t start = xTaskGetTickCount();
+    uint32_t duration;
+
+    audio_app_switch_state = AUDIO_APP_SWITCH_FADE_OUT;
+
+    while (audio_app_switch_state != AUDIO_APP_SWITCH_IDLE)
     {
-        /* Capture the new sample rate */
-        audio_app_current_sample_rate = usb_comm_new_sample_rate;
-
-        /* Update feedback sample rate */
-        audio_feed_update_sample_rate(audio_app_current_sample_rate);
-
-        /* Update Audio In sample rate */
-        audio_in_update_sample_rate(audio_app_current_sample_rate);
-
-        /* Disable the I2S block */
-        cyhal_i2s_stop_tx(&i2s);
-        cyhal_i2s_stop_rx(&i2s);
-        
-#ifdef COMPONENT_AK4954A
-        /* Disable the codec */
-        ak4954a_deactivate();
-#endif
+        switch (audio_app_switch_state)
+        {
+            case AUDIO_APP_SWITCH_FADE_OUT:
+            {
+                /* The frames queued from now on ramp down to silence */
+                audio_out_fade(true);
 
-        /* Set the new clock rate */
-        audio_app_set_clock(audio_app_current_sample_rate);
+                if (audio_out_is_playing == true)
+                {
+                    audio_app_switch_wait(audio_out_is_faded);
+                }
 
-#ifdef COMPONENT_AK4954A
-        /* Re-enable the codec */
-        ak4954a_activate();
-#endif
+                audio_app_switch_state = AUDIO_APP_SWITCH_DRAIN;
+                break;
+            }
+            case AUDIO_APP_SWITCH_DRAIN:
+            {
+                /* Discard the next host frames, and play the ones buffered,
+                   which end with the fade out */
+                audio_out_set_hold(true);
+
+                if (audio_out_is_playing == true)
+                {
+                    audio_app_switch_wait(audio_app_out_is_drained);
+                }
+
+                /* Disable the I2S block */
+                audio_out_flush();
+                cyhal_i2s_stop_rx(&i2s);
+
+                audio_app_switch_state = AUDIO_APP_SWITCH_CLOCK;
+                break;
+            }
+            case AUDIO_APP_SWITCH_CLOCK:
+            {
+                /* Update the converters, no frame is queued */
+                audio_in_update_sample_rate(in_rate, i2s_rate);
+                audio_out_update_sample_rate(out_rate, i2s_rate);
+
+                if (i2s_rate != audio_app_i2s_sample_rate)
+                {
+                    audio_app_i2s_sample_rate = i2s_rate;
+
+                    /* Mute and deactivate the codec, the clock change also
+                       affects the codec interface, so let the writes complete */
+                    audio_codec.begin_rate();
+                    audio_codec.sync();
+
+                    /* The CapSense scan should not run across the clock change */
+                    if (touch_pause(AUDIO_APP_SWITCH_TIMEOUT_MS) == false)
+                    {
+                        audio_app_switch_stats.timeouts++;
+                    }
+
+                    /* Set the new clock rate */
+                    audio_app_set_clock(i2s_rate);
+
+                    /* Resume the scans with a new baseline */
+                    touch_resume();
+
+                    /* Program the codec for the new rate and MCLK ratio, and
+                       wait for it to run at that rate before restarting the I2S */
+                    audio_codec.set_rate(i2s_rate);
+                    audio_codec.sync();
+                }
+
+                audio_app_switch_state = AUDIO_APP_SWITCH_PRIME;
+                break;
+            }
+            case AUDIO_APP_SWITCH_PRIME:
+            {
+                /* The I2S TX restarts with the first new frame */
+                audio_out_prime_silence();
+
+                /* Re-enable the I2S FIFOs */
+                if ((usb_comm_enable_out_streaming && audio_codec.is_tx_slave) ||
+                    usb_comm_enable_in_streaming)
+                {
+                    cyhal_i2s_start_rx(&i2s);
+                }
+
+                audio_out_set_hold(false);
+
+                audio_app_switch_state = AUDIO_APP_SWITCH_FADE_IN;
+                break;
+            }
+            case AUDIO_APP_SWITCH_FADE_IN:
+            {
+                /* The first new frame ramps up from silence */
+                audio_out_fade(false);
+
+                audio_app_switch_state = AUDIO_APP_SWITCH_IDLE;
+                break;
+            }
+            default:
+                audio_app_switch_state = AUDIO_APP_SWITCH_IDLE;
+                break;
+        }
+    }
+
+    /* The RTOS tick runs at the same rate across the clock change */
+    duration = (uint32_t) (xTaskGetTickCount() - start) * portTICK_PERIOD_MS;
+
+    audio_app_switch_stats.count++;
+    audio_app_switch_stats.last_ms = duration;
+
+    if (duration > audio_app_switch_stats.max_ms)
+    {
+        audio_app_switch_stats.max_ms = duration;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_app_switch_wait
+********************************************************************************
+* Summary:
+*   Wait for a stage of the sample rate switch to complete, at most
+*   AUDIO_APP_SWITCH_TIMEOUT_MS. A timeout is accounted in the statistics.
+*
+* Parameters:
+*   is_done: returns true once the stage is complete
+*
+* Return:
+*   false if the wait timed out.
+*
+*******************************************************************************/
+bool audio_app_switch_wait(bool (*is_done)(void))
+{
+    uint32_t elapsed = 0;
 
-        /* Re-enable the I2S FIFOs */
-        if (usb_comm_enable_out_streaming)
+    while (is_done() == false)
+    {
+        if (elapsed >= AUDIO_APP_SWITCH_TIMEOUT_MS)
         {
-            cyhal_i2s_start_tx(&i2s);
-        #ifdef COMPONENT_AK4954A
-            cyhal_i2s_start_rx(&i2s);
-        #endif
+            audio_app_switch_stats.timeouts++;
+            return false;
         }
-        if (usb_comm_enable_in_streaming)
+
+        vTaskDelay(pdMS_TO_TICKS(1u));
+        elapsed++;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: audio_app_out_is_drained
+********************************************************************************
+* Summary:
+*   Return true once the jitter buffer is played out.
+*
+*******************************************************************************/
+bool audio_app_out_is_drained(void)
+{
+    return (0u == audio_ring_get_level(&audio_out_ring));
+}
+
+/*******************************************************************************
+* Function Name: audio_app_get_i2s_rate
+********************************************************************************
+* Summary:
+*   Return the I2S rate a capture rate is produced from. The capture-only
+*   rates are decimated from the I2S rate of the same family.
+*
+* Parameters:
+*   sample_rate: capture rate in Hz
+*
+* Return:
+*   I2S rate in Hz.
+*
+*******************************************************************************/
+uint32_t audio_app_get_i2s_rate(uint32_t sample_rate)
+{
+    uint32_t i2s_rate;
+
+    switch (sample_rate)
+    {
+        case AUDIO_SAMPLING_RATE_32KHZ:
+        case AUDIO_SAMPLING_RATE_16KHZ:
+        {
+            i2s_rate = AUDIO_SAMPLING_RATE_48KHZ;
+            break;
+        }
+        case AUDIO_SAMPLING_RATE_22KHZ:
         {
-            cyhal_i2s_start_rx(&i2s);
+            i2s_rate = AUDIO_SAMPLING_RATE_44KHZ;
+            break;
         }
+        default:
+            i2s_rate = sample_rate;
+            break;
     }
 
-    usb_comm_enable_feedback = true;
+    return i2s_rate;
 }
 
 /*******************************************************************************
 * Function Name: audio_app_set_clock
 ********************************************************************************
 * Summary:
-*   Update the PLL clock to achieve the desired sample rate.
+*   Update the PLL clock to achieve the desired sample rate. The PLL runs at
+*   1152 fs for 44.1/48 kHz and at 768 fs for 88.2/96 kHz. The MCLK (PLL/3) is
+*   then 384 fs or 256 fs, as required by the codec, and the I2S divider is
+*   set to keep the I2S interface clock at 8 x SCK. The CPU and the peripheral
+*   clock also run from the PLL, so the core clock, the RTOS tick and the
+*   peripheral dividers are updated as well; the codec backend reconfigures
+*   its I2C in set_rate. The CapSense scans and the codec writes should be
+*   paused.
 *
 * Parameters:
 *   sample_rate: new sample rate to be enforced.
@@ -392,36 +627,98 @@ void audio_app_update_sample_rate(void)
 *******************************************************************************/
 void audio_app_set_clock(uint32_t sample_rate)
 {
-    /* Wait till the CapSense is ready */
-    while (!touch_is_ready())
-    {
-        vTaskDelay(1);
-    };
+    uint32_t pll_freq;
 
     switch (sample_rate)
     {
+        case AUDIO_SAMPLING_RATE_96KHZ:
+        {
+            pll_freq = PLL_FREQ_FOR_96KHZ;
+            break;
+        }
+        case AUDIO_SAMPLING_RATE_88KHZ:
+        {
+            pll_freq = PLL_FREQ_FOR_88KHZ;
+            break;
+        }
         case AUDIO_SAMPLING_RATE_48KHZ:
         {
-            cyhal_clock_set_frequency(&pll_clock, PLL_FREQ_FOR_48KHZ, &tolerance_0_p);
+            pll_freq = PLL_FREQ_FOR_48KHZ;
             break;
         }
         case AUDIO_SAMPLING_RATE_44KHZ:
         {
-            cyhal_clock_set_frequency(&pll_clock, PLL_FREQ_FOR_44KHZ, &tolerance_0_p);
+            pll_freq = PLL_FREQ_FOR_44KHZ;
             break;
         }
         default:
+            pll_freq = 0;
             break;
     }
 
-    /* Update the USB Reset clock based on the new frequency */
-    cyhal_clock_set_frequency(&usb_rst_clock, USB_CLK_RESET_HZ, &tolerance_1_p);
+    if (pll_freq != 0)
+    {
+        cyhal_clock_set_frequency(&pll_clock, pll_freq, &tolerance_0_p);
+
+        /* Set the I2S interface clock divider (TX and RX are stopped) */
+        CY_REG32_CLR_SET(REG_I2S_CLOCK_CTL(i2s.base), I2S_CLOCK_CTL_CLOCK_DIV,
+                         (pll_freq / (I2S_CLK_PER_SAMPLE * sample_rate)) - 1u);
+
+        audio_app_update_core_clock();
+    }
+
+    audio_app_update_peri_clocks();
 
     /* Set flag to indicate that the clock was configured */
     usb_comm_clock_configured = true;
+}
+
+/*******************************************************************************
+* Function Name: audio_app_update_core_clock
+********************************************************************************
+* Summary:
+*   Update SystemCoreClock after a PLL change, and have the RTOS port reload
+*   the tick timer from it, so the tick stays at configTICK_RATE_HZ.
+*
+*******************************************************************************/
+void audio_app_update_core_clock(void)
+{
+    SystemCoreClockUpdate();
+
+    taskENTER_CRITICAL();
+    vPortSetupTimerInterrupt();
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: audio_app_update_peri_clocks
+********************************************************************************
+* Summary:
+*   Recompute the dividers of the peripheral clocks after a PLL change: the
+*   USB reset clock, and the CapSense clock, set back to its frequency at the
+*   PLL rate of the design. When the 8-bit divider cannot reach it, the
+*   closest frequency is used, and the baseline refreshed by touch_resume()
+*   absorbs the difference.
+*
+*******************************************************************************/
+void audio_app_update_peri_clocks(void)
+{
+    uint32_t peri_hz = Cy_SysClk_ClkPeriGetFrequency();
+    uint32_t divider;
+
+    /* Update the USB Reset clock based on the new frequency */
+    cyhal_clock_set_frequency(&usb_rst_clock, USB_CLK_RESET_HZ, &tolerance_1_p);
 
-    /* Update baseline to compensate change in the clock */
-    touch_update_baseline();
+    if (audio_app_csd_clock_hz != 0u)
+    {
+        divider = (peri_hz + (audio_app_csd_clock_hz / 2u)) / audio_app_csd_clock_hz;
+        if (divider > CSD_CLK_DIV_MAX)
+        {
+            divider = CSD_CLK_DIV_MAX;
+        }
+
+        cyhal_clock_set_divider(&csd_clock, divider);
+    }
 }
 
 /*******************************************************************************
@@ -488,35 +785,23 @@ void audio_app_touch_events(uint32_t widget, touch_event_t event, uint32_t value
     }
 }
 
-#ifdef COMPONENT_AK4954A
 /*******************************************************************************
-* Function Name: mi2c_transmit
+* Function Name: audio_app_i2s_events
 ********************************************************************************
 * Summary:
-*  I2C Master function to transmit data to the given address.
+*  Dispatch the I2S events to the audio paths.
 *
 * Parameters:
-*  reg_addr: address to be updated
-*  data: 8-bit data to be written in the register
-*
-* Return:
-*  cy_rslt_t - I2C master transaction error status.
-*              Returns CY_RSLT_SUCCESS if succeeded.
+*  arg: not used
+*  event: I2S events that triggered the interrupt
 *
 *******************************************************************************/
-cy_rslt_t mi2c_transmit(uint8_t reg_addr, uint8_t data)
+void audio_app_i2s_events(void *arg, cyhal_i2s_event_t event)
 {
-    cy_rslt_t result;
-    uint8_t buffer[AK4954A_PACKET_SIZE];
-
-    buffer[0] = reg_addr;
-    buffer[1] = data;
-
-    /* Send the data over the I2C */
-    result = cyhal_i2c_master_write(&mi2c, AK4954A_I2C_ADDR, buffer, AK4954A_PACKET_SIZE, MI2C_TIMEOUT_MS, true);
+    (void) arg;
 
-    return result;
+    audio_out_i2s_event(event);
+    audio_in_i2s_event(event);
 }
-#endif
 
 /* [] END OF FILE */
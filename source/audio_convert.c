@@ -0,0 +1,235 @@
+/*******************************************************************************
+* File Name: audio_convert.c
+*
+* Description: This file contains the sample packing routines between the
+*  24-bit or 16-bit USB audio formats and the 32-bit I2S FIFO words. Four
+*  samples are moved per iteration with word accesses.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+
+#include "audio_convert.h"
+
+#include "cy_device_headers.h"
+
+/*******************************************************************************
+* Audio Convert Constants
+*******************************************************************************/
+/* Number of samples packed in three 32-bit words of 24-bit data */
+#define AUDIO_CONVERT_BLOCK         (4u)
+
+/* Number of bytes taken by one block of 24-bit data */
+#define AUDIO_CONVERT_BLOCK_BYTES   (12u)
+
+/* Mask of a 24-bit sample */
+#define AUDIO_CONVERT_MASK          (0x00FFFFFFu)
+
+/* Position of a 16-bit sample in the 24-bit I2S word */
+#define AUDIO_CONVERT_16BIT_SHIFT   (8u)
+
+/*******************************************************************************
+* Function Name: audio_convert_24_to_32
+********************************************************************************
+* Summary:
+*   Convert a 24-bit array to 32-bit array. The most significant byte of each
+*   32-bit word is zero.
+*
+* Parameters:
+*   src: packed 24-bit samples, no alignment required
+*   dst: 32-bit samples
+*   length: number of samples
+*
+*******************************************************************************/
+void audio_convert_24_to_32(const uint8_t *src, uint32_t *dst, uint32_t length)
+{
+    uint32_t w0, w1, w2;
+
+    while (length >= AUDIO_CONVERT_BLOCK)
+    {
+        /* |s1.0|s0.2|s0.1|s0.0| |s2.1|s2.0|s1.2|s1.1| |s3.2|s3.1|s3.0|s2.2| */
+        w0 = __UNALIGNED_UINT32_READ(&src[0]);
+        w1 = __UNALIGNED_UINT32_READ(&src[4]);
+        w2 = __UNALIGNED_UINT32_READ(&src[8]);
+
+        dst[0] = w0 & AUDIO_CONVERT_MASK;
+        dst[1] = (w0 >> 24) | ((w1 & 0xFFFFu) << 8);
+    #if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+        dst[2] = __PKHBT(w1 >> 16, __UXTB16(w2), 16);
+    #else
+        dst[2] = (w1 >> 16) | ((w2 & 0xFFu) << 16);
+    #endif
+        dst[3] = w2 >> 8;
+
+        src    += AUDIO_CONVERT_BLOCK_BYTES;
+        dst    += AUDIO_CONVERT_BLOCK;
+        length -= AUDIO_CONVERT_BLOCK;
+    }
+
+    while (0u != length--)
+    {
+        *(dst++) = (uint32_t) src[0] | ((uint32_t) src[1] << 8) | ((uint32_t) src[2] << 16);
+        src += 3;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_convert_32_to_24
+********************************************************************************
+* Summary:
+*   Convert a 32-bit array to 24-bit array. The most significant byte of each
+*   32-bit word is dropped.
+*
+* Parameters:
+*   src: 32-bit samples
+*   dst: packed 24-bit samples, no alignment required
+*   length: number of samples
+*
+*******************************************************************************/
+void audio_convert_32_to_24(const uint32_t *src, uint8_t *dst, uint32_t length)
+{
+    uint32_t s0, s1, s2, s3;
+
+    while (length >= AUDIO_CONVERT_BLOCK)
+    {
+        s0 = src[0];
+        s1 = src[1];
+        s2 = src[2];
+        s3 = src[3];
+
+        __UNALIGNED_UINT32_WRITE(&dst[0], (s0 & AUDIO_CONVERT_MASK) | (s1 << 24));
+    #if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+        __UNALIGNED_UINT32_WRITE(&dst[4], __PKHBT(s1 >> 8, s2, 16));
+    #else
+        __UNALIGNED_UINT32_WRITE(&dst[4], ((s1 >> 8) & 0xFFFFu) | (s2 << 16));
+    #endif
+        __UNALIGNED_UINT32_WRITE(&dst[8], ((s2 >> 16) & 0xFFu) | (s3 << 8));
+
+        src    += AUDIO_CONVERT_BLOCK;
+        dst    += AUDIO_CONVERT_BLOCK_BYTES;
+        length -= AUDIO_CONVERT_BLOCK;
+    }
+
+    while (0u != length--)
+    {
+        s0 = *(src++);
+        *(dst++) = (uint8_t) s0;
+        *(dst++) = (uint8_t) (s0 >> 8);
+        *(dst++) = (uint8_t) (s0 >> 16);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_convert_16_to_32
+********************************************************************************
+* Summary:
+*   Convert a 16-bit array to 32-bit array. The 16-bit sample is placed in the
+*   upper bits of the 24-bit I2S word and the most significant byte of each
+*   32-bit word is zero.
+*
+* Parameters:
+*   src: packed 16-bit samples, no alignment required
+*   dst: 32-bit samples
+*   length: number of samples
+*
+*******************************************************************************/
+void audio_convert_16_to_32(const uint8_t *src, uint32_t *dst, uint32_t length)
+{
+    uint32_t w0, w1;
+
+    while (length >= AUDIO_CONVERT_BLOCK)
+    {
+        w0 = __UNALIGNED_UINT32_READ(&src[0]);
+        w1 = __UNALIGNED_UINT32_READ(&src[4]);
+
+        dst[0] = (w0 & 0xFFFFu) << AUDIO_CONVERT_16BIT_SHIFT;
+        dst[1] = (w0 >> 16) << AUDIO_CONVERT_16BIT_SHIFT;
+        dst[2] = (w1 & 0xFFFFu) << AUDIO_CONVERT_16BIT_SHIFT;
+        dst[3] = (w1 >> 16) << AUDIO_CONVERT_16BIT_SHIFT;
+
+        src    += AUDIO_CONVERT_BLOCK * 2u;
+        dst    += AUDIO_CONVERT_BLOCK;
+        length -= AUDIO_CONVERT_BLOCK;
+    }
+
+    while (0u != length--)
+    {
+        *(dst++) = ((uint32_t) src[0] | ((uint32_t) src[1] << 8)) << AUDIO_CONVERT_16BIT_SHIFT;
+        src += 2;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_convert_32_to_16
+********************************************************************************
+* Summary:
+*   Convert a 32-bit array to 16-bit array. The upper 16 bits of the 24-bit
+*   I2S word are kept.
+*
+* Parameters:
+*   src: 32-bit samples
+*   dst: packed 16-bit samples, no alignment required
+*   length: number of samples
+*
+*******************************************************************************/
+void audio_convert_32_to_16(const uint32_t *src, uint8_t *dst, uint32_t length)
+{
+    uint32_t s0, s1, s2, s3;
+
+    while (length >= AUDIO_CONVERT_BLOCK)
+    {
+        s0 = src[0];
+        s1 = src[1];
+        s2 = src[2];
+        s3 = src[3];
+
+    #if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+        __UNALIGNED_UINT32_WRITE(&dst[0], __PKHBT(s0 >> 8, s1, 8));
+        __UNALIGNED_UINT32_WRITE(&dst[4], __PKHBT(s2 >> 8, s3, 8));
+    #else
+        __UNALIGNED_UINT32_WRITE(&dst[0], ((s0 >> 8) & 0xFFFFu) | ((s1 << 8) & 0xFFFF0000u));
+        __UNALIGNED_UINT32_WRITE(&dst[4], ((s2 >> 8) & 0xFFFFu) | ((s3 << 8) & 0xFFFF0000u));
+    #endif
+
+        src    += AUDIO_CONVERT_BLOCK;
+        dst    += AUDIO_CONVERT_BLOCK * 2u;
+        length -= AUDIO_CONVERT_BLOCK;
+    }
+
+    while (0u != length--)
+    {
+        s0 = *(src++);
+        *(dst++) = (uint8_t) (s0 >> 8);
+        *(dst++) = (uint8_t) (s0 >> 16);
+    }
+}
+
+/* [] END OF FILE */
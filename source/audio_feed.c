@@ -38,22 +38,72 @@
 
 #include "audio_feed.h"
 #include "audio_app.h"
+#include "audio_out.h"
 #include "usb_comm.h"
 #include "audio.h"
+#include "rtos.h"
 
+#include "cyhal.h"
 #include "cycfg.h"
 #include "cy_sysint.h"
 
+#include "cy_device_headers.h"
+
+/*******************************************************************************
+* Audio Feedback Constants
+*******************************************************************************/
+/* Mask of the SOF frame number */
+#define AUDIO_FEED_SOF_MASK         (0x7FFu)
+
+/* Period of the counter of the measured mode, free-running over 32 bits */
+#define AUDIO_FEED_TIMER_PERIOD     (0xFFFFFFFFu)
+
 /*******************************************************************************
 * Local Functions
 *******************************************************************************/
 void audio_feed_endpoint_callback(USBFS_Type *base,
                                   cy_stc_usbfs_dev_drv_context_t *context);
 
+void    audio_feed_reset(void);
+void    audio_feed_filter(uint32_t level);
+int32_t audio_feed_control(uint32_t level);
+#if (AUDIO_FEED_MODE == AUDIO_FEED_MODE_MEASURED)
+uint32_t audio_feed_measure(USBFS_Type *base, uint32_t ticks);
+#endif
+
 /*******************************************************************************
 * Audio Feedback Variables
 *******************************************************************************/
-uint8_t audio_feed_data[AUDIO_FEEDBACK_ENDPOINT_SIZE] = {0x00, 0x00, 0x0C};
+/* Nominal feedback value (10.14) of the current sample rate */
+volatile uint32_t audio_feed_nominal = AUDIO_FEED_RATE_TO_FEEDBACK(AUDIO_SAMPLING_RATE_48KHZ);
+
+/* Filtered jitter buffer level, in 1/256 of a word */
+uint32_t audio_feed_level;
+
+/* Integral of the level error */
+int32_t  audio_feed_integral;
+
+#if (AUDIO_FEED_MODE == AUDIO_FEED_MODE_MEASURED)
+/* Counter of the peripheral clock, which also clocks the MCLK */
+cyhal_timer_t audio_feed_timer;
+
+/* Nominal frequency of the counter, at the PLL rate of the sample rate */
+uint32_t audio_feed_timer_hz;
+
+/* Host sample rate, the audio clock is measured in counter ticks and scaled
+   to it */
+uint32_t audio_feed_rate = AUDIO_SAMPLING_RATE_48KHZ;
+
+/* Measured feedback value (10.14) and remainder of its division */
+uint32_t audio_feed_measured;
+uint64_t audio_feed_remainder;
+
+/* Counter value and SOF number at the start of the measurement window */
+uint32_t audio_feed_window_ticks;
+uint32_t audio_feed_last_sof;
+uint32_t audio_feed_window_frames;
+bool     audio_feed_window_started;
+#endif
 
 /*******************************************************************************
 * Function Name: audio_feed_init
@@ -64,6 +114,25 @@ uint8_t audio_feed_data[AUDIO_FEEDBACK_ENDPOINT_SIZE] = {0x00, 0x00, 0x0C};
 *******************************************************************************/
 void audio_feed_init(void)
 {
+#if (AUDIO_FEED_MODE == AUDIO_FEED_MODE_MEASURED)
+    const cyhal_timer_cfg_t timer_cfg =
+    {
+        .is_continuous = true,
+        .direction = CYHAL_TIMER_DIR_UP,
+        .is_compare = false,
+        .period = AUDIO_FEED_TIMER_PERIOD,
+        .compare_value = 0,
+        .value = 0
+    };
+
+    /* Run the counter from the undivided peripheral clock. The divider is
+       kept through the PLL changes, so the counter follows the audio clock */
+    cyhal_timer_init(&audio_feed_timer, NC, NULL);
+    cyhal_timer_configure(&audio_feed_timer, &timer_cfg);
+    cyhal_timer_set_frequency(&audio_feed_timer, Cy_SysClk_ClkPeriGetFrequency());
+    cyhal_timer_start(&audio_feed_timer);
+#endif
+
     /* Register SOF Callback */
     Cy_USBFS_Dev_Drv_RegisterSofCallback(CYBSP_USBDEV_HW,
                                          audio_feed_endpoint_callback,
@@ -74,70 +143,223 @@ void audio_feed_init(void)
 * Function Name: audio_feed_update_sample_rate
 ********************************************************************************
 * Summary:
-*   Set the audio streaming sample rate.
+*   Set the audio streaming sample rate. Any rate is supported, the nominal
+*   feedback value is derived from it.
 *
 *******************************************************************************/
 void audio_feed_update_sample_rate(uint32_t sample_rate)
 {
-    switch (sample_rate)
+    /* The sample rate in the feedback endpoint is represented with 3 bytes
+     * as a 10.14 fraction number of samples per frame, e.g. 48 kHz is
+     * 0x0C0000 and 44.1 kHz is 0x0B0666. */
+    audio_feed_nominal = AUDIO_FEED_RATE_TO_FEEDBACK(sample_rate);
+
+#if (AUDIO_FEED_MODE == AUDIO_FEED_MODE_MEASURED)
+    audio_feed_rate = sample_rate;
+
+    /* Called once the PLL runs at the new rate */
+    audio_feed_timer_hz = Cy_SysClk_ClkPeriGetFrequency();
+#endif
+
+    audio_feed_reset();
+}
+
+/*******************************************************************************
+* Function Name: audio_feed_reset
+********************************************************************************
+* Summary:
+*   Reset the feedback controller, so the nominal rate is reported until the
+*   jitter buffer is drained again.
+*
+*******************************************************************************/
+void audio_feed_reset(void)
+{
+    audio_feed_level    = audio_out_prime << 8;
+    audio_feed_integral = 0;
+
+#if (AUDIO_FEED_MODE == AUDIO_FEED_MODE_MEASURED)
+    audio_feed_measured       = audio_feed_nominal;
+    audio_feed_remainder      = 0;
+    audio_feed_window_started = false;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: audio_feed_filter
+********************************************************************************
+* Summary:
+*   Low-pass filter the jitter buffer level, to remove the steps of the USB
+*   packets and DMA transfers.
+*
+* Parameters:
+*   level: number of words queued for the I2S TX
+*
+*******************************************************************************/
+void audio_feed_filter(uint32_t level)
+{
+    /* Single pole low-pass filter */
+    audio_feed_level += ((int32_t) (level << 8) - (int32_t) audio_feed_level) >> AUDIO_FEED_FILTER_SHIFT;
+}
+
+/*******************************************************************************
+* Function Name: audio_feed_control
+********************************************************************************
+* Summary:
+*   PI controller of the feedback value. The filtered jitter buffer level is
+*   compared with the buffer target. The integral is frozen while the output is
+*   saturated (anti-windup).
+*
+* Parameters:
+*   level: number of words queued for the I2S TX
+*
+* Return:
+*   Correction to be added to the nominal feedback value (10.14).
+*
+*******************************************************************************/
+int32_t audio_feed_control(uint32_t level)
+{
+    int32_t error;
+    int32_t integral;
+    int32_t output;
+
+    audio_feed_filter(level);
+
+    /* A low level means the host has to send faster */
+    error = (int32_t) (audio_out_prime << 8) - (int32_t) audio_feed_level;
+    integral = audio_feed_integral + error;
+
+    output = (int32_t) ((((int64_t) AUDIO_FEED_KP * error) +
+                         ((int64_t) AUDIO_FEED_KI * integral)) >> AUDIO_FEED_GAIN_SHIFT);
+
+    if (output > AUDIO_FEED_MAX_DEVIATION)
+    {
+        output = AUDIO_FEED_MAX_DEVIATION;
+    }
+    else if (output < -AUDIO_FEED_MAX_DEVIATION)
+    {
+        output = -AUDIO_FEED_MAX_DEVIATION;
+    }
+    else
+    {
+        audio_feed_integral = integral;
+    }
+
+    return output;
+}
+
+#if (AUDIO_FEED_MODE == AUDIO_FEED_MODE_MEASURED)
+/*******************************************************************************
+* Function Name: audio_feed_measure
+********************************************************************************
+* Summary:
+*   Measure the audio sample rate against the USB SOF. The counter ticks
+*   elapsed over a window of frames are converted to samples per frame (10.14)
+*   of the host rate, which also holds when the I2S runs at a fixed rate. The
+*   remainder of the division is carried to the next window, so the value
+*   reported on average is exact and the jitter buffer level does not creep.
+*   The SOF number is used to count frames, so a missed SOF does not bias the
+*   measurement.
+*
+* Parameters:
+*   base: USB block
+*   ticks: counter value at the SOF
+*
+* Return:
+*   Feedback value (10.14).
+*
+*******************************************************************************/
+uint32_t audio_feed_measure(USBFS_Type *base, uint32_t ticks)
+{
+    uint32_t sof = Cy_USBFS_Dev_Drv_GetSofNubmer(base);
+    uint64_t numerator;
+    uint64_t denominator;
+
+    if (audio_feed_window_started == false)
+    {
+        audio_feed_window_started = true;
+        audio_feed_window_ticks   = ticks;
+        audio_feed_window_frames  = 0;
+        audio_feed_last_sof       = sof;
+
+        return audio_feed_measured;
+    }
+
+    audio_feed_window_frames += (sof - audio_feed_last_sof) & AUDIO_FEED_SOF_MASK;
+    audio_feed_last_sof = sof;
+
+    if (audio_feed_window_frames >= (1u << AUDIO_FEED_MEASURE_SHIFT))
     {
-        /* The sample rate in the feedback endpoint is represented with 3 bytes
-         * as an fraction number - X.Y, where:
-         * X = (Byte[2] << 2) + (Byte[1] >> 6)
-         * Y = (Byte[1] & 0x3F)) + (Byte[0] & 0xF0)
-         */ 
-        case AUDIO_SAMPLING_RATE_48KHZ:
-            audio_feed_data[0] = 0x00u;
-            audio_feed_data[1] = 0x00u;
-            audio_feed_data[2] = 0x0Cu;
-            break;
-
-          case AUDIO_SAMPLING_RATE_44KHZ:
-            audio_feed_data[0] = 0x40u;
-            audio_feed_data[1] = 0x06u;
-            audio_feed_data[2] = 0x0Bu;
-            break;
-          default:
-            break;
+        denominator = (uint64_t) audio_feed_timer_hz * audio_feed_window_frames;
+        numerator   = (((uint64_t) (ticks - audio_feed_window_ticks) << 14) * audio_feed_rate) +
+                      audio_feed_remainder;
+
+        audio_feed_measured  = (uint32_t) (numerator / denominator);
+        audio_feed_remainder = numerator - ((uint64_t) audio_feed_measured * denominator);
+
+        /* Discard windows disturbed by a clock change */
+        if ((audio_feed_measured > (audio_feed_nominal + AUDIO_FEED_MAX_DEVIATION)) ||
+            (audio_feed_measured < (audio_feed_nominal - AUDIO_FEED_MAX_DEVIATION)))
+        {
+            audio_feed_measured  = audio_feed_nominal;
+            audio_feed_remainder = 0;
+        }
+
+        audio_feed_window_ticks  = ticks;
+        audio_feed_window_frames = 0;
     }
+
+    return audio_feed_measured;
 }
+#endif
 
 /*******************************************************************************
 * Function Name: audio_feed_endpoint_callback
 ********************************************************************************
 * Summary:
 *   Audio feedback endpoint callback implementation. It updates the sample rate
-*   based on the status of the internal I2S buffer.
+*   based on the fill level of the audio OUT jitter buffer, through the PI
+*   controller.
 *
 *******************************************************************************/
 void audio_feed_endpoint_callback(USBFS_Type *base, cy_stc_usbfs_dev_drv_context_t *context)
 {
-    uint32_t i2s_count;
+#if (AUDIO_FEED_MODE == AUDIO_FEED_MODE_MEASURED)
+    /* Timestamp the SOF before anything else */
+    uint32_t ticks = cyhal_timer_read(&audio_feed_timer);
+    uint32_t measured_sample_rate;
+#else
+    uint32_t out_level;
+#endif
     uint32_t feedback_sample_rate;
     uint8_t  feedback_data[AUDIO_FEEDBACK_ENDPOINT_SIZE];
     cy_stc_usb_dev_context_t *devContext = Cy_USBFS_Dev_Drv_GetDevContext(base, context);
 
+#if (AUDIO_FEED_MODE == AUDIO_FEED_MODE_MEASURED)
+    /* Keep measuring on every SOF, so the window never spans a gap */
+    measured_sample_rate = audio_feed_measure(base, ticks);
+#endif
+
     /* Only process if the enable feedback flag is set */
     if (usb_comm_enable_feedback == true)
     {
-        /* Get the number of bytes in the I2S TX FIFO */
-        i2s_count = Cy_I2S_GetNumInTxFifo(i2s.base);
+    #if (AUDIO_FEED_MODE == AUDIO_FEED_MODE_MEASURED)
+        feedback_sample_rate = measured_sample_rate;
+    #else
+        /* Get the number of words queued for the I2S TX */
+        out_level = audio_out_get_level();
 
-        /* Extract the current sample rate */
-        feedback_sample_rate = (((uint32_t) audio_feed_data[2]) << 16) |
-                               (((uint32_t) audio_feed_data[1]) << 8)  |
-                               (((uint32_t) audio_feed_data[0]) << 0);
+        feedback_sample_rate = audio_feed_nominal;
 
-        /* Check the current I2S TX FIFO count to slightly change the sample
-           rate if necessary */
-        if (i2s_count < (AUDIO_FRAME_DATA_SIZE - 1))
+        /* Only track the fill level while the jitter buffer is drained */
+        if (audio_out_is_playing == true)
         {
-            feedback_sample_rate += AUDIO_FEED_SINGLE_SAMPLE;
+            feedback_sample_rate += (uint32_t) audio_feed_control(out_level);
         }
-        else if (i2s_count > (AUDIO_FRAME_DATA_SIZE + 1))
+        else
         {
-            feedback_sample_rate -= AUDIO_FEED_SINGLE_SAMPLE;
+            audio_feed_reset();
         }
+    #endif
 
         /* Update the feedback data */
         feedback_data[2] = (uint8_t) (feedback_sample_rate >> 16);
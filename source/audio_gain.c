@@ -0,0 +1,279 @@
+/*******************************************************************************
+* File Name: audio_gain.c
+*
+* Description: This file contains the software gain stage. The USB volume
+*  (1/256 dB) is mapped to a Q31 multiplier with two lookup tables, and each
+*  sample costs one 32x32 multiply. A gain change is ramped over one frame.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio_gain.h"
+
+/*******************************************************************************
+* Audio Gain Constants
+*******************************************************************************/
+/* The USB volume is in 1/256 dB, the tables resolve 1 dB and 1/16 dB */
+#define AUDIO_GAIN_DB_SHIFT         (8u)
+#define AUDIO_GAIN_FINE_SHIFT       (4u)
+#define AUDIO_GAIN_FINE_MASK        (0x0Fu)
+
+/* Mask of a 24-bit sample */
+#define AUDIO_GAIN_SAMPLE_MASK      (0x00FFFFFFu)
+
+/*******************************************************************************
+* Audio Gain Variables
+*******************************************************************************/
+/* Attenuation of 0 to 127 dB, in 1 dB steps, Q31 */
+const uint32_t audio_gain_coarse[AUDIO_GAIN_MIN_DB] =
+{
+    0x7FFFFFFFu, 0x721482C0u, 0x65AC8C2Fu, 0x5A9DF7ACu,
+    0x50C335D4u, 0x47FACCF0u, 0x4026E73Du, 0x392CED8Eu,
+    0x32F52CFFu, 0x2D6A866Fu, 0x287A26C5u, 0x241346F6u,
+    0x2026F310u, 0x1CA7D768u, 0x198A1357u, 0x16C310E3u,
+    0x144960C5u, 0x12149A60u, 0x101D3F2Eu, 0x0E5CA14Cu,
+    0x0CCCCCCDu, 0x0B68737Au, 0x0A2ADAD2u, 0x090FCBF8u,
+    0x08138562u, 0x0732AE18u, 0x066A4A53u, 0x05B7B15Bu,
+    0x05188480u, 0x048AA70Bu, 0x040C3714u, 0x039B8719u,
+    0x0337184Eu, 0x02DD958Au, 0x028DCEBCu, 0x0246B4E4u,
+    0x0207567Au, 0x01CEDC3Du, 0x019C8651u, 0x016FA9BBu,
+    0x0147AE14u, 0x01240B8Cu, 0x01044915u, 0x00E7FACCu,
+    0x00CEC08Au, 0x00B8449Cu, 0x00A43AA2u, 0x00925E89u,
+    0x008273A6u, 0x007443E8u, 0x00679F1Cu, 0x005C5A4Fu,
+    0x00524F3Bu, 0x00495BC1u, 0x00416179u, 0x003A454Au,
+    0x0033EF0Cu, 0x002E4939u, 0x002940A2u, 0x0024C42Cu,
+    0x0020C49Cu, 0x001D345Bu, 0x001A074Fu, 0x001732AEu,
+    0x0014ACDBu, 0x00126D43u, 0x00106C43u, 0x000EA30Eu,
+    0x000D0B91u, 0x000BA064u, 0x000A5CB6u, 0x00093C3Bu,
+    0x00083B20u, 0x000755FAu, 0x000689BFu, 0x0005D3BBu,
+    0x00053181u, 0x0004A0ECu, 0x00042010u, 0x0003AD38u,
+    0x000346DCu, 0x0002EBA3u, 0x00029A55u, 0x000251DEu,
+    0x00021149u, 0x0001D7BAu, 0x0001A46Du, 0x000176B5u,
+    0x00014DF5u, 0x000129A4u, 0x00010945u, 0x0000EC6Cu,
+    0x0000D2B6u, 0x0000BBCCu, 0x0000A760u, 0x0000952Cu,
+    0x000084F3u, 0x0000767Eu, 0x0000699Bu, 0x00005E1Fu,
+    0x000053E3u, 0x00004AC3u, 0x000042A2u, 0x00003B63u,
+    0x000034EEu, 0x00002F2Cu, 0x00002A0Bu, 0x00002578u,
+    0x00002165u, 0x00001DC4u, 0x00001A87u, 0x000017A4u,
+    0x00001512u, 0x000012C8u, 0x000010BDu, 0x00000EEBu,
+    0x00000D4Cu, 0x00000BD9u, 0x00000A90u, 0x0000096Au,
+    0x00000863u, 0x0000077Au, 0x000006AAu, 0x000005F0u,
+    0x0000054Bu, 0x000004B8u, 0x00000434u, 0x000003BFu
+};
+
+/* Attenuation of 0 to 15/16 dB, in 1/16 dB steps, Q31 */
+const uint32_t audio_gain_fine[AUDIO_GAIN_FINE_MASK + 1u] =
+{
+    0x7FFFFFFFu, 0x7F150FC2u, 0x7E2BCEBDu, 0x7D4439D8u,
+    0x7C5E4E02u, 0x7B7A082Fu, 0x7A976557u, 0x79B6627Bu,
+    0x78D6FC9Fu, 0x77F930CBu, 0x771CFC11u, 0x76425B85u,
+    0x75694C40u, 0x7491CB63u, 0x73BBD611u, 0x72E76976u
+};
+
+/*******************************************************************************
+* Function Name: audio_gain_init
+********************************************************************************
+* Summary:
+*   Initialize the gain stage at unity gain.
+*
+*******************************************************************************/
+void audio_gain_init(audio_gain_t *gain)
+{
+    for (uint32_t channel = 0; channel < AUDIO_GAIN_CHANNELS; channel++)
+    {
+        gain->target[channel]  = AUDIO_GAIN_UNITY;
+        gain->current[channel] = AUDIO_GAIN_UNITY;
+        gain->step[channel]    = 0;
+        gain->end[channel]     = AUDIO_GAIN_UNITY;
+    }
+
+    gain->ramp    = 0;
+    gain->channel = 0;
+}
+
+/*******************************************************************************
+* Function Name: audio_gain_from_volume
+********************************************************************************
+* Summary:
+*   Convert a USB volume to a Q31 gain. Positive volumes are limited to 0 dB,
+*   so the stage never clips.
+*
+* Parameters:
+*   volume: USB volume in 1/256 dB
+*   mute: true to silence the output
+*
+* Return:
+*   Gain in Q31.
+*
+*******************************************************************************/
+int32_t audio_gain_from_volume(int16_t volume, bool mute)
+{
+    uint32_t attenuation;
+
+    if (mute == true)
+    {
+        return 0;
+    }
+
+    if (volume >= 0)
+    {
+        return AUDIO_GAIN_UNITY;
+    }
+
+    attenuation = (uint32_t) (-(int32_t) volume);
+
+    if ((attenuation >> AUDIO_GAIN_DB_SHIFT) >= AUDIO_GAIN_MIN_DB)
+    {
+        return 0;
+    }
+
+    return (int32_t) (((uint64_t) audio_gain_coarse[attenuation >> AUDIO_GAIN_DB_SHIFT] *
+                       audio_gain_fine[(attenuation >> AUDIO_GAIN_FINE_SHIFT) & AUDIO_GAIN_FINE_MASK]) >> 31);
+}
+
+/*******************************************************************************
+* Function Name: audio_gain_set_target
+********************************************************************************
+* Summary:
+*   Request a new gain for one channel, reached over the next frame.
+*
+* Parameters:
+*   gain: gain stage
+*   channel: 0 for the left channel, 1 for the right channel
+*   target: gain in Q31
+*
+*******************************************************************************/
+void audio_gain_set_target(audio_gain_t *gain, uint32_t channel, int32_t target)
+{
+    gain->target[channel] = target;
+}
+
+/*******************************************************************************
+* Function Name: audio_gain_start_frame
+********************************************************************************
+* Summary:
+*   Start a frame, which begins with the left channel. If a target changed, a
+*   linear ramp from the current gains to the targets is spread over the
+*   samples of the frame.
+*
+* Parameters:
+*   gain: gain stage
+*   length: number of samples in the frame, all channels
+*
+*******************************************************************************/
+void audio_gain_start_frame(audio_gain_t *gain, uint32_t length)
+{
+    uint32_t frames = length / AUDIO_GAIN_CHANNELS;
+    bool changed = false;
+    int32_t target;
+
+    gain->channel = 0;
+
+    for (uint32_t channel = 0; channel < AUDIO_GAIN_CHANNELS; channel++)
+    {
+        target = gain->target[channel];
+
+        gain->step[channel] = 0;
+        gain->end[channel]  = target;
+
+        if ((target != gain->current[channel]) && (0u != frames))
+        {
+            gain->step[channel] = (target - gain->current[channel]) / (int32_t) frames;
+            changed = true;
+        }
+    }
+
+    if (changed == true)
+    {
+        gain->ramp = frames * AUDIO_GAIN_CHANNELS;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_gain_process
+********************************************************************************
+* Summary:
+*   Apply the gains in place. A frame can be processed in several blocks, a
+*   block may start with any channel. At unity gain the samples are left
+*   untouched; otherwise each sample costs one multiply, plus one add while
+*   ramping.
+*
+* Parameters:
+*   gain: gain stage
+*   samples: interleaved 24-bit samples in 32-bit words
+*   length: number of samples
+*
+*******************************************************************************/
+void audio_gain_process(audio_gain_t *gain, uint32_t *samples, uint32_t length)
+{
+    uint32_t channel = gain->channel;
+    uint32_t ramp = gain->ramp;
+    int32_t  current;
+    int32_t  sample;
+
+    if ((0u == ramp) &&
+        (AUDIO_GAIN_UNITY == gain->current[0]) &&
+        (AUDIO_GAIN_UNITY == gain->current[1]))
+    {
+        gain->channel = (channel + length) % AUDIO_GAIN_CHANNELS;
+        return;
+    }
+
+    while (0u != length)
+    {
+        current = gain->current[channel];
+
+        if (0u != ramp)
+        {
+            ramp--;
+
+            /* The last sample of each channel lands on the target */
+            current = (ramp < AUDIO_GAIN_CHANNELS) ? gain->end[channel] :
+                                                     (current + gain->step[channel]);
+            gain->current[channel] = current;
+        }
+
+        /* Sign extend the 24-bit sample to Q31, scale it, and round back to
+           24 bits */
+        sample = (int32_t) (*samples << 8);
+        sample = (int32_t) ((((int64_t) sample * current) + (1LL << 38)) >> 39);
+
+        *(samples++) = ((uint32_t) sample) & AUDIO_GAIN_SAMPLE_MASK;
+        length--;
+
+        channel = (channel + 1u) % AUDIO_GAIN_CHANNELS;
+    }
+
+    gain->channel = channel;
+    gain->ramp    = ramp;
+}
+
+/* [] END OF FILE */
@@ -39,6 +39,8 @@
 #include "audio_in.h"
 #include "audio_app.h"
 #include "audio.h"
+#include "audio_convert.h"
+#include "audio_src.h"
 #include "usb_comm.h"
 
 #include "cyhal.h"
@@ -57,7 +59,10 @@ void audio_in_endpoint_callback(USBFS_Type *base,
                                 uint32_t errorType, 
                                 cy_stc_usbfs_dev_drv_context_t *context);
 
-void convert_32_to_24_array(uint8_t *src, uint8_t *dst, uint32_t length);
+void audio_in_start_dma(void);
+void audio_in_stop_dma(void);
+uint32_t audio_in_dequeue(uint8_t *dst, uint32_t length, uint32_t subframe);
+uint32_t audio_in_dequeue_resampled(uint8_t *dst, uint32_t length, uint32_t subframe);
 
 /*******************************************************************************
 * Audio In Variables
@@ -65,15 +70,50 @@ void convert_32_to_24_array(uint8_t *src, uint8_t *dst, uint32_t length);
 /* USB IN buffer data for Audio IN endpoint */
 CY_USB_DEV_ALLOC_ENDPOINT_BUFFER(audio_in_usb_buffer, AUDIO_IN_ENDPOINT_SIZE + 1);
 
-/* PCM buffer data (32-bits) */
-uint8_t audio_in_pcm_buffer[4 * AUDIO_IN_ENDPOINT_SIZE/AUDIO_SAMPLE_DATA_SIZE];
+/* Capture buffer between the I2S RX and the Audio IN endpoint */
+uint32_t audio_in_buffer[AUDIO_IN_BUFFER_SIZE];
+audio_ring_t audio_in_ring;
+
+/* Ping-pong buffers filled by the DMA from the I2S RX FIFO */
+uint32_t audio_in_dma_buffer[2][AUDIO_IN_DMA_HALF_SIZE];
+
+/* Index of the ping-pong buffer being filled by the DMA */
+volatile uint32_t audio_in_dma_index = 0;
 
 /* Audio IN flags */
 volatile bool audio_in_is_recording    = false;
+volatile bool audio_in_is_capturing    = false;
+volatile bool audio_in_is_primed       = false;
 
-/* Size of the frame */
+/* Size of the frame, integer part of the samples per frame */
 volatile uint32_t audio_in_frame_size = AUDIO_FRAME_DATA_SIZE;
 
+/* Fractional part of the samples per frame, in 1/1000 of a stereo sample */
+volatile uint32_t audio_in_frame_fraction = 0;
+
+/* Accumulated fractional part, an extra sample is sent when it wraps */
+volatile uint32_t audio_in_frame_phase = 0;
+
+/* Fill level the capture buffer is kept around */
+volatile uint32_t audio_in_target = AUDIO_IN_BUFFER_TARGET(AUDIO_SAMPLING_RATE_48KHZ);
+
+/* Drift counters of the recording session */
+volatile audio_in_drift_t audio_in_drift;
+
+/* Converter from the I2S rate to the host rate of the IN endpoint */
+audio_src_t audio_in_src;
+
+/* Samples taken from the capture buffer, and the same samples at the host rate */
+uint32_t audio_in_src_in[AUDIO_SRC_BUFFER_SIZE];
+uint32_t audio_in_src_out[AUDIO_SRC_BUFFER_SIZE];
+
+/* Set when the host rate differs from the I2S rate */
+volatile bool audio_in_resample = false;
+
+/* Set while the frame pacing and the converter are reconfigured, the IN
+   endpoint then sends silence */
+volatile bool audio_in_is_holding = false;
+
 /*******************************************************************************
 * Function Name: audio_in_init
 ********************************************************************************
@@ -90,6 +130,8 @@ void audio_in_init(void)
                                               audio_in_endpoint_callback,
                                               &usb_drvContext);
 
+    audio_ring_init(&audio_in_ring, audio_in_buffer, AUDIO_IN_BUFFER_SIZE);
+
     /* Run the I2S RX all the time */
     cyhal_i2s_start_rx(&i2s);
 }
@@ -138,6 +180,8 @@ void audio_in_disable(void)
     }
 
     audio_in_is_recording = false;
+
+    audio_in_stop_dma();
 }
 
 /*******************************************************************************
@@ -162,21 +206,36 @@ void audio_in_process(void *arg)
 
         if (usb_comm_clock_configured)
         {
-            audio_in_is_recording = true;
-
             /* Clear Audio In buffer */
             memset(audio_in_usb_buffer, 0, AUDIO_IN_ENDPOINT_SIZE);
 
+            /* Restart the capture from an empty buffer */
+            audio_in_stop_dma();
+            audio_ring_flush(&audio_in_ring);
+            audio_in_is_primed = false;
+
+            if (audio_in_resample == true)
+            {
+                audio_src_reset(&audio_in_src);
+            }
+
+            /* Restart the frame pacing */
+            audio_in_frame_phase = 0;
+            memset((void *) &audio_in_drift, 0, sizeof(audio_in_drift));
+
+            audio_in_is_recording = true;
+
             /* Clear I2S RX FIFO */
             Cy_I2S_ClearRxFifo(i2s.base);
 
             /* Start I2S RX */
+            audio_in_start_dma();
             cyhal_i2s_start_rx(&i2s);
 
             /* Start a transfer to the Audio IN endpoint */
             Cy_USB_Dev_WriteEpNonBlocking(AUDIO_STREAMING_IN_ENDPOINT,
                                           (uint8_t *) audio_in_usb_buffer,
-                                          AUDIO_IN_ENDPOINT_SIZE,
+                                          audio_in_frame_size * usb_comm_in_subframe_size,
                                           &usb_devContext);
 
             xEventGroupClearBits(rtos_events, RTOS_EVENT_IN);
@@ -188,25 +247,221 @@ void audio_in_process(void *arg)
 * Function Name: audio_in_update_sample_rate
 ********************************************************************************
 * Summary:
-*   Updates the audio frame size based on the sample rate. The frame size is 
-*   number of bytes transmitted in 1ms time frame.
+*   Updates the audio frame size based on the sample rate. The frame size is
+*   number of samples transmitted in 1ms time frame. When the rate is not a
+*   multiple of 1 kHz, the fractional part is accumulated and an extra stereo
+*   sample is sent whenever it wraps, e.g. 9x44 + 1x45 stereo samples every
+*   10 ms at 44.1 kHz. The capture buffer target follows the I2S rate. The
+*   converter is configured when the host rate differs from the I2S rate, so
+*   capture can run at another rate than playback.
+*   The rate can change while the IN endpoint streams: the endpoint sends
+*   silence until the update completes, and the capture buffer is primed
+*   again at the new target.
 *
 * Parameters:
-*   sample_rate: sample rate to be enforced in Hz
+*   usb_rate: sample rate of the IN endpoint in Hz
+*   i2s_rate: sample rate of the I2S RX in Hz
 *
 *******************************************************************************/
-void audio_in_update_sample_rate(uint32_t sample_rate)
+void audio_in_update_sample_rate(uint32_t usb_rate, uint32_t i2s_rate)
 {
+    /* Keep the IN endpoint off the state below until it is consistent */
+    audio_in_is_holding = true;
+
     /* Frame Size is equal to sample rate (Hz) / 1000 * 2 (stereo) */
-    audio_in_frame_size = 2 * (sample_rate / 1000);
+    audio_in_frame_size     = AUDIO_IN_CHANNELS * (usb_rate / AUDIO_IN_FRAMES_PER_SEC);
+    audio_in_frame_fraction = usb_rate % AUDIO_IN_FRAMES_PER_SEC;
+    audio_in_frame_phase    = 0;
+
+    audio_in_target = AUDIO_IN_BUFFER_TARGET(i2s_rate);
+
+    audio_in_resample = false;
+
+    if (usb_rate != i2s_rate)
+    {
+        audio_in_resample = audio_src_init(&audio_in_src, i2s_rate, usb_rate);
+    }
+
+    audio_in_is_primed  = false;
+    audio_in_is_holding = false;
+}
+
+/*******************************************************************************
+* Function Name: audio_in_start_dma
+********************************************************************************
+* Summary:
+*   Hand the first ping-pong buffer to the DMA. The following buffers are
+*   chained from the I2S event handler.
+*
+*******************************************************************************/
+void audio_in_start_dma(void)
+{
+    audio_in_dma_index = 0;
+    audio_in_is_capturing = true;
+
+    cyhal_i2s_enable_event(&i2s, CYHAL_I2S_ASYNC_RX_COMPLETE, AUDIO_APP_I2S_PRIORITY, true);
+    cyhal_i2s_read_async(&i2s, audio_in_dma_buffer[0], AUDIO_IN_DMA_HALF_SIZE);
+}
+
+/*******************************************************************************
+* Function Name: audio_in_stop_dma
+********************************************************************************
+* Summary:
+*   Stop chaining the ping-pong buffers and abort the pending DMA transfer.
+*
+*******************************************************************************/
+void audio_in_stop_dma(void)
+{
+    audio_in_is_capturing = false;
+
+    cyhal_i2s_enable_event(&i2s, CYHAL_I2S_ASYNC_RX_COMPLETE, AUDIO_APP_I2S_PRIORITY, false);
+    cyhal_i2s_abort_read_async(&i2s);
+}
+
+/*******************************************************************************
+* Function Name: audio_in_i2s_event
+********************************************************************************
+* Summary:
+*   I2S RX event handler. The DMA is handed the next ping-pong buffer and the
+*   one just filled is pushed to the capture buffer while the DMA runs.
+*
+* Parameters:
+*   event: I2S events that triggered the interrupt
+*
+*******************************************************************************/
+void audio_in_i2s_event(cyhal_i2s_event_t event)
+{
+    if (audio_in_is_capturing == false)
+    {
+        return;
+    }
+
+    if (0u != (event & CYHAL_I2S_ASYNC_RX_COMPLETE))
+    {
+        uint32_t done_index = audio_in_dma_index;
+
+        /* Keep the DMA busy with the other buffer */
+        audio_in_dma_index = done_index ^ 1u;
+        cyhal_i2s_read_async(&i2s, audio_in_dma_buffer[audio_in_dma_index], AUDIO_IN_DMA_HALF_SIZE);
+
+        /* Push the buffer just filled, overruns are counted by the ring */
+        audio_ring_write(&audio_in_ring, audio_in_dma_buffer[done_index], AUDIO_IN_DMA_HALF_SIZE);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_in_dequeue
+********************************************************************************
+* Summary:
+*   Convert the capture buffer (32-bit) straight into the USB array (24-bit
+*   or 16-bit), with no intermediate copy. The frame is taken in two blocks
+*   when the capture buffer wraps around. Missing samples are accounted as
+*   underruns.
+*
+* Parameters:
+*   dst: USB array
+*   length: number of samples
+*   subframe: number of bytes per sample in the USB array
+*
+* Return:
+*   Number of samples actually converted.
+*
+*******************************************************************************/
+uint32_t audio_in_dequeue(uint8_t *dst, uint32_t length, uint32_t subframe)
+{
+    uint32_t *src;
+    uint32_t count;
+    uint32_t total = 0;
+
+    while (total < length)
+    {
+        count = length - total;
+        src = audio_ring_get_read_block(&audio_in_ring, &count);
+
+        if (0u == count)
+        {
+            audio_in_ring.underruns += (length - total);
+            break;
+        }
+
+        if (AUDIO_SAMPLE_DATA_SIZE_16BIT == subframe)
+        {
+            audio_convert_32_to_16(src, dst, count);
+        }
+        else
+        {
+            audio_convert_32_to_24(src, dst, count);
+        }
+        audio_ring_commit_read(&audio_in_ring, count);
+
+        dst   += count * subframe;
+        total += count;
+    }
+
+    return total;
+}
+
+/*******************************************************************************
+* Function Name: audio_in_dequeue_resampled
+********************************************************************************
+* Summary:
+*   Take from the capture buffer the samples needed to produce one frame at
+*   the host rate, resample them and convert them into the USB array (24-bit
+*   or 16-bit). Missing samples are replaced with silence and accounted as
+*   underruns.
+*
+* Parameters:
+*   dst: USB array
+*   length: number of samples
+*   subframe: number of bytes per sample in the USB array
+*
+* Return:
+*   Number of samples actually converted.
+*
+*******************************************************************************/
+uint32_t audio_in_dequeue_resampled(uint8_t *dst, uint32_t length, uint32_t subframe)
+{
+    uint32_t frames = length / AUDIO_SRC_CHANNELS;
+    uint32_t needed = AUDIO_SRC_CHANNELS * audio_src_get_input_frames(&audio_in_src, frames);
+    uint32_t read;
+
+    if (needed > AUDIO_SRC_BUFFER_SIZE)
+    {
+        needed = AUDIO_SRC_BUFFER_SIZE;
+    }
+
+    read = audio_ring_read(&audio_in_ring, audio_in_src_in, needed);
+    if (read < needed)
+    {
+        memset(&audio_in_src_in[read], 0, (needed - read) * sizeof(uint32_t));
+    }
+
+    frames = audio_src_process(&audio_in_src,
+                               audio_in_src_in, needed / AUDIO_SRC_CHANNELS,
+                               audio_in_src_out, frames);
+
+    if (AUDIO_SAMPLE_DATA_SIZE_16BIT == subframe)
+    {
+        audio_convert_32_to_16(audio_in_src_out, dst, frames * AUDIO_SRC_CHANNELS);
+    }
+    else
+    {
+        audio_convert_32_to_24(audio_in_src_out, dst, frames * AUDIO_SRC_CHANNELS);
+    }
+
+    return frames * AUDIO_SRC_CHANNELS;
 }
 
 /*******************************************************************************
 * Function Name: audio_in_endpoint_callback
 ********************************************************************************
 * Summary:
-*   Audio in endpoint callback implementation. It enables the Audio in DMA to
-*   stream an audio frame.
+*   Audio in endpoint callback implementation. It slices one audio frame from
+*   the capture buffer and streams it to the Audio IN endpoint. Silence is sent
+*   until the capture buffer reaches its target level. The frame is one sample
+*   longer or shorter when the level drifts away from the target, so the
+*   capture buffer tracks the difference between the I2S and USB clocks.
+*   Only silence is sent while the sample rate is updated.
 *
 *******************************************************************************/
 void audio_in_endpoint_callback(USBFS_Type *base, 
@@ -215,7 +470,10 @@ void audio_in_endpoint_callback(USBFS_Type *base,
                                 cy_stc_usbfs_dev_drv_context_t *context)
 {
     /* Set the count equal to the frame size */
-    size_t audio_in_count = audio_in_frame_size;
+    uint32_t audio_in_count = audio_in_frame_size;
+    uint32_t subframe = usb_comm_in_subframe_size;
+    uint32_t level;
+    uint32_t read;
 
     (void) errorType;
     (void) endpoint,
@@ -225,8 +483,59 @@ void audio_in_endpoint_callback(USBFS_Type *base,
     /* Check if should keep recording */
     if ((audio_in_is_recording == true) && (usb_comm_clock_configured == true))
     {
-        /* Read all the data in the I2S RX buffer */
-        cyhal_i2s_read(&i2s, (void *) audio_in_pcm_buffer, &audio_in_count);
+        if (audio_in_is_holding == true)
+        {
+            /* The sample rate is being updated, send a frame of silence at
+               the old or the new frame size, whichever was read */
+            memset(audio_in_usb_buffer, 0, audio_in_count * subframe);
+
+            Cy_USB_Dev_WriteEpNonBlocking(AUDIO_STREAMING_IN_ENDPOINT,
+                                          (uint8_t *) audio_in_usb_buffer,
+                                          audio_in_count*subframe,
+                                          &usb_devContext);
+            return;
+        }
+
+        /* Send the extra sample of the fractional rate when the phase wraps */
+        audio_in_frame_phase += audio_in_frame_fraction;
+        if (audio_in_frame_phase >= AUDIO_IN_FRAMES_PER_SEC)
+        {
+            audio_in_frame_phase -= AUDIO_IN_FRAMES_PER_SEC;
+            audio_in_count += AUDIO_IN_CHANNELS;
+            audio_in_drift.long_packets++;
+        }
+
+        audio_in_drift.packets++;
+
+        level = audio_ring_get_level(&audio_in_ring);
+
+        if (audio_in_is_primed == false)
+        {
+            if (level >= audio_in_target)
+            {
+                /* The capture ran past the target by up to one frame and one
+                   DMA buffer while silence was sent, drop the oldest words so
+                   the correction below does not take the excess as drift */
+                audio_ring_commit_read(&audio_in_ring, level - audio_in_target);
+
+                audio_in_is_primed = true;
+            }
+        }
+        else
+        {
+            /* The level moves in steps of one DMA buffer, so only correct
+               when it drifts further than that from the target */
+            if (level > (audio_in_target + AUDIO_IN_DMA_HALF_SIZE))
+            {
+                audio_in_count += AUDIO_IN_CHANNELS;
+                audio_in_drift.added++;
+            }
+            else if (level < (audio_in_target - AUDIO_IN_DMA_HALF_SIZE))
+            {
+                audio_in_count -= AUDIO_IN_CHANNELS;
+                audio_in_drift.removed++;
+            }
+        }
 
         /* Limit the size to avoid overflow in the internal buffer */
         if (audio_in_count > AUDIO_MAX_DATA_SIZE)
@@ -234,12 +543,32 @@ void audio_in_endpoint_callback(USBFS_Type *base,
             audio_in_count = AUDIO_MAX_DATA_SIZE;
         }
 
-        /* Convert the I2S data array (32-bit) to USB data array (24-bit) */
-        convert_32_to_24_array(audio_in_pcm_buffer, audio_in_usb_buffer, audio_in_count);
+        if (audio_in_is_primed == true)
+        {
+            if (audio_in_resample == true)
+            {
+                read = audio_in_dequeue_resampled(audio_in_usb_buffer, audio_in_count, subframe);
+            }
+            else
+            {
+                read = audio_in_dequeue(audio_in_usb_buffer, audio_in_count, subframe);
+            }
+        }
+        else
+        {
+            read = 0;
+        }
+
+        /* Pad with silence if the capture buffer ran short */
+        if (read < audio_in_count)
+        {
+            memset(&audio_in_usb_buffer[read * subframe], 0,
+                   (audio_in_count - read) * subframe);
+        }
 
         Cy_USB_Dev_WriteEpNonBlocking(AUDIO_STREAMING_IN_ENDPOINT,
                                       (uint8_t *) audio_in_usb_buffer,
-                                      audio_in_count*AUDIO_SAMPLE_DATA_SIZE,
+                                      audio_in_count*subframe,
                                       &usb_devContext);
     }
     else
@@ -248,22 +577,4 @@ void audio_in_endpoint_callback(USBFS_Type *base,
     }
 }
 
-/*******************************************************************************
-* Function Name: convert_32_to_24_array
-********************************************************************************
-* Summary:
-*   Convert a 32-bit array to 24-bit array.
-*
-*******************************************************************************/
-void convert_32_to_24_array(uint8_t *src, uint8_t *dst, uint32_t length)
-{
-    while (0u != length--)
-    {
-        *(dst++) = *src++;
-        *(dst++) = *src++;
-        *(dst++) = *src++;
-        src++;
-    }
-}
-
 /* [] END OF FILE */
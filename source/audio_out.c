@@ -39,6 +39,10 @@
 #include "audio_out.h"
 #include "audio_app.h"
 #include "audio.h"
+#include "audio_convert.h"
+#include "audio_src.h"
+#include "audio_gain.h"
+#include "audio_codec.h"
 #include "usb_comm.h"
 
 #include "cyhal.h"
@@ -49,6 +53,8 @@
 
 #include "cy_device_headers.h"
 
+#include <string.h>
+
 /*******************************************************************************
 * Local Functions
 *******************************************************************************/
@@ -57,7 +63,13 @@ void audio_out_endpoint_callback(USBFS_Type *base,
                                  uint32_t errorType,
                                  cy_stc_usbfs_dev_drv_context_t *context);
 
-void convert_24_to_32_array(uint8_t *src, uint8_t *dst, uint32_t length);
+void audio_out_queue(const uint8_t *src, uint32_t length, uint32_t subframe);
+#if (AUDIO_APP_FIXED_RATE == 1u)
+void audio_out_queue_resampled(const uint8_t *src, uint32_t length, uint32_t subframe);
+#endif
+void audio_out_start_i2s(void);
+void audio_out_fill_i2s(bool pad);
+void audio_out_fill_dma(uint32_t *dst);
 
 /*******************************************************************************
 * Audio Out Variables
@@ -65,8 +77,52 @@ void convert_24_to_32_array(uint8_t *src, uint8_t *dst, uint32_t length);
 /* USB OUT buffer data for Audio OUT endpoint */
 CY_USB_DEV_ALLOC_ENDPOINT_BUFFER(audio_out_usb_buffer, AUDIO_OUT_ENDPOINT_SIZE);
 
-/* PCM Intermediary buffer (32-bits) */
-uint8_t audio_out_to_i2s_tx[4 * AUDIO_OUT_ENDPOINT_SIZE/AUDIO_SAMPLE_DATA_SIZE];
+/* Jitter buffer between the OUT endpoint and the I2S TX */
+uint32_t     audio_out_buffer[AUDIO_OUT_BUFFER_SIZE];
+audio_ring_t audio_out_ring;
+
+#if (AUDIO_OUT_DMA_ENABLE == 1u)
+/* Ping-pong buffers moved by the DMA to the I2S TX FIFO */
+uint32_t audio_out_dma_buffer[2][AUDIO_OUT_DMA_HALF_SIZE];
+
+/* Index of the ping-pong buffer being moved by the DMA */
+volatile uint32_t audio_out_dma_index = 0;
+#else
+/* Silence used to pad the I2S TX FIFO on underruns */
+const uint32_t audio_out_silence[AUDIO_OUT_SILENCE_SIZE] = {0};
+#endif
+
+/* Audio OUT flags */
+volatile bool audio_out_is_playing = false;
+
+/* Fill level of the jitter buffer to reach before starting the I2S TX */
+volatile uint32_t audio_out_prime = AUDIO_OUT_BUFFER_PRIME(AUDIO_SAMPLING_RATE_48KHZ);
+
+#if (AUDIO_APP_FIXED_RATE == 1u)
+/* Converter from the host rate of the OUT endpoint to the I2S rate. The
+   I2S otherwise follows the playback rate, and the converter is not built */
+audio_src_t audio_out_src;
+
+/* Frame converted to 32-bit, and the same frame at the I2S rate */
+uint32_t audio_out_src_in[AUDIO_SRC_BUFFER_SIZE];
+uint32_t audio_out_src_out[AUDIO_SRC_BUFFER_SIZE];
+#endif
+
+/* Set when the host rate differs from the I2S rate */
+volatile bool audio_out_resample = false;
+
+/* Volume and mute applied to the frames queued, when the codec does not
+   apply them, and fades around sample rate switches */
+audio_gain_t audio_out_gain;
+
+/* Gain set by the volume and mute of each channel, Q31 */
+int32_t audio_out_volume[AUDIO_GAIN_CHANNELS] = {AUDIO_GAIN_UNITY, AUDIO_GAIN_UNITY};
+
+/* Set while the frames queued are faded out */
+bool audio_out_faded = false;
+
+/* Set while the host frames are discarded, during sample rate switches */
+volatile bool audio_out_hold = false;
 
 /*******************************************************************************
 * Function Name: audio_out_init
@@ -78,6 +134,11 @@ uint8_t audio_out_to_i2s_tx[4 * AUDIO_OUT_ENDPOINT_SIZE/AUDIO_SAMPLE_DATA_SIZE];
 *******************************************************************************/
 void audio_out_init(void)
 {
+    /* Initialize the jitter buffer */
+    audio_ring_init(&audio_out_ring, audio_out_buffer, AUDIO_OUT_BUFFER_SIZE);
+
+    audio_gain_init(&audio_out_gain);
+
     /* Register Data Endpoint Callbacks */
     Cy_USBFS_Dev_Drv_RegisterEndpointCallback(CYBSP_USBDEV_HW,
                                               AUDIO_STREAMING_OUT_ENDPOINT,
@@ -122,16 +183,204 @@ void audio_out_enable(void)
 *******************************************************************************/
 void audio_out_disable(void)
 {
-    /* Stop the I2S TX */
-    cyhal_i2s_stop_tx(&i2s);
+    /* Stop the I2S TX and discard any buffered frame */
+    audio_out_flush();
 
-#ifdef COMPONENT_AK4954A
-    /* If not audio IN streaming, stop RX as well */
-    if (false == usb_comm_enable_in_streaming)
+    /* If the RX only runs to clock the TX, stop it as well */
+    if ((true == audio_codec.is_tx_slave) && (false == usb_comm_enable_in_streaming))
     {
         cyhal_i2s_stop_rx(&i2s);
     }
+}
+
+/*******************************************************************************
+* Function Name: audio_out_flush
+********************************************************************************
+* Summary:
+*   Stop the I2S TX and discard the frames in the jitter buffer. The I2S TX is
+*   started again once the jitter buffer is primed with new frames.
+*
+*******************************************************************************/
+void audio_out_flush(void)
+{
+    audio_out_is_playing = false;
+
+    /* Stop draining the jitter buffer */
+#if (AUDIO_OUT_DMA_ENABLE == 1u)
+    cyhal_i2s_enable_event(&i2s, CYHAL_I2S_ASYNC_TX_COMPLETE, AUDIO_APP_I2S_PRIORITY, false);
+    cyhal_i2s_abort_write_async(&i2s);
+#else
+    cyhal_i2s_enable_event(&i2s, CYHAL_I2S_TX_HALF_EMPTY, AUDIO_APP_I2S_PRIORITY, false);
+#endif
+    cyhal_i2s_stop_tx(&i2s);
+
+    audio_ring_flush(&audio_out_ring);
+
+#if (AUDIO_APP_FIXED_RATE == 1u)
+    if (audio_out_resample == true)
+    {
+        audio_src_reset(&audio_out_src);
+    }
+#endif
+}
+
+/*******************************************************************************
+* Function Name: audio_out_update_sample_rate
+********************************************************************************
+* Summary:
+*   Updates the jitter buffer prime level based on the I2S rate, so the
+*   buffer holds the same time of audio at any rate. The converter is
+*   configured when the host rate differs from the I2S rate.
+*   The frames are queued unconverted while the converter is configured.
+*
+* Parameters:
+*   usb_rate: sample rate of the OUT endpoint in Hz
+*   i2s_rate: sample rate of the I2S TX in Hz
+*
+*******************************************************************************/
+void audio_out_update_sample_rate(uint32_t usb_rate, uint32_t i2s_rate)
+{
+    audio_out_prime = AUDIO_OUT_BUFFER_PRIME(i2s_rate);
+
+    audio_out_resample = false;
+
+#if (AUDIO_APP_FIXED_RATE == 1u)
+    if (usb_rate != i2s_rate)
+    {
+        audio_out_resample = audio_src_init(&audio_out_src, usb_rate, i2s_rate);
+    }
+#else
+    (void) usb_rate;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: audio_out_update_volume
+********************************************************************************
+* Summary:
+*   Updates the volume of one channel applied to the frames queued. The new
+*   gain is ramped in over the next frame. Only called by the codecs that do
+*   not apply the volume, the gain stays at unity otherwise.
+*
+* Parameters:
+*   channel: 0 for the left channel, 1 for the right channel
+*   volume: USB volume in 1/256 dB
+*   mute: true to silence the channel
+*
+*******************************************************************************/
+void audio_out_update_volume(uint32_t channel, int16_t volume, bool mute)
+{
+    audio_out_volume[channel] = audio_gain_from_volume(volume, mute);
+
+    if (audio_out_faded == false)
+    {
+        audio_gain_set_target(&audio_out_gain, channel, audio_out_volume[channel]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_out_fade
+********************************************************************************
+* Summary:
+*   Fades the frames queued out to silence, or back in to the volume. The
+*   gain is ramped over the next frame.
+*
+* Parameters:
+*   fade_out: true to fade out, false to fade in
+*
+*******************************************************************************/
+void audio_out_fade(bool fade_out)
+{
+    audio_out_faded = fade_out;
+
+    for (uint32_t channel = 0; channel < AUDIO_GAIN_CHANNELS; channel++)
+    {
+        audio_gain_set_target(&audio_out_gain, channel, fade_out ? 0 : audio_out_volume[channel]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_out_is_faded
+********************************************************************************
+* Summary:
+*   Return true once the fade out is complete: the frames queued from then on
+*   are silent.
+*
+*******************************************************************************/
+bool audio_out_is_faded(void)
+{
+    return (0u == audio_out_gain.ramp) &&
+           (0 == audio_out_gain.current[0]) && (0 == audio_out_gain.current[1]);
+}
+
+/*******************************************************************************
+* Function Name: audio_out_set_hold
+********************************************************************************
+* Summary:
+*   Discard the host frames, or queue them again. The frames are held while
+*   the converter and the clocks are reconfigured.
+*
+* Parameters:
+*   hold: true to discard the host frames
+*
+*******************************************************************************/
+void audio_out_set_hold(bool hold)
+{
+    audio_out_hold = hold;
+}
+
+/*******************************************************************************
+* Function Name: audio_out_prime_silence
+********************************************************************************
+* Summary:
+*   Fill the jitter buffer with silence up to the prime level, so the I2S TX
+*   starts with the first host frame. Should be called with the frames held.
+*
+*******************************************************************************/
+void audio_out_prime_silence(void)
+{
+    uint32_t *block;
+    uint32_t  count;
+    uint32_t  level = audio_ring_get_level(&audio_out_ring);
+
+    while (level < audio_out_prime)
+    {
+        count = audio_out_prime - level;
+        block = audio_ring_get_write_block(&audio_out_ring, &count);
+
+        if (0u == count)
+        {
+            break;
+        }
+
+        memset(block, 0, count * sizeof(uint32_t));
+        audio_ring_commit_write(&audio_out_ring, count);
+
+        level += count;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_out_get_level
+********************************************************************************
+* Summary:
+*   Return the number of words queued for the I2S TX, including the jitter
+*   buffer, the ping-pong buffer waiting for the DMA and the I2S TX FIFO. The
+*   words of the buffer being moved by the DMA are not accounted.
+*
+*******************************************************************************/
+uint32_t audio_out_get_level(void)
+{
+    uint32_t level = audio_ring_get_level(&audio_out_ring) + Cy_I2S_GetNumInTxFifo(i2s.base);
+
+#if (AUDIO_OUT_DMA_ENABLE == 1u)
+    if (audio_out_is_playing == true)
+    {
+        level += AUDIO_OUT_DMA_HALF_SIZE;
+    }
 #endif
+
+    return level;
 }
 
 /*******************************************************************************
@@ -160,12 +409,11 @@ void audio_out_process(void *arg)
             /* Start I2S Tx */
             Cy_I2S_ClearTxFifo(i2s.base);
 
-    #ifdef COMPONENT_AK4954A
-            if (usb_comm_enable_in_streaming == false)
+            /* Start the RX as well if it clocks the TX */
+            if ((audio_codec.is_tx_slave == true) && (usb_comm_enable_in_streaming == false))
             {
                 cyhal_i2s_start_rx(&i2s);
             }
-    #endif
 
             /* Arm the USB to receive data from host */
             Cy_USB_Dev_StartReadEp(AUDIO_STREAMING_OUT_ENDPOINT, &usb_devContext);
@@ -180,8 +428,8 @@ void audio_out_process(void *arg)
 * Function Name: audio_out_endpoint_callback
 ********************************************************************************
 * Summary:
-*   Audio OUT endpoint callback implementation. It enables the Audio OUT DMA to
-*   stream an audio frame.
+*   Audio OUT endpoint callback implementation. It stores the audio frame in
+*   the jitter buffer and starts the I2S TX once the buffer is primed.
 *
 *******************************************************************************/
 void audio_out_endpoint_callback(USBFS_Type *base,
@@ -191,6 +439,7 @@ void audio_out_endpoint_callback(USBFS_Type *base,
 {
     uint32_t count;
     uint32_t data_to_write;
+    uint32_t subframe = usb_comm_out_subframe_size;
 
     (void) errorType;
     (void) endpoint,
@@ -205,38 +454,265 @@ void audio_out_endpoint_callback(USBFS_Type *base,
                                      audio_out_usb_buffer, AUDIO_OUT_ENDPOINT_SIZE,
                                      &count, &usb_devContext);
 
-        data_to_write = count / AUDIO_SAMPLE_DATA_SIZE;
+        /* Discard the frame while the sample rate switches */
+        if (audio_out_hold == true)
+        {
+            return;
+        }
+
+        data_to_write = count / subframe;
+
+        audio_gain_start_frame(&audio_out_gain, data_to_write);
+
+        /* Queue the frame, the I2S TX event drains it */
+#if (AUDIO_APP_FIXED_RATE == 1u)
+        if (audio_out_resample == true)
+        {
+            audio_out_queue_resampled(audio_out_usb_buffer, data_to_write, subframe);
+        }
+        else
+#endif
+        {
+            audio_out_queue(audio_out_usb_buffer, data_to_write, subframe);
+        }
+
+        /* Start the I2S TX once the jitter buffer is primed */
+        if ((audio_out_is_playing == false) &&
+            (audio_ring_get_level(&audio_out_ring) >= audio_out_prime))
+        {
+            audio_out_start_i2s();
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_out_queue
+********************************************************************************
+* Summary:
+*   Convert the USB array (24-bit or 16-bit) straight into the jitter buffer
+*   (32-bit), with no intermediate copy, applying the software volume. The
+*   frame is split in two blocks when the jitter buffer wraps around. Samples
+*   that do not fit are dropped and accounted as overruns.
+*
+* Parameters:
+*   src: USB array
+*   length: number of samples
+*   subframe: number of bytes per sample in the USB array
+*
+*******************************************************************************/
+void audio_out_queue(const uint8_t *src, uint32_t length, uint32_t subframe)
+{
+    uint32_t *dst;
+    uint32_t count;
 
-        /* Convert USB array (24-bit) to I2S array (32-bit) */
-        convert_24_to_32_array(audio_out_usb_buffer, audio_out_to_i2s_tx, data_to_write);
+    while (0u != length)
+    {
+        count = length;
+        dst = audio_ring_get_write_block(&audio_out_ring, &count);
 
-        /* Write data to I2S Tx */
-        cyhal_i2s_write(&i2s, audio_out_to_i2s_tx, (size_t *) &data_to_write);
+        if (0u == count)
+        {
+            audio_out_ring.overruns += length;
+            break;
+        }
 
-        /* Start the I2S TX if disabled */
-        if ((Cy_I2S_GetCurrentState(i2s.base) & CY_I2S_TX_START) == 0)
+        if (AUDIO_SAMPLE_DATA_SIZE_16BIT == subframe)
+        {
+            audio_convert_16_to_32(src, dst, count);
+        }
+        else
         {
-            cyhal_i2s_start_tx(&i2s);
+            audio_convert_24_to_32(src, dst, count);
         }
+        audio_gain_process(&audio_out_gain, dst, count);
+        audio_ring_commit_write(&audio_out_ring, count);
+
+        src    += count * subframe;
+        length -= count;
     }
 }
 
+#if (AUDIO_APP_FIXED_RATE == 1u)
 /*******************************************************************************
-* Function Name: convert_24_to_32_array
+* Function Name: audio_out_queue_resampled
 ********************************************************************************
 * Summary:
-*   Convert a 24-bit array to 32-bit array.
+*   Convert the USB array (24-bit or 16-bit) to 32-bit, resample it to the I2S
+*   rate and store it in the jitter buffer. Samples that do not fit in the
+*   converter buffers or in the jitter buffer are dropped and accounted as
+*   overruns of the jitter buffer.
+*
+* Parameters:
+*   src: USB array
+*   length: number of samples
+*   subframe: number of bytes per sample in the USB array
 *
 *******************************************************************************/
-void convert_24_to_32_array(uint8_t *src, uint8_t *dst, uint32_t length)
+void audio_out_queue_resampled(const uint8_t *src, uint32_t length, uint32_t subframe)
 {
-    while (0u != length--)
+    uint32_t frames;
+
+    /* A 16-bit packet can be larger than a frame at the highest rate */
+    if (length > AUDIO_SRC_BUFFER_SIZE)
+    {
+        audio_out_ring.overruns += (length - AUDIO_SRC_BUFFER_SIZE);
+        length = AUDIO_SRC_BUFFER_SIZE;
+    }
+
+    if (AUDIO_SAMPLE_DATA_SIZE_16BIT == subframe)
+    {
+        audio_convert_16_to_32(src, audio_out_src_in, length);
+    }
+    else
     {
-        *(dst++) = *(src++);
-        *(dst++) = *(src++);
-        *(dst++) = *(src++);
-        *(dst++) = 0;
+        audio_convert_24_to_32(src, audio_out_src_in, length);
     }
+
+    audio_gain_process(&audio_out_gain, audio_out_src_in, length);
+
+    frames = audio_src_process(&audio_out_src,
+                               audio_out_src_in, length / AUDIO_SRC_CHANNELS,
+                               audio_out_src_out, AUDIO_SRC_BUFFER_SIZE / AUDIO_SRC_CHANNELS);
+
+    audio_ring_write(&audio_out_ring, audio_out_src_out, frames * AUDIO_SRC_CHANNELS);
 }
+#endif
+
+/*******************************************************************************
+* Function Name: audio_out_start_i2s
+********************************************************************************
+* Summary:
+*   Start draining the jitter buffer and start the I2S TX.
+*
+*******************************************************************************/
+void audio_out_start_i2s(void)
+{
+#if (AUDIO_OUT_DMA_ENABLE == 1u)
+    /* Fill both ping-pong buffers and hand the first one to the DMA */
+    audio_out_fill_dma(audio_out_dma_buffer[0]);
+    audio_out_fill_dma(audio_out_dma_buffer[1]);
+    audio_out_dma_index = 0;
+
+    audio_out_is_playing = true;
+
+    cyhal_i2s_enable_event(&i2s, CYHAL_I2S_ASYNC_TX_COMPLETE, AUDIO_APP_I2S_PRIORITY, true);
+    cyhal_i2s_write_async(&i2s, audio_out_dma_buffer[0], AUDIO_OUT_DMA_HALF_SIZE);
+#else
+    /* Fill the I2S TX FIFO before starting */
+    audio_out_fill_i2s(false);
+
+    audio_out_is_playing = true;
+
+    cyhal_i2s_enable_event(&i2s, CYHAL_I2S_TX_HALF_EMPTY, AUDIO_APP_I2S_PRIORITY, true);
+#endif
+
+    cyhal_i2s_start_tx(&i2s);
+}
+
+/*******************************************************************************
+* Function Name: audio_out_i2s_event
+********************************************************************************
+* Summary:
+*   I2S TX event handler. Drains the jitter buffer into the I2S TX FIFO. In DMA
+*   mode, the DMA is handed the next ping-pong buffer and the one just moved to
+*   the FIFO is refilled while the DMA runs.
+*
+* Parameters:
+*   event: I2S events that triggered the interrupt
+*
+*******************************************************************************/
+void audio_out_i2s_event(cyhal_i2s_event_t event)
+{
+    if (audio_out_is_playing == false)
+    {
+        return;
+    }
+
+#if (AUDIO_OUT_DMA_ENABLE == 1u)
+    if (0u != (event & CYHAL_I2S_ASYNC_TX_COMPLETE))
+    {
+        uint32_t done_index = audio_out_dma_index;
+
+        /* Keep the DMA busy with the other buffer */
+        audio_out_dma_index = done_index ^ 1u;
+        cyhal_i2s_write_async(&i2s, audio_out_dma_buffer[audio_out_dma_index], AUDIO_OUT_DMA_HALF_SIZE);
+
+        /* Refill the buffer just moved */
+        audio_out_fill_dma(audio_out_dma_buffer[done_index]);
+    }
+#else
+    if (0u != (event & CYHAL_I2S_TX_HALF_EMPTY))
+    {
+        audio_out_fill_i2s(true);
+    }
+#endif
+}
+
+#if (AUDIO_OUT_DMA_ENABLE == 1u)
+/*******************************************************************************
+* Function Name: audio_out_fill_dma
+********************************************************************************
+* Summary:
+*   Fill a ping-pong buffer from the jitter buffer. If the jitter buffer runs
+*   dry, the rest is filled with silence (accounted as underruns by the ring).
+*
+* Parameters:
+*   dst: ping-pong buffer to be filled
+*
+*******************************************************************************/
+void audio_out_fill_dma(uint32_t *dst)
+{
+    uint32_t count = audio_ring_read(&audio_out_ring, dst, AUDIO_OUT_DMA_HALF_SIZE);
+
+    if (count < AUDIO_OUT_DMA_HALF_SIZE)
+    {
+        memset(&dst[count], 0, (AUDIO_OUT_DMA_HALF_SIZE - count) * sizeof(uint32_t));
+    }
+}
+#else
+
+/*******************************************************************************
+* Function Name: audio_out_fill_i2s
+********************************************************************************
+* Summary:
+*   Move words from the jitter buffer to the I2S TX FIFO till the FIFO is full
+*   or the jitter buffer is empty.
+*
+* Parameters:
+*   pad: if true, fill the rest of the FIFO with silence when the jitter buffer
+*        runs dry, and account the silence words as underruns.
+*
+*******************************************************************************/
+void audio_out_fill_i2s(bool pad)
+{
+    uint32_t *block;
+    uint32_t  count;
+    size_t    written;
+
+    do
+    {
+        count = AUDIO_OUT_BUFFER_SIZE;
+        block = audio_ring_get_read_block(&audio_out_ring, &count);
+
+        /* The I2S driver only writes what fits in the FIFO */
+        written = count;
+        cyhal_i2s_write(&i2s, block, &written);
+
+        audio_ring_commit_read(&audio_out_ring, written);
+    } while ((0u != count) && (written == count));
+
+    /* Check if the jitter buffer ran dry */
+    if ((0u == count) && pad)
+    {
+        do
+        {
+            written = AUDIO_OUT_SILENCE_SIZE;
+            cyhal_i2s_write(&i2s, audio_out_silence, &written);
+
+            audio_out_ring.underruns += written;
+        } while (written == AUDIO_OUT_SILENCE_SIZE);
+    }
+}
+#endif
 
 /* [] END OF FILE */
@@ -0,0 +1,321 @@
+/*******************************************************************************
+* File Name: audio_ring.c
+*
+* Description: This file contains the implementation of the
+*  single-producer/single-consumer PCM ring buffer.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+
+#include "audio_ring.h"
+
+#include "cy_device_headers.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Function Name: audio_ring_init
+********************************************************************************
+* Summary:
+*   Initialize a ring with the given storage. One word of the storage is kept
+*   free to tell a full ring from an empty one.
+*
+* Parameters:
+*   ring: ring to be initialized
+*   buffer: storage for the PCM words
+*   size: number of words in the storage
+*
+*******************************************************************************/
+void audio_ring_init(audio_ring_t *ring, uint32_t *buffer, uint32_t size)
+{
+    ring->buffer    = buffer;
+    ring->size      = size;
+    ring->write_idx = 0;
+    ring->read_idx  = 0;
+    ring->overruns  = 0;
+    ring->underruns = 0;
+}
+
+/*******************************************************************************
+* Function Name: audio_ring_flush
+********************************************************************************
+* Summary:
+*   Discard all the words in the ring. Must be called from the consumer side or
+*   while the consumer is stopped.
+*
+*******************************************************************************/
+void audio_ring_flush(audio_ring_t *ring)
+{
+    ring->read_idx = ring->write_idx;
+}
+
+/*******************************************************************************
+* Function Name: audio_ring_get_level
+********************************************************************************
+* Summary:
+*   Return the number of words available to be read.
+*
+*******************************************************************************/
+uint32_t audio_ring_get_level(audio_ring_t *ring)
+{
+    uint32_t write_idx = ring->write_idx;
+    uint32_t read_idx  = ring->read_idx;
+
+    if (write_idx >= read_idx)
+    {
+        return (write_idx - read_idx);
+    }
+
+    return (ring->size - read_idx + write_idx);
+}
+
+/*******************************************************************************
+* Function Name: audio_ring_get_space
+********************************************************************************
+* Summary:
+*   Return the number of words that can be written without overrunning.
+*
+*******************************************************************************/
+uint32_t audio_ring_get_space(audio_ring_t *ring)
+{
+    return (ring->size - 1u - audio_ring_get_level(ring));
+}
+
+/*******************************************************************************
+* Function Name: audio_ring_write
+********************************************************************************
+* Summary:
+*   Producer side. Copy words into the ring. Words that do not fit are dropped
+*   and accounted as overruns.
+*
+* Parameters:
+*   ring: ring to be written
+*   src: words to be copied
+*   length: number of words to be copied
+*
+* Return:
+*   Number of words actually written.
+*
+*******************************************************************************/
+uint32_t audio_ring_write(audio_ring_t *ring, const uint32_t *src, uint32_t length)
+{
+    uint32_t space = audio_ring_get_space(ring);
+    uint32_t write_idx = ring->write_idx;
+    uint32_t chunk;
+
+    if (length > space)
+    {
+        ring->overruns += (length - space);
+        length = space;
+    }
+
+    /* Copy up to the end of the storage, then wrap around */
+    chunk = ring->size - write_idx;
+    if (chunk > length)
+    {
+        chunk = length;
+    }
+
+    memcpy(&ring->buffer[write_idx], src, chunk * sizeof(uint32_t));
+    memcpy(ring->buffer, &src[chunk], (length - chunk) * sizeof(uint32_t));
+
+    write_idx += length;
+    if (write_idx >= ring->size)
+    {
+        write_idx -= ring->size;
+    }
+
+    /* Make sure the data is in memory before publishing the new index */
+    __DMB();
+    ring->write_idx = write_idx;
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: audio_ring_read
+********************************************************************************
+* Summary:
+*   Consumer side. Copy words out of the ring. If not enough words are
+*   available, the missing words are accounted as underruns.
+*
+* Parameters:
+*   ring: ring to be read
+*   dst: destination of the words
+*   length: number of words to be read
+*
+* Return:
+*   Number of words actually read.
+*
+*******************************************************************************/
+uint32_t audio_ring_read(audio_ring_t *ring, uint32_t *dst, uint32_t length)
+{
+    uint32_t *block;
+    uint32_t count;
+    uint32_t total = 0;
+
+    while (total < length)
+    {
+        count = length - total;
+        block = audio_ring_get_read_block(ring, &count);
+
+        if (0u == count)
+        {
+            ring->underruns += (length - total);
+            break;
+        }
+
+        memcpy(&dst[total], block, count * sizeof(uint32_t));
+        audio_ring_commit_read(ring, count);
+
+        total += count;
+    }
+
+    return total;
+}
+
+/*******************************************************************************
+* Function Name: audio_ring_get_write_block
+********************************************************************************
+* Summary:
+*   Producer side. Return the largest contiguous block of free words that can
+*   be written in place. Call audio_ring_commit_write() once the words are
+*   written.
+*
+* Parameters:
+*   ring: ring to be written
+*   length: in - maximum number of words, out - words in the block
+*
+* Return:
+*   Pointer to the first word of the block.
+*
+*******************************************************************************/
+uint32_t *audio_ring_get_write_block(audio_ring_t *ring, uint32_t *length)
+{
+    uint32_t write_idx = ring->write_idx;
+    uint32_t count = audio_ring_get_space(ring);
+
+    /* Stop at the end of the storage */
+    if (count > (ring->size - write_idx))
+    {
+        count = ring->size - write_idx;
+    }
+
+    if (count < *length)
+    {
+        *length = count;
+    }
+
+    return &ring->buffer[write_idx];
+}
+
+/*******************************************************************************
+* Function Name: audio_ring_commit_write
+********************************************************************************
+* Summary:
+*   Producer side. Publish words previously written in a block obtained with
+*   audio_ring_get_write_block().
+*
+*******************************************************************************/
+void audio_ring_commit_write(audio_ring_t *ring, uint32_t length)
+{
+    uint32_t write_idx = ring->write_idx + length;
+
+    if (write_idx >= ring->size)
+    {
+        write_idx -= ring->size;
+    }
+
+    /* Make sure the data is in memory before publishing the new index */
+    __DMB();
+    ring->write_idx = write_idx;
+}
+
+/*******************************************************************************
+* Function Name: audio_ring_get_read_block
+********************************************************************************
+* Summary:
+*   Consumer side. Return the largest contiguous block of words that can be
+*   read in place. Call audio_ring_commit_read() once the words are consumed.
+*
+* Parameters:
+*   ring: ring to be read
+*   length: in - maximum number of words, out - words in the block
+*
+* Return:
+*   Pointer to the first word of the block.
+*
+*******************************************************************************/
+uint32_t *audio_ring_get_read_block(audio_ring_t *ring, uint32_t *length)
+{
+    uint32_t read_idx = ring->read_idx;
+    uint32_t count = audio_ring_get_level(ring);
+
+    /* Stop at the end of the storage */
+    if (count > (ring->size - read_idx))
+    {
+        count = ring->size - read_idx;
+    }
+
+    if (count < *length)
+    {
+        *length = count;
+    }
+
+    /* Make sure the data is read after the index */
+    __DMB();
+
+    return &ring->buffer[read_idx];
+}
+
+/*******************************************************************************
+* Function Name: audio_ring_commit_read
+********************************************************************************
+* Summary:
+*   Consumer side. Release words previously obtained with
+*   audio_ring_get_read_block().
+*
+*******************************************************************************/
+void audio_ring_commit_read(audio_ring_t *ring, uint32_t length)
+{
+    uint32_t read_idx = ring->read_idx + length;
+
+    if (read_idx >= ring->size)
+    {
+        read_idx -= ring->size;
+    }
+
+    __DMB();
+    ring->read_idx = read_idx;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,327 @@
+/*******************************************************************************
+* File Name: audio_src.c
+*
+* Description: This file contains the polyphase sample-rate converter. The
+*  rate ratio is reduced to L/M and the prototype low-pass filter is split in
+*  L branches of AUDIO_SRC_TAPS taps, so each output sample costs one short
+*  fixed-point dot product per channel. Integer decimation ratios use a
+*  single longer symmetric branch instead.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+
+#include "audio_src.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Audio SRC Constants
+*******************************************************************************/
+/* Coefficients are stored in Q15 */
+#define AUDIO_SRC_COEF_SHIFT        (15u)
+#define AUDIO_SRC_COEF_ONE          (1L << AUDIO_SRC_COEF_SHIFT)
+
+/* Limits of a 24-bit sample */
+#define AUDIO_SRC_SAMPLE_MAX        (0x007FFFFFL)
+#define AUDIO_SRC_SAMPLE_MIN        (-0x00800000L)
+#define AUDIO_SRC_SAMPLE_MASK       (0x00FFFFFFu)
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+uint32_t audio_src_gcd(uint32_t a, uint32_t b);
+void     audio_src_push(audio_src_t *src, const uint32_t *frame);
+uint32_t audio_src_filter(audio_src_t *src, uint32_t channel);
+uint32_t audio_src_decimate(audio_src_t *src, uint32_t channel);
+uint32_t audio_src_saturate(int64_t acc);
+
+/*******************************************************************************
+* Function Name: audio_src_init
+********************************************************************************
+* Summary:
+*   Configure the converter for a pair of rates: select the coefficient table
+*   of their reduced ratio and clear the history. No coefficient is computed,
+*   so it is cheap enough for the sample rate switch.
+*
+* Parameters:
+*   src: converter to be configured
+*   in_rate: input rate in Hz
+*   out_rate: output rate in Hz
+*
+* Return:
+*   false if there is no table for the ratio, the converter is then left
+*   unchanged.
+*
+*******************************************************************************/
+bool audio_src_init(audio_src_t *src, uint32_t in_rate, uint32_t out_rate)
+{
+    uint32_t gcd = audio_src_gcd(in_rate, out_rate);
+    uint32_t up = out_rate / gcd;
+    uint32_t down = in_rate / gcd;
+    uint32_t i;
+
+    for (i = 0; i < audio_src_ratios_number; i++)
+    {
+        if ((audio_src_ratios[i].up == up) && (audio_src_ratios[i].down == down))
+        {
+            src->up   = up;
+            src->down = down;
+            src->taps = audio_src_ratios[i].taps;
+            src->coef = audio_src_ratios[i].coef;
+
+            audio_src_reset(src);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: audio_src_reset
+********************************************************************************
+* Summary:
+*   Clear the history of the converter, keeping its configuration.
+*
+*******************************************************************************/
+void audio_src_reset(audio_src_t *src)
+{
+    memset(src->history, 0, sizeof(src->history));
+
+    src->pos   = 0;
+    src->phase = src->up;
+}
+
+/*******************************************************************************
+* Function Name: audio_src_get_input_frames
+********************************************************************************
+* Summary:
+*   Return the number of input frames audio_src_process() consumes to produce
+*   exactly the given number of output frames.
+*
+*******************************************************************************/
+uint32_t audio_src_get_input_frames(audio_src_t *src, uint32_t out_frames)
+{
+    uint32_t phase = src->phase;
+    uint32_t count = 0;
+
+    while (0u != out_frames)
+    {
+        if (phase >= src->up)
+        {
+            phase -= src->up;
+            count++;
+        }
+        else
+        {
+            phase += src->down;
+            out_frames--;
+        }
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: audio_src_process
+********************************************************************************
+* Summary:
+*   Convert interleaved frames. Stops when all the input frames are consumed
+*   or when the output is full; input frames beyond the output capacity are
+*   not consumed and should be accounted by the caller.
+*
+* Parameters:
+*   src: converter
+*   in: input frames
+*   in_frames: number of input frames
+*   out: output frames
+*   out_frames: capacity of the output, in frames
+*
+* Return:
+*   Number of output frames produced.
+*
+*******************************************************************************/
+uint32_t audio_src_process(audio_src_t *src, const uint32_t *in, uint32_t in_frames,
+                           uint32_t *out, uint32_t out_frames)
+{
+    uint32_t produced = 0;
+    uint32_t channel;
+
+    while (produced < out_frames)
+    {
+        if (src->phase >= src->up)
+        {
+            if (0u == in_frames)
+            {
+                break;
+            }
+
+            audio_src_push(src, in);
+            in += AUDIO_SRC_CHANNELS;
+            in_frames--;
+
+            src->phase -= src->up;
+        }
+        else
+        {
+            for (channel = 0; channel < AUDIO_SRC_CHANNELS; channel++)
+            {
+                *(out++) = (1u == src->up) ? audio_src_decimate(src, channel) :
+                                             audio_src_filter(src, channel);
+            }
+
+            src->phase += src->down;
+            produced++;
+        }
+    }
+
+    return produced;
+}
+
+/*******************************************************************************
+* Function Name: audio_src_gcd
+********************************************************************************
+* Summary:
+*   Greatest common divisor of two rates.
+*
+*******************************************************************************/
+uint32_t audio_src_gcd(uint32_t a, uint32_t b)
+{
+    uint32_t t;
+
+    while (0u != b)
+    {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+/*******************************************************************************
+* Function Name: audio_src_push
+********************************************************************************
+* Summary:
+*   Push one input frame in the history. The history is stored twice, so the
+*   last taps samples are always contiguous, newest first.
+*
+*******************************************************************************/
+void audio_src_push(audio_src_t *src, const uint32_t *frame)
+{
+    uint32_t channel;
+    int32_t  sample;
+
+    src->pos = (0u == src->pos) ? (src->taps - 1u) : (src->pos - 1u);
+
+    for (channel = 0; channel < AUDIO_SRC_CHANNELS; channel++)
+    {
+        /* Sign extend the 24-bit sample */
+        sample = ((int32_t) (frame[channel] << 8)) >> 8;
+
+        src->history[channel][src->pos] = sample;
+        src->history[channel][src->pos + src->taps] = sample;
+    }
+}
+
+/*******************************************************************************
+* Function Name: audio_src_filter
+********************************************************************************
+* Summary:
+*   Compute one output sample of a channel with the current branch.
+*
+*******************************************************************************/
+uint32_t audio_src_filter(audio_src_t *src, uint32_t channel)
+{
+    const int16_t *coef = &src->coef[src->phase * src->taps];
+    const int32_t *x = &src->history[channel][src->pos];
+    int64_t acc = 0;
+    uint32_t tap;
+
+    for (tap = 0; tap < src->taps; tap++)
+    {
+        acc += (int64_t) coef[tap] * x[tap];
+    }
+
+    return audio_src_saturate(acc);
+}
+
+/*******************************************************************************
+* Function Name: audio_src_decimate
+********************************************************************************
+* Summary:
+*   Compute one output sample of a channel with the single symmetric branch
+*   of an integer decimation. Samples at the same distance from the center
+*   are added first, so each coefficient is multiplied once.
+*
+*******************************************************************************/
+uint32_t audio_src_decimate(audio_src_t *src, uint32_t channel)
+{
+    const int16_t *coef = src->coef;
+    const int32_t *x = &src->history[channel][src->pos];
+    uint32_t last = src->taps - 1u;
+    int64_t acc = 0;
+    uint32_t tap;
+
+    for (tap = 0; tap < (src->taps / 2u); tap++)
+    {
+        acc += (int64_t) coef[tap] * ((int64_t) x[tap] + x[last - tap]);
+    }
+
+    return audio_src_saturate(acc);
+}
+
+/*******************************************************************************
+* Function Name: audio_src_saturate
+********************************************************************************
+* Summary:
+*   Round a Q15 accumulator to a 24-bit sample, with saturation.
+*
+*******************************************************************************/
+uint32_t audio_src_saturate(int64_t acc)
+{
+    int32_t y = (int32_t) ((acc + (AUDIO_SRC_COEF_ONE / 2)) >> AUDIO_SRC_COEF_SHIFT);
+
+    if (y > AUDIO_SRC_SAMPLE_MAX)
+    {
+        y = AUDIO_SRC_SAMPLE_MAX;
+    }
+    else if (y < AUDIO_SRC_SAMPLE_MIN)
+    {
+        y = AUDIO_SRC_SAMPLE_MIN;
+    }
+
+    return ((uint32_t) y) & AUDIO_SRC_SAMPLE_MASK;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,5533 @@
+/*******************************************************************************
+* File Name: audio_src_coef.c
+*
+* Description: Coefficients of the polyphase sample-rate converter, in Q15,
+*  for each rate ratio of the Audio OUT and Audio IN streams. The branches of
+*  a ratio are stored one after the other; the single branch of an integer
+*  decimation is symmetric and only its first half is stored.
+*  Generated by test/gen_audio_src_coef.c (make -C test coef), do not edit.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+
+#include "audio_src.h"
+
+/*******************************************************************************
+* Audio SRC Coefficients
+*******************************************************************************/
+/* 48 taps per branch: 44100 to 16000 Hz, 88200 to 32000 Hz */
+const int16_t audio_src_coef_160_441[7680] =
+{
+        0,    -1,    -2,     3,    14,    14,   -15,   -58,   -55,    38,   161,   154,
+      -76,  -371,  -370,   125,   772,   818,  -176, -1601, -1907,   220,  4510,  8867,
+    10704,  8846,  4480,   198, -1912, -1594,  -168,   821,   769,   121,  -371,  -370,
+      -74,   155,   160,    37,   -55,   -57,   -14,    14,    14,     3,    -2,    -1,
+        0,    -1,    -2,     3,    14,    14,   -15,   -58,   -54,    39,   161,   154,
+      -78,  -373,  -368,   129,   775,   815,  -185, -1608, -1902,   241,  4540,  8889,
+    10701,  8824,  4450,   177, -1917, -1586,  -159,   824,   766,   117,  -373,  -369,
+      -72,   156,   160,    36,   -55,   -57,   -14,    15,    14,     3,    -2,    -1,
+        0,    -1,    -2,     3,    14,    14,   -15,   -58,   -54,    40,   162,   153,
+      -80,  -374,  -367,   133,   778,   812,  -194, -1615, -1897,   263,  4570,  8910,
+    10701,  8802,  4420,   156, -1922, -1579,  -150,   827,   763,   112,  -374,  -367,
+      -70,   157,   159,    36,   -56,   -57,   -14,    15,    14,     3,    -2,    -1,
+        0,    -1,    -2,     3,    14,    14,   -15,   -58,   -54,    41,   163,   152,
+      -82,  -375,  -365,   138,   781,   809,  -203, -1622, -1892,   284,  4600,  8932,
+    10698,  8780,  4391,   135, -1926, -1572,  -141,   830,   760,   108,  -376,  -366,
+      -68,   157,   159,    35,   -56,   -57,   -14,    15,    14,     3,    -2,    -1,
+        0,    -1,    -2,     3,    14,    14,   -16,   -58,   -54,    41,   163,   151,
+      -84,  -377,  -363,   142,   784,   806,  -212, -1629, -1887,   306,  4630,  8953,
+    10700,  8758,  4361,   114, -1931, -1564,  -132,   832,   757,   104,  -377,  -365,
+      -66,   158,   158,    34,   -56,   -57,   -13,    15,    14,     3,    -2,    -1,
+        0,    -1,    -2,     3,    14,    14,   -16,   -59,   -53,    42,   164,   151,
+      -86,  -378,  -362,   146,   787,   803,  -221, -1636, -1881,   328,  4660,  8974,
+    10696,  8736,  4331,    93, -1935, -1557,  -124,   835,   754,   100,  -379,  -363,
+      -64,   159,   158,    33,   -56,   -56,   -13,    15,    14,     3,    -2,    -1,
+        0,    -1,    -2,     4,    14,    14,   -16,   -59,   -53,    43,   164,   150,
+      -88,  -379,  -360,   151,   790,   800,  -230, -1643, -1876,   350,  4689,  8995,
+    10696,  8713,  4301,    72, -1939, -1549,  -115,   838,   751,    96,  -380,  -362,
+      -62,   159,   157,    32,   -57,   -56,   -13,    15,    14,     3,    -2,    -1,
+        0,    -1,    -2,     4,    14,    14,   -16,   -59,   -53,    44,   165,   149,
+      -90,  -380,  -358,   155,   792,   796,  -239, -1650, -1870,   372,  4719,  9016,
+    10696,  8691,  4271,    51, -1943, -1542,  -106,   840,   748,    91,  -382,  -361,
+      -60,   160,   156,    32,   -57,   -56,   -12,    15,    14,     3,    -2,    -1,
+        0,    -1,    -2,     4,    14,    14,   -17,   -59,   -52,    45,   165,   148,
+      -92,  -381,  -357,   159,   795,   793,  -248, -1657, -1865,   394,  4749,  9037,
+    10697,  8668,  4241,    31, -1948, -1534,   -98,   843,   744,    87,  -383,  -359,
+      -58,   161,   156,    31,   -57,   -56,   -12,    15,    13,     3,    -2,    -1,
+        0,    -1,    -2,     4,    15,    14,   -17,   -59,   -52,    45,   166,   147,
+      -94,  -383,  -355,   163,   798,   790,  -257, -1664, -1859,   416,  4779,  9058,
+    10694,  8646,  4212,    10, -1952, -1526,   -89,   846,   741,    83,  -385,  -358,
+      -56,   161,   155,    30,   -57,   -55,   -12,    15,    13,     3,    -2,    -1,
+        0,    -1,    -2,     4,    15,    14,   -17,   -59,   -52,    46,   166,   146,
+      -96,  -384,  -353,   168,   801,   786,  -266, -1671, -1853,   438,  4809,  9079,
+    10692,  8623,  4182,   -10, -1955, -1519,   -80,   848,   738,    79,  -386,  -356,
+      -55,   162,   155,    29,   -58,   -55,   -12,    15,    13,     3,    -2,    -1,
+        0,    -1,    -2,     4,    15,    13,   -18,   -60,   -51,    47,   167,   146,
+      -98,  -385,  -351,   172,   803,   783,  -275, -1677, -1847,   461,  4839,  9099,
+    10690,  8600,  4152,   -31, -1959, -1511,   -72,   850,   735,    75,  -387,  -355,
+      -53,   163,   154,    29,   -58,   -55,   -11,    15,    13,     3,    -2,    -1,
+        0,    -1,    -2,     4,    15,    13,   -18,   -60,   -51,    48,   167,   145,
+     -100,  -386,  -349,   176,   806,   779,  -284, -1684, -1841,   483,  4869,  9120,
+    10691,  8577,  4122,   -51, -1963, -1503,   -63,   853,   731,    71,  -389,  -353,
+      -51,   163,   153,    28,   -58,   -55,   -11,    15,    13,     2,    -2,    -1,
+        0,    -1,    -2,     4,    15,    13,   -18,   -60,   -51,    49,   168,   144,
+     -102,  -387,  -347,   181,   809,   776,  -293, -1691, -1835,   506,  4899,  9140,
+    10687,  8554,  4093,   -71, -1966, -1496,   -55,   855,   728,    66,  -390,  -352,
+      -49,   164,   153,    27,   -58,   -55,   -11,    15,    13,     2,    -2,    -1,
+        0,    -1,    -2,     4,    15,    13,   -18,   -60,   -50,    50,   168,   143,
+     -104,  -389,  -346,   185,   811,   772,  -302, -1697, -1828,   528,  4929,  9160,
+    10685,  8531,  4063,   -91, -1970, -1488,   -46,   858,   725,    62,  -391,  -350,
+      -47,   165,   152,    26,   -59,   -54,   -11,    15,    13,     2,    -2,    -1,
+        0,    -1,    -2,     4,    15,    13,   -19,   -60,   -50,    50,   168,   142,
+     -106,  -390,  -344,   189,   814,   769,  -311, -1704, -1822,   551,  4958,  9180,
+    10684,  8508,  4033,  -111, -1973, -1480,   -38,   860,   722,    58,  -392,  -349,
+      -45,   165,   152,    25,   -59,   -54,   -10,    16,    13,     2,    -2,    -1,
+        0,    -1,    -2,     4,    15,    13,   -19,   -60,   -50,    51,   169,   141,
+     -108,  -391,  -342,   194,   817,   765,  -320, -1710, -1815,   574,  4988,  9200,
+    10679,  8485,  4003,  -131, -1977, -1472,   -29,   862,   718,    54,  -394,  -347,
+      -43,   166,   151,    25,   -59,   -54,   -10,    16,    13,     2,    -2,    -1,
+        0,    -1,    -2,     4,    15,    13,   -19,   -61,   -49,    52,   169,   140,
+     -110,  -392,  -340,   198,   819,   761,  -329, -1717, -1809,   597,  5018,  9220,
+    10680,  8461,  3974,  -151, -1980, -1464,   -21,   864,   715,    50,  -395,  -346,
+      -41,   166,   150,    24,   -59,   -54,   -10,    16,    13,     2,    -2,    -1,
+        0,    -1,    -1,     4,    15,    13,   -20,   -61,   -49,    53,   170,   139,
+     -112,  -393,  -338,   202,   822,   758,  -338, -1723, -1802,   620,  5048,  9240,
+    10673,  8438,  3944,  -170, -1983, -1456,   -13,   866,   711,    46,  -396,  -344,
+      -39,   167,   150,    23,   -60,   -53,   -10,    16,    13,     2,    -2,    -1,
+        0,    -1,    -1,     4,    15,    13,   -20,   -61,   -48,    54,   170,   138,
+     -114,  -394,  -336,   207,   824,   754,  -347, -1730, -1795,   643,  5078,  9259,
+    10671,  8414,  3914,  -190, -1986, -1448,    -4,   868,   708,    42,  -397,  -343,
+      -37,   167,   149,    22,   -60,   -53,    -9,    16,    13,     2,    -2,    -1,
+        0,    -1,    -1,     4,    15,    13,   -20,   -61,   -48,    54,   171,   138,
+     -116,  -395,  -334,   211,   827,   750,  -357, -1736, -1788,   666,  5108,  9279,
+    10665,  8391,  3885,  -209, -1989, -1440,     4,   870,   705,    38,  -398,  -341,
+      -36,   168,   148,    22,   -60,   -53,    -9,    16,    13,     2,    -2,    -1,
+        0,    -1,    -1,     4,    15,    12,   -20,   -61,   -48,    55,   171,   137,
+     -118,  -396,  -332,   215,   829,   746,  -366, -1742, -1781,   689,  5137,  9298,
+    10667,  8367,  3855,  -229, -1992, -1432,    12,   872,   701,    34,  -399,  -340,
+      -34,   169,   148,    21,   -60,   -53,    -9,    16,    13,     2,    -2,    -1,
+        0,    -1,    -1,     4,    15,    12,   -21,   -61,   -47,    56,   172,   136,
+     -120,  -397,  -330,   220,   831,   742,  -375, -1748, -1774,   712,  5167,  9318,
+    10661,  8343,  3826,  -248, -1994, -1424,    21,   874,   698,    30,  -401,  -338,
+      -32,   169,   147,    20,   -60,   -53,    -9,    16,    13,     2,    -2,    -1,
+        0,    -1,    -1,     5,    15,    12,   -21,   -62,   -47,    57,   172,   135,
+     -122,  -398,  -328,   224,   834,   738,  -384, -1754, -1767,   736,  5197,  9337,
+    10658,  8319,  3796,  -267, -1997, -1416,    29,   876,   694,    26,  -402,  -337,
+      -30,   170,   146,    19,   -61,   -52,    -8,    16,    12,     2,    -2,     0,
+        0,    -1,    -1,     5,    15,    12,   -21,   -62,   -47,    58,   172,   134,
+     -124,  -399,  -326,   229,   836,   734,  -393, -1760, -1760,   759,  5227,  9356,
+    10654,  8295,  3766,  -286, -1999, -1408,    37,   878,   691,    22,  -403,  -335,
+      -28,   170,   146,    18,   -61,   -52,    -8,    16,    12,     2,    -2,     0,
+        0,    -1,    -1,     5,    15,    12,   -21,   -62,   -46,    59,   173,   133,
+     -126,  -400,  -324,   233,   839,   730,  -403, -1766, -1752,   783,  5257,  9375,
+    10646,  8271,  3737,  -305, -2002, -1399,    46,   880,   687,    18,  -404,  -334,
+      -26,   171,   145,    18,   -61,   -52,    -8,    16,    12,     2,    -2,     0,
+        0,    -1,    -1,     5,    15,    12,   -22,   -62,   -46,    60,   173,   132,
+     -128,  -401,  -322,   237,   841,   726,  -412, -1772, -1745,   806,  5286,  9394,
+    10646,  8247,  3707,  -324, -2004, -1391,    54,   882,   683,    14,  -405,  -332,
+      -24,   171,   145,    17,   -61,   -52,    -8,    16,    12,     2,    -2,     0,
+        0,    -1,    -1,     5,    15,    12,   -22,   -62,   -45,    60,   174,   131,
+     -130,  -402,  -319,   242,   843,   722,  -421, -1778, -1737,   830,  5316,  9412,
+    10638,  8222,  3678,  -343, -2006, -1383,    62,   884,   680,    10,  -406,  -330,
+      -23,   172,   144,    16,   -61,   -51,    -7,    16,    12,     2,    -2,     0,
+        0,    -1,    -1,     5,    16,    12,   -22,   -62,   -45,    61,   174,   130,
+     -132,  -403,  -317,   246,   845,   718,  -430, -1784, -1729,   854,  5346,  9431,
+    10637,  8198,  3648,  -362, -2009, -1374,    70,   885,   676,     6,  -407,  -329,
+      -21,   172,   143,    15,   -62,   -51,    -7,    16,    12,     2,    -2,     0,
+        0,    -1,    -1,     5,    16,    12,   -23,   -62,   -45,    62,   174,   129,
+     -134,  -404,  -315,   250,   848,   714,  -440, -1790, -1721,   878,  5376,  9450,
+    10630,  8174,  3619,  -380, -2011, -1366,    78,   887,   673,     2,  -408,  -327,
+      -19,   173,   142,    15,   -62,   -51,    -7,    16,    12,     2,    -2,     0,
+        0,    -1,    -1,     5,    16,    11,   -23,   -63,   -44,    63,   175,   128,
+     -136,  -405,  -313,   255,   850,   710,  -449, -1796, -1713,   902,  5405,  9468,
+    10628,  8149,  3589,  -399, -2013, -1358,    86,   889,   669,    -2,  -409,  -325,
+      -17,   173,   142,    14,   -62,   -51,    -7,    16,    12,     2,    -2,     0,
+        0,    -1,    -1,     5,    16,    11,   -23,   -63,   -44,    64,   175,   127,
+     -138,  -406,  -311,   259,   852,   705,  -458, -1801, -1705,   926,  5435,  9486,
+    10624,  8124,  3560,  -417, -2015, -1349,    94,   890,   665,    -6,  -410,  -324,
+      -15,   173,   141,    13,   -62,   -50,    -6,    16,    12,     2,    -2,     0,
+        0,    -1,    -1,     5,    16,    11,   -23,   -63,   -43,    65,   175,   126,
+     -140,  -407,  -308,   264,   854,   701,  -468, -1807, -1697,   950,  5465,  9504,
+    10614,  8100,  3531,  -435, -2016, -1341,   102,   892,   662,   -10,  -410,  -322,
+      -13,   174,   140,    13,   -62,   -50,    -6,    16,    12,     1,    -2,     0,
+        0,    -1,    -1,     5,    16,    11,   -24,   -63,   -43,    65,   176,   125,
+     -142,  -407,  -306,   268,   856,   696,  -477, -1812, -1689,   974,  5494,  9522,
+    10616,  8075,  3501,  -454, -2018, -1333,   110,   893,   658,   -14,  -411,  -321,
+      -12,   174,   140,    12,   -62,   -50,    -6,    16,    12,     1,    -2,     0,
+        0,    -1,    -1,     5,    16,    11,   -24,   -63,   -43,    66,   176,   123,
+     -144,  -408,  -304,   272,   858,   692,  -486, -1818, -1680,   998,  5524,  9540,
+    10612,  8050,  3472,  -472, -2020, -1324,   118,   895,   654,   -18,  -412,  -319,
+      -10,   175,   139,    11,   -63,   -50,    -6,    16,    12,     1,    -2,     0,
+        0,    -1,    -1,     5,    16,    11,   -24,   -63,   -42,    67,   176,   122,
+     -146,  -409,  -302,   277,   860,   688,  -496, -1823, -1672,  1023,  5554,  9558,
+    10602,  8025,  3443,  -490, -2021, -1316,   126,   896,   651,   -21,  -413,  -317,
+       -8,   175,   138,    10,   -63,   -49,    -5,    16,    12,     1,    -2,     0,
+        0,    -1,    -1,     5,    16,    11,   -25,   -63,   -42,    68,   177,   121,
+     -148,  -410,  -299,   281,   862,   683,  -505, -1829, -1663,  1047,  5583,  9576,
+    10595,  8000,  3414,  -508, -2022, -1307,   134,   897,   647,   -25,  -414,  -316,
+       -6,   176,   138,    10,   -63,   -49,    -5,    17,    12,     1,    -2,     0,
+        0,    -1,    -1,     5,    16,    11,   -25,   -64,   -41,    69,   177,   120,
+     -150,  -411,  -297,   286,   864,   678,  -514, -1834, -1655,  1071,  5613,  9593,
+    10591,  7975,  3384,  -525, -2024, -1298,   142,   899,   643,   -29,  -415,  -314,
+       -4,   176,   137,     9,   -63,   -49,    -5,    17,    12,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,    10,   -25,   -64,   -41,    70,   177,   119,
+     -152,  -412,  -295,   290,   866,   674,  -524, -1839, -1646,  1096,  5642,  9610,
+    10589,  7950,  3355,  -543, -2025, -1290,   150,   900,   639,   -33,  -415,  -312,
+       -3,   176,   136,     8,   -63,   -49,    -5,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,    10,   -25,   -64,   -40,    70,   178,   118,
+     -154,  -412,  -292,   294,   868,   669,  -533, -1844, -1637,  1121,  5672,  9628,
+    10578,  7924,  3326,  -561, -2026, -1281,   158,   901,   636,   -37,  -416,  -310,
+       -1,   177,   135,     7,   -63,   -48,    -5,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,    10,   -26,   -64,   -40,    71,   178,   117,
+     -156,  -413,  -290,   299,   870,   664,  -543, -1850, -1628,  1145,  5701,  9645,
+    10577,  7899,  3297,  -578, -2027, -1273,   165,   902,   632,   -41,  -417,  -309,
+        1,   177,   135,     7,   -64,   -48,    -4,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,    10,   -26,   -64,   -39,    72,   178,   116,
+     -158,  -414,  -287,   303,   872,   660,  -552, -1855, -1619,  1170,  5731,  9662,
+    10569,  7873,  3268,  -596, -2028, -1264,   173,   903,   628,   -44,  -418,  -307,
+        3,   177,   134,     6,   -64,   -48,    -4,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,    10,   -26,   -64,   -39,    73,   179,   115,
+     -160,  -415,  -285,   308,   873,   655,  -561, -1860, -1609,  1195,  5760,  9679,
+    10560,  7848,  3239,  -613, -2029, -1255,   181,   905,   624,   -48,  -418,  -305,
+        4,   178,   133,     5,   -64,   -48,    -4,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,    10,   -27,   -64,   -39,    74,   179,   113,
+     -162,  -415,  -282,   312,   875,   650,  -571, -1865, -1600,  1220,  5790,  9695,
+    10555,  7822,  3210,  -630, -2030, -1246,   188,   906,   620,   -52,  -419,  -303,
+        6,   178,   133,     5,   -64,   -47,    -4,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,    10,   -27,   -64,   -38,    75,   179,   112,
+     -164,  -416,  -280,   316,   877,   645,  -580, -1869, -1591,  1245,  5819,  9712,
+    10548,  7797,  3181,  -647, -2030, -1238,   196,   907,   616,   -56,  -420,  -302,
+        8,   178,   132,     4,   -64,   -47,    -3,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,     9,   -27,   -64,   -38,    75,   179,   111,
+     -166,  -417,  -277,   321,   879,   640,  -590, -1874, -1581,  1270,  5849,  9729,
+    10539,  7771,  3152,  -664, -2031, -1229,   204,   908,   613,   -59,  -420,  -300,
+       10,   179,   131,     3,   -64,   -47,    -3,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,     9,   -28,   -65,   -37,    76,   180,   110,
+     -168,  -417,  -275,   325,   880,   635,  -599, -1879, -1571,  1295,  5878,  9745,
+    10536,  7745,  3123,  -681, -2031, -1220,   211,   908,   609,   -63,  -421,  -298,
+       11,   179,   130,     2,   -64,   -46,    -3,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,     9,   -28,   -65,   -37,    77,   180,   109,
+     -170,  -418,  -272,   330,   882,   630,  -608, -1884, -1562,  1321,  5907,  9761,
+    10527,  7719,  3094,  -698, -2032, -1211,   219,   909,   605,   -67,  -421,  -296,
+       13,   179,   130,     2,   -64,   -46,    -3,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,     9,   -28,   -65,   -36,    78,   180,   107,
+     -173,  -419,  -270,   334,   883,   625,  -618, -1888, -1552,  1346,  5936,  9777,
+    10523,  7693,  3065,  -714, -2032, -1202,   226,   910,   601,   -71,  -422,  -295,
+       15,   180,   129,     1,   -64,   -46,    -2,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,     9,   -28,   -65,   -36,    79,   180,   106,
+     -175,  -419,  -267,   338,   885,   620,  -627, -1893, -1542,  1371,  5966,  9793,
+    10515,  7667,  3036,  -731, -2032, -1194,   234,   911,   597,   -74,  -422,  -293,
+       17,   180,   128,     0,   -65,   -46,    -2,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,     9,   -29,   -65,   -35,    80,   181,   105,
+     -177,  -420,  -265,   343,   887,   615,  -637, -1897, -1532,  1397,  5995,  9809,
+    10506,  7641,  3007,  -747, -2032, -1185,   241,   912,   593,   -78,  -423,  -291,
+       18,   180,   127,     0,   -65,   -45,    -2,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,     9,   -29,   -65,   -35,    81,   181,   104,
+     -179,  -420,  -262,   347,   888,   610,  -646, -1902, -1521,  1422,  6024,  9825,
+    10499,  7615,  2979,  -764, -2033, -1176,   249,   912,   589,   -82,  -424,  -289,
+       20,   180,   127,    -1,   -65,   -45,    -2,    17,    11,     1,    -2,     0,
+        0,    -1,    -1,     6,    16,     8,   -29,   -65,   -34,    81,   181,   103,
+     -181,  -421,  -259,   352,   890,   605,  -656, -1906, -1511,  1448,  6053,  9841,
+    10491,  7588,  2950,  -780, -2033, -1167,   256,   913,   585,   -85,  -424,  -287,
+       22,   181,   126,    -2,   -65,   -45,    -2,    17,    10,     1,    -2,     0,
+        0,    -1,    -1,     7,    17,     8,   -30,   -65,   -34,    82,   181,   101,
+     -183,  -421,  -257,   356,   891,   599,  -665, -1910, -1501,  1474,  6083,  9856,
+    10483,  7562,  2921,  -796, -2032, -1158,   263,   914,   581,   -89,  -424,  -286,
+       23,   181,   125,    -2,   -65,   -45,    -1,    17,    10,     1,    -2,     0,
+        0,    -1,    -1,     7,    17,     8,   -30,   -65,   -33,    83,   182,   100,
+     -185,  -422,  -254,   360,   892,   594,  -674, -1915, -1490,  1499,  6112,  9872,
+    10472,  7536,  2893,  -812, -2032, -1149,   271,   914,   577,   -92,  -425,  -284,
+       25,   181,   124,    -3,   -65,   -44,    -1,    17,    10,     1,    -2,     0,
+        0,    -1,    -1,     7,    17,     8,   -30,   -65,   -33,    84,   182,    99,
+     -187,  -422,  -251,   365,   894,   589,  -684, -1919, -1480,  1525,  6141,  9887,
+    10463,  7509,  2864,  -828, -2032, -1140,   278,   915,   573,   -96,  -425,  -282,
+       27,   181,   124,    -4,   -65,   -44,    -1,    17,    10,     1,    -2,     0,
+        0,    -1,    -1,     7,    17,     8,   -30,   -65,   -32,    85,   182,    98,
+     -189,  -423,  -248,   369,   895,   583,  -693, -1923, -1469,  1551,  6170,  9902,
+    10457,  7483,  2835,  -844, -2032, -1131,   285,   915,   569,  -100,  -426,  -280,
+       28,   182,   123,    -4,   -65,   -44,    -1,    17,    10,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     8,   -31,   -65,   -32,    86,   182,    96,
+     -191,  -423,  -246,   374,   896,   578,  -703, -1927, -1458,  1577,  6199,  9917,
+    10449,  7456,  2807,  -860, -2031, -1122,   292,   916,   565,  -103,  -426,  -278,
+       30,   182,   122,    -5,   -65,   -44,    -1,    17,    10,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     8,   -31,   -65,   -31,    86,   182,    95,
+     -193,  -424,  -243,   378,   898,   573,  -712, -1931, -1447,  1603,  6228,  9932,
+    10437,  7429,  2778,  -875, -2030, -1113,   300,   916,   561,  -107,  -426,  -276,
+       32,   182,   121,    -6,   -65,   -43,     0,    17,    10,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     7,   -31,   -66,   -31,    87,   182,    94,
+     -195,  -424,  -240,   382,   899,   567,  -722, -1935, -1436,  1629,  6257,  9946,
+    10432,  7403,  2750,  -891, -2030, -1104,   307,   917,   557,  -110,  -427,  -275,
+       33,   182,   121,    -6,   -65,   -43,     0,    17,    10,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     7,   -32,   -66,   -30,    88,   183,    92,
+     -197,  -425,  -237,   387,   900,   561,  -731, -1939, -1425,  1655,  6286,  9961,
+    10424,  7376,  2722,  -906, -2029, -1095,   314,   917,   553,  -114,  -427,  -273,
+       35,   182,   120,    -7,   -66,   -43,     0,    17,    10,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     7,   -32,   -66,   -30,    89,   183,    91,
+     -199,  -425,  -235,   391,   901,   556,  -740, -1942, -1414,  1682,  6314,  9975,
+    10416,  7349,  2693,  -922, -2028, -1086,   321,   917,   549,  -117,  -427,  -271,
+       36,   182,   119,    -8,   -66,   -42,     0,    17,    10,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     7,   -32,   -66,   -29,    90,   183,    90,
+     -201,  -426,  -232,   395,   902,   550,  -750, -1946, -1402,  1708,  6343,  9990,
+    10403,  7322,  2665,  -937, -2027, -1076,   328,   918,   545,  -121,  -428,  -269,
+       38,   183,   118,    -8,   -66,   -42,     1,    17,    10,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     7,   -32,   -66,   -29,    91,   183,    88,
+     -203,  -426,  -229,   400,   903,   545,  -759, -1950, -1391,  1734,  6372, 10004,
+    10394,  7295,  2637,  -952, -2026, -1067,   335,   918,   540,  -124,  -428,  -267,
+       40,   183,   117,    -9,   -66,   -42,     1,    17,    10,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     7,   -33,   -66,   -28,    91,   183,    87,
+     -205,  -426,  -226,   404,   904,   539,  -769, -1953, -1379,  1761,  6401, 10018,
+    10385,  7268,  2609,  -967, -2025, -1058,   342,   918,   536,  -128,  -428,  -265,
+       41,   183,   117,   -10,   -66,   -42,     1,    17,    10,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     6,   -33,   -66,   -28,    92,   183,    86,
+     -207,  -427,  -223,   409,   905,   533,  -778, -1957, -1367,  1787,  6429, 10032,
+    10377,  7241,  2580,  -982, -2024, -1049,   349,   918,   532,  -131,  -428,  -263,
+       43,   183,   116,   -10,   -66,   -41,     1,    17,     9,     0,    -2,     0,
+        0,    -1,    -1,     7,    17,     6,   -33,   -66,   -27,    93,   183,    84,
+     -209,  -427,  -220,   413,   906,   527,  -788, -1960, -1356,  1814,  6458, 10046,
+    10371,  7213,  2552,  -997, -2023, -1040,   356,   918,   528,  -134,  -429,  -262,
+       44,   183,   115,   -11,   -66,   -41,     1,    17,     9,     0,    -2,     0,
+        0,    -1,    -1,     8,    17,     6,   -34,   -66,   -26,    94,   183,    83,
+     -211,  -427,  -217,   417,   907,   521,  -797, -1963, -1344,  1840,  6487, 10059,
+    10359,  7186,  2524, -1011, -2022, -1031,   363,   918,   524,  -138,  -429,  -260,
+       46,   183,   114,   -12,   -66,   -41,     2,    17,     9,     0,    -2,     0,
+        0,    -1,    -1,     8,    17,     6,   -34,   -66,   -26,    95,   184,    82,
+     -213,  -428,  -214,   422,   908,   516,  -807, -1967, -1332,  1867,  6515, 10073,
+    10345,  7159,  2496, -1026, -2020, -1021,   369,   918,   520,  -141,  -429,  -258,
+       48,   183,   113,   -12,   -66,   -40,     2,    17,     9,     0,    -2,     0,
+        0,    -1,    -1,     8,    17,     6,   -34,   -66,   -25,    96,   184,    80,
+     -215,  -428,  -211,   426,   909,   510,  -816, -1970, -1320,  1894,  6544, 10086,
+    10335,  7131,  2468, -1040, -2019, -1012,   376,   918,   516,  -145,  -429,  -256,
+       49,   183,   113,   -13,   -66,   -40,     2,    17,     9,     0,    -2,     0,
+        0,    -1,    -1,     8,    17,     6,   -34,   -66,   -25,    96,   184,    79,
+     -217,  -428,  -208,   430,   910,   504,  -825, -1973, -1307,  1920,  6572, 10099,
+    10325,  7104,  2440, -1055, -2017, -1003,   383,   918,   511,  -148,  -429,  -254,
+       51,   184,   112,   -14,   -66,   -40,     2,    17,     9,     0,    -2,     0,
+        0,    -1,    -1,     8,    17,     5,   -35,   -66,   -24,    97,   184,    77,
+     -219,  -428,  -205,   435,   911,   498,  -835, -1976, -1295,  1947,  6601, 10112,
+    10314,  7077,  2413, -1069, -2016,  -994,   390,   918,   507,  -151,  -429,  -252,
+       52,   184,   111,   -14,   -66,   -40,     2,    17,     9,     0,    -2,     0,
+        0,    -1,    -1,     8,    17,     5,   -35,   -66,   -24,    98,   184,    76,
+     -221,  -429,  -202,   439,   911,   492,  -844, -1979, -1283,  1974,  6629, 10125,
+    10303,  7049,  2385, -1083, -2014,  -984,   396,   918,   503,  -155,  -429,  -250,
+       54,   184,   110,   -15,   -66,   -39,     3,    17,     9,     0,    -1,     0,
+        0,    -1,     0,     8,    17,     5,   -35,   -66,   -23,    99,   184,    75,
+     -223,  -429,  -199,   443,   912,   486,  -854, -1982, -1270,  2001,  6657, 10138,
+    10291,  7021,  2357, -1097, -2012,  -975,   403,   918,   499,  -158,  -430,  -248,
+       55,   184,   109,   -15,   -66,   -39,     3,    17,     9,     0,    -1,     0,
+        0,    -1,     0,     8,    17,     5,   -36,   -66,   -23,   100,   184,    73,
+     -225,  -429,  -196,   448,   913,   479,  -863, -1985, -1257,  2028,  6686, 10151,
+    10278,  6994,  2329, -1111, -2010,  -966,   410,   918,   495,  -161,  -430,  -246,
+       57,   184,   109,   -16,   -66,   -39,     3,    17,     9,     0,    -1,     0,
+        0,    -1,     0,     8,    17,     5,   -36,   -66,   -22,   101,   184,    72,
+     -227,  -429,  -193,   452,   913,   473,  -872, -1987, -1245,  2055,  6714, 10163,
+    10269,  6966,  2302, -1125, -2008,  -957,   416,   917,   490,  -164,  -430,  -244,
+       58,   184,   108,   -17,   -66,   -38,     3,    17,     9,     0,    -1,     0,
+        0,    -1,     0,     8,    17,     5,   -36,   -66,   -21,   101,   184,    70,
+     -229,  -429,  -190,   456,   914,   467,  -882, -1990, -1232,  2082,  6742, 10176,
+    10258,  6938,  2274, -1139, -2006,  -947,   423,   917,   486,  -168,  -430,  -242,
+       60,   184,   107,   -17,   -66,   -38,     3,    17,     9,     0,    -1,     0,
+        0,    -1,     0,     8,    17,     4,   -36,   -66,   -21,   102,   184,    69,
+     -231,  -429,  -187,   460,   915,   461,  -891, -1993, -1219,  2110,  6770, 10188,
+    10248,  6910,  2246, -1152, -2004,  -938,   429,   917,   482,  -171,  -430,  -240,
+       61,   184,   106,   -18,   -66,   -38,     3,    17,     9,     0,    -1,     0,
+        0,    -1,     0,     8,    17,     4,   -37,   -66,   -20,   103,   184,    67,
+     -233,  -429,  -184,   465,   915,   455,  -901, -1995, -1206,  2137,  6798, 10200,
+    10236,  6882,  2219, -1166, -2002,  -929,   436,   916,   478,  -174,  -430,  -238,
+       63,   184,   105,   -18,   -66,   -38,     4,    17,     9,     0,    -1,     0,
+        0,    -1,     0,     8,    17,     4,   -37,   -66,   -20,   104,   184,    66,
+     -235,  -429,  -180,   469,   916,   448,  -910, -1997, -1192,  2164,  6827, 10212,
+    10221,  6854,  2192, -1179, -2000,  -919,   442,   916,   473,  -177,  -430,  -236,
+       64,   184,   105,   -19,   -66,   -37,     4,    17,     8,     0,    -1,     0,
+        0,    -1,     0,     8,    17,     4,   -37,   -66,   -19,   105,   184,    64,
+     -236,  -430,  -177,   473,   916,   442,  -919, -2000, -1179,  2192,  6854, 10224,
+    10210,  6826,  2164, -1192, -1997,  -910,   448,   916,   469,  -180,  -429,  -235,
+       66,   184,   104,   -20,   -66,   -37,     4,    17,     8,     0,    -1,     0,
+        0,    -1,     0,     9,    17,     4,   -38,   -66,   -18,   105,   184,    63,
+     -238,  -430,  -174,   478,   916,   436,  -929, -2002, -1166,  2219,  6882, 10236,
+    10200,  6798,  2137, -1206, -1995,  -901,   455,   915,   465,  -184,  -429,  -233,
+       67,   184,   103,   -20,   -66,   -37,     4,    17,     8,     0,    -1,     0,
+        0,    -1,     0,     9,    17,     3,   -38,   -66,   -18,   106,   184,    61,
+     -240,  -430,  -171,   482,   917,   429,  -938, -2004, -1152,  2246,  6910, 10247,
+    10189,  6770,  2110, -1219, -1993,  -891,   461,   915,   460,  -187,  -429,  -231,
+       69,   184,   102,   -21,   -66,   -36,     4,    17,     8,     0,    -1,     0,
+        0,    -1,     0,     9,    17,     3,   -38,   -66,   -17,   107,   184,    60,
+     -242,  -430,  -168,   486,   917,   423,  -947, -2006, -1139,  2274,  6938, 10259,
+    10175,  6742,  2082, -1232, -1990,  -882,   467,   914,   456,  -190,  -429,  -229,
+       70,   184,   101,   -21,   -66,   -36,     5,    17,     8,     0,    -1,     0,
+        0,    -1,     0,     9,    17,     3,   -38,   -66,   -17,   108,   184,    58,
+     -244,  -430,  -164,   490,   917,   416,  -957, -2008, -1125,  2302,  6966, 10270,
+    10162,  6714,  2055, -1245, -1987,  -872,   473,   913,   452,  -193,  -429,  -227,
+       72,   184,   101,   -22,   -66,   -36,     5,    17,     8,     0,    -1,     0,
+        0,    -1,     0,     9,    17,     3,   -39,   -66,   -16,   109,   184,    57,
+     -246,  -430,  -161,   495,   918,   410,  -966, -2010, -1111,  2329,  6994, 10281,
+    10148,  6686,  2028, -1257, -1985,  -863,   479,   913,   448,  -196,  -429,  -225,
+       73,   184,   100,   -23,   -66,   -36,     5,    17,     8,     0,    -1,     0,
+        0,    -1,     0,     9,    17,     3,   -39,   -66,   -15,   109,   184,    55,
+     -248,  -430,  -158,   499,   918,   403,  -975, -2012, -1097,  2357,  7021, 10292,
+    10137,  6657,  2001, -1270, -1982,  -854,   486,   912,   443,  -199,  -429,  -223,
+       75,   184,    99,   -23,   -66,   -35,     5,    17,     8,     0,    -1,     0,
+        0,    -1,     0,     9,    17,     3,   -39,   -66,   -15,   110,   184,    54,
+     -250,  -429,  -155,   503,   918,   396,  -984, -2014, -1083,  2385,  7049, 10303,
+    10125,  6629,  1974, -1283, -1979,  -844,   492,   911,   439,  -202,  -429,  -221,
+       76,   184,    98,   -24,   -66,   -35,     5,    17,     8,    -1,    -1,     0,
+        0,    -2,     0,     9,    17,     2,   -40,   -66,   -14,   111,   184,    52,
+     -252,  -429,  -151,   507,   918,   390,  -994, -2016, -1069,  2413,  7077, 10314,
+    10112,  6601,  1947, -1295, -1976,  -835,   498,   911,   435,  -205,  -428,  -219,
+       77,   184,    97,   -24,   -66,   -35,     5,    17,     8,    -1,    -1,     0,
+        0,    -2,     0,     9,    17,     2,   -40,   -66,   -14,   112,   184,    51,
+     -254,  -429,  -148,   511,   918,   383, -1003, -2017, -1055,  2440,  7104, 10324,
+    10100,  6572,  1920, -1307, -1973,  -825,   504,   910,   430,  -208,  -428,  -217,
+       79,   184,    96,   -25,   -66,   -34,     6,    17,     8,    -1,    -1,     0,
+        0,    -2,     0,     9,    17,     2,   -40,   -66,   -13,   113,   183,    49,
+     -256,  -429,  -145,   516,   918,   376, -1012, -2019, -1040,  2468,  7131, 10335,
+    10086,  6544,  1894, -1320, -1970,  -816,   510,   909,   426,  -211,  -428,  -215,
+       80,   184,    96,   -25,   -66,   -34,     6,    17,     8,    -1,    -1,     0,
+        0,    -2,     0,     9,    17,     2,   -40,   -66,   -12,   113,   183,    48,
+     -258,  -429,  -141,   520,   918,   369, -1021, -2020, -1026,  2496,  7159, 10345,
+    10073,  6515,  1867, -1332, -1967,  -807,   516,   908,   422,  -214,  -428,  -213,
+       82,   184,    95,   -26,   -66,   -34,     6,    17,     8,    -1,    -1,     0,
+        0,    -2,     0,     9,    17,     2,   -41,   -66,   -12,   114,   183,    46,
+     -260,  -429,  -138,   524,   918,   363, -1031, -2022, -1011,  2524,  7186, 10355,
+    10063,  6487,  1840, -1344, -1963,  -797,   521,   907,   417,  -217,  -427,  -211,
+       83,   183,    94,   -26,   -66,   -34,     6,    17,     8,    -1,    -1,     0,
+        0,    -2,     0,     9,    17,     1,   -41,   -66,   -11,   115,   183,    44,
+     -262,  -429,  -134,   528,   918,   356, -1040, -2023,  -997,  2552,  7213, 10365,
+    10052,  6458,  1814, -1356, -1960,  -788,   527,   906,   413,  -220,  -427,  -209,
+       84,   183,    93,   -27,   -66,   -33,     6,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,     9,    17,     1,   -41,   -66,   -10,   116,   183,    43,
+     -263,  -428,  -131,   532,   918,   349, -1049, -2024,  -982,  2580,  7241, 10375,
+    10034,  6429,  1787, -1367, -1957,  -778,   533,   905,   409,  -223,  -427,  -207,
+       86,   183,    92,   -28,   -66,   -33,     6,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,    10,    17,     1,   -42,   -66,   -10,   117,   183,    41,
+     -265,  -428,  -128,   536,   918,   342, -1058, -2025,  -967,  2609,  7268, 10385,
+    10018,  6401,  1761, -1379, -1953,  -769,   539,   904,   404,  -226,  -426,  -205,
+       87,   183,    91,   -28,   -66,   -33,     7,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,    10,    17,     1,   -42,   -66,    -9,   117,   183,    40,
+     -267,  -428,  -124,   540,   918,   335, -1067, -2026,  -952,  2637,  7295, 10395,
+    10003,  6372,  1734, -1391, -1950,  -759,   545,   903,   400,  -229,  -426,  -203,
+       88,   183,    91,   -29,   -66,   -32,     7,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,    10,    17,     1,   -42,   -66,    -8,   118,   183,    38,
+     -269,  -428,  -121,   545,   918,   328, -1076, -2027,  -937,  2665,  7322, 10404,
+     9989,  6343,  1708, -1402, -1946,  -750,   550,   902,   395,  -232,  -426,  -201,
+       90,   183,    90,   -29,   -66,   -32,     7,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,    10,    17,     0,   -42,   -66,    -8,   119,   182,    36,
+     -271,  -427,  -117,   549,   917,   321, -1086, -2028,  -922,  2693,  7349, 10413,
+     9978,  6314,  1682, -1414, -1942,  -740,   556,   901,   391,  -235,  -425,  -199,
+       91,   183,    89,   -30,   -66,   -32,     7,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,    10,    17,     0,   -43,   -66,    -7,   120,   182,    35,
+     -273,  -427,  -114,   553,   917,   314, -1095, -2029,  -906,  2722,  7376, 10422,
+     9963,  6286,  1655, -1425, -1939,  -731,   561,   900,   387,  -237,  -425,  -197,
+       92,   183,    88,   -30,   -66,   -32,     7,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,    10,    17,     0,   -43,   -65,    -6,   121,   182,    33,
+     -275,  -427,  -110,   557,   917,   307, -1104, -2030,  -891,  2750,  7403, 10431,
+     9947,  6257,  1629, -1436, -1935,  -722,   567,   899,   382,  -240,  -424,  -195,
+       94,   182,    87,   -31,   -66,   -31,     7,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,    10,    17,     0,   -43,   -65,    -6,   121,   182,    32,
+     -276,  -426,  -107,   561,   916,   300, -1113, -2030,  -875,  2778,  7429, 10440,
+     9929,  6228,  1603, -1447, -1931,  -712,   573,   898,   378,  -243,  -424,  -193,
+       95,   182,    86,   -31,   -65,   -31,     8,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,    10,    17,    -1,   -44,   -65,    -5,   122,   182,    30,
+     -278,  -426,  -103,   565,   916,   292, -1122, -2031,  -860,  2807,  7456, 10449,
+     9917,  6199,  1577, -1458, -1927,  -703,   578,   896,   374,  -246,  -423,  -191,
+       96,   182,    86,   -32,   -65,   -31,     8,    17,     7,    -1,    -1,     0,
+        0,    -2,     0,    10,    17,    -1,   -44,   -65,    -4,   123,   182,    28,
+     -280,  -426,  -100,   569,   915,   285, -1131, -2032,  -844,  2835,  7483, 10458,
+     9901,  6170,  1551, -1469, -1923,  -693,   583,   895,   369,  -248,  -423,  -189,
+       98,   182,    85,   -32,   -65,   -30,     8,    17,     7,    -1,    -1,     0,
+        0,    -2,     1,    10,    17,    -1,   -44,   -65,    -4,   124,   181,    27,
+     -282,  -425,   -96,   573,   915,   278, -1140, -2032,  -828,  2864,  7509, 10466,
+     9884,  6141,  1525, -1480, -1919,  -684,   589,   894,   365,  -251,  -422,  -187,
+       99,   182,    84,   -33,   -65,   -30,     8,    17,     7,    -1,    -1,     0,
+        0,    -2,     1,    10,    17,    -1,   -44,   -65,    -3,   124,   181,    25,
+     -284,  -425,   -92,   577,   914,   271, -1149, -2032,  -812,  2893,  7536, 10474,
+     9870,  6112,  1499, -1490, -1915,  -674,   594,   892,   360,  -254,  -422,  -185,
+      100,   182,    83,   -33,   -65,   -30,     8,    17,     7,    -1,    -1,     0,
+        0,    -2,     1,    10,    17,    -1,   -45,   -65,    -2,   125,   181,    23,
+     -286,  -424,   -89,   581,   914,   263, -1158, -2032,  -796,  2921,  7562, 10482,
+     9857,  6083,  1474, -1501, -1910,  -665,   599,   891,   356,  -257,  -421,  -183,
+      101,   181,    82,   -34,   -65,   -30,     8,    17,     7,    -1,    -1,     0,
+        0,    -2,     1,    10,    17,    -2,   -45,   -65,    -2,   126,   181,    22,
+     -287,  -424,   -85,   585,   913,   256, -1167, -2033,  -780,  2950,  7588, 10490,
+     9842,  6053,  1448, -1511, -1906,  -656,   605,   890,   352,  -259,  -421,  -181,
+      103,   181,    81,   -34,   -65,   -29,     8,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -2,   -45,   -65,    -1,   127,   180,    20,
+     -289,  -424,   -82,   589,   912,   249, -1176, -2033,  -764,  2979,  7615, 10498,
+     9826,  6024,  1422, -1521, -1902,  -646,   610,   888,   347,  -262,  -420,  -179,
+      104,   181,    81,   -35,   -65,   -29,     9,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -2,   -45,   -65,     0,   127,   180,    18,
+     -291,  -423,   -78,   593,   912,   241, -1185, -2032,  -747,  3007,  7641, 10506,
+     9809,  5995,  1397, -1532, -1897,  -637,   615,   887,   343,  -265,  -420,  -177,
+      105,   181,    80,   -35,   -65,   -29,     9,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -2,   -46,   -65,     0,   128,   180,    17,
+     -293,  -422,   -74,   597,   911,   234, -1194, -2032,  -731,  3036,  7667, 10513,
+     9795,  5966,  1371, -1542, -1893,  -627,   620,   885,   338,  -267,  -419,  -175,
+      106,   180,    79,   -36,   -65,   -28,     9,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -2,   -46,   -64,     1,   129,   180,    15,
+     -295,  -422,   -71,   601,   910,   226, -1202, -2032,  -714,  3065,  7693, 10521,
+     9779,  5936,  1346, -1552, -1888,  -618,   625,   883,   334,  -270,  -419,  -173,
+      107,   180,    78,   -36,   -65,   -28,     9,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -3,   -46,   -64,     2,   130,   179,    13,
+     -296,  -421,   -67,   605,   909,   219, -1211, -2032,  -698,  3094,  7719, 10528,
+     9760,  5907,  1321, -1562, -1884,  -608,   630,   882,   330,  -272,  -418,  -170,
+      109,   180,    77,   -37,   -65,   -28,     9,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -3,   -46,   -64,     2,   130,   179,    11,
+     -298,  -421,   -63,   609,   908,   211, -1220, -2031,  -681,  3123,  7745, 10535,
+     9746,  5878,  1295, -1571, -1879,  -599,   635,   880,   325,  -275,  -417,  -168,
+      110,   180,    76,   -37,   -65,   -28,     9,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -3,   -47,   -64,     3,   131,   179,    10,
+     -300,  -420,   -59,   613,   908,   204, -1229, -2031,  -664,  3152,  7771, 10542,
+     9726,  5849,  1270, -1581, -1874,  -590,   640,   879,   321,  -277,  -417,  -166,
+      111,   179,    75,   -38,   -64,   -27,     9,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -3,   -47,   -64,     4,   132,   178,     8,
+     -302,  -420,   -56,   616,   907,   196, -1238, -2030,  -647,  3181,  7797, 10549,
+     9711,  5819,  1245, -1591, -1869,  -580,   645,   877,   316,  -280,  -416,  -164,
+      112,   179,    75,   -38,   -64,   -27,    10,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -4,   -47,   -64,     5,   133,   178,     6,
+     -303,  -419,   -52,   620,   906,   188, -1246, -2030,  -630,  3210,  7822, 10556,
+     9694,  5790,  1220, -1600, -1865,  -571,   650,   875,   312,  -282,  -415,  -162,
+      113,   179,    74,   -39,   -64,   -27,    10,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -4,   -48,   -64,     5,   133,   178,     4,
+     -305,  -418,   -48,   624,   905,   181, -1255, -2029,  -613,  3239,  7848, 10562,
+     9677,  5760,  1195, -1609, -1860,  -561,   655,   873,   308,  -285,  -415,  -160,
+      115,   179,    73,   -39,   -64,   -26,    10,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -4,   -48,   -64,     6,   134,   177,     3,
+     -307,  -418,   -44,   628,   903,   173, -1264, -2028,  -596,  3268,  7873, 10568,
+     9663,  5731,  1170, -1619, -1855,  -552,   660,   872,   303,  -287,  -414,  -158,
+      116,   178,    72,   -39,   -64,   -26,    10,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -4,   -48,   -64,     7,   135,   177,     1,
+     -309,  -417,   -41,   632,   902,   165, -1273, -2027,  -578,  3297,  7899, 10575,
+     9647,  5701,  1145, -1628, -1850,  -543,   664,   870,   299,  -290,  -413,  -156,
+      117,   178,    71,   -40,   -64,   -26,    10,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -5,   -48,   -63,     7,   135,   177,    -1,
+     -310,  -416,   -37,   636,   901,   158, -1281, -2026,  -561,  3326,  7924, 10581,
+     9625,  5672,  1121, -1637, -1844,  -533,   669,   868,   294,  -292,  -412,  -154,
+      118,   178,    70,   -40,   -64,   -25,    10,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    11,    17,    -5,   -49,   -63,     8,   136,   176,    -3,
+     -312,  -415,   -33,   639,   900,   150, -1290, -2025,  -543,  3355,  7950, 10587,
+     9612,  5642,  1096, -1646, -1839,  -524,   674,   866,   290,  -295,  -412,  -152,
+      119,   177,    70,   -41,   -64,   -25,    10,    16,     6,    -1,    -1,     0,
+        0,    -2,     1,    12,    17,    -5,   -49,   -63,     9,   137,   176,    -4,
+     -314,  -415,   -29,   643,   899,   142, -1298, -2024,  -525,  3384,  7975, 10592,
+     9592,  5613,  1071, -1655, -1834,  -514,   678,   864,   286,  -297,  -411,  -150,
+      120,   177,    69,   -41,   -64,   -25,    11,    16,     5,    -1,    -1,     0,
+        0,    -2,     1,    12,    17,    -5,   -49,   -63,    10,   138,   176,    -6,
+     -316,  -414,   -25,   647,   897,   134, -1307, -2022,  -508,  3414,  8000, 10598,
+     9573,  5583,  1047, -1663, -1829,  -505,   683,   862,   281,  -299,  -410,  -148,
+      121,   177,    68,   -42,   -63,   -25,    11,    16,     5,    -1,    -1,     0,
+        0,    -2,     1,    12,    16,    -5,   -49,   -63,    10,   138,   175,    -8,
+     -317,  -413,   -21,   651,   896,   126, -1316, -2021,  -490,  3443,  8025, 10603,
+     9557,  5554,  1023, -1672, -1823,  -496,   688,   860,   277,  -302,  -409,  -146,
+      122,   176,    67,   -42,   -63,   -24,    11,    16,     5,    -1,    -1,     0,
+        0,    -2,     1,    12,    16,    -6,   -50,   -63,    11,   139,   175,   -10,
+     -319,  -412,   -18,   654,   895,   118, -1324, -2020,  -472,  3472,  8050, 10609,
+     9543,  5524,   998, -1680, -1818,  -486,   692,   858,   272,  -304,  -408,  -144,
+      123,   176,    66,   -43,   -63,   -24,    11,    16,     5,    -1,    -1,     0,
+        0,    -2,     1,    12,    16,    -6,   -50,   -62,    12,   140,   174,   -12,
+     -321,  -411,   -14,   658,   893,   110, -1333, -2018,  -454,  3501,  8075, 10614,
+     9524,  5494,   974, -1689, -1812,  -477,   696,   856,   268,  -306,  -407,  -142,
+      125,   176,    65,   -43,   -63,   -24,    11,    16,     5,    -1,    -1,     0,
+        0,    -2,     1,    12,    16,    -6,   -50,   -62,    13,   140,   174,   -13,
+     -322,  -410,   -10,   662,   892,   102, -1341, -2016,  -435,  3531,  8100, 10619,
+     9499,  5465,   950, -1697, -1807,  -468,   701,   854,   264,  -308,  -407,  -140,
+      126,   175,    65,   -43,   -63,   -23,    11,    16,     5,    -1,    -1,     0,
+        0,    -2,     2,    12,    16,    -6,   -50,   -62,    13,   141,   173,   -15,
+     -324,  -410,    -6,   665,   890,    94, -1349, -2015,  -417,  3560,  8124, 10624,
+     9486,  5435,   926, -1705, -1801,  -458,   705,   852,   259,  -311,  -406,  -138,
+      127,   175,    64,   -44,   -63,   -23,    11,    16,     5,    -1,    -1,     0,
+        0,    -2,     2,    12,    16,    -7,   -51,   -62,    14,   142,   173,   -17,
+     -325,  -409,    -2,   669,   889,    86, -1358, -2013,  -399,  3589,  8149, 10628,
+     9468,  5405,   902, -1713, -1796,  -449,   710,   850,   255,  -313,  -405,  -136,
+      128,   175,    63,   -44,   -63,   -23,    11,    16,     5,    -1,    -1,     0,
+        0,    -2,     2,    12,    16,    -7,   -51,   -62,    15,   142,   173,   -19,
+     -327,  -408,     2,   673,   887,    78, -1366, -2011,  -380,  3619,  8173, 10633,
+     9448,  5376,   878, -1721, -1790,  -440,   714,   848,   250,  -315,  -404,  -134,
+      129,   174,    62,   -45,   -62,   -23,    12,    16,     5,    -1,    -1,     0,
+        0,    -2,     2,    12,    16,    -7,   -51,   -62,    15,   143,   172,   -21,
+     -329,  -407,     6,   676,   885,    70, -1374, -2009,  -362,  3648,  8198, 10637,
+     9431,  5346,   854, -1729, -1784,  -430,   718,   845,   246,  -317,  -403,  -132,
+      130,   174,    61,   -45,   -62,   -22,    12,    16,     5,    -1,    -1,     0,
+        0,    -2,     2,    12,    16,    -7,   -51,   -61,    16,   144,   172,   -23,
+     -330,  -406,    10,   680,   884,    62, -1383, -2006,  -343,  3678,  8222, 10642,
+     9408,  5316,   830, -1737, -1778,  -421,   722,   843,   242,  -319,  -402,  -130,
+      131,   174,    60,   -45,   -62,   -22,    12,    15,     5,    -1,    -1,     0,
+        0,    -2,     2,    12,    16,    -8,   -52,   -61,    17,   145,   171,   -24,
+     -332,  -405,    14,   683,   882,    54, -1391, -2004,  -324,  3707,  8247, 10646,
+     9394,  5286,   806, -1745, -1772,  -412,   726,   841,   237,  -322,  -401,  -128,
+      132,   173,    60,   -46,   -62,   -22,    12,    15,     5,    -1,    -1,     0,
+        0,    -2,     2,    12,    16,    -8,   -52,   -61,    18,   145,   171,   -26,
+     -334,  -404,    18,   687,   880,    46, -1399, -2002,  -305,  3737,  8271, 10650,
+     9371,  5257,   783, -1752, -1766,  -403,   730,   839,   233,  -324,  -400,  -126,
+      133,   173,    59,   -46,   -62,   -21,    12,    15,     5,    -1,    -1,     0,
+        0,    -2,     2,    12,    16,    -8,   -52,   -61,    18,   146,   170,   -28,
+     -335,  -403,    22,   691,   878,    37, -1408, -1999,  -286,  3766,  8295, 10653,
+     9357,  5227,   759, -1760, -1760,  -393,   734,   836,   229,  -326,  -399,  -124,
+      134,   172,    58,   -47,   -62,   -21,    12,    15,     5,    -1,    -1,     0,
+        0,    -2,     2,    12,    16,    -8,   -52,   -61,    19,   146,   170,   -30,
+     -337,  -402,    26,   694,   876,    29, -1416, -1997,  -267,  3796,  8319, 10657,
+     9338,  5197,   736, -1767, -1754,  -384,   738,   834,   224,  -328,  -398,  -122,
+      135,   172,    57,   -47,   -62,   -21,    12,    15,     5,    -1,    -1,     0,
+       -1,    -2,     2,    13,    16,    -9,   -53,   -60,    20,   147,   169,   -32,
+     -338,  -401,    30,   698,   874,    21, -1424, -1994,  -248,  3826,  8343, 10661,
+     9318,  5167,   712, -1774, -1748,  -375,   742,   831,   220,  -330,  -397,  -120,
+      136,   172,    56,   -47,   -61,   -21,    12,    15,     4,    -1,    -1,     0,
+       -1,    -2,     2,    13,    16,    -9,   -53,   -60,    21,   148,   169,   -34,
+     -340,  -399,    34,   701,   872,    12, -1432, -1992,  -229,  3855,  8367, 10664,
+     9301,  5137,   689, -1781, -1742,  -366,   746,   829,   215,  -332,  -396,  -118,
+      137,   171,    55,   -48,   -61,   -20,    12,    15,     4,    -1,    -1,     0,
+       -1,    -2,     2,    13,    16,    -9,   -53,   -60,    22,   148,   168,   -36,
+     -341,  -398,    38,   705,   870,     4, -1440, -1989,  -209,  3885,  8391, 10667,
+     9277,  5108,   666, -1788, -1736,  -357,   750,   827,   211,  -334,  -395,  -116,
+      138,   171,    54,   -48,   -61,   -20,    13,    15,     4,    -1,    -1,     0,
+       -1,    -2,     2,    13,    16,    -9,   -53,   -60,    22,   149,   167,   -37,
+     -343,  -397,    42,   708,   868,    -4, -1448, -1986,  -190,  3914,  8414, 10670,
+     9260,  5078,   643, -1795, -1730,  -347,   754,   824,   207,  -336,  -394,  -114,
+      138,   170,    54,   -48,   -61,   -20,    13,    15,     4,    -1,    -1,     0,
+       -1,    -2,     2,    13,    16,   -10,   -53,   -60,    23,   150,   167,   -39,
+     -344,  -396,    46,   711,   866,   -13, -1456, -1983,  -170,  3944,  8438, 10673,
+     9240,  5048,   620, -1802, -1723,  -338,   758,   822,   202,  -338,  -393,  -112,
+      139,   170,    53,   -49,   -61,   -20,    13,    15,     4,    -1,    -1,     0,
+       -1,    -2,     2,    13,    16,   -10,   -54,   -59,    24,   150,   166,   -41,
+     -346,  -395,    50,   715,   864,   -21, -1464, -1980,  -151,  3974,  8461, 10676,
+     9224,  5018,   597, -1809, -1717,  -329,   761,   819,   198,  -340,  -392,  -110,
+      140,   169,    52,   -49,   -61,   -19,    13,    15,     4,    -2,    -1,     0,
+       -1,    -2,     2,    13,    16,   -10,   -54,   -59,    25,   151,   166,   -43,
+     -347,  -394,    54,   718,   862,   -29, -1472, -1977,  -131,  4003,  8485, 10678,
+     9201,  4988,   574, -1815, -1710,  -320,   765,   817,   194,  -342,  -391,  -108,
+      141,   169,    51,   -50,   -60,   -19,    13,    15,     4,    -2,    -1,     0,
+       -1,    -2,     2,    13,    16,   -10,   -54,   -59,    25,   152,   165,   -45,
+     -349,  -392,    58,   722,   860,   -38, -1480, -1973,  -111,  4033,  8508, 10681,
+     9183,  4958,   551, -1822, -1704,  -311,   769,   814,   189,  -344,  -390,  -106,
+      142,   168,    50,   -50,   -60,   -19,    13,    15,     4,    -2,    -1,     0,
+       -1,    -2,     2,    13,    15,   -11,   -54,   -59,    26,   152,   165,   -47,
+     -350,  -391,    62,   725,   858,   -46, -1488, -1970,   -91,  4063,  8531, 10683,
+     9162,  4929,   528, -1828, -1697,  -302,   772,   811,   185,  -346,  -389,  -104,
+      143,   168,    50,   -50,   -60,   -18,    13,    15,     4,    -2,    -1,     0,
+       -1,    -2,     2,    13,    15,   -11,   -55,   -58,    27,   153,   164,   -49,
+     -352,  -390,    66,   728,   855,   -55, -1496, -1966,   -71,  4093,  8554, 10685,
+     9142,  4899,   506, -1835, -1691,  -293,   776,   809,   181,  -347,  -387,  -102,
+      144,   168,    49,   -51,   -60,   -18,    13,    15,     4,    -2,    -1,     0,
+       -1,    -2,     2,    13,    15,   -11,   -55,   -58,    28,   153,   163,   -51,
+     -353,  -389,    71,   731,   853,   -63, -1503, -1963,   -51,  4122,  8577, 10687,
+     9124,  4869,   483, -1841, -1684,  -284,   779,   806,   176,  -349,  -386,  -100,
+      145,   167,    48,   -51,   -60,   -18,    13,    15,     4,    -2,    -1,     0,
+       -1,    -2,     3,    13,    15,   -11,   -55,   -58,    29,   154,   163,   -53,
+     -355,  -387,    75,   735,   850,   -72, -1511, -1959,   -31,  4152,  8600, 10689,
+     9100,  4839,   461, -1847, -1677,  -275,   783,   803,   172,  -351,  -385,   -98,
+      146,   167,    47,   -51,   -60,   -18,    13,    15,     4,    -2,    -1,     0,
+       -1,    -2,     3,    13,    15,   -12,   -55,   -58,    29,   155,   162,   -55,
+     -356,  -386,    79,   738,   848,   -80, -1519, -1955,   -10,  4182,  8623, 10691,
+     9080,  4809,   438, -1853, -1671,  -266,   786,   801,   168,  -353,  -384,   -96,
+      146,   166,    46,   -52,   -59,   -17,    14,    15,     4,    -2,    -1,     0,
+       -1,    -2,     3,    13,    15,   -12,   -55,   -57,    30,   155,   161,   -56,
+     -358,  -385,    83,   741,   846,   -89, -1526, -1952,    10,  4212,  8646, 10692,
+     9060,  4779,   416, -1859, -1664,  -257,   790,   798,   163,  -355,  -383,   -94,
+      147,   166,    45,   -52,   -59,   -17,    14,    15,     4,    -2,    -1,     0,
+       -1,    -2,     3,    13,    15,   -12,   -56,   -57,    31,   156,   161,   -58,
+     -359,  -383,    87,   744,   843,   -98, -1534, -1948,    31,  4241,  8668, 10694,
+     9040,  4749,   394, -1865, -1657,  -248,   793,   795,   159,  -357,  -381,   -92,
+      148,   165,    45,   -52,   -59,   -17,    14,    14,     4,    -2,    -1,     0,
+       -1,    -2,     3,    14,    15,   -12,   -56,   -57,    32,   156,   160,   -60,
+     -361,  -382,    91,   748,   840,  -106, -1542, -1943,    51,  4271,  8691, 10695,
+     9017,  4719,   372, -1870, -1650,  -239,   796,   792,   155,  -358,  -380,   -90,
+      149,   165,    44,   -53,   -59,   -16,    14,    14,     4,    -2,    -1,     0,
+       -1,    -2,     3,    14,    15,   -13,   -56,   -57,    32,   157,   159,   -62,
+     -362,  -380,    96,   751,   838,  -115, -1549, -1939,    72,  4301,  8713, 10696,
+     8995,  4689,   350, -1876, -1643,  -230,   800,   790,   151,  -360,  -379,   -88,
+      150,   164,    43,   -53,   -59,   -16,    14,    14,     4,    -2,    -1,     0,
+       -1,    -2,     3,    14,    15,   -13,   -56,   -56,    33,   158,   159,   -64,
+     -363,  -379,   100,   754,   835,  -124, -1557, -1935,    93,  4331,  8736, 10697,
+     8973,  4660,   328, -1881, -1636,  -221,   803,   787,   146,  -362,  -378,   -86,
+      151,   164,    42,   -53,   -59,   -16,    14,    14,     3,    -2,    -1,     0,
+       -1,    -2,     3,    14,    15,   -13,   -57,   -56,    34,   158,   158,   -66,
+     -365,  -377,   104,   757,   832,  -132, -1564, -1931,   114,  4361,  8758, 10698,
+     8955,  4630,   306, -1887, -1629,  -212,   806,   784,   142,  -363,  -377,   -84,
+      151,   163,    41,   -54,   -58,   -16,    14,    14,     3,    -2,    -1,     0,
+       -1,    -2,     3,    14,    15,   -14,   -57,   -56,    35,   159,   157,   -68,
+     -366,  -376,   108,   760,   830,  -141, -1572, -1926,   135,  4391,  8780, 10698,
+     8932,  4600,   284, -1892, -1622,  -203,   809,   781,   138,  -365,  -375,   -82,
+      152,   163,    41,   -54,   -58,   -15,    14,    14,     3,    -2,    -1,     0,
+       -1,    -2,     3,    14,    15,   -14,   -57,   -56,    36,   159,   157,   -70,
+     -367,  -374,   112,   763,   827,  -150, -1579, -1922,   156,  4420,  8802, 10699,
+     8912,  4570,   263, -1897, -1615,  -194,   812,   778,   133,  -367,  -374,   -80,
+      153,   162,    40,   -54,   -58,   -15,    14,    14,     3,    -2,    -1,     0,
+       -1,    -2,     3,    14,    15,   -14,   -57,   -55,    36,   160,   156,   -72,
+     -369,  -373,   117,   766,   824,  -159, -1586, -1917,   177,  4450,  8824, 10699,
+     8891,  4540,   241, -1902, -1608,  -185,   815,   775,   129,  -368,  -373,   -78,
+      154,   161,    39,   -54,   -58,   -15,    14,    14,     3,    -2,    -1,     0,
+       -1,    -2,     3,    14,    14,   -14,   -57,   -55,    37,   160,   155,   -74,
+     -370,  -371,   121,   769,   821,  -168, -1594, -1912,   198,  4480,  8846, 10699,
+     8872,  4510,   220, -1907, -1601,  -176,   818,   772,   125,  -370,  -371,   -76,
+      154,   161,    38,   -55,   -58,   -15,    14,    14,     3,    -2,    -1,     0,
+};
+
+/* 48 taps per branch: 44100 to 22050 Hz, 88200 to 44100 Hz, 96000 to 48000 Hz */
+const int16_t audio_src_coef_1_2[24] =
+{
+        0,     0,    -3,    -5,    10,    22,   -16,   -61,     7,   130,    42,  -225,
+     -169,   323,   419,  -371,  -842,   273,  1510,   157, -2648, -1525,  5832, 13524,
+};
+
+/* 24 taps per branch: 44100 to 32000 Hz */
+const int16_t audio_src_coef_320_441[7680] =
+{
+        0,    -3,    28,   -29,  -110,   322,  -152,  -740,  1544,  -353, -3815,  9020,
+    21400,  8961, -3824,  -335,  1538,  -743,  -148,   321,  -110,   -29,    28,    -3,
+        0,    -3,    28,   -30,  -109,   323,  -156,  -737,  1550,  -370, -3805,  9080,
+    21399,  8901, -3834,  -317,  1532,  -746,  -144,   320,  -111,   -28,    28,    -3,
+        0,    -3,    28,   -30,  -108,   324,  -160,  -733,  1556,  -388, -3794,  9140,
+    21396,  8841, -3843,  -300,  1526,  -749,  -140,   319,  -111,   -28,    28,    -3,
+        0,    -3,    28,   -31,  -108,   325,  -164,  -730,  1562,  -406, -3784,  9200,
+    21397,  8781, -3852,  -282,  1520,  -752,  -136,   317,  -112,   -27,    28,    -3,
+        0,    -3,    29,   -31,  -107,   326,  -168,  -727,  1568,  -424, -3773,  9259,
+    21394,  8722, -3861,  -265,  1514,  -755,  -132,   316,  -112,   -26,    27,    -3,
+        0,    -3,    29,   -32,  -106,   327,  -172,  -723,  1574,  -442, -3763,  9319,
+    21393,  8662, -3870,  -247,  1508,  -758,  -128,   315,  -113,   -26,    27,    -3,
+        0,    -3,    29,   -32,  -106,   328,  -176,  -720,  1579,  -459, -3752,  9379,
+    21392,  8602, -3879,  -230,  1502,  -761,  -125,   314,  -113,   -25,    27,    -3,
+        0,    -3,    29,   -33,  -105,   329,  -179,  -717,  1585,  -477, -3741,  9439,
+    21390,  8543, -3887,  -213,  1495,  -764,  -121,   313,  -114,   -25,    27,    -3,
+        0,    -3,    29,   -33,  -105,   330,  -183,  -713,  1591,  -495, -3729,  9498,
+    21384,  8483, -3895,  -195,  1489,  -766,  -117,   312,  -114,   -24,    27,    -3,
+        0,    -3,    29,   -34,  -104,   331,  -187,  -710,  1596,  -513, -3718,  9558,
+    21385,  8423, -3903,  -178,  1482,  -769,  -113,   311,  -115,   -24,    27,    -3,
+        0,    -3,    29,   -35,  -103,   332,  -191,  -706,  1602,  -531, -3706,  9618,
+    21380,  8364, -3911,  -161,  1476,  -772,  -109,   309,  -115,   -23,    27,    -3,
+        0,    -3,    29,   -35,  -103,   333,  -195,  -702,  1607,  -549, -3694,  9678,
+    21378,  8304, -3918,  -144,  1469,  -775,  -105,   308,  -116,   -23,    27,    -3,
+        0,    -3,    29,   -36,  -102,   334,  -199,  -699,  1612,  -567, -3682,  9738,
+    21374,  8245, -3926,  -127,  1463,  -777,  -101,   307,  -116,   -22,    26,    -3,
+        0,    -3,    30,   -36,  -101,   335,  -203,  -695,  1618,  -586, -3669,  9797,
+    21371,  8185, -3933,  -110,  1456,  -780,   -98,   306,  -117,   -22,    26,    -3,
+        0,    -3,    30,   -37,  -101,   336,  -207,  -691,  1623,  -604, -3657,  9857,
+    21366,  8126, -3940,   -93,  1450,  -782,   -94,   304,  -117,   -21,    26,    -3,
+        0,    -3,    30,   -37,  -100,   337,  -211,  -687,  1628,  -622, -3644,  9917,
+    21362,  8066, -3947,   -76,  1443,  -785,   -90,   303,  -118,   -21,    26,    -3,
+        0,    -3,    30,   -38,   -99,   338,  -215,  -684,  1633,  -640, -3631,  9977,
+    21355,  8007, -3953,   -59,  1436,  -787,   -86,   302,  -118,   -20,    26,    -3,
+        0,    -3,    30,   -38,   -98,   339,  -219,  -680,  1638,  -658, -3618, 10036,
+    21351,  7947, -3960,   -42,  1430,  -790,   -82,   301,  -119,   -20,    26,    -3,
+        0,    -3,    30,   -39,   -98,   340,  -223,  -676,  1643,  -677, -3604, 10096,
+    21346,  7888, -3966,   -25,  1423,  -792,   -79,   299,  -119,   -19,    26,    -3,
+        0,    -3,    30,   -40,   -97,   341,  -227,  -672,  1648,  -695, -3591, 10156,
+    21341,  7829, -3972,    -8,  1416,  -794,   -75,   298,  -120,   -19,    25,    -3,
+        0,    -3,    30,   -40,   -96,   341,  -231,  -668,  1653,  -713, -3577, 10215,
+    21335,  7770, -3978,     8,  1409,  -797,   -71,   297,  -120,   -18,    25,    -3,
+        0,    -3,    30,   -41,   -96,   342,  -236,  -664,  1658,  -732, -3563, 10275,
+    21330,  7710, -3983,    25,  1402,  -799,   -67,   296,  -120,   -18,    25,    -3,
+        0,    -3,    30,   -41,   -95,   343,  -240,  -660,  1663,  -750, -3548, 10335,
+    21322,  7651, -3989,    42,  1395,  -801,   -64,   294,  -121,   -17,    25,    -3,
+        0,    -3,    31,   -42,   -94,   344,  -244,  -656,  1668,  -769, -3534, 10394,
+    21315,  7592, -3994,    58,  1388,  -803,   -60,   293,  -121,   -17,    25,    -3,
+        0,    -3,    31,   -42,   -93,   345,  -248,  -652,  1672,  -787, -3519, 10454,
+    21305,  7533, -3999,    75,  1381,  -805,   -56,   292,  -122,   -16,    25,    -3,
+        0,    -3,    31,   -43,   -92,   346,  -252,  -647,  1677,  -805, -3504, 10513,
+    21298,  7474, -4004,    91,  1374,  -808,   -52,   290,  -122,   -16,    25,    -3,
+        0,    -3,    31,   -44,   -92,   346,  -256,  -643,  1682,  -824, -3489, 10573,
+    21292,  7415, -4009,   107,  1367,  -810,   -49,   289,  -122,   -15,    25,    -3,
+        0,    -3,    31,   -44,   -91,   347,  -260,  -639,  1686,  -842, -3474, 10632,
+    21284,  7356, -4013,   124,  1360,  -812,   -45,   288,  -123,   -15,    24,    -3,
+        0,    -3,    31,   -45,   -90,   348,  -264,  -635,  1691,  -861, -3458, 10692,
+    21274,  7297, -4017,   140,  1353,  -814,   -41,   286,  -123,   -14,    24,    -3,
+        0,    -3,    31,   -45,   -89,   349,  -268,  -630,  1695,  -880, -3443, 10751,
+    21267,  7238, -4021,   156,  1345,  -815,   -38,   285,  -124,   -14,    24,    -3,
+        0,    -3,    31,   -46,   -88,   349,  -272,  -626,  1699,  -898, -3427, 10811,
+    21257,  7179, -4025,   172,  1338,  -817,   -34,   284,  -124,   -13,    24,    -3,
+        0,    -3,    31,   -46,   -88,   350,  -276,  -621,  1704,  -917, -3410, 10870,
+    21247,  7120, -4029,   188,  1331,  -819,   -30,   282,  -124,   -13,    24,    -3,
+        0,    -3,    31,   -47,   -87,   351,  -280,  -617,  1708,  -935, -3394, 10929,
+    21238,  7061, -4033,   205,  1324,  -821,   -27,   281,  -125,   -12,    24,    -3,
+        0,    -3,    32,   -48,   -86,   352,  -284,  -612,  1712,  -954, -3378, 10989,
+    21227,  7003, -4036,   221,  1316,  -823,   -23,   279,  -125,   -12,    24,    -3,
+        0,    -3,    32,   -48,   -85,   352,  -288,  -608,  1716,  -973, -3361, 11048,
+    21218,  6944, -4039,   236,  1309,  -824,   -20,   278,  -125,   -11,    23,    -3,
+        0,    -3,    32,   -49,   -84,   353,  -292,  -603,  1720,  -991, -3344, 11107,
+    21207,  6886, -4042,   252,  1301,  -826,   -16,   277,  -126,   -11,    23,    -3,
+        0,    -3,    32,   -49,   -83,   354,  -296,  -598,  1724, -1010, -3327, 11166,
+    21195,  6827, -4045,   268,  1294,  -828,   -12,   275,  -126,   -10,    23,    -3,
+        0,    -3,    32,   -50,   -83,   354,  -300,  -594,  1728, -1029, -3309, 11226,
+    21184,  6769, -4047,   284,  1286,  -829,    -9,   274,  -126,   -10,    23,    -3,
+        0,    -2,    32,   -50,   -82,   355,  -304,  -589,  1732, -1048, -3291, 11285,
+    21172,  6710, -4050,   299,  1279,  -831,    -5,   272,  -126,   -10,    23,    -3,
+        0,    -2,    32,   -51,   -81,   355,  -308,  -584,  1736, -1066, -3274, 11344,
+    21160,  6652, -4052,   315,  1271,  -832,    -2,   271,  -127,    -9,    23,    -3,
+        0,    -2,    32,   -52,   -80,   356,  -313,  -579,  1739, -1085, -3256, 11403,
+    21148,  6594, -4054,   331,  1264,  -834,     2,   270,  -127,    -9,    23,    -3,
+        0,    -2,    32,   -52,   -79,   357,  -317,  -575,  1743, -1104, -3237, 11462,
+    21137,  6535, -4056,   346,  1256,  -835,     5,   268,  -127,    -8,    22,    -3,
+        0,    -2,    32,   -53,   -78,   357,  -321,  -570,  1747, -1123, -3219, 11521,
+    21126,  6477, -4058,   362,  1248,  -837,     9,   267,  -128,    -8,    22,    -3,
+        0,    -2,    32,   -53,   -77,   358,  -325,  -565,  1750, -1141, -3200, 11579,
+    21111,  6419, -4059,   377,  1241,  -838,    12,   265,  -128,    -7,    22,    -3,
+        0,    -2,    32,   -54,   -76,   358,  -329,  -560,  1754, -1160, -3181, 11638,
+    21098,  6361, -4061,   392,  1233,  -839,    16,   264,  -128,    -7,    22,    -3,
+        0,    -2,    32,   -54,   -75,   359,  -333,  -555,  1757, -1179, -3162, 11697,
+    21084,  6303, -4062,   407,  1225,  -840,    19,   262,  -128,    -6,    22,    -3,
+        0,    -2,    33,   -55,   -74,   359,  -337,  -550,  1760, -1198, -3143, 11756,
+    21071,  6245, -4063,   423,  1217,  -842,    23,   261,  -129,    -6,    22,    -3,
+        0,    -2,    33,   -56,   -73,   360,  -341,  -545,  1764, -1217, -3123, 11814,
+    21055,  6188, -4064,   438,  1210,  -843,    26,   259,  -129,    -5,    22,    -3,
+        0,    -2,    33,   -56,   -72,   360,  -345,  -539,  1767, -1236, -3103, 11873,
+    21039,  6130, -4064,   453,  1202,  -844,    30,   258,  -129,    -5,    21,    -3,
+        0,    -2,    33,   -57,   -71,   361,  -349,  -534,  1770, -1254, -3084, 11932,
+    21026,  6072, -4065,   468,  1194,  -845,    33,   256,  -129,    -5,    21,    -3,
+        0,    -2,    33,   -57,   -71,   361,  -353,  -529,  1773, -1273, -3063, 11990,
+    21010,  6015, -4065,   483,  1186,  -846,    36,   255,  -129,    -4,    21,    -3,
+        0,    -2,    33,   -58,   -70,   362,  -357,  -524,  1776, -1292, -3043, 12048,
+    20998,  5957, -4065,   497,  1178,  -847,    40,   253,  -130,    -4,    21,    -3,
+        0,    -2,    33,   -58,   -69,   362,  -361,  -519,  1779, -1311, -3022, 12107,
+    20980,  5900, -4065,   512,  1170,  -848,    43,   252,  -130,    -3,    21,    -3,
+        0,    -2,    33,   -59,   -68,   363,  -365,  -513,  1782, -1330, -3001, 12165,
+    20964,  5842, -4065,   527,  1162,  -849,    47,   250,  -130,    -3,    21,    -3,
+        0,    -2,    33,   -60,   -67,   363,  -369,  -508,  1785, -1349, -2980, 12223,
+    20947,  5785, -4064,   542,  1154,  -850,    50,   249,  -130,    -2,    21,    -3,
+        0,    -2,    33,   -60,   -66,   363,  -373,  -502,  1787, -1368, -2959, 12281,
+    20934,  5728, -4064,   556,  1146,  -851,    53,   247,  -130,    -2,    20,    -3,
+        0,    -2,    33,   -61,   -65,   364,  -377,  -497,  1790, -1387, -2938, 12340,
+    20913,  5671, -4063,   571,  1138,  -851,    57,   246,  -130,    -1,    20,    -3,
+        0,    -2,    33,   -61,   -64,   364,  -381,  -491,  1793, -1405, -2916, 12398,
+    20896,  5614, -4062,   585,  1130,  -852,    60,   244,  -131,    -1,    20,    -3,
+        0,    -2,    33,   -62,   -62,   364,  -385,  -486,  1795, -1424, -2894, 12455,
+    20881,  5557, -4061,   599,  1122,  -853,    63,   243,  -131,    -1,    20,    -3,
+        0,    -2,    33,   -63,   -61,   365,  -390,  -480,  1798, -1443, -2872, 12513,
+    20863,  5500, -4060,   614,  1114,  -854,    66,   241,  -131,     0,    20,    -3,
+        0,    -2,    33,   -63,   -60,   365,  -394,  -475,  1800, -1462, -2850, 12571,
+    20845,  5443, -4058,   628,  1105,  -854,    70,   240,  -131,     0,    20,    -3,
+        0,    -2,    33,   -64,   -59,   365,  -398,  -469,  1802, -1481, -2827, 12629,
+    20827,  5387, -4057,   642,  1097,  -855,    73,   238,  -131,     1,    20,    -3,
+        0,    -2,    33,   -64,   -58,   366,  -402,  -463,  1804, -1500, -2804, 12686,
+    20809,  5330, -4055,   656,  1089,  -855,    76,   236,  -131,     1,    19,    -3,
+        0,    -1,    34,   -65,   -57,   366,  -406,  -458,  1807, -1519, -2781, 12744,
+    20788,  5274, -4053,   670,  1081,  -856,    79,   235,  -131,     1,    19,    -3,
+        0,    -1,    34,   -65,   -56,   366,  -410,  -452,  1809, -1538, -2758, 12801,
+    20769,  5217, -4051,   684,  1073,  -856,    83,   233,  -132,     2,    19,    -3,
+        0,    -1,    34,   -66,   -55,   366,  -414,  -446,  1811, -1557, -2735, 12859,
+    20751,  5161, -4049,   698,  1064,  -857,    86,   232,  -132,     2,    19,    -3,
+        0,    -1,    34,   -67,   -54,   367,  -418,  -440,  1813, -1575, -2711, 12916,
+    20728,  5105, -4046,   712,  1056,  -857,    89,   230,  -132,     3,    19,    -3,
+        0,    -1,    34,   -67,   -53,   367,  -422,  -434,  1815, -1594, -2687, 12973,
+    20708,  5049, -4043,   725,  1048,  -858,    92,   229,  -132,     3,    19,    -3,
+        0,    -1,    34,   -68,   -52,   367,  -426,  -428,  1816, -1613, -2663, 13031,
+    20690,  4993, -4041,   739,  1039,  -858,    95,   227,  -132,     3,    19,    -3,
+        0,    -1,    34,   -68,   -51,   367,  -430,  -423,  1818, -1632, -2639, 13088,
+    20671,  4937, -4038,   752,  1031,  -858,    98,   225,  -132,     4,    18,    -3,
+        0,    -1,    34,   -69,   -50,   367,  -434,  -417,  1820, -1651, -2615, 13145,
+    20650,  4881, -4035,   766,  1023,  -859,   102,   224,  -132,     4,    18,    -3,
+        0,    -1,    34,   -69,   -48,   368,  -438,  -411,  1821, -1670, -2590, 13201,
+    20628,  4825, -4031,   779,  1014,  -859,   105,   222,  -132,     5,    18,    -3,
+        0,    -1,    34,   -70,   -47,   368,  -442,  -404,  1823, -1688, -2565, 13258,
+    20604,  4769, -4028,   793,  1006,  -859,   108,   221,  -132,     5,    18,    -3,
+        0,    -1,    34,   -71,   -46,   368,  -445,  -398,  1824, -1707, -2540, 13315,
+    20583,  4714, -4024,   806,   997,  -859,   111,   219,  -132,     5,    18,    -3,
+        0,    -1,    34,   -71,   -45,   368,  -449,  -392,  1826, -1726, -2515, 13372,
+    20560,  4659, -4021,   819,   989,  -859,   114,   217,  -132,     6,    18,    -3,
+        0,    -1,    34,   -72,   -44,   368,  -453,  -386,  1827, -1745, -2489, 13428,
+    20539,  4603, -4017,   832,   981,  -859,   117,   216,  -132,     6,    18,    -3,
+        0,    -1,    34,   -72,   -43,   368,  -457,  -380,  1828, -1764, -2463, 13484,
+    20518,  4548, -4013,   845,   972,  -859,   120,   214,  -132,     7,    17,    -3,
+        0,    -1,    34,   -73,   -42,   368,  -461,  -374,  1829, -1782, -2437, 13541,
+    20493,  4493, -4008,   858,   964,  -859,   123,   213,  -132,     7,    17,    -3,
+        0,    -1,    34,   -74,   -40,   368,  -465,  -367,  1830, -1801, -2411, 13597,
+    20471,  4438, -4004,   871,   955,  -859,   126,   211,  -132,     7,    17,    -3,
+        0,    -1,    34,   -74,   -39,   368,  -469,  -361,  1831, -1820, -2385, 13653,
+    20448,  4383, -4000,   884,   947,  -859,   129,   209,  -132,     8,    17,    -3,
+        0,    -1,    34,   -75,   -38,   368,  -473,  -355,  1832, -1838, -2358, 13709,
+    20424,  4328, -3995,   897,   938,  -859,   132,   208,  -132,     8,    17,    -3,
+        0,    -1,    34,   -75,   -37,   368,  -477,  -348,  1833, -1857, -2331, 13765,
+    20399,  4274, -3990,   909,   930,  -859,   135,   206,  -132,     8,    17,    -3,
+        0,     0,    34,   -76,   -36,   368,  -481,  -342,  1834, -1876, -2304, 13821,
+    20375,  4219, -3985,   922,   921,  -859,   138,   204,  -132,     9,    17,    -3,
+        0,     0,    34,   -76,   -34,   368,  -485,  -335,  1834, -1894, -2277, 13876,
+    20350,  4165, -3980,   934,   912,  -858,   141,   203,  -132,     9,    16,    -3,
+        0,     0,    34,   -77,   -33,   368,  -489,  -329,  1835, -1913, -2250, 13932,
+    20327,  4111, -3975,   947,   904,  -858,   143,   201,  -132,     9,    16,    -3,
+        0,     0,    34,   -78,   -32,   368,  -492,  -322,  1835, -1932, -2222, 13987,
+    20303,  4056, -3969,   959,   895,  -858,   146,   199,  -132,    10,    16,    -3,
+        0,     0,    34,   -78,   -31,   368,  -496,  -316,  1836, -1950, -2194, 14043,
+    20275,  4002, -3964,   971,   887,  -857,   149,   198,  -132,    10,    16,    -3,
+        0,     0,    34,   -79,   -30,   367,  -500,  -309,  1836, -1969, -2166, 14098,
+    20252,  3948, -3958,   983,   878,  -857,   152,   196,  -132,    11,    16,    -3,
+        0,     0,    34,   -79,   -28,   367,  -504,  -303,  1836, -1987, -2138, 14153,
+    20227,  3894, -3952,   995,   869,  -857,   155,   194,  -132,    11,    16,    -3,
+        0,     0,    34,   -80,   -27,   367,  -508,  -296,  1837, -2006, -2109, 14208,
+    20198,  3841, -3946,  1007,   861,  -856,   158,   193,  -132,    11,    16,    -3,
+        0,     0,    34,   -80,   -26,   367,  -512,  -289,  1837, -2024, -2081, 14263,
+    20174,  3787, -3940,  1019,   852,  -856,   160,   191,  -132,    12,    15,    -3,
+        0,     0,    34,   -81,   -24,   367,  -515,  -282,  1837, -2043, -2052, 14318,
+    20145,  3734, -3933,  1031,   843,  -855,   163,   189,  -132,    12,    15,    -3,
+        0,     0,    34,   -81,   -23,   367,  -519,  -276,  1837, -2061, -2022, 14372,
+    20118,  3680, -3927,  1043,   835,  -855,   166,   188,  -132,    12,    15,    -3,
+        0,     0,    34,   -82,   -22,   366,  -523,  -269,  1837, -2080, -1993, 14427,
+    20091,  3627, -3920,  1055,   826,  -854,   169,   186,  -132,    13,    15,    -3,
+        0,     0,    34,   -83,   -21,   366,  -527,  -262,  1836, -2098, -1963, 14481,
+    20065,  3574, -3913,  1066,   817,  -853,   171,   185,  -132,    13,    15,    -3,
+        0,     0,    34,   -83,   -19,   366,  -531,  -255,  1836, -2116, -1934, 14536,
+    20036,  3521, -3906,  1078,   808,  -853,   174,   183,  -132,    13,    15,    -3,
+        0,     0,    34,   -84,   -18,   366,  -534,  -248,  1836, -2135, -1904, 14590,
+    20007,  3468, -3899,  1089,   800,  -852,   177,   181,  -132,    14,    15,    -3,
+        0,     1,    34,   -84,   -17,   365,  -538,  -241,  1835, -2153, -1873, 14644,
+    19979,  3416, -3892,  1100,   791,  -851,   179,   179,  -131,    14,    14,    -3,
+        0,     1,    34,   -85,   -15,   365,  -542,  -234,  1835, -2171, -1843, 14698,
+    19949,  3363, -3885,  1112,   782,  -850,   182,   178,  -131,    14,    14,    -3,
+        0,     1,    34,   -85,   -14,   365,  -546,  -227,  1834, -2189, -1812, 14751,
+    19920,  3311, -3877,  1123,   773,  -850,   185,   176,  -131,    15,    14,    -3,
+        0,     1,    34,   -86,   -13,   364,  -549,  -220,  1833, -2207, -1782, 14805,
+    19894,  3258, -3870,  1134,   765,  -849,   187,   174,  -131,    15,    14,    -3,
+       -1,     1,    34,   -86,   -12,   364,  -553,  -213,  1833, -2226, -1751, 14859,
+    19864,  3206, -3862,  1145,   756,  -848,   190,   173,  -131,    15,    14,    -3,
+       -1,     1,    34,   -87,   -10,   363,  -557,  -206,  1832, -2244, -1719, 14912,
+    19834,  3154, -3854,  1156,   747,  -847,   193,   171,  -131,    15,    14,    -2,
+       -1,     1,    34,   -88,    -9,   363,  -560,  -199,  1831, -2262, -1688, 14965,
+    19805,  3102, -3846,  1167,   738,  -846,   195,   169,  -131,    16,    14,    -2,
+       -1,     1,    34,   -88,    -8,   363,  -564,  -192,  1830, -2280, -1656, 15018,
+    19774,  3050, -3838,  1178,   730,  -845,   198,   168,  -131,    16,    13,    -2,
+       -1,     1,    34,   -89,    -6,   362,  -568,  -185,  1829, -2298, -1624, 15071,
+    19744,  2999, -3829,  1188,   721,  -844,   200,   166,  -130,    16,    13,    -2,
+       -1,     1,    34,   -89,    -5,   362,  -571,  -178,  1828, -2316, -1592, 15124,
+    19712,  2947, -3821,  1199,   712,  -843,   203,   164,  -130,    17,    13,    -2,
+       -1,     1,    34,   -90,    -3,   361,  -575,  -170,  1826, -2334, -1560, 15177,
+    19682,  2896, -3812,  1209,   703,  -842,   205,   163,  -130,    17,    13,    -2,
+       -1,     1,    34,   -90,    -2,   361,  -579,  -163,  1825, -2351, -1527, 15229,
+    19649,  2845, -3804,  1220,   695,  -841,   208,   161,  -130,    17,    13,    -2,
+       -1,     1,    34,   -91,    -1,   360,  -582,  -156,  1824, -2369, -1495, 15282,
+    19619,  2794, -3795,  1230,   686,  -840,   210,   159,  -130,    18,    13,    -2,
+       -1,     1,    34,   -91,     1,   360,  -586,  -148,  1822, -2387, -1462, 15334,
+    19585,  2743, -3786,  1240,   677,  -838,   213,   158,  -130,    18,    13,    -2,
+       -1,     2,    34,   -92,     2,   359,  -589,  -141,  1820, -2405, -1429, 15386,
+    19555,  2692, -3777,  1251,   668,  -837,   215,   156,  -129,    18,    12,    -2,
+       -1,     2,    34,   -92,     3,   359,  -593,  -134,  1819, -2423, -1395, 15438,
+    19523,  2641, -3767,  1261,   659,  -836,   217,   154,  -129,    18,    12,    -2,
+       -1,     2,    34,   -93,     5,   358,  -596,  -126,  1817, -2440, -1362, 15490,
+    19488,  2591, -3758,  1271,   650,  -835,   220,   153,  -129,    19,    12,    -2,
+       -1,     2,    34,   -93,     6,   357,  -600,  -119,  1815, -2458, -1328, 15542,
+    19457,  2540, -3749,  1281,   642,  -833,   222,   151,  -129,    19,    12,    -2,
+       -1,     2,    34,   -94,     8,   357,  -603,  -111,  1813, -2475, -1294, 15593,
+    19424,  2490, -3739,  1290,   633,  -832,   224,   149,  -129,    19,    12,    -2,
+       -1,     2,    33,   -95,     9,   356,  -607,  -104,  1811, -2493, -1260, 15644,
+    19392,  2440, -3729,  1300,   624,  -831,   227,   148,  -128,    20,    12,    -2,
+       -1,     2,    33,   -95,    11,   355,  -610,   -96,  1809, -2510, -1226, 15696,
+    19356,  2390, -3719,  1310,   615,  -829,   229,   146,  -128,    20,    12,    -2,
+       -1,     2,    33,   -96,    12,   355,  -614,   -89,  1807, -2528, -1191, 15747,
+    19327,  2340, -3709,  1319,   606,  -828,   231,   144,  -128,    20,    11,    -2,
+       -1,     2,    33,   -96,    13,   354,  -617,   -81,  1805, -2545, -1156, 15798,
+    19288,  2291, -3699,  1329,   598,  -826,   234,   143,  -128,    20,    11,    -2,
+       -1,     2,    33,   -97,    15,   353,  -621,   -74,  1802, -2562, -1121, 15848,
+    19258,  2241, -3689,  1338,   589,  -825,   236,   141,  -128,    21,    11,    -2,
+       -1,     2,    33,   -97,    16,   353,  -624,   -66,  1800, -2580, -1086, 15899,
+    19220,  2192, -3678,  1348,   580,  -823,   238,   139,  -127,    21,    11,    -2,
+       -1,     3,    33,   -98,    18,   352,  -628,   -58,  1797, -2597, -1051, 15949,
+    19188,  2143, -3668,  1357,   571,  -822,   240,   137,  -127,    21,    11,    -2,
+       -1,     3,    33,   -98,    19,   351,  -631,   -51,  1795, -2614, -1015, 16000,
+    19150,  2094, -3657,  1366,   562,  -820,   243,   136,  -127,    21,    11,    -2,
+       -1,     3,    33,   -99,    21,   350,  -634,   -43,  1792, -2631,  -979, 16050,
+    19114,  2045, -3647,  1375,   554,  -818,   245,   134,  -127,    22,    11,    -2,
+       -1,     3,    33,   -99,    22,   349,  -638,   -35,  1789, -2648,  -943, 16100,
+    19080,  1996, -3636,  1384,   545,  -817,   247,   132,  -126,    22,    11,    -2,
+       -1,     3,    33,  -100,    24,   349,  -641,   -27,  1786, -2665,  -907, 16149,
+    19044,  1948, -3625,  1393,   536,  -815,   249,   131,  -126,    22,    10,    -2,
+       -1,     3,    33,  -100,    25,   348,  -644,   -20,  1783, -2682,  -871, 16199,
+    19010,  1899, -3614,  1402,   527,  -813,   251,   129,  -126,    22,    10,    -2,
+       -1,     3,    33,  -101,    27,   347,  -648,   -12,  1780, -2699,  -834, 16249,
+    18973,  1851, -3602,  1410,   518,  -811,   253,   127,  -126,    23,    10,    -2,
+       -1,     3,    33,  -101,    28,   346,  -651,    -4,  1777, -2716,  -797, 16298,
+    18935,  1803, -3591,  1419,   510,  -810,   255,   126,  -125,    23,    10,    -2,
+       -1,     3,    32,  -102,    29,   345,  -654,     4,  1774, -2732,  -760, 16347,
+    18900,  1755, -3580,  1428,   501,  -808,   257,   124,  -125,    23,    10,    -2,
+       -1,     3,    32,  -102,    31,   344,  -657,    12,  1771, -2749,  -723, 16396,
+    18862,  1708, -3568,  1436,   492,  -806,   259,   122,  -125,    23,    10,    -2,
+       -1,     3,    32,  -103,    32,   343,  -661,    20,  1767, -2766,  -686, 16445,
+    18826,  1660, -3556,  1444,   483,  -804,   261,   121,  -124,    24,    10,    -2,
+       -1,     4,    32,  -103,    34,   342,  -664,    28,  1764, -2782,  -648, 16493,
+    18786,  1613, -3545,  1453,   475,  -802,   263,   119,  -124,    24,     9,    -2,
+       -1,     4,    32,  -104,    35,   341,  -667,    36,  1760, -2799,  -610, 16542,
+    18751,  1565, -3533,  1461,   466,  -800,   265,   117,  -124,    24,     9,    -2,
+       -1,     4,    32,  -104,    37,   340,  -670,    44,  1756, -2815,  -573, 16590,
+    18713,  1518, -3521,  1469,   457,  -798,   267,   116,  -124,    24,     9,    -2,
+       -1,     4,    32,  -105,    39,   339,  -673,    52,  1753, -2831,  -534, 16638,
+    18673,  1471, -3509,  1477,   448,  -796,   269,   114,  -123,    24,     9,    -2,
+       -1,     4,    32,  -105,    40,   338,  -677,    60,  1749, -2848,  -496, 16686,
+    18634,  1425, -3496,  1485,   440,  -794,   271,   112,  -123,    25,     9,    -2,
+       -1,     4,    32,  -105,    42,   337,  -680,    68,  1745, -2864,  -457, 16733,
+    18595,  1378, -3484,  1493,   431,  -792,   273,   111,  -123,    25,     9,    -2,
+       -1,     4,    32,  -106,    43,   336,  -683,    76,  1741, -2880,  -419, 16781,
+    18558,  1332, -3472,  1500,   422,  -790,   275,   109,  -122,    25,     9,    -2,
+       -1,     4,    31,  -106,    45,   335,  -686,    84,  1737, -2896,  -380, 16828,
+    18520,  1285, -3459,  1508,   413,  -788,   277,   107,  -122,    25,     9,    -2,
+       -1,     4,    31,  -107,    46,   334,  -689,    92,  1733, -2912,  -341, 16875,
+    18480,  1239, -3446,  1516,   405,  -786,   279,   106,  -122,    26,     8,    -2,
+       -1,     4,    31,  -107,    48,   333,  -692,   100,  1728, -2928,  -301, 16922,
+    18441,  1193, -3434,  1523,   396,  -784,   281,   104,  -121,    26,     8,    -2,
+       -1,     5,    31,  -108,    49,   331,  -695,   108,  1724, -2944,  -262, 16969,
+    18403,  1148, -3421,  1530,   387,  -781,   282,   102,  -121,    26,     8,    -2,
+       -1,     5,    31,  -108,    51,   330,  -698,   117,  1720, -2960,  -222, 17016,
+    18359,  1102, -3408,  1538,   379,  -779,   284,   101,  -121,    26,     8,    -2,
+       -1,     5,    31,  -109,    52,   329,  -701,   125,  1715, -2975,  -182, 17062,
+    18320,  1057, -3395,  1545,   370,  -777,   286,    99,  -120,    26,     8,    -2,
+       -1,     5,    31,  -109,    54,   328,  -704,   133,  1710, -2991,  -142, 17108,
+    18281,  1011, -3382,  1552,   361,  -775,   288,    97,  -120,    27,     8,    -2,
+       -1,     5,    31,  -110,    55,   327,  -707,   141,  1706, -3007,  -102, 17154,
+    18239,   966, -3368,  1559,   353,  -772,   290,    96,  -120,    27,     8,    -2,
+       -1,     5,    31,  -110,    57,   325,  -710,   149,  1701, -3022,   -61, 17200,
+    18199,   921, -3355,  1566,   344,  -770,   291,    94,  -119,    27,     8,    -2,
+       -1,     5,    30,  -110,    59,   324,  -713,   158,  1696, -3037,   -20, 17246,
+    18156,   877, -3341,  1573,   335,  -768,   293,    92,  -119,    27,     8,    -2,
+       -1,     5,    30,  -111,    60,   323,  -715,   166,  1691, -3053,    20, 17291,
+    18117,   832, -3328,  1580,   327,  -765,   295,    91,  -119,    27,     7,    -2,
+       -1,     5,    30,  -111,    62,   322,  -718,   174,  1686, -3068,    62, 17336,
+    18075,   788, -3314,  1586,   318,  -763,   296,    89,  -118,    27,     7,    -2,
+       -1,     5,    30,  -112,    63,   320,  -721,   183,  1681, -3083,   103, 17381,
+    18032,   744, -3300,  1593,   310,  -761,   298,    88,  -118,    28,     7,    -2,
+       -1,     6,    30,  -112,    65,   319,  -724,   191,  1676, -3098,   144, 17426,
+    17989,   700, -3287,  1599,   301,  -758,   300,    86,  -117,    28,     7,    -2,
+       -1,     6,    30,  -113,    67,   317,  -727,   199,  1670, -3113,   186, 17471,
+    17948,   656, -3273,  1606,   293,  -756,   301,    84,  -117,    28,     7,    -1,
+       -1,     6,    30,  -113,    68,   316,  -729,   208,  1665, -3128,   228, 17515,
+    17904,   612, -3259,  1612,   284,  -753,   303,    83,  -117,    28,     7,    -1,
+       -1,     6,    29,  -113,    70,   315,  -732,   216,  1659, -3143,   270, 17560,
+    17862,   569, -3244,  1618,   275,  -751,   304,    81,  -116,    28,     7,    -1,
+       -1,     6,    29,  -114,    71,   313,  -735,   225,  1654, -3158,   312, 17604,
+    17821,   525, -3230,  1624,   267,  -748,   306,    79,  -116,    28,     7,    -1,
+       -1,     6,    29,  -114,    73,   312,  -738,   233,  1648, -3172,   354, 17647,
+    17778,   482, -3216,  1630,   258,  -745,   307,    78,  -115,    29,     6,    -1,
+       -1,     6,    29,  -115,    75,   310,  -740,   242,  1642, -3187,   397, 17691,
+    17735,   439, -3202,  1636,   250,  -743,   309,    76,  -115,    29,     6,    -1,
+       -1,     6,    29,  -115,    76,   309,  -743,   250,  1636, -3202,   439, 17735,
+    17691,   397, -3187,  1642,   242,  -740,   310,    75,  -115,    29,     6,    -1,
+       -1,     6,    29,  -115,    78,   307,  -745,   258,  1630, -3216,   482, 17778,
+    17647,   354, -3172,  1648,   233,  -738,   312,    73,  -114,    29,     6,    -1,
+       -1,     7,    28,  -116,    79,   306,  -748,   267,  1624, -3230,   525, 17821,
+    17604,   312, -3158,  1654,   225,  -735,   313,    71,  -114,    29,     6,    -1,
+       -1,     7,    28,  -116,    81,   304,  -751,   275,  1618, -3244,   569, 17864,
+    17558,   270, -3143,  1659,   216,  -732,   315,    70,  -113,    29,     6,    -1,
+       -1,     7,    28,  -117,    83,   303,  -753,   284,  1612, -3259,   612, 17906,
+    17513,   228, -3128,  1665,   208,  -729,   316,    68,  -113,    30,     6,    -1,
+       -1,     7,    28,  -117,    84,   301,  -756,   293,  1606, -3273,   656, 17948,
+    17471,   186, -3113,  1670,   199,  -727,   317,    67,  -113,    30,     6,    -1,
+       -2,     7,    28,  -117,    86,   300,  -758,   301,  1599, -3287,   700, 17991,
+    17424,   144, -3098,  1676,   191,  -724,   319,    65,  -112,    30,     6,    -1,
+       -2,     7,    28,  -118,    88,   298,  -761,   310,  1593, -3300,   744, 18033,
+    17380,   103, -3083,  1681,   183,  -721,   320,    63,  -112,    30,     5,    -1,
+       -2,     7,    27,  -118,    89,   296,  -763,   318,  1586, -3314,   788, 18074,
+    17337,    62, -3068,  1686,   174,  -718,   322,    62,  -111,    30,     5,    -1,
+       -2,     7,    27,  -119,    91,   295,  -765,   327,  1580, -3328,   832, 18116,
+    17292,    20, -3053,  1691,   166,  -715,   323,    60,  -111,    30,     5,    -1,
+       -2,     8,    27,  -119,    92,   293,  -768,   335,  1573, -3341,   877, 18157,
+    17245,   -20, -3037,  1696,   158,  -713,   324,    59,  -110,    30,     5,    -1,
+       -2,     8,    27,  -119,    94,   291,  -770,   344,  1566, -3355,   921, 18198,
+    17201,   -61, -3022,  1701,   149,  -710,   325,    57,  -110,    31,     5,    -1,
+       -2,     8,    27,  -120,    96,   290,  -772,   353,  1559, -3368,   966, 18239,
+    17154,  -102, -3007,  1706,   141,  -707,   327,    55,  -110,    31,     5,    -1,
+       -2,     8,    27,  -120,    97,   288,  -775,   361,  1552, -3382,  1011, 18280,
+    17109,  -142, -2991,  1710,   133,  -704,   328,    54,  -109,    31,     5,    -1,
+       -2,     8,    26,  -120,    99,   286,  -777,   370,  1545, -3395,  1057, 18320,
+    17062,  -182, -2975,  1715,   125,  -701,   329,    52,  -109,    31,     5,    -1,
+       -2,     8,    26,  -121,   101,   284,  -779,   379,  1538, -3408,  1102, 18360,
+    17015,  -222, -2960,  1720,   117,  -698,   330,    51,  -108,    31,     5,    -1,
+       -2,     8,    26,  -121,   102,   282,  -781,   387,  1530, -3421,  1148, 18400,
+    16972,  -262, -2944,  1724,   108,  -695,   331,    49,  -108,    31,     5,    -1,
+       -2,     8,    26,  -121,   104,   281,  -784,   396,  1523, -3434,  1193, 18440,
+    16923,  -301, -2928,  1728,   100,  -692,   333,    48,  -107,    31,     4,    -1,
+       -2,     8,    26,  -122,   106,   279,  -786,   405,  1516, -3446,  1239, 18480,
+    16875,  -341, -2912,  1733,    92,  -689,   334,    46,  -107,    31,     4,    -1,
+       -2,     9,    25,  -122,   107,   277,  -788,   413,  1508, -3459,  1285, 18519,
+    16829,  -380, -2896,  1737,    84,  -686,   335,    45,  -106,    31,     4,    -1,
+       -2,     9,    25,  -122,   109,   275,  -790,   422,  1500, -3472,  1332, 18558,
+    16781,  -419, -2880,  1741,    76,  -683,   336,    43,  -106,    32,     4,    -1,
+       -2,     9,    25,  -123,   111,   273,  -792,   431,  1493, -3484,  1378, 18597,
+    16731,  -457, -2864,  1745,    68,  -680,   337,    42,  -105,    32,     4,    -1,
+       -2,     9,    25,  -123,   112,   271,  -794,   440,  1485, -3496,  1425, 18635,
+    16685,  -496, -2848,  1749,    60,  -677,   338,    40,  -105,    32,     4,    -1,
+       -2,     9,    24,  -123,   114,   269,  -796,   448,  1477, -3509,  1471, 18674,
+    16637,  -534, -2831,  1753,    52,  -673,   339,    39,  -105,    32,     4,    -1,
+       -2,     9,    24,  -124,   116,   267,  -798,   457,  1469, -3521,  1518, 18712,
+    16591,  -573, -2815,  1756,    44,  -670,   340,    37,  -104,    32,     4,    -1,
+       -2,     9,    24,  -124,   117,   265,  -800,   466,  1461, -3533,  1565, 18750,
+    16543,  -610, -2799,  1760,    36,  -667,   341,    35,  -104,    32,     4,    -1,
+       -2,     9,    24,  -124,   119,   263,  -802,   475,  1453, -3545,  1613, 18787,
+    16492,  -648, -2782,  1764,    28,  -664,   342,    34,  -103,    32,     4,    -1,
+       -2,    10,    24,  -124,   121,   261,  -804,   483,  1444, -3556,  1660, 18825,
+    16446,  -686, -2766,  1767,    20,  -661,   343,    32,  -103,    32,     3,    -1,
+       -2,    10,    23,  -125,   122,   259,  -806,   492,  1436, -3568,  1708, 18862,
+    16396,  -723, -2749,  1771,    12,  -657,   344,    31,  -102,    32,     3,    -1,
+       -2,    10,    23,  -125,   124,   257,  -808,   501,  1428, -3580,  1755, 18899,
+    16348,  -760, -2732,  1774,     4,  -654,   345,    29,  -102,    32,     3,    -1,
+       -2,    10,    23,  -125,   126,   255,  -810,   510,  1419, -3591,  1803, 18936,
+    16297,  -797, -2716,  1777,    -4,  -651,   346,    28,  -101,    33,     3,    -1,
+       -2,    10,    23,  -126,   127,   253,  -811,   518,  1410, -3602,  1851, 18972,
+    16250,  -834, -2699,  1780,   -12,  -648,   347,    27,  -101,    33,     3,    -1,
+       -2,    10,    22,  -126,   129,   251,  -813,   527,  1402, -3614,  1899, 19008,
+    16201,  -871, -2682,  1783,   -20,  -644,   348,    25,  -100,    33,     3,    -1,
+       -2,    10,    22,  -126,   131,   249,  -815,   536,  1393, -3625,  1948, 19044,
+    16149,  -907, -2665,  1786,   -27,  -641,   349,    24,  -100,    33,     3,    -1,
+       -2,    11,    22,  -126,   132,   247,  -817,   545,  1384, -3636,  1996, 19080,
+    16100,  -943, -2648,  1789,   -35,  -638,   349,    22,   -99,    33,     3,    -1,
+       -2,    11,    22,  -127,   134,   245,  -818,   554,  1375, -3647,  2045, 19116,
+    16048,  -979, -2631,  1792,   -43,  -634,   350,    21,   -99,    33,     3,    -1,
+       -2,    11,    21,  -127,   136,   243,  -820,   562,  1366, -3657,  2094, 19151,
+    15999, -1015, -2614,  1795,   -51,  -631,   351,    19,   -98,    33,     3,    -1,
+       -2,    11,    21,  -127,   137,   240,  -822,   571,  1357, -3668,  2143, 19186,
+    15951, -1051, -2597,  1797,   -58,  -628,   352,    18,   -98,    33,     3,    -1,
+       -2,    11,    21,  -127,   139,   238,  -823,   580,  1348, -3678,  2192, 19221,
+    15898, -1086, -2580,  1800,   -66,  -624,   353,    16,   -97,    33,     2,    -1,
+       -2,    11,    21,  -128,   141,   236,  -825,   589,  1338, -3689,  2241, 19255,
+    15851, -1121, -2562,  1802,   -74,  -621,   353,    15,   -97,    33,     2,    -1,
+       -2,    11,    20,  -128,   143,   234,  -826,   598,  1329, -3699,  2291, 19290,
+    15796, -1156, -2545,  1805,   -81,  -617,   354,    13,   -96,    33,     2,    -1,
+       -2,    11,    20,  -128,   144,   231,  -828,   606,  1319, -3709,  2340, 19324,
+    15750, -1191, -2528,  1807,   -89,  -614,   355,    12,   -96,    33,     2,    -1,
+       -2,    12,    20,  -128,   146,   229,  -829,   615,  1310, -3719,  2390, 19357,
+    15695, -1226, -2510,  1809,   -96,  -610,   355,    11,   -95,    33,     2,    -1,
+       -2,    12,    20,  -128,   148,   227,  -831,   624,  1300, -3729,  2440, 19391,
+    15645, -1260, -2493,  1811,  -104,  -607,   356,     9,   -95,    33,     2,    -1,
+       -2,    12,    19,  -129,   149,   224,  -832,   633,  1290, -3739,  2490, 19424,
+    15593, -1294, -2475,  1813,  -111,  -603,   357,     8,   -94,    34,     2,    -1,
+       -2,    12,    19,  -129,   151,   222,  -833,   642,  1281, -3749,  2540, 19457,
+    15542, -1328, -2458,  1815,  -119,  -600,   357,     6,   -93,    34,     2,    -1,
+       -2,    12,    19,  -129,   153,   220,  -835,   650,  1271, -3758,  2591, 19490,
+    15488, -1362, -2440,  1817,  -126,  -596,   358,     5,   -93,    34,     2,    -1,
+       -2,    12,    18,  -129,   154,   217,  -836,   659,  1261, -3767,  2641, 19523,
+    15438, -1395, -2423,  1819,  -134,  -593,   359,     3,   -92,    34,     2,    -1,
+       -2,    12,    18,  -129,   156,   215,  -837,   668,  1251, -3777,  2692, 19555,
+    15386, -1429, -2405,  1820,  -141,  -589,   359,     2,   -92,    34,     2,    -1,
+       -2,    13,    18,  -130,   158,   213,  -838,   677,  1240, -3786,  2743, 19587,
+    15332, -1462, -2387,  1822,  -148,  -586,   360,     1,   -91,    34,     1,    -1,
+       -2,    13,    18,  -130,   159,   210,  -840,   686,  1230, -3795,  2794, 19619,
+    15282, -1495, -2369,  1824,  -156,  -582,   360,    -1,   -91,    34,     1,    -1,
+       -2,    13,    17,  -130,   161,   208,  -841,   695,  1220, -3804,  2845, 19650,
+    15228, -1527, -2351,  1825,  -163,  -579,   361,    -2,   -90,    34,     1,    -1,
+       -2,    13,    17,  -130,   163,   205,  -842,   703,  1209, -3812,  2896, 19681,
+    15178, -1560, -2334,  1826,  -170,  -575,   361,    -3,   -90,    34,     1,    -1,
+       -2,    13,    17,  -130,   164,   203,  -843,   712,  1199, -3821,  2947, 19712,
+    15124, -1592, -2316,  1828,  -178,  -571,   362,    -5,   -89,    34,     1,    -1,
+       -2,    13,    16,  -130,   166,   200,  -844,   721,  1188, -3829,  2999, 19743,
+    15072, -1624, -2298,  1829,  -185,  -568,   362,    -6,   -89,    34,     1,    -1,
+       -2,    13,    16,  -131,   168,   198,  -845,   730,  1178, -3838,  3050, 19774,
+    15018, -1656, -2280,  1830,  -192,  -564,   363,    -8,   -88,    34,     1,    -1,
+       -2,    14,    16,  -131,   169,   195,  -846,   738,  1167, -3846,  3102, 19804,
+    14966, -1688, -2262,  1831,  -199,  -560,   363,    -9,   -88,    34,     1,    -1,
+       -2,    14,    15,  -131,   171,   193,  -847,   747,  1156, -3854,  3154, 19834,
+    14912, -1719, -2244,  1832,  -206,  -557,   363,   -10,   -87,    34,     1,    -1,
+       -3,    14,    15,  -131,   173,   190,  -848,   756,  1145, -3862,  3206, 19863,
+    14860, -1751, -2226,  1833,  -213,  -553,   364,   -12,   -86,    34,     1,    -1,
+       -3,    14,    15,  -131,   174,   187,  -849,   765,  1134, -3870,  3258, 19893,
+    14806, -1782, -2207,  1833,  -220,  -549,   364,   -13,   -86,    34,     1,     0,
+       -3,    14,    15,  -131,   176,   185,  -850,   773,  1123, -3877,  3311, 19922,
+    14749, -1812, -2189,  1834,  -227,  -546,   365,   -14,   -85,    34,     1,     0,
+       -3,    14,    14,  -131,   178,   182,  -850,   782,  1112, -3885,  3363, 19951,
+    14696, -1843, -2171,  1835,  -234,  -542,   365,   -15,   -85,    34,     1,     0,
+       -3,    14,    14,  -131,   179,   179,  -851,   791,  1100, -3892,  3416, 19979,
+    14644, -1873, -2153,  1835,  -241,  -538,   365,   -17,   -84,    34,     1,     0,
+       -3,    15,    14,  -132,   181,   177,  -852,   800,  1089, -3899,  3468, 20008,
+    14589, -1904, -2135,  1836,  -248,  -534,   366,   -18,   -84,    34,     0,     0,
+       -3,    15,    13,  -132,   183,   174,  -853,   808,  1078, -3906,  3521, 20036,
+    14536, -1934, -2116,  1836,  -255,  -531,   366,   -19,   -83,    34,     0,     0,
+       -3,    15,    13,  -132,   185,   171,  -853,   817,  1066, -3913,  3574, 20064,
+    14482, -1963, -2098,  1836,  -262,  -527,   366,   -21,   -83,    34,     0,     0,
+       -3,    15,    13,  -132,   186,   169,  -854,   826,  1055, -3920,  3627, 20091,
+    14427, -1993, -2080,  1837,  -269,  -523,   366,   -22,   -82,    34,     0,     0,
+       -3,    15,    12,  -132,   188,   166,  -855,   835,  1043, -3927,  3680, 20118,
+    14372, -2022, -2061,  1837,  -276,  -519,   367,   -23,   -81,    34,     0,     0,
+       -3,    15,    12,  -132,   189,   163,  -855,   843,  1031, -3933,  3734, 20145,
+    14318, -2052, -2043,  1837,  -282,  -515,   367,   -24,   -81,    34,     0,     0,
+       -3,    15,    12,  -132,   191,   160,  -856,   852,  1019, -3940,  3787, 20172,
+    14265, -2081, -2024,  1837,  -289,  -512,   367,   -26,   -80,    34,     0,     0,
+       -3,    16,    11,  -132,   193,   158,  -856,   861,  1007, -3946,  3841, 20199,
+    14207, -2109, -2006,  1837,  -296,  -508,   367,   -27,   -80,    34,     0,     0,
+       -3,    16,    11,  -132,   194,   155,  -857,   869,   995, -3952,  3894, 20225,
+    14155, -2138, -1987,  1836,  -303,  -504,   367,   -28,   -79,    34,     0,     0,
+       -3,    16,    11,  -132,   196,   152,  -857,   878,   983, -3958,  3948, 20251,
+    14099, -2166, -1969,  1836,  -309,  -500,   367,   -30,   -79,    34,     0,     0,
+       -3,    16,    10,  -132,   198,   149,  -857,   887,   971, -3964,  4002, 20276,
+    14042, -2194, -1950,  1836,  -316,  -496,   368,   -31,   -78,    34,     0,     0,
+       -3,    16,    10,  -132,   199,   146,  -858,   895,   959, -3969,  4056, 20302,
+    13988, -2222, -1932,  1835,  -322,  -492,   368,   -32,   -78,    34,     0,     0,
+       -3,    16,     9,  -132,   201,   143,  -858,   904,   947, -3975,  4111, 20327,
+    13932, -2250, -1913,  1835,  -329,  -489,   368,   -33,   -77,    34,     0,     0,
+       -3,    16,     9,  -132,   203,   141,  -858,   912,   934, -3980,  4165, 20352,
+    13874, -2277, -1894,  1834,  -335,  -485,   368,   -34,   -76,    34,     0,     0,
+       -3,    17,     9,  -132,   204,   138,  -859,   921,   922, -3985,  4219, 20376,
+    13820, -2304, -1876,  1834,  -342,  -481,   368,   -36,   -76,    34,     0,     0,
+       -3,    17,     8,  -132,   206,   135,  -859,   930,   909, -3990,  4274, 20401,
+    13763, -2331, -1857,  1833,  -348,  -477,   368,   -37,   -75,    34,    -1,     0,
+       -3,    17,     8,  -132,   208,   132,  -859,   938,   897, -3995,  4328, 20425,
+    13708, -2358, -1838,  1832,  -355,  -473,   368,   -38,   -75,    34,    -1,     0,
+       -3,    17,     8,  -132,   209,   129,  -859,   947,   884, -4000,  4383, 20448,
+    13653, -2385, -1820,  1831,  -361,  -469,   368,   -39,   -74,    34,    -1,     0,
+       -3,    17,     7,  -132,   211,   126,  -859,   955,   871, -4004,  4438, 20472,
+    13596, -2411, -1801,  1830,  -367,  -465,   368,   -40,   -74,    34,    -1,     0,
+       -3,    17,     7,  -132,   213,   123,  -859,   964,   858, -4008,  4493, 20495,
+    13539, -2437, -1782,  1829,  -374,  -461,   368,   -42,   -73,    34,    -1,     0,
+       -3,    17,     7,  -132,   214,   120,  -859,   972,   845, -4013,  4548, 20518,
+    13484, -2463, -1764,  1828,  -380,  -457,   368,   -43,   -72,    34,    -1,     0,
+       -3,    18,     6,  -132,   216,   117,  -859,   981,   832, -4017,  4603, 20540,
+    13427, -2489, -1745,  1827,  -386,  -453,   368,   -44,   -72,    34,    -1,     0,
+       -3,    18,     6,  -132,   217,   114,  -859,   989,   819, -4021,  4659, 20563,
+    13369, -2515, -1726,  1826,  -392,  -449,   368,   -45,   -71,    34,    -1,     0,
+       -3,    18,     5,  -132,   219,   111,  -859,   997,   806, -4024,  4714, 20585,
+    13313, -2540, -1707,  1824,  -398,  -445,   368,   -46,   -71,    34,    -1,     0,
+       -3,    18,     5,  -132,   221,   108,  -859,  1006,   793, -4028,  4769, 20606,
+    13256, -2565, -1688,  1823,  -404,  -442,   368,   -47,   -70,    34,    -1,     0,
+       -3,    18,     5,  -132,   222,   105,  -859,  1014,   779, -4031,  4825, 20628,
+    13201, -2590, -1670,  1821,  -411,  -438,   368,   -48,   -69,    34,    -1,     0,
+       -3,    18,     4,  -132,   224,   102,  -859,  1023,   766, -4035,  4881, 20649,
+    13146, -2615, -1651,  1820,  -417,  -434,   367,   -50,   -69,    34,    -1,     0,
+       -3,    18,     4,  -132,   225,    98,  -858,  1031,   752, -4038,  4937, 20670,
+    13089, -2639, -1632,  1818,  -423,  -430,   367,   -51,   -68,    34,    -1,     0,
+       -3,    19,     3,  -132,   227,    95,  -858,  1039,   739, -4041,  4993, 20690,
+    13031, -2663, -1613,  1816,  -428,  -426,   367,   -52,   -68,    34,    -1,     0,
+       -3,    19,     3,  -132,   229,    92,  -858,  1048,   725, -4043,  5049, 20711,
+    12970, -2687, -1594,  1815,  -434,  -422,   367,   -53,   -67,    34,    -1,     0,
+       -3,    19,     3,  -132,   230,    89,  -857,  1056,   712, -4046,  5105, 20731,
+    12913, -2711, -1575,  1813,  -440,  -418,   367,   -54,   -67,    34,    -1,     0,
+       -3,    19,     2,  -132,   232,    86,  -857,  1064,   698, -4049,  5161, 20750,
+    12860, -2735, -1557,  1811,  -446,  -414,   366,   -55,   -66,    34,    -1,     0,
+       -3,    19,     2,  -132,   233,    83,  -856,  1073,   684, -4051,  5217, 20770,
+    12800, -2758, -1538,  1809,  -452,  -410,   366,   -56,   -65,    34,    -1,     0,
+       -3,    19,     1,  -131,   235,    79,  -856,  1081,   670, -4053,  5274, 20789,
+    12743, -2781, -1519,  1807,  -458,  -406,   366,   -57,   -65,    34,    -1,     0,
+       -3,    19,     1,  -131,   236,    76,  -855,  1089,   656, -4055,  5330, 20808,
+    12687, -2804, -1500,  1804,  -463,  -402,   366,   -58,   -64,    33,    -2,     0,
+       -3,    20,     1,  -131,   238,    73,  -855,  1097,   642, -4057,  5387, 20827,
+    12629, -2827, -1481,  1802,  -469,  -398,   365,   -59,   -64,    33,    -2,     0,
+       -3,    20,     0,  -131,   240,    70,  -854,  1105,   628, -4058,  5443, 20845,
+    12571, -2850, -1462,  1800,  -475,  -394,   365,   -60,   -63,    33,    -2,     0,
+       -3,    20,     0,  -131,   241,    66,  -854,  1114,   614, -4060,  5500, 20863,
+    12513, -2872, -1443,  1798,  -480,  -390,   365,   -61,   -63,    33,    -2,     0,
+       -3,    20,    -1,  -131,   243,    63,  -853,  1122,   599, -4061,  5557, 20881,
+    12455, -2894, -1424,  1795,  -486,  -385,   364,   -62,   -62,    33,    -2,     0,
+       -3,    20,    -1,  -131,   244,    60,  -852,  1130,   585, -4062,  5614, 20898,
+    12396, -2916, -1405,  1793,  -491,  -381,   364,   -64,   -61,    33,    -2,     0,
+       -3,    20,    -1,  -130,   246,    57,  -851,  1138,   571, -4063,  5671, 20915,
+    12338, -2938, -1387,  1790,  -497,  -377,   364,   -65,   -61,    33,    -2,     0,
+       -3,    20,    -2,  -130,   247,    53,  -851,  1146,   556, -4064,  5728, 20932,
+    12283, -2959, -1368,  1787,  -502,  -373,   363,   -66,   -60,    33,    -2,     0,
+       -3,    21,    -2,  -130,   249,    50,  -850,  1154,   542, -4064,  5785, 20948,
+    12222, -2980, -1349,  1785,  -508,  -369,   363,   -67,   -60,    33,    -2,     0,
+       -3,    21,    -3,  -130,   250,    47,  -849,  1162,   527, -4065,  5842, 20965,
+    12164, -3001, -1330,  1782,  -513,  -365,   363,   -68,   -59,    33,    -2,     0,
+       -3,    21,    -3,  -130,   252,    43,  -848,  1170,   512, -4065,  5900, 20981,
+    12106, -3022, -1311,  1779,  -519,  -361,   362,   -69,   -58,    33,    -2,     0,
+       -3,    21,    -4,  -130,   253,    40,  -847,  1178,   497, -4065,  5957, 20996,
+    12050, -3043, -1292,  1776,  -524,  -357,   362,   -70,   -58,    33,    -2,     0,
+       -3,    21,    -4,  -129,   255,    36,  -846,  1186,   483, -4065,  6015, 21012,
+    11988, -3063, -1273,  1773,  -529,  -353,   361,   -71,   -57,    33,    -2,     0,
+       -3,    21,    -5,  -129,   256,    33,  -845,  1194,   468, -4065,  6072, 21027,
+    11931, -3084, -1254,  1770,  -534,  -349,   361,   -71,   -57,    33,    -2,     0,
+       -3,    21,    -5,  -129,   258,    30,  -844,  1202,   453, -4064,  6130, 21042,
+    11870, -3103, -1236,  1767,  -539,  -345,   360,   -72,   -56,    33,    -2,     0,
+       -3,    22,    -5,  -129,   259,    26,  -843,  1210,   438, -4064,  6188, 21056,
+    11813, -3123, -1217,  1764,  -545,  -341,   360,   -73,   -56,    33,    -2,     0,
+       -3,    22,    -6,  -129,   261,    23,  -842,  1217,   423, -4063,  6245, 21070,
+    11757, -3143, -1198,  1760,  -550,  -337,   359,   -74,   -55,    33,    -2,     0,
+       -3,    22,    -6,  -128,   262,    19,  -840,  1225,   407, -4062,  6303, 21084,
+    11697, -3162, -1179,  1757,  -555,  -333,   359,   -75,   -54,    32,    -2,     0,
+       -3,    22,    -7,  -128,   264,    16,  -839,  1233,   392, -4061,  6361, 21098,
+    11638, -3181, -1160,  1754,  -560,  -329,   358,   -76,   -54,    32,    -2,     0,
+       -3,    22,    -7,  -128,   265,    12,  -838,  1241,   377, -4059,  6419, 21111,
+    11579, -3200, -1141,  1750,  -565,  -325,   358,   -77,   -53,    32,    -2,     0,
+       -3,    22,    -8,  -128,   267,     9,  -837,  1248,   362, -4058,  6477, 21124,
+    11523, -3219, -1123,  1747,  -570,  -321,   357,   -78,   -53,    32,    -2,     0,
+       -3,    22,    -8,  -127,   268,     5,  -835,  1256,   346, -4056,  6535, 21137,
+    11462, -3237, -1104,  1743,  -575,  -317,   357,   -79,   -52,    32,    -2,     0,
+       -3,    23,    -9,  -127,   270,     2,  -834,  1264,   331, -4054,  6594, 21149,
+    11402, -3256, -1085,  1739,  -579,  -313,   356,   -80,   -52,    32,    -2,     0,
+       -3,    23,    -9,  -127,   271,    -2,  -832,  1271,   315, -4052,  6652, 21161,
+    11343, -3274, -1066,  1736,  -584,  -308,   355,   -81,   -51,    32,    -2,     0,
+       -3,    23,   -10,  -126,   272,    -5,  -831,  1279,   299, -4050,  6710, 21173,
+    11284, -3291, -1048,  1732,  -589,  -304,   355,   -82,   -50,    32,    -2,     0,
+       -3,    23,   -10,  -126,   274,    -9,  -829,  1286,   284, -4047,  6769, 21185,
+    11225, -3309, -1029,  1728,  -594,  -300,   354,   -83,   -50,    32,    -3,     0,
+       -3,    23,   -10,  -126,   275,   -12,  -828,  1294,   268, -4045,  6827, 21196,
+    11165, -3327, -1010,  1724,  -598,  -296,   354,   -83,   -49,    32,    -3,     0,
+       -3,    23,   -11,  -126,   277,   -16,  -826,  1301,   252, -4042,  6886, 21207,
+    11107, -3344,  -991,  1720,  -603,  -292,   353,   -84,   -49,    32,    -3,     0,
+       -3,    23,   -11,  -125,   278,   -20,  -824,  1309,   236, -4039,  6944, 21217,
+    11049, -3361,  -973,  1716,  -608,  -288,   352,   -85,   -48,    32,    -3,     0,
+       -3,    24,   -12,  -125,   279,   -23,  -823,  1316,   221, -4036,  7003, 21228,
+    10988, -3378,  -954,  1712,  -612,  -284,   352,   -86,   -48,    32,    -3,     0,
+       -3,    24,   -12,  -125,   281,   -27,  -821,  1324,   205, -4033,  7061, 21238,
+    10929, -3394,  -935,  1708,  -617,  -280,   351,   -87,   -47,    31,    -3,     0,
+       -3,    24,   -13,  -124,   282,   -30,  -819,  1331,   188, -4029,  7120, 21247,
+    10870, -3410,  -917,  1704,  -621,  -276,   350,   -88,   -46,    31,    -3,     0,
+       -3,    24,   -13,  -124,   284,   -34,  -817,  1338,   172, -4025,  7179, 21257,
+    10811, -3427,  -898,  1699,  -626,  -272,   349,   -88,   -46,    31,    -3,     0,
+       -3,    24,   -14,  -124,   285,   -38,  -815,  1345,   156, -4021,  7238, 21266,
+    10752, -3443,  -880,  1695,  -630,  -268,   349,   -89,   -45,    31,    -3,     0,
+       -3,    24,   -14,  -123,   286,   -41,  -814,  1353,   140, -4017,  7297, 21275,
+    10691, -3458,  -861,  1691,  -635,  -264,   348,   -90,   -45,    31,    -3,     0,
+       -3,    24,   -15,  -123,   288,   -45,  -812,  1360,   124, -4013,  7356, 21283,
+    10633, -3474,  -842,  1686,  -639,  -260,   347,   -91,   -44,    31,    -3,     0,
+       -3,    25,   -15,  -122,   289,   -49,  -810,  1367,   107, -4009,  7415, 21292,
+    10573, -3489,  -824,  1682,  -643,  -256,   346,   -92,   -44,    31,    -3,     0,
+       -3,    25,   -16,  -122,   290,   -52,  -808,  1374,    91, -4004,  7474, 21299,
+    10512, -3504,  -805,  1677,  -647,  -252,   346,   -92,   -43,    31,    -3,     0,
+       -3,    25,   -16,  -122,   292,   -56,  -805,  1381,    75, -3999,  7533, 21307,
+    10452, -3519,  -787,  1672,  -652,  -248,   345,   -93,   -42,    31,    -3,     0,
+       -3,    25,   -17,  -121,   293,   -60,  -803,  1388,    58, -3994,  7592, 21314,
+    10395, -3534,  -769,  1668,  -656,  -244,   344,   -94,   -42,    31,    -3,     0,
+       -3,    25,   -17,  -121,   294,   -64,  -801,  1395,    42, -3989,  7651, 21321,
+    10336, -3548,  -750,  1663,  -660,  -240,   343,   -95,   -41,    30,    -3,     0,
+       -3,    25,   -18,  -120,   296,   -67,  -799,  1402,    25, -3983,  7710, 21328,
+    10277, -3563,  -732,  1658,  -664,  -236,   342,   -96,   -41,    30,    -3,     0,
+       -3,    25,   -18,  -120,   297,   -71,  -797,  1409,     8, -3978,  7770, 21334,
+    10216, -3577,  -713,  1653,  -668,  -231,   341,   -96,   -40,    30,    -3,     0,
+       -3,    25,   -19,  -120,   298,   -75,  -794,  1416,    -8, -3972,  7829, 21341,
+    10156, -3591,  -695,  1648,  -672,  -227,   341,   -97,   -40,    30,    -3,     0,
+       -3,    26,   -19,  -119,   299,   -79,  -792,  1423,   -25, -3966,  7888, 21346,
+    10096, -3604,  -677,  1643,  -676,  -223,   340,   -98,   -39,    30,    -3,     0,
+       -3,    26,   -20,  -119,   301,   -82,  -790,  1430,   -42, -3960,  7947, 21352,
+    10035, -3618,  -658,  1638,  -680,  -219,   339,   -98,   -38,    30,    -3,     0,
+       -3,    26,   -20,  -118,   302,   -86,  -787,  1436,   -59, -3953,  8007, 21357,
+     9975, -3631,  -640,  1633,  -684,  -215,   338,   -99,   -38,    30,    -3,     0,
+       -3,    26,   -21,  -118,   303,   -90,  -785,  1443,   -76, -3947,  8066, 21362,
+     9917, -3644,  -622,  1628,  -687,  -211,   337,  -100,   -37,    30,    -3,     0,
+       -3,    26,   -21,  -117,   304,   -94,  -782,  1450,   -93, -3940,  8126, 21366,
+     9857, -3657,  -604,  1623,  -691,  -207,   336,  -101,   -37,    30,    -3,     0,
+       -3,    26,   -22,  -117,   306,   -98,  -780,  1456,  -110, -3933,  8185, 21371,
+     9797, -3669,  -586,  1618,  -695,  -203,   335,  -101,   -36,    30,    -3,     0,
+       -3,    26,   -22,  -116,   307,  -101,  -777,  1463,  -127, -3926,  8245, 21375,
+     9737, -3682,  -567,  1612,  -699,  -199,   334,  -102,   -36,    29,    -3,     0,
+       -3,    27,   -23,  -116,   308,  -105,  -775,  1469,  -144, -3918,  8304, 21378,
+     9678, -3694,  -549,  1607,  -702,  -195,   333,  -103,   -35,    29,    -3,     0,
+       -3,    27,   -23,  -115,   309,  -109,  -772,  1476,  -161, -3911,  8364, 21382,
+     9616, -3706,  -531,  1602,  -706,  -191,   332,  -103,   -35,    29,    -3,     0,
+       -3,    27,   -24,  -115,   311,  -113,  -769,  1482,  -178, -3903,  8423, 21385,
+     9558, -3718,  -513,  1596,  -710,  -187,   331,  -104,   -34,    29,    -3,     0,
+       -3,    27,   -24,  -114,   312,  -117,  -766,  1489,  -195, -3895,  8483, 21387,
+     9495, -3729,  -495,  1591,  -713,  -183,   330,  -105,   -33,    29,    -3,     0,
+       -3,    27,   -25,  -114,   313,  -121,  -764,  1495,  -213, -3887,  8543, 21390,
+     9439, -3741,  -477,  1585,  -717,  -179,   329,  -105,   -33,    29,    -3,     0,
+       -3,    27,   -25,  -113,   314,  -125,  -761,  1502,  -230, -3879,  8602, 21392,
+     9379, -3752,  -459,  1579,  -720,  -176,   328,  -106,   -32,    29,    -3,     0,
+       -3,    27,   -26,  -113,   315,  -128,  -758,  1508,  -247, -3870,  8662, 21394,
+     9318, -3763,  -442,  1574,  -723,  -172,   327,  -106,   -32,    29,    -3,     0,
+       -3,    27,   -26,  -112,   316,  -132,  -755,  1514,  -265, -3861,  8722, 21395,
+     9258, -3773,  -424,  1568,  -727,  -168,   326,  -107,   -31,    29,    -3,     0,
+       -3,    28,   -27,  -112,   317,  -136,  -752,  1520,  -282, -3852,  8781, 21397,
+     9200, -3784,  -406,  1562,  -730,  -164,   325,  -108,   -31,    28,    -3,     0,
+       -3,    28,   -28,  -111,   319,  -140,  -749,  1526,  -300, -3843,  8841, 21398,
+     9138, -3794,  -388,  1556,  -733,  -160,   324,  -108,   -30,    28,    -3,     0,
+       -3,    28,   -28,  -111,   320,  -144,  -746,  1532,  -317, -3834,  8901, 21398,
+     9081, -3805,  -370,  1550,  -737,  -156,   323,  -109,   -30,    28,    -3,     0,
+       -3,    28,   -29,  -110,   321,  -148,  -743,  1538,  -335, -3824,  8961, 21398,
+     9022, -3815,  -353,  1544,  -740,  -152,   322,  -110,   -29,    28,    -3,     0,
+};
+
+/* 24 taps per branch: 44100 to 48000 Hz, 88200 to 96000 Hz */
+const int16_t audio_src_coef_160_147[3840] =
+{
+        0,    -2,     0,    23,   -99,   265,  -561,  1003, -1569,  2193, -2776,  3229,
+    29492,  3038, -2699,  2158, -1555,  1000,  -562,   268,  -100,    24,     0,    -2,
+        0,    -2,     1,    22,   -96,   263,  -560,  1006, -1582,  2227, -2853,  3422,
+    29488,  2849, -2621,  2123, -1541,   996,  -564,   270,  -102,    25,    -1,    -2,
+        0,    -2,     1,    21,   -94,   260,  -558,  1008, -1595,  2261, -2929,  3616,
+    29481,  2661, -2544,  2087, -1526,   992,  -564,   272,  -104,    27,    -1,    -2,
+        0,    -2,     2,    20,   -92,   258,  -556,  1010, -1607,  2294, -3005,  3812,
+    29470,  2474, -2466,  2051, -1511,   988,  -565,   274,  -106,    28,    -2,    -1,
+        0,    -2,     2,    18,   -90,   255,  -554,  1012, -1619,  2327, -3081,  4009,
+    29460,  2289, -2388,  2014, -1496,   984,  -566,   276,  -108,    29,    -2,    -1,
+        0,    -3,     3,    17,   -88,   252,  -552,  1014, -1631,  2360, -3156,  4207,
+    29445,  2106, -2310,  1977, -1480,   979,  -566,   278,  -110,    30,    -3,    -1,
+        0,    -3,     3,    16,   -86,   249,  -549,  1015, -1642,  2391, -3231,  4407,
+    29424,  1925, -2231,  1940, -1464,   974,  -566,   280,  -111,    31,    -3,    -1,
+        0,    -3,     4,    14,   -83,   246,  -547,  1016, -1653,  2422, -3306,  4608,
+    29406,  1745, -2153,  1902, -1448,   969,  -566,   281,  -113,    32,    -4,    -1,
+        0,    -3,     4,    13,   -81,   242,  -544,  1017, -1663,  2453, -3380,  4810,
+    29379,  1567, -2074,  1864, -1431,   964,  -566,   283,  -114,    33,    -4,    -1,
+        0,    -3,     5,    12,   -78,   239,  -541,  1017, -1673,  2483, -3453,  5014,
+    29351,  1390, -1996,  1825, -1414,   958,  -565,   284,  -116,    34,    -4,    -1,
+        0,    -3,     6,    10,   -76,   236,  -538,  1017, -1682,  2512, -3526,  5219,
+    29319,  1216, -1917,  1786, -1396,   952,  -565,   286,  -117,    35,    -5,    -1,
+        0,    -3,     6,     9,   -73,   232,  -534,  1017, -1691,  2541, -3598,  5425,
+    29285,  1043, -1839,  1747, -1378,   945,  -564,   287,  -119,    36,    -5,    -1,
+        0,    -4,     7,     8,   -71,   228,  -530,  1016, -1699,  2569, -3670,  5633,
+    29246,   872, -1760,  1708, -1360,   939,  -563,   288,  -120,    37,    -6,     0,
+        0,    -4,     7,     6,   -68,   225,  -527,  1015, -1706,  2597, -3742,  5841,
+    29206,   703, -1681,  1668, -1341,   932,  -562,   289,  -121,    37,    -6,     0,
+        0,    -4,     8,     5,   -66,   221,  -523,  1014, -1714,  2624, -3812,  6051,
+    29164,   535, -1603,  1628, -1323,   925,  -561,   290,  -123,    38,    -6,     0,
+        0,    -4,     8,     3,   -63,   217,  -518,  1012, -1720,  2650, -3882,  6262,
+    29115,   370, -1524,  1587, -1303,   918,  -559,   291,  -124,    39,    -7,     0,
+        0,    -4,     9,     2,   -60,   213,  -514,  1010, -1727,  2675, -3951,  6473,
+    29067,   206, -1446,  1547, -1284,   910,  -558,   292,  -125,    40,    -7,     0,
+        0,    -4,    10,     0,   -57,   209,  -509,  1008, -1732,  2700, -4020,  6686,
+    29011,    45, -1367,  1506, -1264,   902,  -556,   292,  -126,    41,    -7,     0,
+        0,    -5,    10,    -1,   -55,   204,  -504,  1005, -1737,  2724, -4087,  6900,
+    28958,  -115, -1289,  1465, -1244,   894,  -554,   293,  -127,    41,    -8,     0,
+        0,    -5,    11,    -3,   -52,   200,  -499,  1002, -1742,  2747, -4154,  7115,
+    28900,  -273, -1211,  1423, -1224,   886,  -552,   293,  -128,    42,    -8,     0,
+        0,    -5,    12,    -4,   -49,   195,  -494,   999, -1746,  2770, -4221,  7331,
+    28838,  -429, -1134,  1382, -1203,   877,  -549,   293,  -129,    43,    -9,     0,
+        0,    -5,    12,    -6,   -46,   191,  -489,   995, -1750,  2792, -4286,  7547,
+    28774,  -583, -1056,  1340, -1182,   868,  -547,   294,  -130,    44,    -9,     0,
+        0,    -5,    13,    -7,   -43,   186,  -483,   991, -1753,  2813, -4351,  7765,
+    28706,  -735,  -979,  1298, -1161,   859,  -544,   294,  -131,    44,    -9,     0,
+        0,    -5,    13,    -9,   -40,   181,  -477,   987, -1755,  2833, -4414,  7983,
+    28634,  -885,  -901,  1256, -1140,   850,  -542,   294,  -131,    45,    -9,     0,
+        0,    -6,    14,   -10,   -37,   177,  -471,   982, -1757,  2853, -4477,  8202,
+    28560, -1033,  -825,  1214, -1118,   841,  -539,   294,  -132,    46,   -10,     0,
+        0,    -6,    15,   -12,   -34,   172,  -465,   977, -1759,  2872, -4539,  8422,
+    28483, -1178,  -748,  1172, -1096,   831,  -536,   293,  -133,    46,   -10,     1,
+        0,    -6,    15,   -14,   -30,   167,  -459,   971, -1759,  2890, -4600,  8642,
+    28402, -1322,  -672,  1130, -1074,   821,  -532,   293,  -133,    47,   -10,     1,
+        0,    -6,    16,   -15,   -27,   161,  -452,   965, -1760,  2907, -4660,  8864,
+    28322, -1464,  -596,  1087, -1052,   811,  -529,   293,  -134,    47,   -11,     1,
+        0,    -6,    17,   -17,   -24,   156,  -445,   959, -1759,  2923, -4718,  9086,
+    28235, -1604,  -521,  1045, -1030,   801,  -525,   292,  -135,    48,   -11,     1,
+        0,    -6,    17,   -19,   -21,   151,  -438,   953, -1758,  2939, -4776,  9308,
+    28146, -1741,  -445,  1002, -1007,   790,  -522,   292,  -135,    48,   -11,     1,
+        0,    -7,    18,   -20,   -17,   145,  -431,   946, -1757,  2953, -4833,  9531,
+    28056, -1877,  -371,   959,  -984,   780,  -518,   291,  -135,    49,   -11,     1,
+        0,    -7,    19,   -22,   -14,   140,  -424,   939, -1755,  2967, -4889,  9755,
+    27963, -2010,  -297,   917,  -961,   769,  -514,   290,  -136,    49,   -12,     1,
+        0,    -7,    19,   -24,   -11,   134,  -416,   931, -1752,  2980, -4943,  9979,
+    27865, -2141,  -223,   874,  -938,   758,  -510,   290,  -136,    50,   -12,     1,
+        0,    -7,    20,   -25,    -7,   129,  -408,   923, -1749,  2992, -4997, 10203,
+    27763, -2270,  -149,   831,  -915,   747,  -505,   289,  -136,    50,   -12,     1,
+        0,    -7,    21,   -27,    -4,   123,  -401,   915, -1745,  3003, -5049, 10428,
+    27662, -2397,   -76,   788,  -891,   735,  -501,   288,  -137,    51,   -12,     1,
+        0,    -7,    21,   -29,     0,   117,  -392,   906, -1741,  3014, -5100, 10654,
+    27556, -2522,    -4,   746,  -867,   724,  -497,   287,  -137,    51,   -13,     1,
+        0,    -8,    22,   -30,     3,   111,  -384,   897, -1736,  3023, -5150, 10880,
+    27450, -2644,    68,   703,  -844,   712,  -492,   285,  -137,    51,   -13,     1,
+        0,    -8,    23,   -32,     7,   105,  -376,   888, -1731,  3032, -5199, 11106,
+    27338, -2764,   139,   660,  -820,   700,  -487,   284,  -137,    52,   -13,     1,
+        0,    -8,    23,   -34,    10,    99,  -367,   879, -1724,  3039, -5246, 11332,
+    27224, -2883,   210,   618,  -796,   688,  -482,   283,  -137,    52,   -13,     1,
+        0,    -8,    24,   -36,    14,    93,  -358,   869, -1718,  3046, -5293, 11558,
+    27110, -2999,   280,   575,  -772,   676,  -477,   281,  -137,    52,   -13,     1,
+        0,    -8,    25,   -37,    18,    86,  -349,   858, -1710,  3051, -5337, 11785,
+    26987, -3112,   350,   533,  -747,   664,  -472,   280,  -137,    52,   -13,     1,
+        0,    -9,    25,   -39,    21,    80,  -340,   848, -1702,  3056, -5381, 12012,
+    26870, -3224,   419,   490,  -723,   651,  -467,   278,  -137,    53,   -14,     1,
+        0,    -9,    26,   -41,    25,    74,  -331,   836, -1694,  3060, -5423, 12239,
+    26745, -3333,   487,   448,  -699,   639,  -461,   277,  -137,    53,   -14,     1,
+        0,    -9,    26,   -43,    29,    67,  -321,   825, -1685,  3063, -5464, 12466,
+    26619, -3440,   555,   406,  -674,   626,  -456,   275,  -137,    53,   -14,     1,
+        0,    -9,    27,   -44,    32,    61,  -311,   813, -1675,  3065, -5503, 12693,
+    26488, -3545,   622,   364,  -650,   613,  -450,   273,  -136,    53,   -14,     1,
+        0,    -9,    28,   -46,    36,    54,  -302,   801, -1665,  3066, -5541, 12921,
+    26357, -3648,   688,   322,  -625,   600,  -444,   271,  -136,    53,   -14,     1,
+        0,    -9,    28,   -48,    40,    47,  -292,   789, -1654,  3066, -5578, 13148,
+    26223, -3748,   754,   280,  -600,   587,  -439,   269,  -136,    54,   -14,     1,
+        0,   -10,    29,   -50,    44,    41,  -281,   776, -1642,  3065, -5613, 13375,
+    26085, -3846,   819,   238,  -576,   574,  -433,   267,  -135,    54,   -14,     1,
+        0,   -10,    30,   -51,    47,    34,  -271,   763, -1630,  3063, -5646, 13602,
+    25944, -3942,   884,   197,  -551,   561,  -427,   265,  -135,    54,   -14,     1,
+        1,   -10,    30,   -53,    51,    27,  -260,   750, -1618,  3060, -5678, 13828,
+    25803, -4036,   947,   156,  -526,   548,  -421,   263,  -134,    54,   -15,     1,
+        1,   -10,    31,   -55,    55,    20,  -250,   736, -1604,  3056, -5708, 14055,
+    25658, -4127,  1010,   115,  -501,   534,  -414,   260,  -134,    54,   -15,     1,
+        1,   -10,    32,   -57,    59,    13,  -239,   722, -1590,  3051, -5737, 14281,
+    25511, -4216,  1072,    74,  -477,   521,  -408,   258,  -133,    54,   -15,     1,
+        1,   -10,    32,   -58,    63,     6,  -228,   708, -1576,  3044, -5765, 14507,
+    25364, -4303,  1133,    34,  -452,   507,  -402,   256,  -133,    54,   -15,     1,
+        1,   -11,    33,   -60,    67,    -1,  -217,   693, -1561,  3037, -5790, 14733,
+    25211, -4387,  1194,    -7,  -427,   494,  -395,   253,  -132,    54,   -15,     1,
+        1,   -11,    34,   -62,    71,    -8,  -206,   678, -1545,  3029, -5814, 14958,
+    25059, -4470,  1253,   -47,  -402,   480,  -389,   251,  -132,    54,   -15,     1,
+        1,   -11,    34,   -64,    74,   -16,  -194,   663, -1529,  3020, -5837, 15183,
+    24906, -4550,  1312,   -87,  -378,   466,  -382,   248,  -131,    54,   -15,     1,
+        1,   -11,    35,   -65,    78,   -23,  -183,   647, -1512,  3010, -5857, 15408,
+    24743, -4627,  1370,  -126,  -353,   452,  -375,   245,  -130,    54,   -15,     2,
+        1,   -11,    36,   -67,    82,   -30,  -171,   632, -1494,  2999, -5876, 15632,
+    24580, -4703,  1427,  -165,  -328,   438,  -369,   243,  -129,    54,   -15,     2,
+        1,   -11,    36,   -69,    86,   -37,  -159,   615, -1476,  2987, -5894, 15855,
+    24420, -4776,  1484,  -204,  -304,   424,  -362,   240,  -129,    54,   -15,     2,
+        1,   -12,    37,   -71,    90,   -45,  -147,   599, -1458,  2973, -5909, 16078,
+    24257, -4847,  1539,  -243,  -279,   410,  -355,   237,  -128,    54,   -15,     2,
+        1,   -12,    37,   -72,    94,   -52,  -135,   582, -1439,  2959, -5923, 16301,
+    24090, -4916,  1594,  -281,  -254,   396,  -348,   234,  -127,    53,   -15,     1,
+        1,   -12,    38,   -74,    98,   -60,  -123,   565, -1419,  2944, -5935, 16522,
+    23922, -4983,  1648,  -319,  -230,   382,  -341,   231,  -126,    53,   -15,     1,
+        1,   -12,    39,   -76,   102,   -67,  -111,   548, -1398,  2927, -5945, 16743,
+    23751, -5047,  1700,  -357,  -206,   368,  -334,   228,  -125,    53,   -15,     1,
+        1,   -12,    39,   -77,   106,   -75,   -98,   530, -1377,  2910, -5954, 16964,
+    23575, -5109,  1752,  -394,  -181,   354,  -326,   225,  -124,    53,   -15,     1,
+        1,   -12,    40,   -79,   110,   -82,   -86,   512, -1356,  2891, -5960, 17183,
+    23401, -5169,  1803,  -431,  -157,   340,  -319,   222,  -123,    53,   -15,     1,
+        1,   -13,    40,   -81,   114,   -90,   -73,   494, -1334,  2872, -5965, 17402,
+    23226, -5226,  1853,  -468,  -133,   326,  -312,   219,  -122,    52,   -15,     1,
+        1,   -13,    41,   -83,   118,   -98,   -60,   475, -1311,  2851, -5968, 17620,
+    23046, -5282,  1903,  -504,  -109,   312,  -304,   216,  -121,    52,   -15,     1,
+        1,   -13,    41,   -84,   121,  -105,   -47,   456, -1288,  2830, -5969, 17837,
+    22866, -5335,  1951,  -540,   -85,   297,  -297,   213,  -120,    52,   -15,     1,
+        1,   -13,    42,   -86,   125,  -113,   -34,   437, -1264,  2807, -5968, 18053,
+    22684, -5386,  1998,  -575,   -61,   283,  -290,   209,  -119,    52,   -15,     1,
+        1,   -13,    43,   -87,   129,  -121,   -21,   418, -1240,  2783, -5965, 18268,
+    22498, -5434,  2044,  -610,   -38,   269,  -282,   206,  -117,    51,   -15,     1,
+        1,   -13,    43,   -89,   133,  -128,    -8,   399, -1215,  2758, -5960, 18483,
+    22311, -5481,  2089,  -645,   -14,   255,  -275,   203,  -116,    51,   -15,     1,
+        1,   -13,    44,   -91,   137,  -136,     5,   379, -1189,  2732, -5953, 18696,
+    22122, -5525,  2134,  -679,     9,   241,  -267,   199,  -115,    51,   -15,     1,
+        1,   -13,    44,   -92,   141,  -144,    19,   359, -1163,  2706, -5945, 18908,
+    21933, -5567,  2177,  -713,    32,   226,  -260,   196,  -114,    51,   -15,     1,
+        1,   -14,    45,   -94,   145,  -152,    32,   338, -1137,  2678, -5934, 19119,
+    21744, -5607,  2220,  -746,    55,   212,  -252,   192,  -113,    50,   -15,     1,
+        1,   -14,    45,   -95,   148,  -159,    45,   318, -1110,  2649, -5921, 19329,
+    21549, -5645,  2261,  -779,    78,   198,  -244,   189,  -111,    50,   -15,     1,
+        1,   -14,    46,   -97,   152,  -167,    59,   297, -1082,  2618, -5906, 19537,
+    21358, -5681,  2301,  -812,   101,   184,  -237,   185,  -110,    49,   -15,     1,
+        1,   -14,    46,   -98,   156,  -175,    73,   276, -1054,  2587, -5890, 19745,
+    21159, -5714,  2341,  -844,   124,   170,  -229,   182,  -109,    49,   -15,     1,
+        1,   -14,    47,  -100,   160,  -183,    86,   255, -1026,  2555, -5871, 19951,
+    20962, -5746,  2379,  -875,   146,   156,  -221,   178,  -107,    49,   -15,     1,
+        1,   -14,    47,  -101,   163,  -190,   100,   234,  -996,  2522, -5850, 20156,
+    20761, -5775,  2416,  -906,   168,   142,  -214,   175,  -106,    48,   -14,     1,
+        1,   -14,    47,  -103,   167,  -198,   114,   212,  -967,  2488, -5827, 20359,
+    20561, -5802,  2453,  -937,   190,   128,  -206,   171,  -104,    48,   -14,     1,
+        1,   -14,    48,  -104,   171,  -206,   128,   190,  -937,  2453, -5802, 20561,
+    20359, -5827,  2488,  -967,   212,   114,  -198,   167,  -103,    47,   -14,     1,
+        1,   -14,    48,  -106,   175,  -214,   142,   168,  -906,  2416, -5775, 20762,
+    20155, -5850,  2522,  -996,   234,   100,  -190,   163,  -101,    47,   -14,     1,
+        1,   -15,    49,  -107,   178,  -221,   156,   146,  -875,  2379, -5746, 20961,
+    19952, -5871,  2555, -1026,   255,    86,  -183,   160,  -100,    47,   -14,     1,
+        1,   -15,    49,  -109,   182,  -229,   170,   124,  -844,  2341, -5714, 21159,
+    19745, -5890,  2587, -1054,   276,    73,  -175,   156,   -98,    46,   -14,     1,
+        1,   -15,    49,  -110,   185,  -237,   184,   101,  -812,  2301, -5681, 21355,
+    19540, -5906,  2618, -1082,   297,    59,  -167,   152,   -97,    46,   -14,     1,
+        1,   -15,    50,  -111,   189,  -244,   198,    78,  -779,  2261, -5645, 21549,
+    19329, -5921,  2649, -1110,   318,    45,  -159,   148,   -95,    45,   -14,     1,
+        1,   -15,    50,  -113,   192,  -252,   212,    55,  -746,  2220, -5607, 21742,
+    19121, -5934,  2678, -1137,   338,    32,  -152,   145,   -94,    45,   -14,     1,
+        1,   -15,    51,  -114,   196,  -260,   226,    32,  -713,  2177, -5567, 21934,
+    18907, -5945,  2706, -1163,   359,    19,  -144,   141,   -92,    44,   -13,     1,
+        1,   -15,    51,  -115,   199,  -267,   241,     9,  -679,  2134, -5525, 22123,
+    18695, -5953,  2732, -1189,   379,     5,  -136,   137,   -91,    44,   -13,     1,
+        1,   -15,    51,  -116,   203,  -275,   255,   -14,  -645,  2089, -5481, 22311,
+    18483, -5960,  2758, -1215,   399,    -8,  -128,   133,   -89,    43,   -13,     1,
+        1,   -15,    51,  -117,   206,  -282,   269,   -38,  -610,  2044, -5434, 22498,
+    18268, -5965,  2783, -1240,   418,   -21,  -121,   129,   -87,    43,   -13,     1,
+        1,   -15,    52,  -119,   209,  -290,   283,   -61,  -575,  1998, -5386, 22682,
+    18055, -5968,  2807, -1264,   437,   -34,  -113,   125,   -86,    42,   -13,     1,
+        1,   -15,    52,  -120,   213,  -297,   297,   -85,  -540,  1951, -5335, 22865,
+    17838, -5969,  2830, -1288,   456,   -47,  -105,   121,   -84,    41,   -13,     1,
+        1,   -15,    52,  -121,   216,  -304,   312,  -109,  -504,  1903, -5282, 23045,
+    17621, -5968,  2851, -1311,   475,   -60,   -98,   118,   -83,    41,   -13,     1,
+        1,   -15,    52,  -122,   219,  -312,   326,  -133,  -468,  1853, -5226, 23224,
+    17404, -5965,  2872, -1334,   494,   -73,   -90,   114,   -81,    40,   -13,     1,
+        1,   -15,    53,  -123,   222,  -319,   340,  -157,  -431,  1803, -5169, 23401,
+    17183, -5960,  2891, -1356,   512,   -86,   -82,   110,   -79,    40,   -12,     1,
+        1,   -15,    53,  -124,   225,  -326,   354,  -181,  -394,  1752, -5109, 23576,
+    16963, -5954,  2910, -1377,   530,   -98,   -75,   106,   -77,    39,   -12,     1,
+        1,   -15,    53,  -125,   228,  -334,   368,  -206,  -357,  1700, -5047, 23749,
+    16745, -5945,  2927, -1398,   548,  -111,   -67,   102,   -76,    39,   -12,     1,
+        1,   -15,    53,  -126,   231,  -341,   382,  -230,  -319,  1648, -4983, 23920,
+    16524, -5935,  2944, -1419,   565,  -123,   -60,    98,   -74,    38,   -12,     1,
+        1,   -15,    53,  -127,   234,  -348,   396,  -254,  -281,  1594, -4916, 24089,
+    16302, -5923,  2959, -1439,   582,  -135,   -52,    94,   -72,    37,   -12,     1,
+        2,   -15,    54,  -128,   237,  -355,   410,  -279,  -243,  1539, -4847, 24256,
+    16079, -5909,  2973, -1458,   599,  -147,   -45,    90,   -71,    37,   -12,     1,
+        2,   -15,    54,  -129,   240,  -362,   424,  -304,  -204,  1484, -4776, 24421,
+    15854, -5894,  2987, -1476,   615,  -159,   -37,    86,   -69,    36,   -11,     1,
+        2,   -15,    54,  -129,   243,  -369,   438,  -328,  -165,  1427, -4703, 24583,
+    15629, -5876,  2999, -1494,   632,  -171,   -30,    82,   -67,    36,   -11,     1,
+        2,   -15,    54,  -130,   245,  -375,   452,  -353,  -126,  1370, -4627, 24744,
+    15407, -5857,  3010, -1512,   647,  -183,   -23,    78,   -65,    35,   -11,     1,
+        1,   -15,    54,  -131,   248,  -382,   466,  -378,   -87,  1312, -4550, 24902,
+    15187, -5837,  3020, -1529,   663,  -194,   -16,    74,   -64,    34,   -11,     1,
+        1,   -15,    54,  -132,   251,  -389,   480,  -402,   -47,  1253, -4470, 25058,
+    14959, -5814,  3029, -1545,   678,  -206,    -8,    71,   -62,    34,   -11,     1,
+        1,   -15,    54,  -132,   253,  -395,   494,  -427,    -7,  1194, -4387, 25211,
+    14733, -5790,  3037, -1561,   693,  -217,    -1,    67,   -60,    33,   -11,     1,
+        1,   -15,    54,  -133,   256,  -402,   507,  -452,    34,  1133, -4303, 25363,
+    14508, -5765,  3044, -1576,   708,  -228,     6,    63,   -58,    32,   -10,     1,
+        1,   -15,    54,  -133,   258,  -408,   521,  -477,    74,  1072, -4216, 25512,
+    14280, -5737,  3051, -1590,   722,  -239,    13,    59,   -57,    32,   -10,     1,
+        1,   -15,    54,  -134,   260,  -414,   534,  -501,   115,  1010, -4127, 25658,
+    14055, -5708,  3056, -1604,   736,  -250,    20,    55,   -55,    31,   -10,     1,
+        1,   -15,    54,  -134,   263,  -421,   548,  -526,   156,   947, -4036, 25803,
+    13828, -5678,  3060, -1618,   750,  -260,    27,    51,   -53,    30,   -10,     1,
+        1,   -14,    54,  -135,   265,  -427,   561,  -551,   197,   884, -3942, 25945,
+    13601, -5646,  3063, -1630,   763,  -271,    34,    47,   -51,    30,   -10,     0,
+        1,   -14,    54,  -135,   267,  -433,   574,  -576,   238,   819, -3846, 26084,
+    13376, -5613,  3065, -1642,   776,  -281,    41,    44,   -50,    29,   -10,     0,
+        1,   -14,    54,  -136,   269,  -439,   587,  -600,   280,   754, -3748, 26221,
+    13150, -5578,  3066, -1654,   789,  -292,    47,    40,   -48,    28,    -9,     0,
+        1,   -14,    53,  -136,   271,  -444,   600,  -625,   322,   688, -3648, 26355,
+    12923, -5541,  3066, -1665,   801,  -302,    54,    36,   -46,    28,    -9,     0,
+        1,   -14,    53,  -136,   273,  -450,   613,  -650,   364,   622, -3545, 26487,
+    12694, -5503,  3065, -1675,   813,  -311,    61,    32,   -44,    27,    -9,     0,
+        1,   -14,    53,  -137,   275,  -456,   626,  -674,   406,   555, -3440, 26617,
+    12468, -5464,  3063, -1685,   825,  -321,    67,    29,   -43,    26,    -9,     0,
+        1,   -14,    53,  -137,   277,  -461,   639,  -699,   448,   487, -3333, 26743,
+    12241, -5423,  3060, -1694,   836,  -331,    74,    25,   -41,    26,    -9,     0,
+        1,   -14,    53,  -137,   278,  -467,   651,  -723,   490,   419, -3224, 26868,
+    12014, -5381,  3056, -1702,   848,  -340,    80,    21,   -39,    25,    -9,     0,
+        1,   -13,    52,  -137,   280,  -472,   664,  -747,   533,   350, -3112, 26989,
+    11783, -5337,  3051, -1710,   858,  -349,    86,    18,   -37,    25,    -8,     0,
+        1,   -13,    52,  -137,   281,  -477,   676,  -772,   575,   280, -2999, 27108,
+    11560, -5293,  3046, -1718,   869,  -358,    93,    14,   -36,    24,    -8,     0,
+        1,   -13,    52,  -137,   283,  -482,   688,  -796,   618,   210, -2883, 27224,
+    11332, -5246,  3039, -1724,   879,  -367,    99,    10,   -34,    23,    -8,     0,
+        1,   -13,    52,  -137,   284,  -487,   700,  -820,   660,   139, -2764, 27338,
+    11106, -5199,  3032, -1731,   888,  -376,   105,     7,   -32,    23,    -8,     0,
+        1,   -13,    51,  -137,   285,  -492,   712,  -844,   703,    68, -2644, 27449,
+    10881, -5150,  3023, -1736,   897,  -384,   111,     3,   -30,    22,    -8,     0,
+        1,   -13,    51,  -137,   287,  -497,   724,  -867,   746,    -4, -2522, 27557,
+    10653, -5100,  3014, -1741,   906,  -392,   117,     0,   -29,    21,    -7,     0,
+        1,   -12,    51,  -137,   288,  -501,   735,  -891,   788,   -76, -2397, 27662,
+    10428, -5049,  3003, -1745,   915,  -401,   123,    -4,   -27,    21,    -7,     0,
+        1,   -12,    50,  -136,   289,  -505,   747,  -915,   831,  -149, -2270, 27765,
+    10201, -4997,  2992, -1749,   923,  -408,   129,    -7,   -25,    20,    -7,     0,
+        1,   -12,    50,  -136,   290,  -510,   758,  -938,   874,  -223, -2141, 27865,
+     9979, -4943,  2980, -1752,   931,  -416,   134,   -11,   -24,    19,    -7,     0,
+        1,   -12,    49,  -136,   290,  -514,   769,  -961,   917,  -297, -2010, 27962,
+     9756, -4889,  2967, -1755,   939,  -424,   140,   -14,   -22,    19,    -7,     0,
+        1,   -11,    49,  -135,   291,  -518,   780,  -984,   959,  -371, -1877, 28056,
+     9531, -4833,  2953, -1757,   946,  -431,   145,   -17,   -20,    18,    -7,     0,
+        1,   -11,    48,  -135,   292,  -522,   790, -1007,  1002,  -445, -1741, 28147,
+     9307, -4776,  2939, -1758,   953,  -438,   151,   -21,   -19,    17,    -6,     0,
+        1,   -11,    48,  -135,   292,  -525,   801, -1030,  1045,  -521, -1604, 28235,
+     9086, -4718,  2923, -1759,   959,  -445,   156,   -24,   -17,    17,    -6,     0,
+        1,   -11,    47,  -134,   293,  -529,   811, -1052,  1087,  -596, -1464, 28321,
+     8865, -4660,  2907, -1760,   965,  -452,   161,   -27,   -15,    16,    -6,     0,
+        1,   -10,    47,  -133,   293,  -532,   821, -1074,  1130,  -672, -1322, 28404,
+     8640, -4600,  2890, -1759,   971,  -459,   167,   -30,   -14,    15,    -6,     0,
+        1,   -10,    46,  -133,   293,  -536,   831, -1096,  1172,  -748, -1178, 28483,
+     8422, -4539,  2872, -1759,   977,  -465,   172,   -34,   -12,    15,    -6,     0,
+        0,   -10,    46,  -132,   294,  -539,   841, -1118,  1214,  -825, -1033, 28560,
+     8202, -4477,  2853, -1757,   982,  -471,   177,   -37,   -10,    14,    -6,     0,
+        0,    -9,    45,  -131,   294,  -542,   850, -1140,  1256,  -901,  -885, 28634,
+     7983, -4414,  2833, -1755,   987,  -477,   181,   -40,    -9,    13,    -5,     0,
+        0,    -9,    44,  -131,   294,  -544,   859, -1161,  1298,  -979,  -735, 28705,
+     7766, -4351,  2813, -1753,   991,  -483,   186,   -43,    -7,    13,    -5,     0,
+        0,    -9,    44,  -130,   294,  -547,   868, -1182,  1340, -1056,  -583, 28773,
+     7548, -4286,  2792, -1750,   995,  -489,   191,   -46,    -6,    12,    -5,     0,
+        0,    -9,    43,  -129,   293,  -549,   877, -1203,  1382, -1134,  -429, 28837,
+     7332, -4221,  2770, -1746,   999,  -494,   195,   -49,    -4,    12,    -5,     0,
+        0,    -8,    42,  -128,   293,  -552,   886, -1224,  1423, -1211,  -273, 28899,
+     7116, -4154,  2747, -1742,  1002,  -499,   200,   -52,    -3,    11,    -5,     0,
+        0,    -8,    41,  -127,   293,  -554,   894, -1244,  1465, -1289,  -115, 28958,
+     6900, -4087,  2724, -1737,  1005,  -504,   204,   -55,    -1,    10,    -5,     0,
+        0,    -7,    41,  -126,   292,  -556,   902, -1264,  1506, -1367,    45, 29014,
+     6683, -4020,  2700, -1732,  1008,  -509,   209,   -57,     0,    10,    -4,     0,
+        0,    -7,    40,  -125,   292,  -558,   910, -1284,  1547, -1446,   206, 29067,
+     6473, -3951,  2675, -1727,  1010,  -514,   213,   -60,     2,     9,    -4,     0,
+        0,    -7,    39,  -124,   291,  -559,   918, -1303,  1587, -1524,   370, 29116,
+     6261, -3882,  2650, -1720,  1012,  -518,   217,   -63,     3,     8,    -4,     0,
+        0,    -6,    38,  -123,   290,  -561,   925, -1323,  1628, -1603,   535, 29163,
+     6052, -3812,  2624, -1714,  1014,  -523,   221,   -66,     5,     8,    -4,     0,
+        0,    -6,    37,  -121,   289,  -562,   932, -1341,  1668, -1681,   703, 29207,
+     5840, -3742,  2597, -1706,  1015,  -527,   225,   -68,     6,     7,    -4,     0,
+        0,    -6,    37,  -120,   288,  -563,   939, -1360,  1708, -1760,   872, 29247,
+     5632, -3670,  2569, -1699,  1016,  -530,   228,   -71,     8,     7,    -4,     0,
+       -1,    -5,    36,  -119,   287,  -564,   945, -1378,  1747, -1839,  1043, 29285,
+     5425, -3598,  2541, -1691,  1017,  -534,   232,   -73,     9,     6,    -3,     0,
+       -1,    -5,    35,  -117,   286,  -565,   952, -1396,  1786, -1917,  1216, 29319,
+     5219, -3526,  2512, -1682,  1017,  -538,   236,   -76,    10,     6,    -3,     0,
+       -1,    -4,    34,  -116,   284,  -566,   958, -1414,  1825, -1996,  1390, 29350,
+     5016, -3453,  2483, -1673,  1017,  -541,   239,   -78,    12,     5,    -3,     0,
+       -1,    -4,    33,  -114,   283,  -566,   964, -1431,  1864, -2074,  1567, 29378,
+     4811, -3380,  2453, -1663,  1017,  -544,   242,   -81,    13,     4,    -3,     0,
+       -1,    -4,    32,  -113,   281,  -566,   969, -1448,  1902, -2153,  1745, 29403,
+     4611, -3306,  2422, -1653,  1016,  -547,   246,   -83,    14,     4,    -3,     0,
+       -1,    -3,    31,  -111,   280,  -566,   974, -1464,  1940, -2231,  1925, 29425,
+     4406, -3231,  2391, -1642,  1015,  -549,   249,   -86,    16,     3,    -3,     0,
+       -1,    -3,    30,  -110,   278,  -566,   979, -1480,  1977, -2310,  2106, 29444,
+     4208, -3156,  2360, -1631,  1014,  -552,   252,   -88,    17,     3,    -3,     0,
+       -1,    -2,    29,  -108,   276,  -566,   984, -1496,  2014, -2388,  2289, 29460,
+     4009, -3081,  2327, -1619,  1012,  -554,   255,   -90,    18,     2,    -2,     0,
+       -1,    -2,    28,  -106,   274,  -565,   988, -1511,  2051, -2466,  2474, 29472,
+     3810, -3005,  2294, -1607,  1010,  -556,   258,   -92,    20,     2,    -2,     0,
+       -2,    -1,    27,  -104,   272,  -564,   992, -1526,  2087, -2544,  2661, 29482,
+     3615, -2929,  2261, -1595,  1008,  -558,   260,   -94,    21,     1,    -2,     0,
+       -2,    -1,    25,  -102,   270,  -564,   996, -1541,  2123, -2621,  2849, 29488,
+     3422, -2853,  2227, -1582,  1006,  -560,   263,   -96,    22,     1,    -2,     0,
+       -2,     0,    24,  -100,   268,  -562,  1000, -1555,  2158, -2699,  3038, 29491,
+     3230, -2776,  2193, -1569,  1003,  -561,   265,   -99,    23,     0,    -2,     0,
+};
+
+/* 24 taps per branch: 44100 to 88200 Hz, 48000 to 96000 Hz */
+const int16_t audio_src_coef_2_1[48] =
+{
+        0,    -5,    20,   -32,    14,    84,  -338,   839, -1684,  3021, -5295, 11664,
+    27044, -3050,   313,   547,  -742,   646,  -450,   260,  -123,    44,   -10,     1,
+        1,   -10,    44,  -123,   260,  -450,   646,  -742,   547,   313, -3050, 27046,
+    11662, -5295,  3021, -1684,   839,  -338,    84,    14,   -32,    20,    -5,     0,
+};
+
+/* 24 taps per branch: 44100 to 96000 Hz */
+const int16_t audio_src_coef_320_147[7680] =
+{
+        0,    -2,     0,    23,   -99,   266,  -562,  1002, -1566,  2184, -2757,  3182,
+    29493,  3086, -2718,  2167, -1559,  1001,  -562,   267,  -100,    24,     0,    -2,
+        0,    -2,     0,    23,   -98,   265,  -561,  1004, -1572,  2202, -2795,  3277,
+    29490,  2991, -2679,  2149, -1552,   999,  -563,   268,  -101,    25,     0,    -2,
+        0,    -2,     1,    22,   -97,   264,  -560,  1005, -1579,  2219, -2834,  3374,
+    29489,  2896, -2641,  2132, -1545,   997,  -563,   270,  -102,    25,    -1,    -2,
+        0,    -2,     1,    22,   -96,   262,  -559,  1006, -1586,  2236, -2872,  3470,
+    29488,  2802, -2602,  2114, -1538,   995,  -564,   271,  -103,    26,    -1,    -2,
+        0,    -2,     1,    21,   -95,   261,  -559,  1008, -1592,  2253, -2910,  3568,
+    29483,  2708, -2563,  2096, -1530,   993,  -564,   272,  -104,    26,    -1,    -2,
+        0,    -2,     1,    20,   -94,   260,  -558,  1009, -1598,  2270, -2948,  3665,
+    29479,  2614, -2524,  2078, -1523,   992,  -565,   273,  -105,    27,    -1,    -2,
+        0,    -2,     2,    20,   -93,   258,  -557,  1010, -1605,  2286, -2986,  3763,
+    29476,  2521, -2486,  2060, -1515,   989,  -565,   274,  -106,    27,    -2,    -1,
+        0,    -2,     2,    19,   -92,   257,  -556,  1011, -1611,  2303, -3024,  3861,
+    29470,  2428, -2447,  2042, -1508,   987,  -565,   275,  -107,    28,    -2,    -1,
+        0,    -2,     2,    19,   -91,   256,  -555,  1012, -1617,  2319, -3062,  3959,
+    29462,  2336, -2408,  2024, -1500,   985,  -566,   276,  -107,    29,    -2,    -1,
+        0,    -2,     2,    18,   -90,   254,  -554,  1013, -1623,  2336, -3100,  4058,
+    29456,  2244, -2369,  2005, -1492,   983,  -566,   277,  -108,    29,    -2,    -1,
+        0,    -3,     3,    17,   -88,   253,  -553,  1014, -1628,  2352, -3138,  4157,
+    29447,  2152, -2329,  1987, -1485,   981,  -566,   278,  -109,    30,    -3,    -1,
+        0,    -3,     3,    17,   -87,   251,  -551,  1015, -1634,  2368, -3175,  4257,
+    29438,  2061, -2290,  1968, -1477,   978,  -566,   279,  -110,    30,    -3,    -1,
+        0,    -3,     3,    16,   -86,   250,  -550,  1015, -1640,  2384, -3213,  4357,
+    29429,  1970, -2251,  1949, -1468,   976,  -566,   280,  -111,    31,    -3,    -1,
+        0,    -3,     4,    15,   -85,   248,  -549,  1016, -1645,  2399, -3250,  4457,
+    29421,  1880, -2212,  1930, -1460,   973,  -566,   280,  -112,    31,    -3,    -1,
+        0,    -3,     4,    15,   -84,   247,  -548,  1016, -1650,  2415, -3287,  4558,
+    29407,  1790, -2173,  1912, -1452,   971,  -566,   281,  -113,    32,    -3,    -1,
+        0,    -3,     4,    14,   -83,   245,  -546,  1017, -1656,  2430, -3324,  4659,
+    29397,  1700, -2133,  1893, -1444,   968,  -566,   282,  -113,    32,    -4,    -1,
+        0,    -3,     4,    13,   -82,   243,  -545,  1017, -1661,  2446, -3361,  4760,
+    29386,  1611, -2094,  1873, -1435,   965,  -566,   283,  -114,    33,    -4,    -1,
+        0,    -3,     5,    13,   -80,   242,  -543,  1017, -1666,  2461, -3398,  4861,
+    29371,  1523, -2055,  1854, -1427,   962,  -566,   284,  -115,    33,    -4,    -1,
+        0,    -3,     5,    12,   -79,   240,  -542,  1017, -1670,  2476, -3435,  4963,
+    29359,  1434, -2016,  1835, -1418,   959,  -566,   284,  -116,    34,    -4,    -1,
+        0,    -3,     5,    11,   -78,   238,  -540,  1017, -1675,  2491, -3472,  5065,
+    29344,  1347, -1976,  1816, -1410,   956,  -566,   285,  -116,    34,    -4,    -1,
+        0,    -3,     5,    11,   -77,   237,  -539,  1017, -1680,  2505, -3508,  5168,
+    29329,  1259, -1937,  1796, -1401,   953,  -565,   286,  -117,    35,    -5,    -1,
+        0,    -3,     6,    10,   -75,   235,  -537,  1017, -1684,  2520, -3544,  5271,
+    29311,  1172, -1898,  1777, -1392,   950,  -565,   286,  -118,    35,    -5,    -1,
+        0,    -3,     6,     9,   -74,   233,  -535,  1017, -1689,  2534, -3581,  5374,
+    29295,  1086, -1858,  1757, -1383,   947,  -565,   287,  -118,    35,    -5,    -1,
+        0,    -3,     6,     9,   -73,   231,  -533,  1017, -1693,  2548, -3617,  5477,
+    29277,  1000, -1819,  1737, -1374,   944,  -564,   287,  -119,    36,    -5,    -1,
+        0,    -4,     7,     8,   -72,   229,  -532,  1017, -1697,  2562, -3653,  5581,
+    29259,   915, -1780,  1718, -1365,   941,  -564,   288,  -120,    36,    -6,     0,
+        0,    -4,     7,     7,   -70,   228,  -530,  1016, -1701,  2576, -3688,  5685,
+    29237,   830, -1740,  1698, -1356,   937,  -563,   289,  -121,    37,    -6,     0,
+        0,    -4,     7,     7,   -69,   226,  -528,  1016, -1705,  2590, -3724,  5789,
+    29217,   745, -1701,  1678, -1346,   934,  -563,   289,  -121,    37,    -6,     0,
+        0,    -4,     7,     6,   -68,   224,  -526,  1015, -1709,  2604, -3759,  5894,
+    29196,   661, -1662,  1658, -1337,   930,  -562,   290,  -122,    38,    -6,     0,
+        0,    -4,     8,     5,   -66,   222,  -524,  1014, -1712,  2617, -3795,  5998,
+    29174,   577, -1622,  1638, -1328,   927,  -561,   290,  -122,    38,    -6,     0,
+        0,    -4,     8,     4,   -65,   220,  -522,  1014, -1716,  2630, -3830,  6103,
+    29153,   494, -1583,  1618, -1318,   923,  -561,   290,  -123,    39,    -6,     0,
+        0,    -4,     8,     4,   -64,   218,  -520,  1013, -1719,  2643, -3865,  6209,
+    29129,   411, -1544,  1598, -1308,   920,  -560,   291,  -124,    39,    -7,     0,
+        0,    -4,     9,     3,   -62,   216,  -517,  1012, -1722,  2656, -3899,  6314,
+    29104,   329, -1505,  1577, -1299,   916,  -559,   291,  -124,    39,    -7,     0,
+        0,    -4,     9,     2,   -61,   214,  -515,  1011, -1725,  2669, -3934,  6420,
+    29078,   247, -1465,  1557, -1289,   912,  -558,   292,  -125,    40,    -7,     0,
+        0,    -4,     9,     2,   -60,   212,  -513,  1010, -1728,  2682, -3968,  6527,
+    29050,   166, -1426,  1537, -1279,   908,  -557,   292,  -125,    40,    -7,     0,
+        0,    -4,    10,     1,   -58,   210,  -511,  1009, -1731,  2694, -4003,  6633,
+    29026,    85, -1387,  1516, -1269,   904,  -557,   292,  -126,    41,    -7,     0,
+        0,    -4,    10,     0,   -57,   208,  -508,  1007, -1734,  2706, -4037,  6740,
+    29001,     4, -1348,  1496, -1259,   900,  -556,   292,  -126,    41,    -8,     0,
+        0,    -4,    10,    -1,   -55,   205,  -506,  1006, -1736,  2718, -4071,  6847,
+    28973,   -75, -1309,  1475, -1249,   896,  -555,   293,  -127,    41,    -8,     0,
+        0,    -5,    10,    -1,   -54,   203,  -503,  1005, -1739,  2730, -4104,  6954,
+    28943,  -155, -1270,  1455, -1239,   892,  -554,   293,  -127,    42,    -8,     0,
+        0,    -5,    11,    -2,   -52,   201,  -501,  1003, -1741,  2742, -4138,  7061,
+    28915,  -234, -1231,  1434, -1229,   888,  -553,   293,  -128,    42,    -8,     0,
+        0,    -5,    11,    -3,   -51,   199,  -498,  1002, -1743,  2753, -4171,  7169,
+    28883,  -312, -1192,  1413, -1219,   884,  -551,   293,  -128,    42,    -8,     0,
+        0,    -5,    11,    -4,   -50,   197,  -496,  1000, -1745,  2765, -4204,  7277,
+    28853,  -390, -1153,  1392, -1208,   879,  -550,   293,  -129,    43,    -8,     0,
+        0,    -5,    12,    -5,   -48,   194,  -493,   998, -1747,  2776, -4237,  7385,
+    28821,  -468, -1114,  1372, -1198,   875,  -549,   294,  -129,    43,    -9,     0,
+        0,    -5,    12,    -5,   -47,   192,  -490,   996, -1749,  2787, -4270,  7493,
+    28789,  -545, -1075,  1351, -1188,   871,  -548,   294,  -130,    44,    -9,     0,
+        0,    -5,    12,    -6,   -45,   190,  -487,   994, -1751,  2797, -4302,  7602,
+    28756,  -621, -1037,  1330, -1177,   866,  -547,   294,  -130,    44,    -9,     0,
+        0,    -5,    13,    -7,   -44,   187,  -485,   992, -1752,  2808, -4335,  7710,
+    28724,  -697,  -998,  1309, -1167,   862,  -545,   294,  -131,    44,    -9,     0,
+        0,    -5,    13,    -8,   -42,   185,  -482,   990, -1754,  2818, -4367,  7819,
+    28688,  -772,  -959,  1288, -1156,   857,  -544,   294,  -131,    45,    -9,     0,
+        0,    -5,    13,    -8,   -41,   183,  -479,   988, -1755,  2828, -4398,  7928,
+    28650,  -847,  -921,  1267, -1145,   853,  -542,   294,  -131,    45,    -9,     0,
+        0,    -5,    14,    -9,   -39,   180,  -476,   986, -1756,  2838, -4430,  8038,
+    28616,  -922,  -882,  1246, -1135,   848,  -541,   294,  -132,    45,   -10,     0,
+        0,    -5,    14,   -10,   -37,   178,  -473,   983, -1757,  2848, -4461,  8147,
+    28580,  -996,  -844,  1225, -1124,   843,  -540,   294,  -132,    45,   -10,     0,
+        0,    -6,    14,   -11,   -36,   175,  -470,   981, -1758,  2858, -4493,  8257,
+    28542, -1069,  -806,  1204, -1113,   838,  -538,   294,  -132,    46,   -10,     1,
+        0,    -6,    15,   -12,   -34,   173,  -467,   978, -1759,  2867, -4524,  8367,
+    28503, -1142,  -767,  1183, -1102,   834,  -537,   294,  -133,    46,   -10,     1,
+        0,    -6,    15,   -12,   -33,   170,  -464,   976, -1759,  2876, -4554,  8477,
+    28463, -1215,  -729,  1162, -1091,   829,  -535,   294,  -133,    46,   -10,     1,
+        0,    -6,    15,   -13,   -31,   168,  -460,   973, -1759,  2885, -4585,  8587,
+    28422, -1286,  -691,  1140, -1080,   824,  -533,   293,  -133,    47,   -10,     1,
+        0,    -6,    15,   -14,   -30,   165,  -457,   970, -1760,  2894, -4615,  8698,
+    28385, -1358,  -653,  1119, -1069,   819,  -532,   293,  -134,    47,   -10,     1,
+        0,    -6,    16,   -15,   -28,   163,  -454,   967, -1760,  2903, -4645,  8808,
+    28343, -1429,  -615,  1098, -1058,   814,  -530,   293,  -134,    47,   -11,     1,
+        0,    -6,    16,   -16,   -26,   160,  -451,   964, -1760,  2911, -4675,  8919,
+    28301, -1499,  -577,  1077, -1047,   809,  -528,   293,  -134,    47,   -11,     1,
+        0,    -6,    16,   -16,   -25,   158,  -447,   961, -1760,  2919, -4704,  9030,
+    28257, -1569,  -539,  1055, -1035,   803,  -526,   293,  -135,    48,   -11,     1,
+        0,    -6,    17,   -17,   -23,   155,  -444,   958, -1759,  2927, -4733,  9141,
+    28214, -1638,  -502,  1034, -1024,   798,  -525,   292,  -135,    48,   -11,     1,
+        0,    -6,    17,   -18,   -21,   152,  -440,   955, -1759,  2935, -4762,  9252,
+    28169, -1707,  -464,  1013, -1013,   793,  -523,   292,  -135,    48,   -11,     1,
+        0,    -6,    17,   -19,   -20,   150,  -437,   951, -1758,  2943, -4791,  9364,
+    28123, -1775,  -427,   991, -1001,   788,  -521,   292,  -135,    49,   -11,     1,
+        0,    -7,    18,   -20,   -18,   147,  -433,   948, -1758,  2950, -4819,  9475,
+    28079, -1843,  -389,   970,  -990,   782,  -519,   291,  -135,    49,   -11,     1,
+        0,    -7,    18,   -21,   -16,   144,  -429,   944, -1757,  2957, -4847,  9587,
+    28032, -1910,  -352,   949,  -978,   777,  -517,   291,  -136,    49,   -11,     1,
+        0,    -7,    18,   -21,   -15,   141,  -426,   941, -1756,  2964, -4875,  9699,
+    27987, -1977,  -315,   927,  -967,   772,  -515,   291,  -136,    49,   -12,     1,
+        0,    -7,    19,   -22,   -13,   139,  -422,   937, -1755,  2971, -4903,  9811,
+    27938, -2043,  -278,   906,  -955,   766,  -513,   290,  -136,    49,   -12,     1,
+        0,    -7,    19,   -23,   -11,   136,  -418,   933, -1753,  2977, -4930,  9923,
+    27887, -2108,  -241,   885,  -944,   761,  -511,   290,  -136,    50,   -12,     1,
+        0,    -7,    19,   -24,   -10,   133,  -414,   929, -1752,  2983, -4957, 10035,
+    27841, -2173,  -204,   863,  -932,   755,  -509,   289,  -136,    50,   -12,     1,
+        0,    -7,    20,   -25,    -8,   130,  -411,   925, -1750,  2989, -4984, 10147,
+    27792, -2238,  -168,   842,  -921,   750,  -507,   289,  -136,    50,   -12,     1,
+        0,    -7,    20,   -26,    -6,   127,  -407,   921, -1748,  2995, -5010, 10260,
+    27741, -2302,  -131,   820,  -909,   744,  -505,   289,  -137,    50,   -12,     1,
+        0,    -7,    20,   -27,    -5,   124,  -403,   917, -1747,  3001, -5036, 10372,
+    27691, -2365,   -95,   799,  -897,   738,  -502,   288,  -137,    50,   -12,     1,
+        0,    -7,    21,   -27,    -3,   121,  -399,   913, -1745,  3006, -5062, 10485,
+    27635, -2428,   -58,   778,  -885,   732,  -500,   288,  -137,    51,   -12,     1,
+        0,    -7,    21,   -28,    -1,   118,  -395,   909, -1742,  3011, -5088, 10597,
+    27584, -2491,   -22,   756,  -873,   727,  -498,   287,  -137,    51,   -12,     1,
+        0,    -7,    21,   -29,     1,   116,  -390,   904, -1740,  3016, -5113, 10710,
+    27531, -2552,    14,   735,  -862,   721,  -496,   286,  -137,    51,   -13,     1,
+        0,    -8,    22,   -30,     2,   113,  -386,   900, -1738,  3021, -5138, 10823,
+    27477, -2614,    50,   714,  -850,   715,  -493,   286,  -137,    51,   -13,     1,
+        0,    -8,    22,   -31,     4,   110,  -382,   895, -1735,  3025, -5163, 10936,
+    27424, -2674,    86,   692,  -838,   709,  -491,   285,  -137,    51,   -13,     1,
+        0,    -8,    22,   -32,     6,   107,  -378,   891, -1732,  3030, -5187, 11049,
+    27366, -2735,   121,   671,  -826,   703,  -488,   285,  -137,    52,   -13,     1,
+        0,    -8,    23,   -33,     8,   104,  -374,   886, -1729,  3034, -5211, 11162,
+    27309, -2794,   157,   650,  -814,   697,  -486,   284,  -137,    52,   -13,     1,
+        0,    -8,    23,   -33,    10,   100,  -369,   881, -1726,  3037, -5235, 11275,
+    27255, -2853,   192,   628,  -802,   691,  -484,   283,  -137,    52,   -13,     1,
+        0,    -8,    23,   -34,    11,    97,  -365,   876, -1723,  3041, -5258, 11389,
+    27196, -2912,   228,   607,  -790,   685,  -481,   283,  -137,    52,   -13,     1,
+        0,    -8,    24,   -35,    13,    94,  -361,   871, -1720,  3044, -5281, 11502,
+    27139, -2970,   263,   586,  -778,   679,  -479,   282,  -137,    52,   -13,     1,
+        0,    -8,    24,   -36,    15,    91,  -356,   866, -1716,  3047, -5304, 11615,
+    27080, -3027,   298,   564,  -766,   673,  -476,   281,  -137,    52,   -13,     1,
+        0,    -8,    24,   -37,    17,    88,  -352,   861, -1712,  3050, -5326, 11729,
+    27020, -3084,   332,   543,  -754,   667,  -473,   280,  -137,    52,   -13,     1,
+        0,    -8,    25,   -38,    19,    85,  -347,   856, -1709,  3053, -5349, 11842,
+    26957, -3140,   367,   522,  -741,   661,  -471,   280,  -137,    53,   -13,     1,
+        0,    -8,    25,   -39,    20,    82,  -342,   850, -1705,  3055, -5370, 11955,
+    26898, -3196,   402,   501,  -729,   655,  -468,   279,  -137,    53,   -14,     1,
+        0,    -9,    25,   -39,    22,    79,  -338,   845, -1701,  3057, -5392, 12069,
+    26839, -3251,   436,   480,  -717,   648,  -466,   278,  -137,    53,   -14,     1,
+        0,    -9,    26,   -40,    24,    75,  -333,   839, -1696,  3059, -5413, 12182,
+    26778, -3306,   470,   458,  -705,   642,  -463,   277,  -137,    53,   -14,     1,
+        0,    -9,    26,   -41,    26,    72,  -328,   834, -1692,  3061, -5434, 12296,
+    26714, -3360,   504,   437,  -693,   636,  -460,   276,  -137,    53,   -14,     1,
+        0,    -9,    26,   -42,    28,    69,  -324,   828, -1687,  3062, -5454, 12410,
+    26651, -3414,   538,   416,  -680,   629,  -457,   275,  -137,    53,   -14,     1,
+        0,    -9,    27,   -43,    30,    66,  -319,   822, -1683,  3064, -5474, 12523,
+    26587, -3467,   572,   395,  -668,   623,  -455,   274,  -137,    53,   -14,     1,
+        0,    -9,    27,   -44,    31,    62,  -314,   817, -1678,  3065, -5494, 12637,
+    26521, -3519,   605,   374,  -656,   617,  -452,   274,  -136,    53,   -14,     1,
+        0,    -9,    27,   -45,    33,    59,  -309,   811, -1673,  3065, -5513, 12750,
+    26457, -3571,   639,   353,  -644,   610,  -449,   273,  -136,    53,   -14,     1,
+        0,    -9,    28,   -46,    35,    56,  -304,   805, -1668,  3066, -5532, 12864,
+    26388, -3622,   672,   332,  -631,   604,  -446,   272,  -136,    53,   -14,     1,
+        0,    -9,    28,   -46,    37,    52,  -299,   798, -1662,  3066, -5550, 12977,
+    26322, -3673,   705,   311,  -619,   597,  -443,   271,  -136,    54,   -14,     1,
+        0,    -9,    28,   -47,    39,    49,  -294,   792, -1657,  3066, -5569, 13091,
+    26255, -3723,   738,   290,  -607,   591,  -440,   270,  -136,    54,   -14,     1,
+        0,    -9,    29,   -48,    41,    46,  -289,   786, -1651,  3066, -5587, 13204,
+    26185, -3773,   771,   270,  -594,   584,  -437,   269,  -136,    54,   -14,     1,
+        0,   -10,    29,   -49,    43,    42,  -284,   780, -1646,  3065, -5604, 13318,
+    26118, -3822,   803,   249,  -582,   578,  -434,   268,  -135,    54,   -14,     1,
+        0,   -10,    29,   -50,    45,    39,  -279,   773, -1640,  3064, -5621, 13431,
+    26051, -3870,   835,   228,  -570,   571,  -431,   267,  -135,    54,   -14,     1,
+        0,   -10,    30,   -51,    47,    36,  -274,   767, -1634,  3063, -5638, 13545,
+    25978, -3918,   868,   207,  -557,   565,  -428,   266,  -135,    54,   -14,     1,
+        1,   -10,    30,   -52,    48,    32,  -268,   760, -1627,  3062, -5654, 13658,
+    25910, -3966,   900,   187,  -545,   558,  -425,   264,  -135,    54,   -15,     1,
+        1,   -10,    30,   -53,    50,    29,  -263,   753, -1621,  3061, -5670, 13772,
+    25839, -4012,   931,   166,  -532,   551,  -422,   263,  -135,    54,   -15,     1,
+        1,   -10,    31,   -54,    52,    25,  -258,   747, -1614,  3059, -5686, 13885,
+    25766, -4059,   963,   146,  -520,   545,  -419,   262,  -134,    54,   -15,     1,
+        1,   -10,    31,   -54,    54,    22,  -253,   740, -1608,  3057, -5701, 13998,
+    25695, -4104,   994,   125,  -508,   538,  -416,   261,  -134,    54,   -15,     1,
+        1,   -10,    31,   -55,    56,    18,  -247,   733, -1601,  3055, -5716, 14111,
+    25621, -4149,  1026,   105,  -495,   531,  -413,   260,  -134,    54,   -15,     1,
+        1,   -10,    32,   -56,    58,    15,  -242,   726, -1594,  3052, -5730, 14225,
+    25548, -4194,  1057,    84,  -483,   524,  -410,   259,  -134,    54,   -15,     1,
+        1,   -10,    32,   -57,    60,    11,  -236,   719, -1587,  3049, -5744, 14338,
+    25474, -4238,  1087,    64,  -471,   518,  -407,   258,  -133,    54,   -15,     1,
+        1,   -10,    32,   -58,    62,     8,  -231,   712, -1580,  3046, -5758, 14451,
+    25399, -4281,  1118,    44,  -458,   511,  -403,   256,  -133,    54,   -15,     1,
+        1,   -11,    33,   -59,    64,     4,  -225,   704, -1572,  3043, -5771, 14564,
+    25325, -4324,  1148,    24,  -446,   504,  -400,   255,  -133,    54,   -15,     1,
+        1,   -11,    33,   -60,    66,     1,  -220,   697, -1565,  3039, -5784, 14677,
+    25249, -4366,  1179,     3,  -433,   497,  -397,   254,  -132,    54,   -15,     1,
+        1,   -11,    33,   -61,    68,    -3,  -214,   690, -1557,  3036, -5797, 14789,
+    25174, -4408,  1209,   -17,  -421,   490,  -394,   253,  -132,    54,   -15,     1,
+        1,   -11,    34,   -61,    70,    -7,  -209,   682, -1549,  3032, -5809, 14902,
+    25096, -4449,  1239,   -37,  -409,   484,  -390,   251,  -132,    54,   -15,     1,
+        1,   -11,    34,   -62,    72,   -10,  -203,   675, -1541,  3027, -5820, 15015,
+    25016, -4490,  1268,   -57,  -396,   477,  -387,   250,  -131,    54,   -15,     2,
+        1,   -11,    34,   -63,    74,   -14,  -197,   667, -1533,  3023, -5831, 15127,
+    24939, -4530,  1298,   -77,  -384,   470,  -384,   249,  -131,    54,   -15,     2,
+        1,   -11,    34,   -64,    75,   -17,  -191,   659, -1525,  3018, -5842, 15239,
+    24860, -4569,  1327,   -96,  -371,   463,  -380,   248,  -131,    54,   -15,     2,
+        1,   -11,    35,   -65,    77,   -21,  -186,   651, -1516,  3013, -5853, 15352,
+    24782, -4608,  1356,  -116,  -359,   456,  -377,   246,  -130,    54,   -15,     2,
+        1,   -11,    35,   -66,    79,   -25,  -180,   644, -1508,  3008, -5862, 15464,
+    24703, -4647,  1385,  -136,  -347,   449,  -374,   245,  -130,    54,   -15,     2,
+        1,   -11,    35,   -67,    81,   -28,  -174,   636, -1499,  3002, -5872, 15576,
+    24622, -4684,  1413,  -156,  -334,   442,  -370,   244,  -130,    54,   -15,     2,
+        1,   -11,    36,   -68,    83,   -32,  -168,   628, -1490,  2996, -5881, 15688,
+    24541, -4722,  1442,  -175,  -322,   435,  -367,   242,  -129,    54,   -15,     2,
+        1,   -11,    36,   -68,    85,   -36,  -162,   619, -1481,  2990, -5890, 15800,
+    24460, -4758,  1470,  -195,  -310,   428,  -363,   241,  -129,    54,   -15,     2,
+        1,   -12,    36,   -69,    87,   -39,  -156,   611, -1472,  2984, -5898, 15911,
+    24378, -4794,  1498,  -214,  -297,   421,  -360,   239,  -128,    54,   -15,     2,
+        1,   -12,    37,   -70,    89,   -43,  -150,   603, -1463,  2977, -5906, 16023,
+    24296, -4830,  1526,  -233,  -285,   414,  -357,   238,  -128,    54,   -15,     2,
+        1,   -12,    37,   -71,    91,   -47,  -144,   595, -1453,  2970, -5913, 16134,
+    24214, -4865,  1553,  -253,  -273,   407,  -353,   237,  -128,    54,   -15,     2,
+        1,   -12,    37,   -72,    93,   -50,  -138,   586, -1444,  2963, -5920, 16245,
+    24133, -4899,  1580,  -272,  -261,   400,  -350,   235,  -127,    53,   -15,     2,
+        1,   -12,    38,   -73,    95,   -54,  -132,   578, -1434,  2955, -5926, 16356,
+    24047, -4933,  1607,  -291,  -248,   393,  -346,   234,  -127,    53,   -15,     2,
+        1,   -12,    38,   -74,    97,   -58,  -126,   569, -1424,  2948, -5932, 16467,
+    23963, -4966,  1634,  -310,  -236,   386,  -343,   232,  -126,    53,   -15,     2,
+        1,   -12,    38,   -75,    99,   -62,  -120,   561, -1414,  2940, -5938, 16578,
+    23878, -4999,  1661,  -329,  -224,   379,  -339,   231,  -126,    53,   -15,     2,
+        1,   -12,    38,   -75,   101,   -65,  -114,   552, -1404,  2932, -5943, 16688,
+    23793, -5031,  1687,  -348,  -212,   372,  -335,   229,  -125,    53,   -15,     1,
+        1,   -12,    39,   -76,   103,   -69,  -108,   543, -1393,  2923, -5948, 16799,
+    23706, -5063,  1714,  -366,  -200,   365,  -332,   228,  -125,    53,   -15,     1,
+        1,   -12,    39,   -77,   105,   -73,  -101,   534, -1383,  2915, -5952, 16909,
+    23618, -5094,  1740,  -385,  -187,   358,  -328,   226,  -124,    53,   -15,     1,
+        1,   -12,    39,   -78,   107,   -77,   -95,   525, -1372,  2906, -5956, 17019,
+    23532, -5124,  1765,  -403,  -175,   351,  -325,   225,  -124,    53,   -15,     1,
+        1,   -12,    40,   -79,   109,   -81,   -89,   517, -1361,  2896, -5959, 17129,
+    23443, -5154,  1791,  -422,  -163,   344,  -321,   223,  -123,    53,   -15,     1,
+        1,   -12,    40,   -80,   111,   -84,   -83,   507, -1350,  2887, -5962, 17238,
+    23356, -5183,  1816,  -440,  -151,   336,  -317,   222,  -123,    53,   -15,     1,
+        1,   -13,    40,   -80,   113,   -88,   -76,   498, -1339,  2877, -5964, 17348,
+    23268, -5212,  1841,  -459,  -139,   329,  -314,   220,  -122,    53,   -15,     1,
+        1,   -13,    40,   -81,   115,   -92,   -70,   489, -1328,  2867, -5966, 17457,
+    23181, -5240,  1866,  -477,  -127,   322,  -310,   218,  -122,    52,   -15,     1,
+        1,   -13,    41,   -82,   117,   -96,   -63,   480, -1317,  2857, -5967, 17566,
+    23089, -5268,  1890,  -495,  -115,   315,  -306,   217,  -121,    52,   -15,     1,
+        1,   -13,    41,   -83,   119,  -100,   -57,   471, -1305,  2846, -5968, 17674,
+    23001, -5295,  1915,  -513,  -103,   308,  -303,   215,  -121,    52,   -15,     1,
+        1,   -13,    41,   -84,   120,  -103,   -51,   461, -1294,  2835, -5969, 17783,
+    22912, -5322,  1939,  -531,   -91,   301,  -299,   214,  -120,    52,   -15,     1,
+        1,   -13,    42,   -85,   122,  -107,   -44,   452, -1282,  2824, -5969, 17891,
+    22820, -5348,  1963,  -549,   -79,   294,  -295,   212,  -120,    52,   -15,     1,
+        1,   -13,    42,   -85,   124,  -111,   -38,   442, -1270,  2813, -5968, 17999,
+    22728, -5373,  1986,  -566,   -67,   287,  -292,   210,  -119,    52,   -15,     1,
+        1,   -13,    42,   -86,   126,  -115,   -31,   433, -1258,  2801, -5967, 18107,
+    22635, -5398,  2010,  -584,   -56,   280,  -288,   209,  -118,    52,   -15,     1,
+        1,   -13,    42,   -87,   128,  -119,   -25,   423, -1246,  2789, -5966, 18215,
+    22545, -5422,  2033,  -602,   -44,   273,  -284,   207,  -118,    52,   -15,     1,
+        1,   -13,    43,   -88,   130,  -123,   -18,   413, -1234,  2777, -5964, 18322,
+    22453, -5446,  2056,  -619,   -32,   265,  -280,   205,  -117,    51,   -15,     1,
+        1,   -13,    43,   -89,   132,  -126,   -11,   404, -1221,  2765, -5962, 18429,
+    22358, -5469,  2078,  -636,   -20,   258,  -277,   204,  -117,    51,   -15,     1,
+        1,   -13,    43,   -90,   134,  -130,    -5,   394, -1209,  2752, -5959, 18536,
+    22266, -5492,  2101,  -654,    -8,   251,  -273,   202,  -116,    51,   -15,     1,
+        1,   -13,    44,   -90,   136,  -134,     2,   384, -1196,  2739, -5955, 18643,
+    22169, -5514,  2123,  -671,     3,   244,  -269,   200,  -115,    51,   -15,     1,
+        1,   -13,    44,   -91,   138,  -138,     8,   374, -1183,  2726, -5951, 18749,
+    22075, -5536,  2145,  -688,    15,   237,  -265,   199,  -115,    51,   -15,     1,
+        1,   -13,    44,   -92,   140,  -142,    15,   364, -1170,  2712, -5947, 18855,
+    21981, -5557,  2167,  -705,    27,   230,  -262,   197,  -114,    51,   -15,     1,
+        1,   -14,    44,   -93,   142,  -146,    22,   354, -1157,  2699, -5942, 18961,
+    21888, -5578,  2188,  -721,    38,   223,  -258,   195,  -114,    50,   -15,     1,
+        1,   -14,    45,   -94,   144,  -150,    29,   344, -1144,  2685, -5937, 19066,
+    21792, -5598,  2209,  -738,    50,   216,  -254,   193,  -113,    50,   -15,     1,
+        1,   -14,    45,   -94,   146,  -154,    35,   333, -1130,  2671, -5931, 19171,
+    21695, -5617,  2230,  -755,    61,   209,  -250,   192,  -112,    50,   -15,     1,
+        1,   -14,    45,   -95,   148,  -157,    42,   323, -1117,  2656, -5925, 19276,
+    21598, -5636,  2251,  -771,    73,   202,  -246,   190,  -112,    50,   -15,     1,
+        1,   -14,    45,   -96,   149,  -161,    49,   313, -1103,  2641, -5918, 19381,
+    21502, -5654,  2271,  -787,    84,   195,  -243,   188,  -111,    50,   -15,     1,
+        1,   -14,    46,   -97,   151,  -165,    56,   302, -1089,  2626, -5910, 19485,
+    21405, -5672,  2291,  -804,    95,   188,  -239,   186,  -110,    50,   -15,     1,
+        1,   -14,    46,   -97,   153,  -169,    62,   292, -1075,  2611, -5903, 19589,
+    21307, -5689,  2311,  -820,   107,   181,  -235,   185,  -110,    49,   -15,     1,
+        1,   -14,    46,   -98,   155,  -173,    69,   282, -1061,  2595, -5894, 19693,
+    21209, -5706,  2331,  -836,   118,   173,  -231,   183,  -109,    49,   -15,     1,
+        1,   -14,    46,   -99,   157,  -177,    76,   271, -1047,  2580, -5885, 19796,
+    21111, -5722,  2350,  -852,   129,   166,  -227,   181,  -108,    49,   -15,     1,
+        1,   -14,    46,  -100,   159,  -181,    83,   260, -1033,  2563, -5876, 19899,
+    21014, -5738,  2370,  -867,   140,   159,  -223,   179,  -108,    49,   -15,     1,
+        1,   -14,    47,  -100,   161,  -185,    90,   250, -1018,  2547, -5866, 20002,
+    20911, -5753,  2388,  -883,   152,   152,  -219,   177,  -107,    49,   -15,     1,
+        1,   -14,    47,  -101,   163,  -189,    97,   239, -1004,  2531, -5855, 20104,
+    20812, -5768,  2407,  -899,   163,   145,  -216,   176,  -106,    48,   -14,     1,
+        1,   -14,    47,  -102,   165,  -192,   104,   228,  -989,  2514, -5844, 20207,
+    20710, -5782,  2425,  -914,   174,   138,  -212,   174,  -105,    48,   -14,     1,
+        1,   -14,    47,  -103,   166,  -196,   111,   217,  -974,  2497, -5833, 20308,
+    20611, -5795,  2444,  -929,   185,   131,  -208,   172,  -105,    48,   -14,     1,
+        1,   -14,    48,  -103,   168,  -200,   118,   207,  -959,  2479, -5821, 20410,
+    20507, -5808,  2462,  -944,   196,   124,  -204,   170,  -104,    48,   -14,     1,
+        1,   -14,    48,  -104,   170,  -204,   124,   196,  -944,  2462, -5808, 20511,
+    20406, -5821,  2479,  -959,   207,   118,  -200,   168,  -103,    48,   -14,     1,
+        1,   -14,    48,  -105,   172,  -208,   131,   185,  -929,  2444, -5795, 20611,
+    20308, -5833,  2497,  -974,   217,   111,  -196,   166,  -103,    47,   -14,     1,
+        1,   -14,    48,  -105,   174,  -212,   138,   174,  -914,  2425, -5782, 20712,
+    20205, -5844,  2514,  -989,   228,   104,  -192,   165,  -102,    47,   -14,     1,
+        1,   -14,    48,  -106,   176,  -216,   145,   163,  -899,  2407, -5768, 20812,
+    20104, -5855,  2531, -1004,   239,    97,  -189,   163,  -101,    47,   -14,     1,
+        1,   -15,    49,  -107,   177,  -219,   152,   152,  -883,  2388, -5753, 20911,
+    20002, -5866,  2547, -1018,   250,    90,  -185,   161,  -100,    47,   -14,     1,
+        1,   -15,    49,  -108,   179,  -223,   159,   140,  -867,  2370, -5738, 21011,
+    19902, -5876,  2563, -1033,   260,    83,  -181,   159,  -100,    46,   -14,     1,
+        1,   -15,    49,  -108,   181,  -227,   166,   129,  -852,  2350, -5722, 21109,
+    19798, -5885,  2580, -1047,   271,    76,  -177,   157,   -99,    46,   -14,     1,
+        1,   -15,    49,  -109,   183,  -231,   173,   118,  -836,  2331, -5706, 21208,
+    19694, -5894,  2595, -1061,   282,    69,  -173,   155,   -98,    46,   -14,     1,
+        1,   -15,    49,  -110,   185,  -235,   181,   107,  -820,  2311, -5689, 21306,
+    19589, -5902,  2611, -1075,   292,    62,  -169,   153,   -97,    46,   -14,     1,
+        1,   -15,    50,  -110,   186,  -239,   188,    95,  -804,  2291, -5672, 21404,
+    19486, -5910,  2626, -1089,   302,    56,  -165,   151,   -97,    46,   -14,     1,
+        1,   -15,    50,  -111,   188,  -243,   195,    84,  -787,  2271, -5654, 21501,
+    19382, -5918,  2641, -1103,   313,    49,  -161,   149,   -96,    45,   -14,     1,
+        1,   -15,    50,  -112,   190,  -246,   202,    73,  -771,  2251, -5636, 21598,
+    19276, -5925,  2656, -1117,   323,    42,  -157,   148,   -95,    45,   -14,     1,
+        1,   -15,    50,  -112,   192,  -250,   209,    61,  -755,  2230, -5617, 21694,
+    19172, -5931,  2671, -1130,   333,    35,  -154,   146,   -94,    45,   -14,     1,
+        1,   -15,    50,  -113,   193,  -254,   216,    50,  -738,  2209, -5598, 21790,
+    19068, -5937,  2685, -1144,   344,    29,  -150,   144,   -94,    45,   -14,     1,
+        1,   -15,    50,  -114,   195,  -258,   223,    38,  -721,  2188, -5578, 21886,
+    18963, -5942,  2699, -1157,   354,    22,  -146,   142,   -93,    44,   -14,     1,
+        1,   -15,    51,  -114,   197,  -262,   230,    27,  -705,  2167, -5557, 21981,
+    18855, -5947,  2712, -1170,   364,    15,  -142,   140,   -92,    44,   -13,     1,
+        1,   -15,    51,  -115,   199,  -265,   237,    15,  -688,  2145, -5536, 22076,
+    18748, -5951,  2726, -1183,   374,     8,  -138,   138,   -91,    44,   -13,     1,
+        1,   -15,    51,  -115,   200,  -269,   244,     3,  -671,  2123, -5514, 22171,
+    18641, -5955,  2739, -1196,   384,     2,  -134,   136,   -90,    44,   -13,     1,
+        1,   -15,    51,  -116,   202,  -273,   251,    -8,  -654,  2101, -5492, 22265,
+    18537, -5959,  2752, -1209,   394,    -5,  -130,   134,   -90,    43,   -13,     1,
+        1,   -15,    51,  -117,   204,  -277,   258,   -20,  -636,  2078, -5469, 22358,
+    18429, -5962,  2765, -1221,   404,   -11,  -126,   132,   -89,    43,   -13,     1,
+        1,   -15,    51,  -117,   205,  -280,   265,   -32,  -619,  2056, -5446, 22451,
+    18324, -5964,  2777, -1234,   413,   -18,  -123,   130,   -88,    43,   -13,     1,
+        1,   -15,    52,  -118,   207,  -284,   273,   -44,  -602,  2033, -5422, 22544,
+    18216, -5966,  2789, -1246,   423,   -25,  -119,   128,   -87,    42,   -13,     1,
+        1,   -15,    52,  -118,   209,  -288,   280,   -56,  -584,  2010, -5398, 22636,
+    18106, -5967,  2801, -1258,   433,   -31,  -115,   126,   -86,    42,   -13,     1,
+        1,   -15,    52,  -119,   210,  -292,   287,   -67,  -566,  1986, -5373, 22728,
+    17999, -5968,  2813, -1270,   442,   -38,  -111,   124,   -85,    42,   -13,     1,
+        1,   -15,    52,  -120,   212,  -295,   294,   -79,  -549,  1963, -5348, 22819,
+    17892, -5969,  2824, -1282,   452,   -44,  -107,   122,   -85,    42,   -13,     1,
+        1,   -15,    52,  -120,   214,  -299,   301,   -91,  -531,  1939, -5322, 22910,
+    17785, -5969,  2835, -1294,   461,   -51,  -103,   120,   -84,    41,   -13,     1,
+        1,   -15,    52,  -121,   215,  -303,   308,  -103,  -513,  1915, -5295, 23000,
+    17675, -5968,  2846, -1305,   471,   -57,  -100,   119,   -83,    41,   -13,     1,
+        1,   -15,    52,  -121,   217,  -306,   315,  -115,  -495,  1890, -5268, 23090,
+    17565, -5967,  2857, -1317,   480,   -63,   -96,   117,   -82,    41,   -13,     1,
+        1,   -15,    52,  -122,   218,  -310,   322,  -127,  -477,  1866, -5240, 23180,
+    17458, -5966,  2867, -1328,   489,   -70,   -92,   115,   -81,    40,   -13,     1,
+        1,   -15,    53,  -122,   220,  -314,   329,  -139,  -459,  1841, -5212, 23269,
+    17347, -5964,  2877, -1339,   498,   -76,   -88,   113,   -80,    40,   -13,     1,
+        1,   -15,    53,  -123,   222,  -317,   336,  -151,  -440,  1816, -5183, 23357,
+    17237, -5962,  2887, -1350,   507,   -83,   -84,   111,   -80,    40,   -12,     1,
+        1,   -15,    53,  -123,   223,  -321,   344,  -163,  -422,  1791, -5154, 23445,
+    17127, -5959,  2896, -1361,   517,   -89,   -81,   109,   -79,    40,   -12,     1,
+        1,   -15,    53,  -124,   225,  -325,   351,  -175,  -403,  1765, -5124, 23533,
+    17018, -5956,  2906, -1372,   525,   -95,   -77,   107,   -78,    39,   -12,     1,
+        1,   -15,    53,  -124,   226,  -328,   358,  -187,  -385,  1740, -5094, 23620,
+    16907, -5952,  2915, -1383,   534,  -101,   -73,   105,   -77,    39,   -12,     1,
+        1,   -15,    53,  -125,   228,  -332,   365,  -200,  -366,  1714, -5063, 23706,
+    16799, -5948,  2923, -1393,   543,  -108,   -69,   103,   -76,    39,   -12,     1,
+        1,   -15,    53,  -125,   229,  -335,   372,  -212,  -348,  1687, -5031, 23792,
+    16689, -5943,  2932, -1404,   552,  -114,   -65,   101,   -75,    38,   -12,     1,
+        2,   -15,    53,  -126,   231,  -339,   379,  -224,  -329,  1661, -4999, 23878,
+    16578, -5938,  2940, -1414,   561,  -120,   -62,    99,   -75,    38,   -12,     1,
+        2,   -15,    53,  -126,   232,  -343,   386,  -236,  -310,  1634, -4966, 23963,
+    16467, -5932,  2948, -1424,   569,  -126,   -58,    97,   -74,    38,   -12,     1,
+        2,   -15,    53,  -127,   234,  -346,   393,  -248,  -291,  1607, -4933, 24047,
+    16356, -5926,  2955, -1434,   578,  -132,   -54,    95,   -73,    38,   -12,     1,
+        2,   -15,    53,  -127,   235,  -350,   400,  -261,  -272,  1580, -4899, 24131,
+    16247, -5920,  2963, -1444,   586,  -138,   -50,    93,   -72,    37,   -12,     1,
+        2,   -15,    54,  -128,   237,  -353,   407,  -273,  -253,  1553, -4865, 24215,
+    16133, -5913,  2970, -1453,   595,  -144,   -47,    91,   -71,    37,   -12,     1,
+        2,   -15,    54,  -128,   238,  -357,   414,  -285,  -233,  1526, -4830, 24297,
+    16022, -5906,  2977, -1463,   603,  -150,   -43,    89,   -70,    37,   -12,     1,
+        2,   -15,    54,  -128,   239,  -360,   421,  -297,  -214,  1498, -4794, 24380,
+    15909, -5898,  2984, -1472,   611,  -156,   -39,    87,   -69,    36,   -12,     1,
+        2,   -15,    54,  -129,   241,  -363,   428,  -310,  -195,  1470, -4758, 24462,
+    15798, -5890,  2990, -1481,   619,  -162,   -36,    85,   -68,    36,   -11,     1,
+        2,   -15,    54,  -129,   242,  -367,   435,  -322,  -175,  1442, -4722, 24543,
+    15686, -5881,  2996, -1490,   628,  -168,   -32,    83,   -68,    36,   -11,     1,
+        2,   -15,    54,  -130,   244,  -370,   442,  -334,  -156,  1413, -4684, 24624,
+    15574, -5872,  3002, -1499,   636,  -174,   -28,    81,   -67,    35,   -11,     1,
+        2,   -15,    54,  -130,   245,  -374,   449,  -347,  -136,  1385, -4647, 24704,
+    15463, -5862,  3008, -1508,   644,  -180,   -25,    79,   -66,    35,   -11,     1,
+        2,   -15,    54,  -130,   246,  -377,   456,  -359,  -116,  1356, -4608, 24783,
+    15350, -5852,  3013, -1516,   651,  -186,   -21,    77,   -65,    35,   -11,     1,
+        2,   -15,    54,  -131,   248,  -380,   463,  -371,   -96,  1327, -4569, 24863,
+    15236, -5842,  3018, -1525,   659,  -191,   -17,    75,   -64,    34,   -11,     1,
+        2,   -15,    54,  -131,   249,  -384,   470,  -384,   -77,  1298, -4530, 24941,
+    15125, -5831,  3023, -1533,   667,  -197,   -14,    74,   -63,    34,   -11,     1,
+        2,   -15,    54,  -131,   250,  -387,   477,  -396,   -57,  1268, -4490, 25019,
+    15012, -5820,  3027, -1541,   675,  -203,   -10,    72,   -62,    34,   -11,     1,
+        1,   -15,    54,  -132,   251,  -390,   484,  -409,   -37,  1239, -4449, 25096,
+    14902, -5809,  3032, -1549,   682,  -209,    -7,    70,   -61,    34,   -11,     1,
+        1,   -15,    54,  -132,   253,  -394,   490,  -421,   -17,  1209, -4408, 25173,
+    14790, -5797,  3036, -1557,   690,  -214,    -3,    68,   -61,    33,   -11,     1,
+        1,   -15,    54,  -132,   254,  -397,   497,  -433,     3,  1179, -4366, 25249,
+    14677, -5784,  3039, -1565,   697,  -220,     1,    66,   -60,    33,   -11,     1,
+        1,   -15,    54,  -133,   255,  -400,   504,  -446,    24,  1148, -4324, 25325,
+    14564, -5771,  3043, -1572,   704,  -225,     4,    64,   -59,    33,   -11,     1,
+        1,   -15,    54,  -133,   256,  -403,   511,  -458,    44,  1118, -4281, 25400,
+    14450, -5758,  3046, -1580,   712,  -231,     8,    62,   -58,    32,   -10,     1,
+        1,   -15,    54,  -133,   258,  -407,   518,  -471,    64,  1087, -4238, 25475,
+    14337, -5744,  3049, -1587,   719,  -236,    11,    60,   -57,    32,   -10,     1,
+        1,   -15,    54,  -134,   259,  -410,   524,  -483,    84,  1057, -4194, 25549,
+    14224, -5730,  3052, -1594,   726,  -242,    15,    58,   -56,    32,   -10,     1,
+        1,   -15,    54,  -134,   260,  -413,   531,  -495,   105,  1026, -4149, 25622,
+    14110, -5716,  3055, -1601,   733,  -247,    18,    56,   -55,    31,   -10,     1,
+        1,   -15,    54,  -134,   261,  -416,   538,  -508,   125,   994, -4104, 25695,
+    13998, -5701,  3057, -1608,   740,  -253,    22,    54,   -54,    31,   -10,     1,
+        1,   -15,    54,  -134,   262,  -419,   545,  -520,   146,   963, -4059, 25767,
+    13884, -5686,  3059, -1614,   747,  -258,    25,    52,   -54,    31,   -10,     1,
+        1,   -15,    54,  -135,   263,  -422,   551,  -532,   166,   931, -4012, 25838,
+    13773, -5670,  3061, -1621,   753,  -263,    29,    50,   -53,    30,   -10,     1,
+        1,   -15,    54,  -135,   264,  -425,   558,  -545,   187,   900, -3966, 25909,
+    13659, -5654,  3062, -1627,   760,  -268,    32,    48,   -52,    30,   -10,     1,
+        1,   -14,    54,  -135,   266,  -428,   565,  -557,   207,   868, -3918, 25980,
+    13543, -5638,  3063, -1634,   767,  -274,    36,    47,   -51,    30,   -10,     0,
+        1,   -14,    54,  -135,   267,  -431,   571,  -570,   228,   835, -3870, 26049,
+    13433, -5621,  3064, -1640,   773,  -279,    39,    45,   -50,    29,   -10,     0,
+        1,   -14,    54,  -135,   268,  -434,   578,  -582,   249,   803, -3822, 26118,
+    13318, -5604,  3065, -1646,   780,  -284,    42,    43,   -49,    29,   -10,     0,
+        1,   -14,    54,  -136,   269,  -437,   584,  -594,   270,   771, -3773, 26187,
+    13202, -5587,  3066, -1651,   786,  -289,    46,    41,   -48,    29,    -9,     0,
+        1,   -14,    54,  -136,   270,  -440,   591,  -607,   290,   738, -3723, 26255,
+    13091, -5569,  3066, -1657,   792,  -294,    49,    39,   -47,    28,    -9,     0,
+        1,   -14,    54,  -136,   271,  -443,   597,  -619,   311,   705, -3673, 26322,
+    12977, -5550,  3066, -1662,   798,  -299,    52,    37,   -46,    28,    -9,     0,
+        1,   -14,    53,  -136,   272,  -446,   604,  -631,   332,   672, -3622, 26389,
+    12863, -5532,  3066, -1668,   805,  -304,    56,    35,   -46,    28,    -9,     0,
+        1,   -14,    53,  -136,   273,  -449,   610,  -644,   353,   639, -3571, 26455,
+    12752, -5513,  3065, -1673,   811,  -309,    59,    33,   -45,    27,    -9,     0,
+        1,   -14,    53,  -136,   274,  -452,   617,  -656,   374,   605, -3519, 26520,
+    12638, -5494,  3065, -1678,   817,  -314,    62,    31,   -44,    27,    -9,     0,
+        1,   -14,    53,  -137,   274,  -455,   623,  -668,   395,   572, -3467, 26585,
+    12525, -5474,  3064, -1683,   822,  -319,    66,    30,   -43,    27,    -9,     0,
+        1,   -14,    53,  -137,   275,  -457,   629,  -680,   416,   538, -3414, 26649,
+    12412, -5454,  3062, -1687,   828,  -324,    69,    28,   -42,    26,    -9,     0,
+        1,   -14,    53,  -137,   276,  -460,   636,  -693,   437,   504, -3360, 26712,
+    12298, -5434,  3061, -1692,   834,  -328,    72,    26,   -41,    26,    -9,     0,
+        1,   -14,    53,  -137,   277,  -463,   642,  -705,   458,   470, -3306, 26775,
+    12185, -5413,  3059, -1696,   839,  -333,    75,    24,   -40,    26,    -9,     0,
+        1,   -14,    53,  -137,   278,  -466,   648,  -717,   480,   436, -3251, 26837,
+    12071, -5392,  3057, -1701,   845,  -338,    79,    22,   -39,    25,    -9,     0,
+        1,   -14,    53,  -137,   279,  -468,   655,  -729,   501,   402, -3196, 26898,
+    11955, -5370,  3055, -1705,   850,  -342,    82,    20,   -39,    25,    -8,     0,
+        1,   -13,    53,  -137,   280,  -471,   661,  -741,   522,   367, -3140, 26959,
+    11840, -5349,  3053, -1709,   856,  -347,    85,    19,   -38,    25,    -8,     0,
+        1,   -13,    52,  -137,   280,  -473,   667,  -754,   543,   332, -3084, 27019,
+    11730, -5326,  3050, -1712,   861,  -352,    88,    17,   -37,    24,    -8,     0,
+        1,   -13,    52,  -137,   281,  -476,   673,  -766,   564,   298, -3027, 27079,
+    11616, -5304,  3047, -1716,   866,  -356,    91,    15,   -36,    24,    -8,     0,
+        1,   -13,    52,  -137,   282,  -479,   679,  -778,   586,   263, -2970, 27137,
+    11504, -5281,  3044, -1720,   871,  -361,    94,    13,   -35,    24,    -8,     0,
+        1,   -13,    52,  -137,   283,  -481,   685,  -790,   607,   228, -2912, 27196,
+    11389, -5258,  3041, -1723,   876,  -365,    97,    11,   -34,    23,    -8,     0,
+        1,   -13,    52,  -137,   283,  -484,   691,  -802,   628,   192, -2853, 27253,
+    11277, -5235,  3037, -1726,   881,  -369,   100,    10,   -33,    23,    -8,     0,
+        1,   -13,    52,  -137,   284,  -486,   697,  -814,   650,   157, -2794, 27310,
+    11161, -5211,  3034, -1729,   886,  -374,   104,     8,   -33,    23,    -8,     0,
+        1,   -13,    52,  -137,   285,  -488,   703,  -826,   671,   121, -2735, 27366,
+    11049, -5187,  3030, -1732,   891,  -378,   107,     6,   -32,    22,    -8,     0,
+        1,   -13,    51,  -137,   285,  -491,   709,  -838,   692,    86, -2674, 27421,
+    10939, -5163,  3025, -1735,   895,  -382,   110,     4,   -31,    22,    -8,     0,
+        1,   -13,    51,  -137,   286,  -493,   715,  -850,   714,    50, -2614, 27476,
+    10824, -5138,  3021, -1738,   900,  -386,   113,     2,   -30,    22,    -8,     0,
+        1,   -13,    51,  -137,   286,  -496,   721,  -862,   735,    14, -2552, 27530,
+    10711, -5113,  3016, -1740,   904,  -390,   116,     1,   -29,    21,    -7,     0,
+        1,   -12,    51,  -137,   287,  -498,   727,  -873,   756,   -22, -2491, 27583,
+    10598, -5088,  3011, -1742,   909,  -395,   118,    -1,   -28,    21,    -7,     0,
+        1,   -12,    51,  -137,   288,  -500,   732,  -885,   778,   -58, -2428, 27636,
+    10484, -5062,  3006, -1745,   913,  -399,   121,    -3,   -27,    21,    -7,     0,
+        1,   -12,    50,  -137,   288,  -502,   738,  -897,   799,   -95, -2365, 27688,
+    10375, -5036,  3001, -1747,   917,  -403,   124,    -5,   -27,    20,    -7,     0,
+        1,   -12,    50,  -137,   289,  -505,   744,  -909,   820,  -131, -2302, 27739,
+    10262, -5010,  2995, -1748,   921,  -407,   127,    -6,   -26,    20,    -7,     0,
+        1,   -12,    50,  -136,   289,  -507,   750,  -921,   842,  -168, -2238, 27790,
+    10149, -4984,  2989, -1750,   925,  -411,   130,    -8,   -25,    20,    -7,     0,
+        1,   -12,    50,  -136,   289,  -509,   755,  -932,   863,  -204, -2173, 27840,
+    10036, -4957,  2983, -1752,   929,  -414,   133,   -10,   -24,    19,    -7,     0,
+        1,   -12,    50,  -136,   290,  -511,   761,  -944,   885,  -241, -2108, 27889,
+     9921, -4930,  2977, -1753,   933,  -418,   136,   -11,   -23,    19,    -7,     0,
+        1,   -12,    49,  -136,   290,  -513,   766,  -955,   906,  -278, -2043, 27938,
+     9811, -4903,  2971, -1755,   937,  -422,   139,   -13,   -22,    19,    -7,     0,
+        1,   -12,    49,  -136,   291,  -515,   772,  -967,   927,  -315, -1977, 27985,
+     9701, -4875,  2964, -1756,   941,  -426,   141,   -15,   -21,    18,    -7,     0,
+        1,   -11,    49,  -136,   291,  -517,   777,  -978,   949,  -352, -1910, 28032,
+     9587, -4847,  2957, -1757,   944,  -429,   144,   -16,   -21,    18,    -7,     0,
+        1,   -11,    49,  -135,   291,  -519,   782,  -990,   970,  -389, -1843, 28079,
+     9475, -4819,  2950, -1758,   948,  -433,   147,   -18,   -20,    18,    -7,     0,
+        1,   -11,    49,  -135,   292,  -521,   788, -1001,   991,  -427, -1775, 28124,
+     9363, -4791,  2943, -1758,   951,  -437,   150,   -20,   -19,    17,    -6,     0,
+        1,   -11,    48,  -135,   292,  -523,   793, -1013,  1013,  -464, -1707, 28169,
+     9252, -4762,  2935, -1759,   955,  -440,   152,   -21,   -18,    17,    -6,     0,
+        1,   -11,    48,  -135,   292,  -525,   798, -1024,  1034,  -502, -1638, 28214,
+     9141, -4733,  2927, -1759,   958,  -444,   155,   -23,   -17,    17,    -6,     0,
+        1,   -11,    48,  -135,   293,  -526,   803, -1035,  1055,  -539, -1569, 28257,
+     9030, -4704,  2919, -1760,   961,  -447,   158,   -25,   -16,    16,    -6,     0,
+        1,   -11,    47,  -134,   293,  -528,   809, -1047,  1077,  -577, -1499, 28300,
+     8920, -4675,  2911, -1760,   964,  -451,   160,   -26,   -16,    16,    -6,     0,
+        1,   -11,    47,  -134,   293,  -530,   814, -1058,  1098,  -615, -1429, 28342,
+     8809, -4645,  2903, -1760,   967,  -454,   163,   -28,   -15,    16,    -6,     0,
+        1,   -10,    47,  -134,   293,  -532,   819, -1069,  1119,  -653, -1358, 28383,
+     8700, -4615,  2894, -1760,   970,  -457,   165,   -30,   -14,    15,    -6,     0,
+        1,   -10,    47,  -133,   293,  -533,   824, -1080,  1140,  -691, -1286, 28424,
+     8585, -4585,  2885, -1759,   973,  -460,   168,   -31,   -13,    15,    -6,     0,
+        1,   -10,    46,  -133,   294,  -535,   829, -1091,  1162,  -729, -1215, 28464,
+     8476, -4554,  2876, -1759,   976,  -464,   170,   -33,   -12,    15,    -6,     0,
+        1,   -10,    46,  -133,   294,  -537,   834, -1102,  1183,  -767, -1142, 28503,
+     8367, -4524,  2867, -1759,   978,  -467,   173,   -34,   -12,    15,    -6,     0,
+        1,   -10,    46,  -132,   294,  -538,   838, -1113,  1204,  -806, -1069, 28541,
+     8258, -4493,  2858, -1758,   981,  -470,   175,   -36,   -11,    14,    -6,     0,
+        0,   -10,    45,  -132,   294,  -540,   843, -1124,  1225,  -844,  -996, 28579,
+     8148, -4461,  2848, -1757,   983,  -473,   178,   -37,   -10,    14,    -5,     0,
+        0,   -10,    45,  -132,   294,  -541,   848, -1135,  1246,  -882,  -922, 28616,
+     8038, -4430,  2838, -1756,   986,  -476,   180,   -39,    -9,    14,    -5,     0,
+        0,    -9,    45,  -131,   294,  -542,   853, -1145,  1267,  -921,  -847, 28652,
+     7926, -4398,  2828, -1755,   988,  -479,   183,   -41,    -8,    13,    -5,     0,
+        0,    -9,    45,  -131,   294,  -544,   857, -1156,  1288,  -959,  -772, 28687,
+     7820, -4367,  2818, -1754,   990,  -482,   185,   -42,    -8,    13,    -5,     0,
+        0,    -9,    44,  -131,   294,  -545,   862, -1167,  1309,  -998,  -697, 28722,
+     7712, -4335,  2808, -1752,   992,  -485,   187,   -44,    -7,    13,    -5,     0,
+        0,    -9,    44,  -130,   294,  -547,   866, -1177,  1330, -1037,  -621, 28756,
+     7602, -4302,  2797, -1751,   994,  -487,   190,   -45,    -6,    12,    -5,     0,
+        0,    -9,    44,  -130,   294,  -548,   871, -1188,  1351, -1075,  -545, 28789,
+     7493, -4270,  2787, -1749,   996,  -490,   192,   -47,    -5,    12,    -5,     0,
+        0,    -9,    43,  -129,   294,  -549,   875, -1198,  1372, -1114,  -468, 28821,
+     7385, -4237,  2776, -1747,   998,  -493,   194,   -48,    -5,    12,    -5,     0,
+        0,    -8,    43,  -129,   293,  -550,   879, -1208,  1392, -1153,  -390, 28853,
+     7277, -4204,  2765, -1745,  1000,  -496,   197,   -50,    -4,    11,    -5,     0,
+        0,    -8,    42,  -128,   293,  -551,   884, -1219,  1413, -1192,  -312, 28884,
+     7168, -4171,  2753, -1743,  1002,  -498,   199,   -51,    -3,    11,    -5,     0,
+        0,    -8,    42,  -128,   293,  -553,   888, -1229,  1434, -1231,  -234, 28914,
+     7062, -4138,  2742, -1741,  1003,  -501,   201,   -52,    -2,    11,    -5,     0,
+        0,    -8,    42,  -127,   293,  -554,   892, -1239,  1455, -1270,  -155, 28944,
+     6953, -4104,  2730, -1739,  1005,  -503,   203,   -54,    -1,    10,    -5,     0,
+        0,    -8,    41,  -127,   293,  -555,   896, -1249,  1475, -1309,   -75, 28972,
+     6848, -4071,  2718, -1736,  1006,  -506,   205,   -55,    -1,    10,    -4,     0,
+        0,    -8,    41,  -126,   292,  -556,   900, -1259,  1496, -1348,     4, 29000,
+     6741, -4037,  2706, -1734,  1007,  -508,   208,   -57,     0,    10,    -4,     0,
+        0,    -7,    41,  -126,   292,  -557,   904, -1269,  1516, -1387,    85, 29027,
+     6632, -4003,  2694, -1731,  1009,  -511,   210,   -58,     1,    10,    -4,     0,
+        0,    -7,    40,  -125,   292,  -557,   908, -1279,  1537, -1426,   166, 29054,
+     6523, -3968,  2682, -1728,  1010,  -513,   212,   -60,     2,     9,    -4,     0,
+        0,    -7,    40,  -125,   292,  -558,   912, -1289,  1557, -1465,   247, 29079,
+     6419, -3934,  2669, -1725,  1011,  -515,   214,   -61,     2,     9,    -4,     0,
+        0,    -7,    39,  -124,   291,  -559,   916, -1299,  1577, -1505,   329, 29104,
+     6314, -3899,  2656, -1722,  1012,  -517,   216,   -62,     3,     9,    -4,     0,
+        0,    -7,    39,  -124,   291,  -560,   920, -1308,  1598, -1544,   411, 29128,
+     6210, -3865,  2643, -1719,  1013,  -520,   218,   -64,     4,     8,    -4,     0,
+        0,    -6,    39,  -123,   290,  -561,   923, -1318,  1618, -1583,   494, 29152,
+     6104, -3830,  2630, -1716,  1014,  -522,   220,   -65,     4,     8,    -4,     0,
+        0,    -6,    38,  -122,   290,  -561,   927, -1328,  1638, -1622,   577, 29174,
+     5998, -3795,  2617, -1712,  1014,  -524,   222,   -66,     5,     8,    -4,     0,
+        0,    -6,    38,  -122,   290,  -562,   930, -1337,  1658, -1662,   661, 29196,
+     5894, -3759,  2604, -1709,  1015,  -526,   224,   -68,     6,     7,    -4,     0,
+        0,    -6,    37,  -121,   289,  -563,   934, -1346,  1678, -1701,   745, 29217,
+     5789, -3724,  2590, -1705,  1016,  -528,   226,   -69,     7,     7,    -4,     0,
+        0,    -6,    37,  -121,   289,  -563,   937, -1356,  1698, -1740,   830, 29237,
+     5685, -3688,  2576, -1701,  1016,  -530,   228,   -70,     7,     7,    -4,     0,
+        0,    -6,    36,  -120,   288,  -564,   941, -1365,  1718, -1780,   915, 29257,
+     5583, -3653,  2562, -1697,  1017,  -532,   229,   -72,     8,     7,    -4,     0,
+       -1,    -5,    36,  -119,   287,  -564,   944, -1374,  1737, -1819,  1000, 29276,
+     5478, -3617,  2548, -1693,  1017,  -533,   231,   -73,     9,     6,    -3,     0,
+       -1,    -5,    35,  -118,   287,  -565,   947, -1383,  1757, -1858,  1086, 29294,
+     5375, -3581,  2534, -1689,  1017,  -535,   233,   -74,     9,     6,    -3,     0,
+       -1,    -5,    35,  -118,   286,  -565,   950, -1392,  1777, -1898,  1172, 29311,
+     5271, -3544,  2520, -1684,  1017,  -537,   235,   -75,    10,     6,    -3,     0,
+       -1,    -5,    35,  -117,   286,  -565,   953, -1401,  1796, -1937,  1259, 29327,
+     5170, -3508,  2505, -1680,  1017,  -539,   237,   -77,    11,     5,    -3,     0,
+       -1,    -4,    34,  -116,   285,  -566,   956, -1410,  1816, -1976,  1347, 29343,
+     5066, -3472,  2491, -1675,  1017,  -540,   238,   -78,    11,     5,    -3,     0,
+       -1,    -4,    34,  -116,   284,  -566,   959, -1418,  1835, -2016,  1434, 29358,
+     4964, -3435,  2476, -1670,  1017,  -542,   240,   -79,    12,     5,    -3,     0,
+       -1,    -4,    33,  -115,   284,  -566,   962, -1427,  1854, -2055,  1523, 29372,
+     4860, -3398,  2461, -1666,  1017,  -543,   242,   -80,    13,     5,    -3,     0,
+       -1,    -4,    33,  -114,   283,  -566,   965, -1435,  1873, -2094,  1611, 29385,
+     4761, -3361,  2446, -1661,  1017,  -545,   243,   -82,    13,     4,    -3,     0,
+       -1,    -4,    32,  -113,   282,  -566,   968, -1444,  1893, -2133,  1700, 29397,
+     4659, -3324,  2430, -1656,  1017,  -546,   245,   -83,    14,     4,    -3,     0,
+       -1,    -3,    32,  -113,   281,  -566,   971, -1452,  1912, -2173,  1790, 29409,
+     4556, -3287,  2415, -1650,  1016,  -548,   247,   -84,    15,     4,    -3,     0,
+       -1,    -3,    31,  -112,   280,  -566,   973, -1460,  1930, -2212,  1880, 29420,
+     4458, -3250,  2399, -1645,  1016,  -549,   248,   -85,    15,     4,    -3,     0,
+       -1,    -3,    31,  -111,   280,  -566,   976, -1468,  1949, -2251,  1970, 29430,
+     4356, -3213,  2384, -1640,  1015,  -550,   250,   -86,    16,     3,    -3,     0,
+       -1,    -3,    30,  -110,   279,  -566,   978, -1477,  1968, -2290,  2061, 29440,
+     4255, -3175,  2368, -1634,  1015,  -551,   251,   -87,    17,     3,    -3,     0,
+       -1,    -3,    30,  -109,   278,  -566,   981, -1485,  1987, -2329,  2152, 29448,
+     4156, -3138,  2352, -1628,  1014,  -553,   253,   -88,    17,     3,    -3,     0,
+       -1,    -2,    29,  -108,   277,  -566,   983, -1492,  2005, -2369,  2244, 29456,
+     4058, -3100,  2336, -1623,  1013,  -554,   254,   -90,    18,     2,    -2,     0,
+       -1,    -2,    29,  -107,   276,  -566,   985, -1500,  2024, -2408,  2336, 29463,
+     3958, -3062,  2319, -1617,  1012,  -555,   256,   -91,    19,     2,    -2,     0,
+       -1,    -2,    28,  -107,   275,  -565,   987, -1508,  2042, -2447,  2428, 29469,
+     3862, -3024,  2303, -1611,  1011,  -556,   257,   -92,    19,     2,    -2,     0,
+       -1,    -2,    27,  -106,   274,  -565,   989, -1515,  2060, -2486,  2521, 29475,
+     3764, -2986,  2286, -1605,  1010,  -557,   258,   -93,    20,     2,    -2,     0,
+       -2,    -1,    27,  -105,   273,  -565,   992, -1523,  2078, -2524,  2614, 29480,
+     3664, -2948,  2270, -1598,  1009,  -558,   260,   -94,    20,     1,    -2,     0,
+       -2,    -1,    26,  -104,   272,  -564,   993, -1530,  2096, -2563,  2708, 29484,
+     3567, -2910,  2253, -1592,  1008,  -559,   261,   -95,    21,     1,    -2,     0,
+       -2,    -1,    26,  -103,   271,  -564,   995, -1538,  2114, -2602,  2802, 29487,
+     3471, -2872,  2236, -1586,  1006,  -559,   262,   -96,    22,     1,    -2,     0,
+       -2,    -1,    25,  -102,   270,  -563,   997, -1545,  2132, -2641,  2896, 29489,
+     3374, -2834,  2219, -1579,  1005,  -560,   264,   -97,    22,     1,    -2,     0,
+       -2,     0,    25,  -101,   268,  -563,   999, -1552,  2149, -2679,  2991, 29491,
+     3276, -2795,  2202, -1572,  1004,  -561,   265,   -98,    23,     0,    -2,     0,
+       -2,     0,    24,  -100,   267,  -562,  1001, -1559,  2167, -2718,  3086, 29491,
+     3184, -2757,  2184, -1566,  1002,  -562,   266,   -99,    23,     0,    -2,     0,
+};
+
+/* 72 taps per branch: 48000 to 16000 Hz, 96000 to 32000 Hz */
+const int16_t audio_src_coef_1_3[36] =
+{
+        0,     0,     0,    -1,    -4,    -3,     4,    14,    14,    -4,   -32,   -41,
+       -9,    53,    93,    53,   -65,  -171,  -148,    39,   267,   317,    66,  -352,
+     -579,  -314,   371,   958,   819,  -219, -1532, -1935,  -448,  2892,  6819,  9462,
+};
+
+/* 52 taps per branch: 48000 to 22050 Hz, 96000 to 44100 Hz */
+const int16_t audio_src_coef_147_320[7644] =
+{
+        0,     0,    -1,    -6,    -3,    15,    22,   -19,   -61,    -7,   112,    94,
+     -131,  -252,    44,   440,   228,  -543,  -723,   366,  1396,   368, -2104, -2249,
+     2659, 10009, 13548,  9965,  2611, -2265, -2090,   383,  1394,   356,  -726,  -538,
+      232,   439,    41,  -252,  -129,    95,   111,    -8,   -61,   -19,    22,    15,
+       -3,    -6,    -1,     0,     0,     0,    -1,    -6,    -3,    16,    21,   -20,
+      -61,    -7,   112,    93,  -132,  -251,    47,   441,   223,  -548,  -720,   376,
+     1397,   353, -2118, -2234,  2707, 10053, 13552,  9921,  2563, -2280, -2076,   398,
+     1392,   346,  -730,  -533,   236,   437,    38,  -253,  -127,    96,   111,    -9,
+      -61,   -18,    22,    15,    -3,    -6,    -1,     0,     0,     0,    -1,    -6,
+       -3,    16,    21,   -20,   -61,    -6,   113,    92,  -134,  -251,    50,   443,
+      219,  -552,  -716,   386,  1398,   338, -2132, -2218,  2755, 10097, 13548,  9876,
+     2515, -2295, -2062,   413,  1391,   337,  -733,  -528,   240,   436,    35,  -253,
+     -125,    97,   110,   -10,   -61,   -18,    22,    15,    -3,    -6,    -1,     0,
+        0,     0,    -1,    -6,    -3,    16,    21,   -20,   -61,    -5,   113,    91,
+     -136,  -250,    54,   444,   215,  -557,  -713,   395,  1400,   323, -2145, -2201,
+     2803, 10141, 13544,  9832,  2468, -2310, -2048,   427,  1389,   327,  -736,  -524,
+      244,   435,    32,  -253,  -124,    98,   109,   -10,   -61,   -18,    22,    15,
+       -3,    -5,     0,     0,     0,     0,    -1,    -6,    -3,    16,    21,   -21,
+      -61,    -4,   114,    90,  -137,  -249,    57,   445,   211,  -562,  -709,   405,
+     1401,   308, -2159, -2185,  2852, 10184, 13542,  9787,  2421, -2324, -2033,   442,
+     1387,   317,  -739,  -519,   248,   433,    28,  -254,  -122,    99,   109,   -11,
+      -61,   -17,    22,    15,    -4,    -5,     0,     0,     0,     0,    -1,    -6,
+       -3,    16,    21,   -21,   -61,    -4,   115,    89,  -139,  -249,    60,   446,
+      206,  -567,  -705,   415,  1402,   293, -2172, -2168,  2900, 10227, 13545,  9742,
+     2373, -2339, -2019,   456,  1385,   307,  -742,  -514,   252,   432,    25,  -254,
+     -120,    99,   108,   -12,   -61,   -17,    22,    15,    -4,    -5,     0,     0,
+        0,     1,    -1,    -6,    -3,    16,    21,   -22,   -61,    -3,   115,    88,
+     -141,  -248,    63,   447,   202,  -571,  -702,   425,  1403,   278, -2186, -2151,
+     2949, 10270, 13545,  9696,  2326, -2353, -2004,   470,  1383,   298,  -745,  -509,
+      256,   430,    22,  -255,  -119,   100,   107,   -13,   -61,   -16,    22,    14,
+       -4,    -5,     0,     0,     0,     1,    -1,    -6,    -3,    16,    21,   -22,
+      -61,    -2,   116,    87,  -142,  -248,    66,   448,   198,  -576,  -698,   435,
+     1403,   262, -2199, -2133,  2998, 10313, 13538,  9651,  2279, -2366, -1989,   485,
+     1380,   288,  -748,  -504,   260,   429,    19,  -255,  -117,   101,   107,   -13,
+      -61,   -16,    22,    14,    -4,    -5,     0,     0,     0,     1,    -1,    -6,
+       -2,    17,    21,   -22,   -61,    -1,   116,    86,  -144,  -247,    69,   449,
+      193,  -580,  -694,   444,  1404,   247, -2212, -2116,  3046, 10355, 13536,  9605,
+     2233, -2380, -1975,   499,  1378,   278,  -750,  -499,   264,   427,    16,  -255,
+     -115,   102,   106,   -14,   -61,   -16,    22,    14,    -4,    -5,     0,     0,
+        0,     1,    -1,    -6,    -2,    17,    20,   -23,   -61,     0,   117,    85,
+     -146,  -246,    73,   450,   189,  -585,  -690,   454,  1405,   231, -2225, -2098,
+     3095, 10398, 13530,  9560,  2186, -2393, -1960,   513,  1376,   268,  -753,  -494,
+      268,   426,    13,  -255,  -113,   103,   105,   -15,   -61,   -15,    22,    14,
+       -4,    -5,     0,     0,     0,     1,    -1,    -6,    -2,    17,    20,   -23,
+      -61,     0,   117,    84,  -147,  -245,    76,   451,   184,  -589,  -686,   464,
+     1405,   216, -2238, -2080,  3144, 10440, 13526,  9514,  2140, -2406, -1945,   527,
+     1373,   259,  -756,  -489,   272,   424,    10,  -256,  -112,   104,   105,   -15,
+      -61,   -15,    23,    14,    -4,    -5,     0,     0,     0,     1,    -1,    -6,
+       -2,    17,    20,   -24,   -61,     1,   118,    83,  -149,  -245,    79,   452,
+      180,  -594,  -682,   474,  1405,   200, -2250, -2062,  3194, 10482, 13522,  9468,
+     2093, -2419, -1930,   541,  1370,   249,  -758,  -484,   275,   423,     7,  -256,
+     -110,   105,   104,   -16,   -60,   -14,    23,    14,    -4,    -5,     0,     0,
+        0,     1,    -1,    -6,    -2,    17,    20,   -24,   -61,     2,   118,    82,
+     -151,  -244,    82,   453,   175,  -598,  -678,   483,  1405,   184, -2263, -2043,
+     3243, 10524, 13520,  9421,  2047, -2431, -1914,   554,  1368,   239,  -761,  -478,
+      279,   421,     4,  -256,  -108,   105,   103,   -17,   -60,   -14,    23,    14,
+       -4,    -5,     0,     0,     0,     1,    -1,    -6,    -2,    17,    20,   -24,
+      -61,     3,   119,    80,  -152,  -243,    85,   454,   171,  -603,  -674,   493,
+     1406,   168, -2275, -2024,  3292, 10565, 13514,  9375,  2001, -2443, -1899,   568,
+     1365,   229,  -763,  -473,   283,   419,     1,  -256,  -106,   106,   103,   -18,
+      -60,   -14,    23,    13,    -4,    -5,     0,     0,     0,     1,    -1,    -6,
+       -2,    17,    20,   -25,   -61,     3,   119,    79,  -154,  -242,    89,   455,
+      166,  -607,  -669,   503,  1406,   153, -2287, -2005,  3342, 10607, 13506,  9328,
+     1955, -2455, -1884,   582,  1362,   220,  -765,  -468,   287,   418,    -2,  -257,
+     -105,   107,   102,   -18,   -60,   -13,    23,    13,    -4,    -5,     0,     0,
+        0,     1,    -1,    -6,    -2,    17,    20,   -25,   -61,     4,   120,    78,
+     -155,  -242,    92,   456,   162,  -611,  -665,   513,  1405,   137, -2300, -1985,
+     3392, 10648, 13502,  9282,  1909, -2467, -1868,   595,  1359,   210,  -768,  -463,
+      290,   416,    -5,  -257,  -103,   108,   101,   -19,   -60,   -13,    23,    13,
+       -4,    -5,     0,     0,     0,     1,    -1,    -6,    -2,    18,    19,   -25,
+      -61,     5,   120,    77,  -157,  -241,    95,   456,   157,  -616,  -661,   522,
+     1405,   121, -2312, -1966,  3441, 10688, 13501,  9235,  1864, -2478, -1853,   609,
+     1355,   200,  -770,  -458,   294,   414,    -8,  -257,  -101,   109,   101,   -20,
+      -60,   -13,    23,    13,    -4,    -5,     0,     0,     0,     1,    -1,    -6,
+       -2,    18,    19,   -26,   -61,     6,   121,    76,  -159,  -240,    98,   457,
+      152,  -620,  -656,   532,  1405,   104, -2323, -1946,  3491, 10729, 13495,  9188,
+     1818, -2490, -1837,   622,  1352,   191,  -772,  -453,   297,   412,   -11,  -257,
+     -100,   109,   100,   -20,   -60,   -12,    23,    13,    -4,    -5,     0,     0,
+        0,     1,    -1,    -6,    -2,    18,    19,   -26,   -61,     7,   121,    75,
+     -160,  -239,   101,   458,   148,  -624,  -652,   542,  1404,    88, -2335, -1926,
+     3541, 10770, 13486,  9140,  1773, -2500, -1821,   635,  1349,   181,  -774,  -447,
+      301,   410,   -14,  -257,   -98,   110,    99,   -21,   -60,   -12,    23,    13,
+       -4,    -5,     0,     0,     0,     1,    -1,    -6,    -1,    18,    19,   -27,
+      -61,     8,   122,    74,  -162,  -238,   105,   458,   143,  -628,  -647,   552,
+     1404,    72, -2347, -1905,  3591, 10810, 13476,  9093,  1728, -2511, -1805,   648,
+     1345,   171,  -776,  -442,   304,   409,   -17,  -257,   -96,   111,    99,   -22,
+      -59,   -11,    23,    13,    -5,    -5,     0,     0,     0,     1,    -1,    -6,
+       -1,    18,    19,   -27,   -61,     8,   122,    72,  -163,  -237,   108,   459,
+      138,  -632,  -642,   561,  1403,    56, -2358, -1885,  3641, 10850, 13471,  9046,
+     1683, -2522, -1790,   661,  1342,   162,  -778,  -437,   308,   407,   -20,  -257,
+      -94,   112,    98,   -22,   -59,   -11,    23,    12,    -5,    -5,     0,     0,
+        0,     1,    -1,    -6,    -1,    18,    19,   -27,   -61,     9,   123,    71,
+     -165,  -236,   111,   460,   133,  -636,  -638,   571,  1402,    39, -2370, -1864,
+     3692, 10889, 13467,  8998,  1638, -2532, -1774,   674,  1338,   152,  -780,  -431,
+      311,   405,   -23,  -257,   -92,   112,    97,   -23,   -59,   -11,    23,    12,
+       -5,    -5,     0,     0,     0,     1,    -1,    -6,    -1,    18,    19,   -28,
+      -61,    10,   123,    70,  -166,  -235,   114,   460,   129,  -640,  -633,   580,
+     1401,    23, -2381, -1842,  3742, 10929, 13458,  8950,  1594, -2542, -1758,   687,
+     1334,   143,  -782,  -426,   315,   403,   -26,  -257,   -91,   113,    96,   -24,
+      -59,   -10,    23,    12,    -5,    -5,     0,     0,     0,     1,    -1,    -6,
+       -1,    18,    18,   -28,   -61,    11,   123,    69,  -168,  -234,   118,   461,
+      124,  -645,  -628,   590,  1400,     6, -2392, -1821,  3792, 10968, 13450,  8902,
+     1549, -2551, -1741,   700,  1331,   133,  -784,  -421,   318,   401,   -29,  -257,
+      -89,   114,    96,   -24,   -59,   -10,    23,    12,    -5,    -5,     0,     0,
+        0,     1,    -1,    -6,    -1,    19,    18,   -29,   -61,    12,   124,    68,
+     -170,  -233,   121,   461,   119,  -648,  -623,   600,  1399,   -10, -2403, -1799,
+     3843, 11007, 13439,  8854,  1505, -2561, -1725,   712,  1327,   124,  -785,  -415,
+      322,   399,   -32,  -257,   -87,   114,    95,   -25,   -59,   -10,    23,    12,
+       -5,    -5,     0,     0,     0,     1,    -1,    -6,    -1,    19,    18,   -29,
+      -61,    12,   124,    66,  -171,  -232,   124,   462,   114,  -652,  -618,   609,
+     1398,   -27, -2413, -1777,  3893, 11046, 13432,  8806,  1461, -2570, -1709,   725,
+     1323,   114,  -787,  -410,   325,   397,   -35,  -257,   -85,   115,    94,   -26,
+      -59,    -9,    23,    12,    -5,    -5,     0,     0,     0,     1,    -1,    -6,
+       -1,    19,    18,   -29,   -61,    13,   125,    65,  -173,  -231,   127,   462,
+      109,  -656,  -613,   619,  1397,   -43, -2424, -1755,  3944, 11085, 13422,  8758,
+     1417, -2579, -1693,   737,  1318,   104,  -788,  -405,   328,   395,   -38,  -257,
+      -84,   116,    93,   -26,   -58,    -9,    24,    12,    -5,    -5,     0,     0,
+        0,     1,    -1,    -6,    -1,    19,    18,   -30,   -61,    14,   125,    64,
+     -174,  -230,   131,   462,   104,  -660,  -608,   628,  1395,   -60, -2435, -1732,
+     3995, 11123, 13411,  8709,  1374, -2587, -1676,   750,  1314,    95,  -790,  -399,
+      331,   393,   -40,  -257,   -82,   116,    93,   -27,   -58,    -8,    24,    11,
+       -5,    -5,     0,     0,     0,     1,    -1,    -6,    -1,    19,    17,   -30,
+      -60,    15,   125,    63,  -176,  -229,   134,   463,    99,  -664,  -603,   638,
+     1394,   -77, -2445, -1710,  4046, 11161, 13400,  8661,  1330, -2596, -1660,   762,
+     1310,    86,  -791,  -394,   335,   391,   -43,  -257,   -80,   117,    92,   -27,
+      -58,    -8,    24,    11,    -5,    -5,     0,     0,     0,     1,    -1,    -6,
+        0,    19,    17,   -31,   -60,    16,   126,    61,  -177,  -228,   137,   463,
+       94,  -668,  -598,   647,  1392,   -94, -2455, -1687,  4097, 11199, 13392,  8612,
+     1287, -2604, -1643,   774,  1306,    76,  -793,  -388,   338,   389,   -46,  -257,
+      -78,   117,    91,   -28,   -58,    -8,    24,    11,    -5,    -5,     0,     0,
+        0,     1,    -1,    -6,     0,    19,    17,   -31,   -60,    17,   126,    60,
+     -179,  -227,   140,   463,    89,  -672,  -592,   657,  1390,  -111, -2465, -1663,
+     4147, 11237, 13385,  8563,  1243, -2612, -1627,   786,  1301,    67,  -794,  -383,
+      341,   386,   -49,  -257,   -77,   118,    90,   -29,   -58,    -7,    24,    11,
+       -5,    -5,     0,     0,     0,     1,    -1,    -6,     0,    19,    17,   -31,
+      -60,    18,   127,    59,  -180,  -225,   144,   464,    84,  -675,  -587,   666,
+     1388,  -128, -2475, -1640,  4198, 11274, 13369,  8514,  1200, -2620, -1610,   798,
+     1296,    57,  -795,  -377,   344,   384,   -52,  -256,   -75,   119,    90,   -29,
+      -58,    -7,    24,    11,    -5,    -5,     0,     0,     0,     1,    -1,    -6,
+        0,    20,    17,   -32,   -60,    18,   127,    58,  -182,  -224,   147,   464,
+       79,  -679,  -581,   676,  1386,  -145, -2484, -1616,  4250, 11311, 13354,  8465,
+     1158, -2627, -1593,   810,  1292,    48,  -796,  -372,   347,   382,   -55,  -256,
+      -73,   119,    89,   -30,   -57,    -7,    24,    11,    -5,    -4,     0,     0,
+        0,     1,    -2,    -6,     0,    20,    17,   -32,   -60,    19,   127,    56,
+     -183,  -223,   150,   464,    74,  -682,  -576,   685,  1384,  -162, -2494, -1592,
+     4301, 11348, 13342,  8416,  1115, -2634, -1576,   821,  1287,    39,  -797,  -366,
+      350,   380,   -57,  -256,   -71,   120,    88,   -30,   -57,    -6,    24,    11,
+       -5,    -4,     0,     0,     0,     1,    -2,    -6,     0,    20,    16,   -33,
+      -60,    20,   128,    55,  -185,  -222,   153,   464,    69,  -686,  -570,   695,
+     1381,  -179, -2503, -1567,  4352, 11384, 13335,  8367,  1073, -2641, -1559,   833,
+     1282,    29,  -798,  -361,   353,   378,   -60,  -256,   -70,   120,    87,   -31,
+      -57,    -6,    24,    10,    -5,    -4,     0,     0,     0,     1,    -2,    -6,
+        0,    20,    16,   -33,   -60,    21,   128,    54,  -186,  -220,   156,   464,
+       64,  -690,  -565,   704,  1379,  -196, -2513, -1543,  4403, 11421, 13327,  8317,
+     1030, -2648, -1543,   844,  1277,    20,  -799,  -355,   356,   375,   -63,  -256,
+      -68,   121,    86,   -32,   -57,    -6,    24,    10,    -5,    -4,     0,     0,
+        0,     1,    -2,    -6,     0,    20,    16,   -33,   -59,    22,   128,    52,
+     -187,  -219,   160,   464,    59,  -693,  -559,   713,  1376,  -213, -2522, -1518,
+     4455, 11457, 13308,  8268,   988, -2654, -1526,   856,  1272,    11,  -800,  -350,
+      359,   373,   -66,  -255,   -66,   121,    86,   -32,   -57,    -5,    24,    10,
+       -5,    -4,     0,     0,     0,     1,    -2,    -6,     0,    20,    16,   -34,
+      -59,    23,   129,    51,  -189,  -218,   163,   464,    54,  -696,  -553,   723,
+     1374,  -230, -2530, -1493,  4506, 11493, 13292,  8218,   946, -2661, -1509,   867,
+     1267,     2,  -801,  -344,   362,   371,   -68,  -255,   -64,   122,    85,   -33,
+      -56,    -5,    24,    10,    -5,    -4,     0,     0,     0,     1,    -2,    -6,
+        0,    20,    16,   -34,   -59,    24,   129,    50,  -190,  -216,   166,   464,
+       49,  -700,  -547,   732,  1371,  -248, -2539, -1468,  4558, 11528, 13281,  8168,
+      905, -2667, -1491,   878,  1262,    -8,  -802,  -339,   364,   369,   -71,  -255,
+      -63,   122,    84,   -33,   -56,    -4,    24,    10,    -5,    -4,     0,     0,
+        0,     1,    -2,    -6,     1,    20,    15,   -34,   -59,    24,   129,    48,
+     -192,  -215,   169,   464,    44,  -703,  -542,   741,  1368,  -265, -2548, -1442,
+     4609, 11563, 13271,  8118,   863, -2672, -1474,   889,  1257,   -17,  -802,  -333,
+      367,   366,   -74,  -254,   -61,   123,    83,   -34,   -56,    -4,    24,    10,
+       -6,    -4,     0,     0,     0,     1,    -2,    -6,     1,    20,    15,   -35,
+      -59,    25,   129,    47,  -193,  -214,   173,   464,    38,  -706,  -536,   750,
+     1365,  -282, -2556, -1416,  4661, 11599, 13256,  8068,   822, -2678, -1457,   900,
+     1251,   -26,  -803,  -328,   370,   364,   -76,  -254,   -59,   123,    82,   -34,
+      -56,    -4,    24,    10,    -6,    -4,     0,     0,     0,     1,    -2,    -6,
+        1,    20,    15,   -35,   -59,    26,   130,    45,  -194,  -212,   176,   464,
+       33,  -710,  -530,   760,  1362,  -300, -2564, -1390,  4712, 11633, 13239,  8018,
+      781, -2683, -1440,   911,  1246,   -35,  -803,  -322,   373,   361,   -79,  -254,
+      -57,   124,    82,   -35,   -55,    -3,    24,     9,    -6,    -4,     0,     0,
+        0,     1,    -2,    -6,     1,    21,    15,   -36,   -58,    27,   130,    44,
+     -196,  -211,   179,   464,    28,  -713,  -524,   769,  1359,  -317, -2572, -1364,
+     4764, 11668, 13226,  7968,   740, -2688, -1423,   922,  1240,   -44,  -804,  -317,
+      375,   359,   -82,  -253,   -56,   124,    81,   -36,   -55,    -3,    24,     9,
+       -6,    -4,     0,     0,     0,     1,    -2,    -6,     1,    21,    15,   -36,
+      -58,    28,   130,    43,  -197,  -209,   182,   463,    23,  -716,  -517,   778,
+     1355,  -335, -2580, -1337,  4816, 11702, 13207,  7918,   699, -2693, -1405,   932,
+     1235,   -53,  -804,  -311,   378,   357,   -84,  -253,   -54,   125,    80,   -36,
+      -55,    -3,    24,     9,    -6,    -4,     0,     0,     0,     1,    -2,    -6,
+        1,    21,    14,   -36,   -58,    29,   130,    41,  -198,  -208,   185,   463,
+       17,  -719,  -511,   787,  1352,  -352, -2588, -1310,  4867, 11736, 13192,  7868,
+      659, -2697, -1388,   943,  1229,   -62,  -804,  -305,   381,   354,   -87,  -252,
+      -52,   125,    79,   -37,   -55,    -2,    24,     9,    -6,    -4,     0,     0,
+        0,     1,    -2,    -6,     1,    21,    14,   -37,   -58,    30,   131,    40,
+     -200,  -206,   189,   463,    12,  -722,  -505,   796,  1348,  -370, -2595, -1283,
+     4919, 11770, 13177,  7817,   618, -2702, -1370,   953,  1223,   -71,  -805,  -300,
+      383,   352,   -90,  -252,   -50,   126,    78,   -37,   -54,    -2,    24,     9,
+       -6,    -4,     0,     0,     0,     1,    -2,    -6,     1,    21,    14,   -37,
+      -58,    30,   131,    38,  -201,  -205,   192,   462,     7,  -725,  -499,   805,
+     1344,  -387, -2603, -1256,  4971, 11803, 13165,  7767,   578, -2706, -1353,   963,
+     1217,   -80,  -805,  -294,   386,   349,   -92,  -251,   -49,   126,    77,   -38,
+      -54,    -2,    24,     9,    -6,    -4,     0,     0,     0,     1,    -2,    -7,
+        2,    21,    14,   -37,   -57,    31,   131,    37,  -202,  -203,   195,   462,
+        1,  -728,  -492,   814,  1340,  -405, -2610, -1228,  5023, 11836, 13143,  7716,
+      538, -2710, -1335,   974,  1212,   -89,  -805,  -288,   388,   347,   -95,  -251,
+      -47,   126,    77,   -38,   -54,    -1,    24,     9,    -6,    -4,     0,     0,
+        0,     1,    -2,    -7,     2,    21,    13,   -38,   -57,    32,   131,    36,
+     -204,  -202,   198,   462,    -4,  -731,  -486,   823,  1336,  -422, -2617, -1200,
+     5075, 11869, 13128,  7665,   499, -2713, -1318,   984,  1206,   -98,  -805,  -283,
+      391,   344,   -97,  -250,   -45,   127,    76,   -39,   -54,    -1,    24,     8,
+       -6,    -4,     0,     0,     0,     1,    -2,    -7,     2,    21,    13,   -38,
+      -57,    33,   131,    34,  -205,  -200,   201,   461,    -9,  -734,  -479,   832,
+     1332,  -440, -2624, -1172,  5127, 11902, 13112,  7615,   459, -2717, -1300,   994,
+     1199,  -107,  -805,  -277,   393,   342,  -100,  -250,   -43,   127,    75,   -39,
+      -54,    -1,    24,     8,    -6,    -4,     0,     0,     0,     1,    -2,    -7,
+        2,    21,    13,   -39,   -57,    34,   131,    33,  -206,  -199,   205,   461,
+      -15,  -737,  -473,   841,  1328,  -458, -2630, -1144,  5179, 11934, 13098,  7564,
+      420, -2720, -1283,  1003,  1193,  -116,  -805,  -272,   395,   339,  -103,  -249,
+      -42,   127,    74,   -40,   -53,     0,    24,     8,    -6,    -4,     0,     0,
+        0,     1,    -2,    -7,     2,    21,    13,   -39,   -56,    35,   132,    31,
+     -208,  -197,   208,   460,   -20,  -739,  -466,   850,  1324,  -476, -2637, -1115,
+     5231, 11966, 13075,  7513,   381, -2723, -1265,  1013,  1187,  -124,  -805,  -266,
+      398,   336,  -105,  -249,   -40,   128,    73,   -40,   -53,     0,    24,     8,
+       -6,    -4,     0,     0,     0,     1,    -2,    -7,     2,    22,    12,   -39,
+      -56,    36,   132,    30,  -209,  -195,   211,   460,   -25,  -742,  -460,   858,
+     1319,  -493, -2643, -1086,  5283, 11998, 13055,  7462,   342, -2725, -1247,  1023,
+     1181,  -133,  -805,  -260,   400,   334,  -108,  -248,   -38,   128,    72,   -41,
+      -53,     0,    24,     8,    -6,    -4,     0,     0,     0,     1,    -2,    -7,
+        2,    22,    12,   -40,   -56,    37,   132,    28,  -210,  -194,   214,   459,
+      -31,  -745,  -453,   867,  1315,  -511, -2649, -1057,  5335, 12029, 13040,  7411,
+      303, -2728, -1230,  1032,  1174,  -142,  -804,  -255,   402,   331,  -110,  -248,
+      -36,   128,    72,   -41,   -52,     1,    24,     8,    -6,    -4,     0,     0,
+        0,     1,    -2,    -7,     2,    22,    12,   -40,   -56,    38,   132,    27,
+     -211,  -192,   217,   458,   -36,  -747,  -446,   876,  1310,  -529, -2655, -1028,
+     5387, 12060, 13018,  7360,   265, -2730, -1212,  1042,  1168,  -151,  -804,  -249,
+      404,   329,  -112,  -247,   -35,   129,    71,   -42,   -52,     1,    24,     8,
+       -6,    -4,     0,     0,     0,     1,    -2,    -7,     3,    22,    12,   -40,
+      -55,    38,   132,    25,  -212,  -190,   220,   458,   -42,  -750,  -439,   885,
+     1305,  -547, -2661,  -998,  5439, 12091, 13000,  7308,   227, -2732, -1194,  1051,
+     1161,  -159,  -804,  -243,   406,   326,  -115,  -246,   -33,   129,    70,   -42,
+      -52,     1,    24,     7,    -6,    -4,     0,     0,     0,     1,    -2,    -7,
+        3,    22,    11,   -41,   -55,    39,   132,    24,  -214,  -188,   223,   457,
+      -47,  -752,  -432,   893,  1300,  -565, -2666,  -968,  5491, 12122, 12981,  7257,
+      189, -2734, -1176,  1060,  1155,  -168,  -803,  -238,   409,   323,  -117,  -246,
+      -31,   129,    69,   -43,   -52,     2,    24,     7,    -6,    -4,     0,     0,
+        0,     1,    -2,    -7,     3,    22,    11,   -41,   -55,    40,   132,    22,
+     -215,  -187,   227,   456,   -53,  -755,  -425,   902,  1295,  -583, -2672,  -938,
+     5543, 12152, 12962,  7206,   151, -2735, -1158,  1069,  1148,  -176,  -803,  -232,
+      411,   320,  -120,  -245,   -30,   130,    68,   -43,   -51,     2,    24,     7,
+       -6,    -4,     0,     0,     0,     1,    -2,    -7,     3,    22,    11,   -41,
+      -55,    41,   132,    21,  -216,  -185,   230,   455,   -58,  -757,  -418,   910,
+     1290,  -601, -2677,  -908,  5595, 12182, 12943,  7154,   113, -2737, -1141,  1078,
+     1141,  -185,  -802,  -226,   413,   318,  -122,  -244,   -28,   130,    67,   -44,
+      -51,     2,    24,     7,    -6,    -4,     0,     0,     0,     1,    -2,    -7,
+        3,    22,    11,   -42,   -54,    42,   133,    19,  -217,  -183,   233,   455,
+      -64,  -760,  -411,   919,  1284,  -618, -2682,  -877,  5648, 12212, 12917,  7103,
+       76, -2738, -1123,  1087,  1135,  -193,  -802,  -221,   415,   315,  -124,  -244,
+      -26,   130,    66,   -44,   -51,     3,    24,     7,    -6,    -3,     0,     0,
+        0,     1,    -2,    -7,     3,    22,    10,   -42,   -54,    43,   133,    18,
+     -218,  -181,   236,   454,   -69,  -762,  -404,   927,  1279,  -636, -2687,  -846,
+     5700, 12241, 12899,  7051,    39, -2739, -1105,  1095,  1128,  -202,  -801,  -215,
+      417,   312,  -127,  -243,   -25,   130,    66,   -45,   -51,     3,    24,     7,
+       -6,    -3,     0,     0,     0,     1,    -2,    -7,     3,    22,    10,   -43,
+      -54,    44,   133,    16,  -219,  -179,   239,   453,   -75,  -764,  -397,   936,
+     1273,  -654, -2691,  -815,  5752, 12271, 12872,  7000,     2, -2739, -1087,  1104,
+     1121,  -210,  -800,  -209,   419,   310,  -129,  -242,   -23,   131,    65,   -45,
+      -50,     3,    24,     7,    -6,    -3,     0,     0,     0,     1,    -3,    -7,
+        3,    22,    10,   -43,   -54,    45,   133,    15,  -221,  -178,   242,   452,
+      -80,  -766,  -390,   944,  1268,  -672, -2695,  -784,  5804, 12299, 12856,  6948,
+      -35, -2740, -1069,  1112,  1114,  -218,  -799,  -204,   420,   307,  -132,  -241,
+      -21,   131,    64,   -45,   -50,     4,    24,     6,    -6,    -3,     0,     0,
+        0,     1,    -3,    -7,     4,    22,    10,   -43,   -53,    45,   133,    13,
+     -222,  -176,   245,   451,   -86,  -768,  -383,   952,  1262,  -690, -2700,  -752,
+     5856, 12328, 12836,  6896,   -71, -2740, -1051,  1121,  1107,  -227,  -798,  -198,
+      422,   304,  -134,  -241,   -20,   131,    63,   -46,   -50,     4,    24,     6,
+       -6,    -3,     0,     0,     0,     1,    -3,    -7,     4,    23,     9,   -44,
+      -53,    46,   133,    11,  -223,  -174,   248,   450,   -91,  -770,  -375,   961,
+     1256,  -708, -2704,  -720,  5908, 12356, 12811,  6845,  -107, -2740, -1033,  1129,
+     1100,  -235,  -798,  -192,   424,   301,  -136,  -240,   -18,   131,    62,   -46,
+      -49,     4,    24,     6,    -6,    -3,     0,     0,     0,     1,    -3,    -7,
+        4,    23,     9,   -44,   -53,    47,   133,    10,  -224,  -172,   251,   449,
+      -97,  -772,  -368,   969,  1250,  -726, -2707,  -688,  5961, 12384, 12790,  6793,
+     -143, -2740, -1015,  1137,  1092,  -243,  -797,  -187,   426,   298,  -138,  -239,
+      -16,   131,    61,   -47,   -49,     4,    23,     6,    -6,    -3,     0,     0,
+        0,     1,    -3,    -7,     4,    23,     9,   -44,   -52,    48,   133,     8,
+     -225,  -170,   254,   448,  -102,  -774,  -360,   977,  1244,  -744, -2711,  -656,
+     6013, 12412, 12762,  6741,  -179, -2739,  -997,  1145,  1085,  -251,  -795,  -181,
+      428,   295,  -141,  -238,   -14,   132,    60,   -47,   -49,     5,    23,     6,
+       -6,    -3,     0,     0,     0,     1,    -3,    -6,     4,    23,     9,   -45,
+      -52,    49,   133,     7,  -226,  -168,   257,   446,  -108,  -776,  -353,   985,
+     1238,  -762, -2714,  -624,  6065, 12439, 12739,  6689,  -215, -2739,  -979,  1153,
+     1078,  -259,  -794,  -175,   429,   293,  -143,  -237,   -13,   132,    60,   -47,
+      -48,     5,    23,     6,    -6,    -3,     0,     0,     0,     1,    -3,    -6,
+        4,    23,     8,   -45,   -52,    50,   133,     5,  -227,  -166,   260,   445,
+     -113,  -778,  -345,   993,  1231,  -780, -2717,  -591,  6117, 12466, 12718,  6637,
+     -250, -2738,  -961,  1160,  1070,  -267,  -793,  -170,   431,   290,  -145,  -236,
+      -11,   132,    59,   -48,   -48,     5,    23,     6,    -6,    -3,     0,     0,
+        0,     1,    -3,    -6,     4,    23,     8,   -45,   -51,    51,   133,     3,
+     -228,  -164,   263,   444,  -119,  -780,  -338,  1001,  1225,  -799, -2720,  -558,
+     6169, 12493, 12694,  6586,  -285, -2737,  -943,  1168,  1063,  -275,  -792,  -164,
+      433,   287,  -147,  -236,   -10,   132,    58,   -48,   -48,     6,    23,     5,
+       -6,    -3,     0,     0,     0,     1,    -3,    -6,     4,    23,     8,   -46,
+      -51,    52,   133,     2,  -229,  -162,   266,   443,  -125,  -782,  -330,  1009,
+     1218,  -817, -2723,  -524,  6221, 12519, 12670,  6534,  -320, -2735,  -925,  1176,
+     1055,  -283,  -791,  -158,   434,   284,  -149,  -235,    -8,   132,    57,   -49,
+      -47,     6,    23,     5,    -6,    -3,     0,     0,     0,     1,    -3,    -6,
+        5,    23,     7,   -46,   -51,    53,   133,     0,  -230,  -160,   269,   441,
+     -130,  -783,  -323,  1017,  1211,  -835, -2726,  -491,  6273, 12545, 12648,  6482,
+     -355, -2734,  -907,  1183,  1048,  -291,  -789,  -153,   436,   281,  -152,  -234,
+       -6,   132,    56,   -49,   -47,     6,    23,     5,    -6,    -3,     0,     0,
+        0,     1,    -3,    -6,     5,    23,     7,   -46,   -50,    53,   133,    -1,
+     -231,  -158,   272,   440,  -136,  -785,  -315,  1025,  1204,  -853, -2728,  -457,
+     6326, 12571, 12621,  6430,  -389, -2732,  -889,  1190,  1040,  -299,  -788,  -147,
+      437,   278,  -154,  -233,    -5,   132,    55,   -49,   -47,     7,    23,     5,
+       -6,    -3,     0,     0,     0,     1,    -3,    -6,     5,    23,     7,   -47,
+      -50,    54,   132,    -3,  -232,  -156,   275,   439,  -142,  -786,  -307,  1032,
+     1197,  -871, -2730,  -423,  6378, 12596, 12598,  6378,  -423, -2730,  -871,  1197,
+     1032,  -307,  -786,  -142,   439,   275,  -156,  -232,    -3,   132,    54,   -50,
+      -47,     7,    23,     5,    -6,    -3,     1,     0,     0,     0,    -3,    -6,
+        5,    23,     7,   -47,   -49,    55,   132,    -5,  -233,  -154,   278,   437,
+     -147,  -788,  -299,  1040,  1190,  -889, -2732,  -389,  6430, 12622, 12570,  6326,
+     -457, -2728,  -853,  1204,  1025,  -315,  -785,  -136,   440,   272,  -158,  -231,
+       -1,   133,    53,   -50,   -46,     7,    23,     5,    -6,    -3,     1,     0,
+        0,     0,    -3,    -6,     5,    23,     6,   -47,   -49,    56,   132,    -6,
+     -234,  -152,   281,   436,  -153,  -789,  -291,  1048,  1183,  -907, -2734,  -355,
+     6482, 12646, 12547,  6273,  -491, -2726,  -835,  1211,  1017,  -323,  -783,  -130,
+      441,   269,  -160,  -230,     0,   133,    53,   -51,   -46,     7,    23,     5,
+       -6,    -3,     1,     0,     0,     0,    -3,    -6,     5,    23,     6,   -47,
+      -49,    57,   132,    -8,  -235,  -149,   284,   434,  -158,  -791,  -283,  1055,
+     1176,  -925, -2735,  -320,  6534, 12671, 12518,  6221,  -524, -2723,  -817,  1218,
+     1009,  -330,  -782,  -125,   443,   266,  -162,  -229,     2,   133,    52,   -51,
+      -46,     8,    23,     4,    -6,    -3,     1,     0,     0,     0,    -3,    -6,
+        5,    23,     6,   -48,   -48,    58,   132,   -10,  -236,  -147,   287,   433,
+     -164,  -792,  -275,  1063,  1168,  -943, -2737,  -285,  6586, 12695, 12492,  6169,
+     -558, -2720,  -799,  1225,  1001,  -338,  -780,  -119,   444,   263,  -164,  -228,
+        3,   133,    51,   -51,   -45,     8,    23,     4,    -6,    -3,     1,     0,
+        0,     0,    -3,    -6,     6,    23,     5,   -48,   -48,    59,   132,   -11,
+     -236,  -145,   290,   431,  -170,  -793,  -267,  1070,  1160,  -961, -2738,  -250,
+     6637, 12719, 12465,  6117,  -591, -2717,  -780,  1231,   993,  -345,  -778,  -113,
+      445,   260,  -166,  -227,     5,   133,    50,   -52,   -45,     8,    23,     4,
+       -6,    -3,     1,     0,     0,     0,    -3,    -6,     6,    23,     5,   -48,
+      -47,    60,   132,   -13,  -237,  -143,   293,   429,  -175,  -794,  -259,  1078,
+     1153,  -979, -2739,  -215,  6689, 12743, 12435,  6065,  -624, -2714,  -762,  1238,
+      985,  -353,  -776,  -108,   446,   257,  -168,  -226,     7,   133,    49,   -52,
+      -45,     9,    23,     4,    -6,    -3,     1,     0,     0,     0,    -3,    -6,
+        6,    23,     5,   -49,   -47,    60,   132,   -14,  -238,  -141,   295,   428,
+     -181,  -795,  -251,  1085,  1145,  -997, -2739,  -179,  6741, 12766, 12408,  6013,
+     -656, -2711,  -744,  1244,   977,  -360,  -774,  -102,   448,   254,  -170,  -225,
+        8,   133,    48,   -52,   -44,     9,    23,     4,    -7,    -3,     1,     0,
+        0,     0,    -3,    -6,     6,    23,     4,   -49,   -47,    61,   131,   -16,
+     -239,  -138,   298,   426,  -187,  -797,  -243,  1092,  1137, -1015, -2740,  -143,
+     6793, 12789, 12385,  5961,  -688, -2707,  -726,  1250,   969,  -368,  -772,   -97,
+      449,   251,  -172,  -224,    10,   133,    47,   -53,   -44,     9,    23,     4,
+       -7,    -3,     1,     0,     0,     0,    -3,    -6,     6,    24,     4,   -49,
+      -46,    62,   131,   -18,  -240,  -136,   301,   424,  -192,  -798,  -235,  1100,
+     1129, -1033, -2740,  -107,  6845, 12811, 12356,  5908,  -720, -2704,  -708,  1256,
+      961,  -375,  -770,   -91,   450,   248,  -174,  -223,    11,   133,    46,   -53,
+      -44,     9,    23,     4,    -7,    -3,     1,     0,     0,     0,    -3,    -6,
+        6,    24,     4,   -50,   -46,    63,   131,   -20,  -241,  -134,   304,   422,
+     -198,  -798,  -227,  1107,  1121, -1051, -2740,   -71,  6896, 12834, 12330,  5856,
+     -752, -2700,  -690,  1262,   952,  -383,  -768,   -86,   451,   245,  -176,  -222,
+       13,   133,    45,   -53,   -43,    10,    22,     4,    -7,    -3,     1,     0,
+        0,     0,    -3,    -6,     6,    24,     4,   -50,   -45,    64,   131,   -21,
+     -241,  -132,   307,   420,  -204,  -799,  -218,  1114,  1112, -1069, -2740,   -35,
+     6948, 12856, 12299,  5804,  -784, -2695,  -672,  1268,   944,  -390,  -766,   -80,
+      452,   242,  -178,  -221,    15,   133,    45,   -54,   -43,    10,    22,     3,
+       -7,    -3,     1,     0,     0,     0,    -3,    -6,     7,    24,     3,   -50,
+      -45,    65,   131,   -23,  -242,  -129,   310,   419,  -209,  -800,  -210,  1121,
+     1104, -1087, -2739,     2,  7000, 12877, 12266,  5752,  -815, -2691,  -654,  1273,
+      936,  -397,  -764,   -75,   453,   239,  -179,  -219,    16,   133,    44,   -54,
+      -43,    10,    22,     3,    -7,    -2,     1,     0,     0,     0,    -3,    -6,
+        7,    24,     3,   -51,   -45,    66,   130,   -25,  -243,  -127,   312,   417,
+     -215,  -801,  -202,  1128,  1095, -1105, -2739,    39,  7051, 12899, 12241,  5700,
+     -846, -2687,  -636,  1279,   927,  -404,  -762,   -69,   454,   236,  -181,  -218,
+       18,   133,    43,   -54,   -42,    10,    22,     3,    -7,    -2,     1,     0,
+        0,     0,    -3,    -6,     7,    24,     3,   -51,   -44,    66,   130,   -26,
+     -244,  -124,   315,   415,  -221,  -802,  -193,  1135,  1087, -1123, -2738,    76,
+     7103, 12920, 12209,  5648,  -877, -2682,  -618,  1284,   919,  -411,  -760,   -64,
+      455,   233,  -183,  -217,    19,   133,    42,   -54,   -42,    11,    22,     3,
+       -7,    -2,     1,     0,     0,     0,    -4,    -6,     7,    24,     2,   -51,
+      -44,    67,   130,   -28,  -244,  -122,   318,   413,  -226,  -802,  -185,  1141,
+     1078, -1141, -2737,   113,  7154, 12940, 12185,  5595,  -908, -2677,  -601,  1290,
+      910,  -418,  -757,   -58,   455,   230,  -185,  -216,    21,   132,    41,   -55,
+      -41,    11,    22,     3,    -7,    -2,     1,     0,     0,     0,    -4,    -6,
+        7,    24,     2,   -51,   -43,    68,   130,   -30,  -245,  -120,   320,   411,
+     -232,  -803,  -176,  1148,  1069, -1158, -2735,   151,  7206, 12961, 12153,  5543,
+     -938, -2672,  -583,  1295,   902,  -425,  -755,   -53,   456,   227,  -187,  -215,
+       22,   132,    40,   -55,   -41,    11,    22,     3,    -7,    -2,     1,     0,
+        0,     0,    -4,    -6,     7,    24,     2,   -52,   -43,    69,   129,   -31,
+     -246,  -117,   323,   409,  -238,  -803,  -168,  1155,  1060, -1176, -2734,   189,
+     7257, 12981, 12122,  5491,  -968, -2666,  -565,  1300,   893,  -432,  -752,   -47,
+      457,   223,  -188,  -214,    24,   132,    39,   -55,   -41,    11,    22,     3,
+       -7,    -2,     1,     0,     0,     0,    -4,    -6,     7,    24,     1,   -52,
+      -42,    70,   129,   -33,  -246,  -115,   326,   406,  -243,  -804,  -159,  1161,
+     1051, -1194, -2732,   227,  7308, 13000, 12091,  5439,  -998, -2661,  -547,  1305,
+      885,  -439,  -750,   -42,   458,   220,  -190,  -212,    25,   132,    38,   -55,
+      -40,    12,    22,     3,    -7,    -2,     1,     0,     0,     0,    -4,    -6,
+        8,    24,     1,   -52,   -42,    71,   129,   -35,  -247,  -112,   329,   404,
+     -249,  -804,  -151,  1168,  1042, -1212, -2730,   265,  7360, 13019, 12059,  5387,
+    -1028, -2655,  -529,  1310,   876,  -446,  -747,   -36,   458,   217,  -192,  -211,
+       27,   132,    38,   -56,   -40,    12,    22,     2,    -7,    -2,     1,     0,
+        0,     0,    -4,    -6,     8,    24,     1,   -52,   -41,    72,   128,   -36,
+     -248,  -110,   331,   402,  -255,  -804,  -142,  1174,  1032, -1230, -2728,   303,
+     7411, 13038, 12031,  5335, -1057, -2649,  -511,  1315,   867,  -453,  -745,   -31,
+      459,   214,  -194,  -210,    28,   132,    37,   -56,   -40,    12,    22,     2,
+       -7,    -2,     1,     0,     0,     0,    -4,    -6,     8,    24,     0,   -53,
+      -41,    72,   128,   -38,  -248,  -108,   334,   400,  -260,  -805,  -133,  1181,
+     1023, -1247, -2725,   342,  7462, 13057, 11996,  5283, -1086, -2643,  -493,  1319,
+      858,  -460,  -742,   -25,   460,   211,  -195,  -209,    30,   132,    36,   -56,
+      -39,    12,    22,     2,    -7,    -2,     1,     0,     0,     0,    -4,    -6,
+        8,    24,     0,   -53,   -40,    73,   128,   -40,  -249,  -105,   336,   398,
+     -266,  -805,  -124,  1187,  1013, -1265, -2723,   381,  7513, 13075, 11966,  5231,
+    -1115, -2637,  -476,  1324,   850,  -466,  -739,   -20,   460,   208,  -197,  -208,
+       31,   132,    35,   -56,   -39,    13,    21,     2,    -7,    -2,     1,     0,
+        0,     0,    -4,    -6,     8,    24,     0,   -53,   -40,    74,   127,   -42,
+     -249,  -103,   339,   395,  -272,  -805,  -116,  1193,  1003, -1283, -2720,   420,
+     7564, 13093, 11939,  5179, -1144, -2630,  -458,  1328,   841,  -473,  -737,   -15,
+      461,   205,  -199,  -206,    33,   131,    34,   -57,   -39,    13,    21,     2,
+       -7,    -2,     1,     0,     0,     0,    -4,    -6,     8,    24,    -1,   -54,
+      -39,    75,   127,   -43,  -250,  -100,   342,   393,  -277,  -805,  -107,  1199,
+      994, -1300, -2717,   459,  7615, 13111, 11903,  5127, -1172, -2624,  -440,  1332,
+      832,  -479,  -734,    -9,   461,   201,  -200,  -205,    34,   131,    33,   -57,
+      -38,    13,    21,     2,    -7,    -2,     1,     0,     0,     0,    -4,    -6,
+        8,    24,    -1,   -54,   -39,    76,   127,   -45,  -250,   -97,   344,   391,
+     -283,  -805,   -98,  1206,   984, -1318, -2713,   499,  7665, 13128, 11869,  5075,
+    -1200, -2617,  -422,  1336,   823,  -486,  -731,    -4,   462,   198,  -202,  -204,
+       36,   131,    32,   -57,   -38,    13,    21,     2,    -7,    -2,     1,     0,
+        0,     0,    -4,    -6,     9,    24,    -1,   -54,   -38,    77,   126,   -47,
+     -251,   -95,   347,   388,  -288,  -805,   -89,  1212,   974, -1335, -2710,   538,
+     7716, 13145, 11834,  5023, -1228, -2610,  -405,  1340,   814,  -492,  -728,     1,
+      462,   195,  -203,  -202,    37,   131,    31,   -57,   -37,    14,    21,     2,
+       -7,    -2,     1,     0,     0,     0,    -4,    -6,     9,    24,    -2,   -54,
+      -38,    77,   126,   -49,  -251,   -92,   349,   386,  -294,  -805,   -80,  1217,
+      963, -1353, -2706,   578,  7767, 13162, 11806,  4971, -1256, -2603,  -387,  1344,
+      805,  -499,  -725,     7,   462,   192,  -205,  -201,    38,   131,    30,   -58,
+      -37,    14,    21,     1,    -6,    -2,     1,     0,     0,     0,    -4,    -6,
+        9,    24,    -2,   -54,   -37,    78,   126,   -50,  -252,   -90,   352,   383,
+     -300,  -805,   -71,  1223,   953, -1370, -2702,   618,  7817, 13178, 11769,  4919,
+    -1283, -2595,  -370,  1348,   796,  -505,  -722,    12,   463,   189,  -206,  -200,
+       40,   131,    30,   -58,   -37,    14,    21,     1,    -6,    -2,     1,     0,
+        0,     0,    -4,    -6,     9,    24,    -2,   -55,   -37,    79,   125,   -52,
+     -252,   -87,   354,   381,  -305,  -804,   -62,  1229,   943, -1388, -2697,   659,
+     7868, 13194, 11734,  4867, -1310, -2588,  -352,  1352,   787,  -511,  -719,    17,
+      463,   185,  -208,  -198,    41,   130,    29,   -58,   -36,    14,    21,     1,
+       -6,    -2,     1,     0,     0,     0,    -4,    -6,     9,    24,    -3,   -55,
+      -36,    80,   125,   -54,  -253,   -84,   357,   378,  -311,  -804,   -53,  1235,
+      932, -1405, -2693,   699,  7918, 13210, 11699,  4816, -1337, -2580,  -335,  1355,
+      778,  -517,  -716,    23,   463,   182,  -209,  -197,    43,   130,    28,   -58,
+      -36,    15,    21,     1,    -6,    -2,     1,     0,     0,     0,    -4,    -6,
+        9,    24,    -3,   -55,   -36,    81,   124,   -56,  -253,   -82,   359,   375,
+     -317,  -804,   -44,  1240,   922, -1423, -2688,   740,  7968, 13225, 11669,  4764,
+    -1364, -2572,  -317,  1359,   769,  -524,  -713,    28,   464,   179,  -211,  -196,
+       44,   130,    27,   -58,   -36,    15,    21,     1,    -6,    -2,     1,     0,
+        0,     0,    -4,    -6,     9,    24,    -3,   -55,   -35,    82,   124,   -57,
+     -254,   -79,   361,   373,  -322,  -803,   -35,  1246,   911, -1440, -2683,   781,
+     8018, 13240, 11632,  4712, -1390, -2564,  -300,  1362,   760,  -530,  -710,    33,
+      464,   176,  -212,  -194,    45,   130,    26,   -59,   -35,    15,    20,     1,
+       -6,    -2,     1,     0,     0,     0,    -4,    -6,    10,    24,    -4,   -56,
+      -34,    82,   123,   -59,  -254,   -76,   364,   370,  -328,  -803,   -26,  1251,
+      900, -1457, -2678,   822,  8068, 13254, 11601,  4661, -1416, -2556,  -282,  1365,
+      750,  -536,  -706,    38,   464,   173,  -214,  -193,    47,   129,    25,   -59,
+      -35,    15,    20,     1,    -6,    -2,     1,     0,     0,     0,    -4,    -6,
+       10,    24,    -4,   -56,   -34,    83,   123,   -61,  -254,   -74,   366,   367,
+     -333,  -802,   -17,  1257,   889, -1474, -2672,   863,  8118, 13269, 11565,  4609,
+    -1442, -2548,  -265,  1368,   741,  -542,  -703,    44,   464,   169,  -215,  -192,
+       48,   129,    24,   -59,   -34,    15,    20,     1,    -6,    -2,     1,     0,
+        0,     0,    -4,    -5,    10,    24,    -4,   -56,   -33,    84,   122,   -63,
+     -255,   -71,   369,   364,  -339,  -802,    -8,  1262,   878, -1491, -2667,   905,
+     8168, 13283, 11526,  4558, -1468, -2539,  -248,  1371,   732,  -547,  -700,    49,
+      464,   166,  -216,  -190,    50,   129,    24,   -59,   -34,    16,    20,     0,
+       -6,    -2,     1,     0,     0,     0,    -4,    -5,    10,    24,    -5,   -56,
+      -33,    85,   122,   -64,  -255,   -68,   371,   362,  -344,  -801,     2,  1267,
+      867, -1509, -2661,   946,  8218, 13296, 11489,  4506, -1493, -2530,  -230,  1374,
+      723,  -553,  -696,    54,   464,   163,  -218,  -189,    51,   129,    23,   -59,
+      -34,    16,    20,     0,    -6,    -2,     1,     0,     0,     0,    -4,    -5,
+       10,    24,    -5,   -57,   -32,    86,   121,   -66,  -255,   -66,   373,   359,
+     -350,  -800,    11,  1272,   856, -1526, -2654,   988,  8268, 13309, 11456,  4455,
+    -1518, -2522,  -213,  1376,   713,  -559,  -693,    59,   464,   160,  -219,  -187,
+       52,   128,    22,   -59,   -33,    16,    20,     0,    -6,    -2,     1,     0,
+        0,     0,    -4,    -5,    10,    24,    -6,   -57,   -32,    86,   121,   -68,
+     -256,   -63,   375,   356,  -355,  -799,    20,  1277,   844, -1543, -2648,  1030,
+     8317, 13322, 11426,  4403, -1543, -2513,  -196,  1379,   704,  -565,  -690,    64,
+      464,   156,  -220,  -186,    54,   128,    21,   -60,   -33,    16,    20,     0,
+       -6,    -2,     1,     0,     0,     0,    -4,    -5,    10,    24,    -6,   -57,
+      -31,    87,   120,   -70,  -256,   -60,   378,   353,  -361,  -798,    29,  1282,
+      833, -1559, -2641,  1073,  8367, 13335, 11384,  4352, -1567, -2503,  -179,  1381,
+      695,  -570,  -686,    69,   464,   153,  -222,  -185,    55,   128,    20,   -60,
+      -33,    16,    20,     0,    -6,    -2,     1,     0,     0,     0,    -4,    -5,
+       11,    24,    -6,   -57,   -30,    88,   120,   -71,  -256,   -57,   380,   350,
+     -366,  -797,    39,  1287,   821, -1576, -2634,  1115,  8416, 13347, 11343,  4301,
+    -1592, -2494,  -162,  1384,   685,  -576,  -682,    74,   464,   150,  -223,  -183,
+       56,   127,    19,   -60,   -32,    17,    20,     0,    -6,    -2,     1,     0,
+        0,     0,    -4,    -5,    11,    24,    -7,   -57,   -30,    89,   119,   -73,
+     -256,   -55,   382,   347,  -372,  -796,    48,  1292,   810, -1593, -2627,  1158,
+     8465, 13358, 11307,  4250, -1616, -2484,  -145,  1386,   676,  -581,  -679,    79,
+      464,   147,  -224,  -182,    58,   127,    18,   -60,   -32,    17,    20,     0,
+       -6,    -1,     1,     0,     0,     0,    -5,    -5,    11,    24,    -7,   -58,
+      -29,    90,   119,   -75,  -256,   -52,   384,   344,  -377,  -795,    57,  1296,
+      798, -1610, -2620,  1200,  8514, 13370, 11273,  4198, -1640, -2475,  -128,  1388,
+      666,  -587,  -675,    84,   464,   144,  -225,  -180,    59,   127,    18,   -60,
+      -31,    17,    19,     0,    -6,    -1,     1,     0,     0,     0,    -5,    -5,
+       11,    24,    -7,   -58,   -29,    90,   118,   -77,  -257,   -49,   386,   341,
+     -383,  -794,    67,  1301,   786, -1627, -2612,  1243,  8563, 13381, 11241,  4147,
+    -1663, -2465,  -111,  1390,   657,  -592,  -672,    89,   463,   140,  -227,  -179,
+       60,   126,    17,   -60,   -31,    17,    19,     0,    -6,    -1,     1,     0,
+        0,     0,    -5,    -5,    11,    24,    -8,   -58,   -28,    91,   117,   -78,
+     -257,   -46,   389,   338,  -388,  -793,    76,  1306,   774, -1643, -2604,  1287,
+     8612, 13392, 11200,  4096, -1687, -2455,   -94,  1392,   647,  -598,  -668,    94,
+      463,   137,  -228,  -177,    61,   126,    16,   -60,   -31,    17,    19,     0,
+       -6,    -1,     1,     0,     0,     0,    -5,    -5,    11,    24,    -8,   -58,
+      -27,    92,   117,   -80,  -257,   -43,   391,   335,  -394,  -791,    86,  1310,
+      762, -1660, -2596,  1330,  8661, 13402, 11159,  4046, -1710, -2445,   -77,  1394,
+      638,  -603,  -664,    99,   463,   134,  -229,  -176,    63,   125,    15,   -60,
+      -30,    17,    19,    -1,    -6,    -1,     1,     0,     0,     0,    -5,    -5,
+       11,    24,    -8,   -58,   -27,    93,   116,   -82,  -257,   -40,   393,   331,
+     -399,  -790,    95,  1314,   750, -1676, -2587,  1374,  8709, 13412, 11122,  3995,
+    -1732, -2435,   -60,  1395,   628,  -608,  -660,   104,   462,   131,  -230,  -174,
+       64,   125,    14,   -61,   -30,    18,    19,    -1,    -6,    -1,     1,     0,
+        0,     0,    -5,    -5,    12,    24,    -9,   -58,   -26,    93,   116,   -84,
+     -257,   -38,   395,   328,  -405,  -788,   104,  1318,   737, -1693, -2579,  1417,
+     8758, 13422, 11085,  3944, -1755, -2424,   -43,  1397,   619,  -613,  -656,   109,
+      462,   127,  -231,  -173,    65,   125,    13,   -61,   -29,    18,    19,    -1,
+       -6,    -1,     1,     0,     0,     0,    -5,    -5,    12,    23,    -9,   -59,
+      -26,    94,   115,   -85,  -257,   -35,   397,   325,  -410,  -787,   114,  1323,
+      725, -1709, -2570,  1461,  8806, 13431, 11047,  3893, -1777, -2413,   -27,  1398,
+      609,  -618,  -652,   114,   462,   124,  -232,  -171,    66,   124,    12,   -61,
+      -29,    18,    19,    -1,    -6,    -1,     1,     0,     0,     0,    -5,    -5,
+       12,    23,   -10,   -59,   -25,    95,   114,   -87,  -257,   -32,   399,   322,
+     -415,  -785,   124,  1327,   712, -1725, -2561,  1505,  8854, 13440, 11006,  3843,
+    -1799, -2403,   -10,  1399,   600,  -623,  -648,   119,   461,   121,  -233,  -170,
+       68,   124,    12,   -61,   -29,    18,    19,    -1,    -6,    -1,     1,     0,
+        0,     0,    -5,    -5,    12,    23,   -10,   -59,   -24,    96,   114,   -89,
+     -257,   -29,   401,   318,  -421,  -784,   133,  1331,   700, -1741, -2551,  1549,
+     8902, 13449, 10969,  3792, -1821, -2392,     6,  1400,   590,  -628,  -645,   124,
+      461,   118,  -234,  -168,    69,   123,    11,   -61,   -28,    18,    18,    -1,
+       -6,    -1,     1,     0,     0,     0,    -5,    -5,    12,    23,   -10,   -59,
+      -24,    96,   113,   -91,  -257,   -26,   403,   315,  -426,  -782,   143,  1334,
+      687, -1758, -2542,  1594,  8950, 13457, 10930,  3742, -1842, -2381,    23,  1401,
+      580,  -633,  -640,   129,   460,   114,  -235,  -166,    70,   123,    10,   -61,
+      -28,    19,    18,    -1,    -6,    -1,     1,     0,     0,     0,    -5,    -5,
+       12,    23,   -11,   -59,   -23,    97,   112,   -92,  -257,   -23,   405,   311,
+     -431,  -780,   152,  1338,   674, -1774, -2532,  1638,  8998, 13465, 10891,  3692,
+    -1864, -2370,    39,  1402,   571,  -638,  -636,   133,   460,   111,  -236,  -165,
+       71,   123,     9,   -61,   -27,    19,    18,    -1,    -6,    -1,     1,     0,
+        0,     0,    -5,    -5,    12,    23,   -11,   -59,   -22,    98,   112,   -94,
+     -257,   -20,   407,   308,  -437,  -778,   162,  1342,   661, -1790, -2522,  1683,
+     9046, 13472, 10849,  3641, -1885, -2358,    56,  1403,   561,  -642,  -632,   138,
+      459,   108,  -237,  -163,    72,   122,     8,   -61,   -27,    19,    18,    -1,
+       -6,    -1,     1,     0,     0,     0,    -5,    -5,    13,    23,   -11,   -59,
+      -22,    99,   111,   -96,  -257,   -17,   409,   304,  -442,  -776,   171,  1345,
+      648, -1805, -2511,  1728,  9093, 13479, 10807,  3591, -1905, -2347,    72,  1404,
+      552,  -647,  -628,   143,   458,   105,  -238,  -162,    74,   122,     8,   -61,
+      -27,    19,    18,    -1,    -6,    -1,     1,     0,     0,     0,    -5,    -4,
+       13,    23,   -12,   -60,   -21,    99,   110,   -98,  -257,   -14,   410,   301,
+     -447,  -774,   181,  1349,   635, -1821, -2500,  1773,  9140, 13486, 10770,  3541,
+    -1926, -2335,    88,  1404,   542,  -652,  -624,   148,   458,   101,  -239,  -160,
+       75,   121,     7,   -61,   -26,    19,    18,    -2,    -6,    -1,     1,     0,
+        0,     0,    -5,    -4,    13,    23,   -12,   -60,   -20,   100,   109,  -100,
+     -257,   -11,   412,   297,  -453,  -772,   191,  1352,   622, -1837, -2490,  1818,
+     9188, 13493, 10731,  3491, -1946, -2323,   104,  1405,   532,  -656,  -620,   152,
+      457,    98,  -240,  -159,    76,   121,     6,   -61,   -26,    19,    18,    -2,
+       -6,    -1,     1,     0,     0,     0,    -5,    -4,    13,    23,   -13,   -60,
+      -20,   101,   109,  -101,  -257,    -8,   414,   294,  -458,  -770,   200,  1355,
+      609, -1853, -2478,  1864,  9235, 13499, 10690,  3441, -1966, -2312,   121,  1405,
+      522,  -661,  -616,   157,   456,    95,  -241,  -157,    77,   120,     5,   -61,
+      -25,    19,    18,    -2,    -6,    -1,     1,     0,     0,     0,    -5,    -4,
+       13,    23,   -13,   -60,   -19,   101,   108,  -103,  -257,    -5,   416,   290,
+     -463,  -768,   210,  1359,   595, -1868, -2467,  1909,  9282, 13505, 10645,  3392,
+    -1985, -2300,   137,  1405,   513,  -665,  -611,   162,   456,    92,  -242,  -155,
+       78,   120,     4,   -61,   -25,    20,    17,    -2,    -6,    -1,     1,     0,
+        0,     0,    -5,    -4,    13,    23,   -13,   -60,   -18,   102,   107,  -105,
+     -257,    -2,   418,   287,  -468,  -765,   220,  1362,   582, -1884, -2455,  1955,
+     9328, 13510, 10603,  3342, -2005, -2287,   153,  1406,   503,  -669,  -607,   166,
+      455,    89,  -242,  -154,    79,   119,     3,   -61,   -25,    20,    17,    -2,
+       -6,    -1,     1,     0,     0,     0,    -5,    -4,    13,    23,   -14,   -60,
+      -18,   103,   106,  -106,  -256,     1,   419,   283,  -473,  -763,   229,  1365,
+      568, -1899, -2443,  2001,  9375, 13515, 10564,  3292, -2024, -2275,   168,  1406,
+      493,  -674,  -603,   171,   454,    85,  -243,  -152,    80,   119,     3,   -61,
+      -24,    20,    17,    -2,    -6,    -1,     1,     0,     0,     0,    -5,    -4,
+       14,    23,   -14,   -60,   -17,   103,   105,  -108,  -256,     4,   421,   279,
+     -478,  -761,   239,  1368,   554, -1914, -2431,  2047,  9421, 13520, 10524,  3243,
+    -2043, -2263,   184,  1405,   483,  -678,  -598,   175,   453,    82,  -244,  -151,
+       82,   118,     2,   -61,   -24,    20,    17,    -2,    -6,    -1,     1,     0,
+        0,     0,    -5,    -4,    14,    23,   -14,   -60,   -16,   104,   105,  -110,
+     -256,     7,   423,   275,  -484,  -758,   249,  1370,   541, -1930, -2419,  2093,
+     9468, 13524, 10480,  3194, -2062, -2250,   200,  1405,   474,  -682,  -594,   180,
+      452,    79,  -245,  -149,    83,   118,     1,   -61,   -24,    20,    17,    -2,
+       -6,    -1,     1,     0,     0,     0,    -5,    -4,    14,    23,   -15,   -61,
+      -15,   105,   104,  -112,  -256,    10,   424,   272,  -489,  -756,   259,  1373,
+      527, -1945, -2406,  2140,  9514, 13528, 10438,  3144, -2080, -2238,   216,  1405,
+      464,  -686,  -589,   184,   451,    76,  -245,  -147,    84,   117,     0,   -61,
+      -23,    20,    17,    -2,    -6,    -1,     1,     0,     0,     0,    -5,    -4,
+       14,    22,   -15,   -61,   -15,   105,   103,  -113,  -255,    13,   426,   268,
+     -494,  -753,   268,  1376,   513, -1960, -2393,  2186,  9560, 13532, 10396,  3095,
+    -2098, -2225,   231,  1405,   454,  -690,  -585,   189,   450,    73,  -246,  -146,
+       85,   117,     0,   -61,   -23,    20,    17,    -2,    -6,    -1,     1,     0,
+        0,     0,    -5,    -4,    14,    22,   -16,   -61,   -14,   106,   102,  -115,
+     -255,    16,   427,   264,  -499,  -750,   278,  1378,   499, -1975, -2380,  2233,
+     9605, 13535, 10356,  3046, -2116, -2212,   247,  1404,   444,  -694,  -580,   193,
+      449,    69,  -247,  -144,    86,   116,    -1,   -61,   -22,    21,    17,    -2,
+       -6,    -1,     1,     0,     0,     0,    -5,    -4,    14,    22,   -16,   -61,
+      -13,   107,   101,  -117,  -255,    19,   429,   260,  -504,  -748,   288,  1380,
+      485, -1989, -2366,  2279,  9651, 13538, 10313,  2998, -2133, -2199,   262,  1403,
+      435,  -698,  -576,   198,   448,    66,  -248,  -142,    87,   116,    -2,   -61,
+      -22,    21,    16,    -3,    -6,    -1,     1,     0,     0,     0,    -5,    -4,
+       14,    22,   -16,   -61,   -13,   107,   100,  -119,  -255,    22,   430,   256,
+     -509,  -745,   298,  1383,   470, -2004, -2353,  2326,  9696, 13540, 10275,  2949,
+    -2151, -2186,   278,  1403,   425,  -702,  -571,   202,   447,    63,  -248,  -141,
+       88,   115,    -3,   -61,   -22,    21,    16,    -3,    -6,    -1,     1,     0,
+        0,     0,    -5,    -4,    15,    22,   -17,   -61,   -12,   108,    99,  -120,
+     -254,    25,   432,   252,  -514,  -742,   307,  1385,   456, -2019, -2339,  2373,
+     9742, 13542, 10230,  2900, -2168, -2172,   293,  1402,   415,  -705,  -567,   206,
+      446,    60,  -249,  -139,    89,   115,    -4,   -61,   -21,    21,    16,    -3,
+       -6,    -1,     0,     0,     0,     0,    -5,    -4,    15,    22,   -17,   -61,
+      -11,   109,    99,  -122,  -254,    28,   433,   248,  -519,  -739,   317,  1387,
+      442, -2033, -2324,  2421,  9787, 13544, 10182,  2852, -2185, -2159,   308,  1401,
+      405,  -709,  -562,   211,   445,    57,  -249,  -137,    90,   114,    -4,   -61,
+      -21,    21,    16,    -3,    -6,    -1,     0,     0,     0,     0,    -5,    -3,
+       15,    22,   -18,   -61,   -10,   109,    98,  -124,  -253,    32,   435,   244,
+     -524,  -736,   327,  1389,   427, -2048, -2310,  2468,  9832, 13546, 10139,  2803,
+    -2201, -2145,   323,  1400,   395,  -713,  -557,   215,   444,    54,  -250,  -136,
+       91,   113,    -5,   -61,   -20,    21,    16,    -3,    -6,    -1,     0,     0,
+        0,    -1,    -6,    -3,    15,    22,   -18,   -61,   -10,   110,    97,  -125,
+     -253,    35,   436,   240,  -528,  -733,   337,  1391,   413, -2062, -2295,  2515,
+     9876, 13547, 10098,  2755, -2218, -2132,   338,  1398,   386,  -716,  -552,   219,
+      443,    50,  -251,  -134,    92,   113,    -6,   -61,   -20,    21,    16,    -3,
+       -6,    -1,     0,     0,     0,    -1,    -6,    -3,    15,    22,   -18,   -61,
+       -9,   111,    96,  -127,  -253,    38,   437,   236,  -533,  -730,   346,  1392,
+      398, -2076, -2280,  2563,  9921, 13547, 10058,  2707, -2234, -2118,   353,  1397,
+      376,  -720,  -548,   223,   441,    47,  -251,  -132,    93,   112,    -7,   -61,
+      -20,    21,    16,    -3,    -6,    -1,     0,     0,     0,    -1,    -6,    -3,
+       15,    22,   -19,   -61,    -8,   111,    95,  -129,  -252,    41,   439,   232,
+     -538,  -726,   356,  1394,   383, -2090, -2265,  2611,  9965, 13548, 10009,  2659,
+    -2249, -2104,   368,  1396,   366,  -723,  -543,   228,   440,    44,  -252,  -131,
+       94,   112,    -7,   -61,   -19,    22,    15,    -3,    -6,    -1,     0,     0,
+};
+
+/* 48 taps per branch: 48000 to 32000 Hz */
+const int16_t audio_src_coef_2_3[96] =
+{
+        0,    -1,     0,     7,    -7,   -18,    36,     9,   -87,    57,   122,  -207,
+      -48,   400,  -238,  -478,   771,   173, -1409,   847,  1777, -3200,  -912, 13680,
+    18930,  5834, -3983,  -465,  2127,  -738,  -887,   872,   120,  -589,   210,   251,
+     -239,   -31,   145,   -48,   -52,    44,     5,   -19,     5,     4,    -2,     0,
+        0,    -2,     4,     5,   -19,     5,    44,   -52,   -48,   145,   -31,  -239,
+      251,   210,  -589,   120,   872,  -887,  -738,  2127,  -465, -3983,  5834, 18933,
+    13677,  -912, -3200,  1777,   847, -1409,   173,   771,  -478,  -238,   400,   -48,
+     -207,   122,    57,   -87,     9,    36,   -18,    -7,     7,     0,    -1,     0,
+};
+
+/* 48 taps per branch: 48000 to 44100 Hz, 96000 to 88200 Hz */
+const int16_t audio_src_coef_147_160[7056] =
+{
+        0,     0,     2,    -7,    14,   -19,    14,    10,   -56,   114,  -161,   159,
+      -74,  -111,   372,  -632,   771,  -655,   175,   702, -1906,  3259, -4519,  5456,
+    27099,  5263, -4461,  3254, -1925,   729,   151,  -640,   765,  -633,   377,  -118,
+      -69,   156,  -160,   114,   -56,    11,    13,   -19,    14,    -7,     2,     0,
+        0,     0,     2,    -7,    14,   -20,    15,     9,   -55,   113,  -162,   162,
+      -79,  -105,   366,  -630,   778,  -671,   199,   675, -1886,  3263, -4576,  5651,
+    27093,  5070, -4403,  3249, -1944,   756,   128,  -624,   758,  -633,   382,  -124,
+      -63,   153,  -159,   115,   -57,    12,    13,   -19,    14,    -7,     2,     0,
+        0,     0,     2,    -7,    14,   -20,    15,     8,   -53,   113,  -163,   165,
+      -84,   -98,   361,  -629,   784,  -686,   223,   648, -1865,  3266, -4632,  5847,
+    27082,  4879, -4343,  3242, -1962,   782,   104,  -608,   752,  -634,   387,  -130,
+      -58,   150,  -157,   115,   -58,    13,    12,   -18,    14,    -7,     2,     0,
+        0,     0,     2,    -7,    14,   -20,    16,     7,   -52,   113,  -163,   168,
+      -89,   -92,   355,  -627,   789,  -701,   247,   620, -1844,  3268, -4686,  6043,
+    27073,  4688, -4282,  3234, -1979,   808,    80,  -592,   745,  -634,   392,  -136,
+      -53,   147,  -156,   115,   -59,    14,    11,   -18,    14,    -7,     2,     0,
+        0,     0,     2,    -6,    14,   -20,    17,     6,   -51,   112,  -164,   171,
+      -95,   -85,   349,  -626,   795,  -716,   271,   592, -1821,  3268, -4740,  6240,
+    27067,  4499, -4221,  3225, -1996,   833,    56,  -576,   737,  -635,   396,  -142,
+      -48,   143,  -155,   115,   -60,    15,    11,   -18,    14,    -7,     2,     0,
+        0,     0,     1,    -6,    14,   -21,    17,     5,   -50,   111,  -165,   174,
+     -100,   -79,   343,  -624,   800,  -731,   295,   563, -1799,  3268, -4792,  6438,
+    27055,  4311, -4158,  3215, -2012,   858,    33,  -559,   730,  -635,   401,  -148,
+      -43,   140,  -154,   116,   -61,    16,    10,   -17,    13,    -7,     2,     0,
+        0,     0,     1,    -6,    14,   -21,    18,     4,   -49,   111,  -166,   177,
+     -105,   -72,   337,  -621,   805,  -746,   319,   535, -1775,  3267, -4844,  6637,
+    27035,  4123, -4095,  3205, -2027,   883,     9,  -543,   722,  -634,   405,  -154,
+      -37,   137,  -152,   116,   -62,    17,     9,   -17,    13,    -7,     2,     0,
+        0,     0,     1,    -6,    14,   -21,    19,     3,   -48,   110,  -166,   180,
+     -110,   -65,   331,  -619,   810,  -760,   343,   506, -1751,  3265, -4894,  6837,
+    27013,  3937, -4031,  3193, -2042,   907,   -14,  -526,   714,  -634,   410,  -160,
+      -32,   134,  -151,   116,   -63,    17,     9,   -16,    13,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -22,    19,     2,   -47,   110,  -167,   182,
+     -115,   -59,   325,  -616,   814,  -774,   367,   477, -1726,  3261, -4943,  7038,
+    26991,  3753, -3966,  3181, -2055,   931,   -38,  -509,   706,  -633,   414,  -166,
+      -27,   130,  -150,   116,   -64,    18,     8,   -16,    13,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -22,    20,     1,   -46,   109,  -168,   185,
+     -120,   -52,   319,  -613,   819,  -789,   390,   447, -1701,  3257, -4991,  7239,
+    26968,  3569, -3900,  3167, -2069,   955,   -61,  -493,   698,  -633,   418,  -172,
+      -22,   127,  -148,   116,   -64,    19,     7,   -16,    13,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -22,    21,     0,   -44,   108,  -168,   188,
+     -125,   -45,   312,  -610,   823,  -802,   414,   417, -1675,  3251, -5037,  7441,
+    26937,  3387, -3834,  3153, -2081,   978,   -84,  -476,   689,  -632,   421,  -177,
+      -17,   123,  -147,   116,   -65,    20,     7,   -15,    13,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -23,    21,    -1,   -43,   107,  -169,   190,
+     -130,   -38,   305,  -607,   827,  -816,   438,   388, -1648,  3245, -5083,  7643,
+    26907,  3206, -3766,  3137, -2093,  1001,  -107,  -459,   681,  -630,   425,  -183,
+      -12,   120,  -145,   116,   -66,    21,     6,   -15,    13,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -23,    22,    -3,   -42,   106,  -169,   193,
+     -135,   -31,   299,  -604,   830,  -830,   462,   357, -1621,  3237, -5127,  7847,
+    26875,  3026, -3699,  3121, -2104,  1024,  -130,  -442,   672,  -629,   429,  -188,
+       -7,   116,  -144,   116,   -66,    22,     5,   -15,    13,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -23,    23,    -4,   -41,   106,  -170,   195,
+     -140,   -24,   292,  -600,   834,  -843,   485,   327, -1593,  3229, -5169,  8050,
+    26834,  2848, -3630,  3104, -2114,  1046,  -153,  -425,   663,  -627,   432,  -194,
+       -1,   113,  -142,   116,   -67,    23,     5,   -14,    12,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -23,    23,    -5,   -39,   105,  -170,   198,
+     -145,   -18,   285,  -596,   837,  -856,   509,   296, -1564,  3219, -5211,  8255,
+    26796,  2671, -3561,  3086, -2124,  1067,  -176,  -407,   654,  -626,   435,  -199,
+        4,   110,  -141,   116,   -68,    24,     4,   -14,    12,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -24,    24,    -6,   -38,   104,  -170,   200,
+     -150,   -11,   278,  -592,   839,  -869,   532,   266, -1535,  3208, -5251,  8460,
+    26757,  2495, -3491,  3067, -2133,  1089,  -198,  -390,   644,  -624,   438,  -204,
+        9,   106,  -139,   115,   -68,    24,     3,   -14,    12,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -24,    25,    -7,   -37,   103,  -170,   203,
+     -155,    -4,   270,  -588,   842,  -881,   556,   235, -1506,  3196, -5290,  8665,
+    26712,  2321, -3420,  3047, -2141,  1109,  -221,  -373,   635,  -622,   441,  -210,
+       14,   102,  -137,   115,   -69,    25,     3,   -13,    12,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -24,    25,    -8,   -35,   102,  -171,   205,
+     -160,     4,   263,  -584,   844,  -893,   579,   203, -1475,  3183, -5327,  8871,
+    26662,  2148, -3349,  3026, -2148,  1130,  -243,  -355,   625,  -619,   444,  -215,
+       19,    99,  -135,   115,   -70,    26,     2,   -13,    12,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -24,    26,    -9,   -34,   101,  -171,   207,
+     -165,    11,   256,  -579,   846,  -906,   602,   172, -1444,  3169, -5363,  9077,
+    26611,  1977, -3277,  3005, -2155,  1150,  -265,  -338,   615,  -617,   447,  -220,
+       24,    95,  -134,   115,   -70,    27,     1,   -12,    12,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -24,    27,   -10,   -33,   100,  -171,   209,
+     -170,    18,   248,  -574,   848,  -917,   625,   140, -1413,  3154, -5398,  9284,
+    26558,  1807, -3205,  2983, -2161,  1169,  -287,  -320,   605,  -614,   449,  -225,
+       29,    92,  -132,   114,   -71,    28,     1,   -12,    12,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -25,    27,   -11,   -31,    98,  -171,   211,
+     -175,    25,   240,  -569,   850,  -929,   648,   109, -1381,  3138, -5431,  9491,
+    26506,  1638, -3132,  2959, -2167,  1188,  -309,  -303,   595,  -611,   452,  -229,
+       34,    88,  -130,   114,   -71,    28,     0,   -12,    11,    -7,     2,     0,
+        0,     0,     1,    -6,    15,   -25,    28,   -12,   -30,    97,  -171,   214,
+     -180,    32,   233,  -564,   851,  -940,   671,    77, -1348,  3121, -5463,  9698,
+    26443,  1472, -3059,  2935, -2171,  1207,  -331,  -285,   585,  -608,   454,  -234,
+       39,    84,  -128,   114,   -72,    29,    -1,   -11,    11,    -6,     2,     0,
+        0,     0,     1,    -6,    15,   -25,    28,   -13,   -29,    96,  -171,   216,
+     -184,    39,   225,  -558,   852,  -951,   694,    45, -1315,  3103, -5493,  9906,
+    26380,  1306, -2985,  2911, -2175,  1225,  -352,  -267,   574,  -605,   456,  -239,
+       43,    81,  -126,   113,   -72,    30,    -1,   -11,    11,    -6,     2,     0,
+        0,     0,     1,    -5,    15,   -25,    29,   -15,   -27,    95,  -170,   217,
+     -189,    46,   217,  -553,   853,  -962,   716,    13, -1281,  3084, -5522, 10114,
+    26318,  1142, -2911,  2885, -2179,  1243,  -374,  -250,   563,  -601,   458,  -243,
+       48,    77,  -124,   113,   -73,    31,    -2,   -11,    11,    -6,     2,     0,
+        0,     0,     1,    -5,    15,   -26,    30,   -16,   -26,    94,  -170,   219,
+     -194,    53,   209,  -547,   853,  -973,   739,   -20, -1246,  3063, -5549, 10322,
+    26252,   980, -2837,  2859, -2181,  1260,  -395,  -232,   553,  -598,   459,  -248,
+       53,    74,  -122,   112,   -73,    31,    -2,   -10,    11,    -6,     2,     0,
+        0,     0,     1,    -5,    15,   -26,    30,   -17,   -24,    92,  -170,   221,
+     -198,    61,   201,  -541,   853,  -983,   761,   -52, -1211,  3042, -5575, 10531,
+    26178,   820, -2762,  2832, -2183,  1277,  -416,  -214,   542,  -594,   461,  -252,
+       58,    70,  -120,   112,   -73,    32,    -3,   -10,    11,    -6,     2,     0,
+        0,     0,     0,    -5,    15,   -26,    31,   -18,   -23,    91,  -170,   223,
+     -203,    68,   192,  -535,   853,  -993,   783,   -85, -1176,  3019, -5599, 10739,
+    26110,   661, -2686,  2804, -2184,  1293,  -436,  -197,   531,  -590,   462,  -256,
+       63,    66,  -118,   111,   -74,    33,    -4,    -9,    11,    -6,     2,     0,
+        0,     0,     0,    -5,    15,   -26,    31,   -19,   -21,    90,  -169,   225,
+     -207,    75,   184,  -528,   853, -1003,   805,  -117, -1140,  2995, -5622, 10948,
+    26036,   504, -2611,  2775, -2185,  1309,  -457,  -179,   519,  -586,   464,  -261,
+       67,    63,  -116,   110,   -74,    33,    -4,    -9,    10,    -6,     2,     0,
+        0,     0,     0,    -5,    15,   -26,    32,   -20,   -20,    88,  -169,   226,
+     -212,    82,   176,  -522,   852, -1012,   827,  -150, -1103,  2971, -5643, 11156,
+    25958,   348, -2535,  2746, -2185,  1325,  -477,  -161,   508,  -581,   465,  -265,
+       72,    59,  -114,   110,   -74,    34,    -5,    -9,    10,    -6,     2,     0,
+        0,     0,     0,    -5,    15,   -26,    33,   -21,   -18,    87,  -168,   228,
+     -216,    89,   167,  -515,   851, -1021,   849,  -183, -1067,  2945, -5662, 11365,
+    25875,   194, -2458,  2716, -2184,  1340,  -497,  -144,   497,  -577,   466,  -269,
+       77,    55,  -112,   109,   -75,    35,    -5,    -8,    10,    -6,     2,     0,
+        0,     0,     0,    -5,    14,   -27,    33,   -22,   -17,    85,  -168,   229,
+     -220,    97,   159,  -508,   850, -1030,   870,  -216, -1029,  2918, -5680, 11574,
+    25796,    42, -2382,  2685, -2182,  1354,  -517,  -126,   485,  -572,   467,  -272,
+       81,    51,  -110,   109,   -75,    35,    -6,    -8,    10,    -6,     2,     0,
+        0,     1,     0,    -5,    14,   -27,    34,   -23,   -15,    84,  -167,   231,
+     -225,   104,   150,  -501,   849, -1039,   891,  -248,  -991,  2890, -5696, 11783,
+    25706,  -108, -2305,  2654, -2180,  1368,  -537,  -108,   473,  -567,   467,  -276,
+       86,    48,  -108,   108,   -75,    36,    -7,    -7,    10,    -6,     2,     0,
+        0,     1,     0,    -5,    14,   -27,    34,   -24,   -14,    82,  -167,   232,
+     -229,   111,   141,  -493,   847, -1047,   912,  -281,  -953,  2861, -5710, 11991,
+    25624,  -257, -2228,  2621, -2177,  1382,  -556,   -91,   462,  -563,   468,  -280,
+       90,    44,  -106,   107,   -75,    36,    -7,    -7,     9,    -6,     2,     0,
+        0,     1,     0,    -4,    14,   -27,    35,   -26,   -12,    81,  -166,   233,
+     -233,   118,   132,  -486,   845, -1055,   933,  -314,  -914,  2831, -5723, 12200,
+    25531,  -404, -2151,  2589, -2174,  1395,  -575,   -73,   450,  -557,   468,  -284,
+       95,    40,  -103,   106,   -75,    37,    -8,    -7,     9,    -6,     2,     0,
+        0,     1,     0,    -4,    14,   -27,    35,   -27,   -10,    79,  -165,   235,
+     -237,   125,   124,  -478,   843, -1063,   954,  -347,  -874,  2800, -5734, 12409,
+    25433,  -549, -2073,  2555, -2169,  1407,  -594,   -55,   438,  -552,   468,  -287,
+       99,    37,  -101,   105,   -76,    38,    -8,    -6,     9,    -6,     2,     0,
+        0,     1,     0,    -4,    14,   -27,    36,   -28,    -9,    77,  -164,   236,
+     -241,   132,   115,  -470,   840, -1070,   974,  -380,  -834,  2768, -5743, 12617,
+    25340,  -693, -1996,  2521, -2164,  1419,  -613,   -38,   426,  -547,   469,  -290,
+      103,    33,   -99,   105,   -76,    38,    -9,    -6,     9,    -6,     2,     0,
+        0,     1,     0,    -4,    14,   -27,    36,   -29,    -7,    76,  -163,   237,
+     -245,   139,   106,  -462,   838, -1077,   994,  -413,  -794,  2735, -5751, 12825,
+    25241,  -834, -1918,  2486, -2159,  1431,  -631,   -20,   414,  -541,   468,  -294,
+      108,    29,   -97,   104,   -76,    39,   -10,    -6,     9,    -6,     2,     0,
+        0,     1,     0,    -4,    14,   -27,    37,   -30,    -6,    74,  -163,   238,
+     -249,   147,    96,  -454,   835, -1084,  1014,  -446,  -754,  2701, -5757, 13033,
+    25141,  -974, -1840,  2451, -2153,  1442,  -649,    -3,   401,  -535,   468,  -297,
+      112,    26,   -94,   103,   -76,    39,   -10,    -5,     9,    -6,     2,     0,
+        0,     1,     0,    -4,    14,   -27,    37,   -31,    -4,    72,  -162,   239,
+     -253,   154,    87,  -446,   831, -1090,  1033,  -479,  -712,  2665, -5761, 13240,
+    25042, -1112, -1763,  2415, -2146,  1453,  -667,    14,   389,  -529,   468,  -300,
+      116,    22,   -92,   102,   -76,    40,   -11,    -5,     8,    -6,     2,     0,
+        0,     1,     0,    -4,    14,   -28,    38,   -32,    -2,    70,  -160,   240,
+     -257,   161,    78,  -437,   828, -1096,  1053,  -512,  -671,  2629, -5763, 13448,
+    24933, -1248, -1685,  2379, -2138,  1463,  -685,    32,   376,  -523,   467,  -303,
+      120,    18,   -90,   101,   -76,    40,   -11,    -4,     8,    -6,     2,     0,
+        0,     1,     0,    -4,    14,   -28,    38,   -33,    -1,    69,  -159,   240,
+     -261,   168,    69,  -429,   824, -1102,  1072,  -545,  -629,  2592, -5764, 13655,
+    24826, -1382, -1607,  2341, -2130,  1473,  -702,    49,   364,  -517,   467,  -306,
+      124,    15,   -87,   100,   -76,    41,   -12,    -4,     8,    -6,     2,     0,
+        0,     1,    -1,    -4,    13,   -28,    39,   -34,     1,    67,  -158,   241,
+     -265,   175,    60,  -420,   820, -1107,  1091,  -578,  -587,  2553, -5762, 13861,
+    24716, -1514, -1529,  2304, -2121,  1482,  -719,    66,   351,  -511,   466,  -308,
+      129,    11,   -85,    99,   -76,    41,   -12,    -4,     8,    -6,     2,     0,
+        0,     1,    -1,    -3,    13,   -28,    39,   -35,     3,    65,  -157,   242,
+     -268,   182,    50,  -411,   815, -1112,  1109,  -611,  -544,  2514, -5759, 14067,
+    24603, -1645, -1451,  2266, -2112,  1490,  -736,    83,   339,  -504,   465,  -311,
+      133,     7,   -83,    98,   -76,    42,   -13,    -3,     8,    -5,     2,     0,
+        0,     1,    -1,    -3,    13,   -28,    40,   -36,     4,    63,  -156,   242,
+     -272,   189,    41,  -401,   810, -1117,  1127,  -644,  -501,  2474, -5754, 14273,
+    24490, -1773, -1373,  2227, -2102,  1498,  -752,   100,   326,  -498,   464,  -314,
+      136,     4,   -80,    97,   -76,    42,   -13,    -3,     7,    -5,     2,     0,
+        0,     1,    -1,    -3,    13,   -28,    40,   -37,     6,    61,  -154,   243,
+     -275,   196,    31,  -392,   805, -1122,  1145,  -676,  -458,  2432, -5747, 14478,
+    24373, -1900, -1295,  2188, -2091,  1506,  -768,   117,   313,  -491,   463,  -316,
+      140,     0,   -78,    96,   -76,    42,   -14,    -3,     7,    -5,     2,     0,
+        0,     1,    -1,    -3,    13,   -28,    40,   -38,     8,    59,  -153,   243,
+     -279,   202,    22,  -383,   800, -1126,  1163,  -709,  -414,  2390, -5738, 14683,
+    24252, -2024, -1218,  2148, -2080,  1513,  -784,   134,   300,  -484,   461,  -318,
+      144,    -3,   -75,    95,   -76,    43,   -14,    -2,     7,    -5,     2,     0,
+        0,     1,    -1,    -3,    13,   -28,    41,   -39,     9,    57,  -152,   244,
+     -282,   209,    12,  -373,   795, -1129,  1180,  -742,  -370,  2346, -5728, 14887,
+    24131, -2147, -1140,  2108, -2068,  1520,  -800,   151,   287,  -477,   460,  -320,
+      148,    -7,   -73,    93,   -75,    43,   -15,    -2,     7,    -5,     2,     0,
+        0,     1,    -1,    -3,    13,   -28,    41,   -40,    11,    55,  -150,   244,
+     -285,   216,     3,  -363,   789, -1133,  1197,  -774,  -326,  2302, -5715, 15091,
+    24005, -2268, -1063,  2067, -2056,  1526,  -815,   167,   275,  -470,   458,  -323,
+      152,   -11,   -70,    92,   -75,    44,   -15,    -1,     7,    -5,     2,     0,
+        0,     1,    -1,    -3,    13,   -28,    42,   -41,    13,    53,  -149,   244,
+     -288,   223,    -7,  -353,   783, -1136,  1214,  -806,  -281,  2257, -5701, 15294,
+    23879, -2386,  -985,  2026, -2043,  1531,  -830,   184,   262,  -463,   456,  -325,
+      155,   -14,   -68,    91,   -75,    44,   -16,    -1,     6,    -5,     2,     0,
+        0,     1,    -1,    -2,    12,   -28,    42,   -42,    14,    51,  -147,   244,
+     -291,   229,   -17,  -343,   777, -1139,  1230,  -838,  -236,  2210, -5684, 15496,
+    23751, -2503,  -908,  1984, -2029,  1537,  -845,   200,   249,  -455,   454,  -326,
+      159,   -18,   -65,    90,   -75,    44,   -16,    -1,     6,    -5,     2,     0,
+        0,     1,    -1,    -2,    12,   -28,    42,   -44,    16,    49,  -145,   244,
+     -294,   236,   -26,  -333,   770, -1141,  1247,  -870,  -191,  2163, -5666, 15698,
+    23620, -2618,  -831,  1942, -2015,  1541,  -859,   217,   235,  -448,   452,  -328,
+      162,   -21,   -63,    89,   -75,    45,   -17,     0,     6,    -5,     2,     0,
+        0,     1,    -1,    -2,    12,   -28,    43,   -44,    18,    47,  -144,   244,
+     -297,   243,   -36,  -322,   763, -1143,  1262,  -902,  -145,  2115, -5646, 15898,
+    23485, -2731,  -754,  1900, -2000,  1545,  -873,   233,   222,  -440,   450,  -330,
+      166,   -25,   -60,    87,   -74,    45,   -17,     0,     6,    -5,     2,     0,
+        0,     1,    -1,    -2,    12,   -28,    43,   -45,    20,    45,  -142,   244,
+     -300,   249,   -46,  -312,   756, -1145,  1278,  -934,  -100,  2066, -5624, 16098,
+    23350, -2841,  -678,  1857, -1984,  1549,  -887,   249,   209,  -432,   448,  -331,
+      169,   -28,   -58,    86,   -74,    45,   -17,     0,     6,    -5,     2,     0,
+        0,     1,    -1,    -2,    12,   -28,    43,   -46,    21,    43,  -140,   244,
+     -303,   256,   -55,  -301,   749, -1146,  1293,  -965,   -54,  2016, -5599, 16298,
+    23211, -2950,  -602,  1814, -1968,  1552,  -900,   265,   196,  -425,   445,  -333,
+      172,   -31,   -55,    85,   -74,    45,   -18,     1,     5,    -5,     2,     0,
+        0,     1,    -2,    -2,    12,   -28,    44,   -47,    23,    40,  -138,   244,
+     -305,   262,   -65,  -290,   741, -1147,  1307,  -997,    -8,  1965, -5573, 16496,
+    23073, -3057,  -526,  1770, -1952,  1555,  -913,   281,   183,  -417,   443,  -334,
+      176,   -35,   -53,    83,   -73,    46,   -18,     1,     5,    -5,     2,     0,
+        0,     1,    -2,    -2,    11,   -28,    44,   -48,    25,    38,  -136,   243,
+     -308,   269,   -75,  -280,   733, -1147,  1322, -1028,    39,  1913, -5545, 16694,
+    22932, -3161,  -450,  1726, -1935,  1557,  -926,   296,   170,  -409,   440,  -335,
+      179,   -38,   -50,    82,   -73,    46,   -19,     1,     5,    -5,     2,     0,
+        0,     1,    -2,    -1,    11,   -27,    44,   -49,    26,    36,  -135,   243,
+     -311,   275,   -85,  -268,   725, -1148,  1336, -1059,    85,  1860, -5515, 16890,
+    22788, -3264,  -375,  1682, -1917,  1558,  -938,   312,   157,  -400,   437,  -336,
+      182,   -42,   -48,    81,   -73,    46,   -19,     2,     5,    -4,     2,     0,
+        0,     1,    -2,    -1,    11,   -27,    45,   -50,    28,    34,  -133,   242,
+     -313,   281,   -94,  -257,   717, -1147,  1349, -1089,   132,  1806, -5483, 17086,
+    22640, -3364,  -300,  1637, -1899,  1560,  -950,   327,   143,  -392,   434,  -337,
+      185,   -45,   -45,    79,   -72,    46,   -20,     2,     5,    -4,     2,     0,
+        0,     1,    -2,    -1,    11,   -27,    45,   -51,    30,    31,  -130,   242,
+     -315,   287,  -104,  -246,   708, -1147,  1362, -1120,   179,  1752, -5449, 17280,
+    22496, -3463,  -225,  1593, -1881,  1560,  -962,   342,   130,  -384,   431,  -338,
+      188,   -48,   -43,    78,   -72,    46,   -20,     2,     4,    -4,     2,     0,
+        0,     1,    -2,    -1,    11,   -27,    45,   -52,    32,    29,  -128,   241,
+     -317,   293,  -114,  -235,   699, -1146,  1375, -1150,   226,  1696, -5412, 17474,
+    22343, -3559,  -151,  1547, -1861,  1560,  -973,   357,   117,  -375,   428,  -339,
+      191,   -52,   -40,    77,   -72,    47,   -20,     3,     4,    -4,     2,     0,
+        0,     1,    -2,    -1,    10,   -27,    45,   -53,    33,    27,  -126,   240,
+     -320,   299,  -124,  -223,   690, -1145,  1388, -1180,   273,  1640, -5374, 17667,
+    22195, -3654,   -77,  1502, -1842,  1560,  -984,   372,   104,  -367,   425,  -340,
+      194,   -55,   -38,    75,   -71,    47,   -21,     3,     4,    -4,     2,     0,
+        0,     1,    -2,    -1,    10,   -27,    46,   -54,    35,    25,  -124,   240,
+     -322,   305,  -134,  -212,   680, -1143,  1400, -1210,   320,  1583, -5334, 17858,
+    22042, -3746,    -4,  1456, -1822,  1559,  -995,   387,    91,  -358,   421,  -340,
+      196,   -58,   -35,    74,   -71,    47,   -21,     3,     4,    -4,     2,     0,
+        0,     1,    -2,     0,    10,   -27,    46,   -55,    37,    22,  -122,   239,
+     -324,   311,  -143,  -200,   671, -1141,  1411, -1239,   368,  1525, -5292, 18049,
+    21883, -3836,    69,  1410, -1801,  1558, -1005,   401,    78,  -350,   417,  -341,
+      199,   -61,   -32,    72,   -70,    47,   -21,     4,     4,    -4,     2,     0,
+        0,     1,    -2,     0,    10,   -27,    46,   -56,    38,    20,  -119,   238,
+     -325,   317,  -153,  -188,   661, -1139,  1423, -1269,   415,  1466, -5247, 18238,
+    21727, -3924,   141,  1364, -1780,  1556, -1015,   416,    64,  -341,   414,  -341,
+      202,   -64,   -30,    71,   -70,    47,   -22,     4,     3,    -4,     2,     0,
+        0,     1,    -2,     0,     9,   -26,    46,   -56,    40,    17,  -117,   237,
+     -327,   323,  -163,  -176,   651, -1136,  1434, -1298,   463,  1407, -5201, 18426,
+    21566, -4010,   213,  1318, -1758,  1554, -1025,   430,    51,  -332,   410,  -341,
+      204,   -67,   -27,    69,   -69,    47,   -22,     4,     3,    -4,     2,     0,
+        0,     1,    -2,     0,     9,   -26,    46,   -57,    42,    15,  -115,   235,
+     -329,   328,  -173,  -164,   640, -1133,  1444, -1326,   511,  1346, -5153, 18613,
+    21408, -4094,   285,  1271, -1736,  1551, -1034,   444,    38,  -323,   406,  -341,
+      207,   -71,   -25,    68,   -69,    47,   -22,     5,     3,    -4,     2,     0,
+        0,     1,    -3,     0,     9,   -26,    47,   -58,    43,    13,  -112,   234,
+     -330,   334,  -182,  -152,   630, -1130,  1454, -1355,   558,  1285, -5102, 18798,
+    21245, -4176,   356,  1224, -1713,  1548, -1043,   458,    25,  -314,   402,  -341,
+      209,   -74,   -22,    66,   -68,    47,   -23,     5,     3,    -4,     2,     0,
+        0,     1,    -3,     0,     9,   -26,    47,   -59,    45,    10,  -110,   233,
+     -332,   339,  -192,  -140,   619, -1126,  1464, -1383,   606,  1223, -5049, 18982,
+    21084, -4256,   426,  1177, -1690,  1544, -1052,   471,    12,  -305,   398,  -341,
+      211,   -77,   -20,    65,   -67,    47,   -23,     5,     3,    -4,     2,     0,
+        0,     1,    -3,     1,     8,   -26,    47,   -60,    47,     8,  -107,   232,
+     -333,   345,  -202,  -127,   608, -1122,  1473, -1410,   654,  1160, -4995, 19165,
+    20914, -4333,   496,  1130, -1667,  1540, -1060,   485,    -1,  -296,   393,  -341,
+      214,   -80,   -17,    63,   -67,    47,   -23,     6,     3,    -4,     2,     0,
+        0,     1,    -3,     1,     8,   -26,    47,   -61,    48,     5,  -105,   230,
+     -334,   350,  -211,  -115,   596, -1117,  1481, -1438,   702,  1097, -4938, 19347,
+    20752, -4409,   565,  1083, -1643,  1535, -1068,   498,   -14,  -287,   389,  -341,
+      216,   -83,   -15,    61,   -66,    47,   -24,     6,     2,    -3,     2,     0,
+        0,     1,    -3,     1,     8,   -25,    47,   -61,    50,     3,  -102,   229,
+     -336,   355,  -221,  -103,   585, -1112,  1490, -1465,   750,  1033, -4879, 19527,
+    20574, -4482,   634,  1036, -1619,  1530, -1075,   511,   -27,  -277,   385,  -340,
+      218,   -85,   -12,    60,   -65,    47,   -24,     6,     2,    -3,     2,     0,
+        0,     1,    -3,     1,     8,   -25,    47,   -62,    52,     0,   -99,   227,
+     -337,   360,  -230,   -90,   573, -1107,  1498, -1491,   797,   968, -4818, 19706,
+    20405, -4554,   702,   988, -1594,  1524, -1082,   524,   -39,  -268,   380,  -340,
+      220,   -88,   -10,    58,   -65,    47,   -24,     7,     2,    -3,     2,     0,
+        0,     2,    -3,     1,     7,   -25,    47,   -63,    53,    -2,   -97,   225,
+     -338,   365,  -240,   -78,   561, -1101,  1505, -1518,   845,   903, -4755, 19883,
+    20233, -4623,   770,   941, -1569,  1518, -1089,   537,   -52,  -259,   375,  -339,
+      222,   -91,    -7,    57,   -64,    47,   -24,     7,     2,    -3,     2,     0,
+        0,     2,    -3,     2,     7,   -25,    47,   -63,    55,    -5,   -94,   224,
+     -338,   370,  -249,   -65,   549, -1095,  1512, -1543,   893,   836, -4690, 20059,
+    20055, -4690,   836,   893, -1543,  1512, -1095,   549,   -65,  -249,   370,  -338,
+      224,   -94,    -5,    55,   -63,    47,   -25,     7,     2,    -3,     2,     0,
+        0,     2,    -3,     2,     7,   -24,    47,   -64,    57,    -7,   -91,   222,
+     -339,   375,  -259,   -52,   537, -1089,  1518, -1569,   941,   770, -4623, 20233,
+    19883, -4755,   903,   845, -1518,  1505, -1101,   561,   -78,  -240,   365,  -338,
+      225,   -97,    -2,    53,   -63,    47,   -25,     7,     1,    -3,     2,     0,
+        0,     2,    -3,     2,     7,   -24,    47,   -65,    58,   -10,   -88,   220,
+     -340,   380,  -268,   -39,   524, -1082,  1524, -1594,   988,   702, -4554, 20406,
+    19705, -4818,   968,   797, -1491,  1498, -1107,   573,   -90,  -230,   360,  -337,
+      227,   -99,     0,    52,   -62,    47,   -25,     8,     1,    -3,     1,     0,
+        0,     2,    -3,     2,     6,   -24,    47,   -65,    60,   -12,   -85,   218,
+     -340,   385,  -277,   -27,   511, -1075,  1530, -1619,  1036,   634, -4482, 20577,
+    19524, -4879,  1033,   750, -1465,  1490, -1112,   585,  -103,  -221,   355,  -336,
+      229,  -102,     3,    50,   -61,    47,   -25,     8,     1,    -3,     1,     0,
+        0,     2,    -3,     2,     6,   -24,    47,   -66,    61,   -15,   -83,   216,
+     -341,   389,  -287,   -14,   498, -1068,  1535, -1643,  1083,   565, -4409, 20746,
+    19353, -4938,  1097,   702, -1438,  1481, -1117,   596,  -115,  -211,   350,  -334,
+      230,  -105,     5,    48,   -61,    47,   -26,     8,     1,    -3,     1,     0,
+        0,     2,    -4,     3,     6,   -23,    47,   -67,    63,   -17,   -80,   214,
+     -341,   393,  -296,    -1,   485, -1060,  1540, -1667,  1130,   496, -4333, 20914,
+    19165, -4995,  1160,   654, -1410,  1473, -1122,   608,  -127,  -202,   345,  -333,
+      232,  -107,     8,    47,   -60,    47,   -26,     8,     1,    -3,     1,     0,
+        0,     2,    -4,     3,     5,   -23,    47,   -67,    65,   -20,   -77,   211,
+     -341,   398,  -305,    12,   471, -1052,  1544, -1690,  1177,   426, -4256, 21080,
+    18986, -5049,  1223,   606, -1383,  1464, -1126,   619,  -140,  -192,   339,  -332,
+      233,  -110,    10,    45,   -59,    47,   -26,     9,     0,    -3,     1,     0,
+        0,     2,    -4,     3,     5,   -23,    47,   -68,    66,   -22,   -74,   209,
+     -341,   402,  -314,    25,   458, -1043,  1548, -1713,  1224,   356, -4176, 21245,
+    18798, -5102,  1285,   558, -1355,  1454, -1130,   630,  -152,  -182,   334,  -330,
+      234,  -112,    13,    43,   -58,    47,   -26,     9,     0,    -3,     1,     0,
+        0,     2,    -4,     3,     5,   -22,    47,   -69,    68,   -25,   -71,   207,
+     -341,   406,  -323,    38,   444, -1034,  1551, -1736,  1271,   285, -4094, 21407,
+    18614, -5153,  1346,   511, -1326,  1444, -1133,   640,  -164,  -173,   328,  -329,
+      235,  -115,    15,    42,   -57,    46,   -26,     9,     0,    -2,     1,     0,
+        0,     2,    -4,     3,     4,   -22,    47,   -69,    69,   -27,   -67,   204,
+     -341,   410,  -332,    51,   430, -1025,  1554, -1758,  1318,   213, -4010, 21568,
+    18424, -5201,  1407,   463, -1298,  1434, -1136,   651,  -176,  -163,   323,  -327,
+      237,  -117,    17,    40,   -56,    46,   -26,     9,     0,    -2,     1,     0,
+        0,     2,    -4,     3,     4,   -22,    47,   -70,    71,   -30,   -64,   202,
+     -341,   414,  -341,    64,   416, -1015,  1556, -1780,  1364,   141, -3924, 21728,
+    18237, -5247,  1466,   415, -1269,  1423, -1139,   661,  -188,  -153,   317,  -325,
+      238,  -119,    20,    38,   -56,    46,   -27,    10,     0,    -2,     1,     0,
+        0,     2,    -4,     4,     4,   -21,    47,   -70,    72,   -32,   -61,   199,
+     -341,   417,  -350,    78,   401, -1005,  1558, -1801,  1410,    69, -3836, 21885,
+    18047, -5292,  1525,   368, -1239,  1411, -1141,   671,  -200,  -143,   311,  -324,
+      239,  -122,    22,    37,   -55,    46,   -27,    10,     0,    -2,     1,     0,
+        0,     2,    -4,     4,     3,   -21,    47,   -71,    74,   -35,   -58,   196,
+     -340,   421,  -358,    91,   387,  -995,  1559, -1822,  1456,    -4, -3746, 22040,
+    17860, -5334,  1583,   320, -1210,  1400, -1143,   680,  -212,  -134,   305,  -322,
+      240,  -124,    25,    35,   -54,    46,   -27,    10,    -1,    -2,     1,     0,
+        0,     2,    -4,     4,     3,   -21,    47,   -71,    75,   -38,   -55,   194,
+     -340,   425,  -367,   104,   372,  -984,  1560, -1842,  1502,   -77, -3654, 22194,
+    17668, -5374,  1640,   273, -1180,  1388, -1145,   690,  -223,  -124,   299,  -320,
+      240,  -126,    27,    33,   -53,    45,   -27,    10,    -1,    -2,     1,     0,
+        0,     2,    -4,     4,     3,   -20,    47,   -72,    77,   -40,   -52,   191,
+     -339,   428,  -375,   117,   357,  -973,  1560, -1861,  1547,  -151, -3559, 22346,
+    17471, -5412,  1696,   226, -1150,  1375, -1146,   699,  -235,  -114,   293,  -317,
+      241,  -128,    29,    32,   -52,    45,   -27,    11,    -1,    -2,     1,     0,
+        0,     2,    -4,     4,     2,   -20,    46,   -72,    78,   -43,   -48,   188,
+     -338,   431,  -384,   130,   342,  -962,  1560, -1881,  1593,  -225, -3463, 22495,
+    17281, -5449,  1752,   179, -1120,  1362, -1147,   708,  -246,  -104,   287,  -315,
+      242,  -130,    31,    30,   -51,    45,   -27,    11,    -1,    -2,     1,     0,
+        0,     2,    -4,     5,     2,   -20,    46,   -72,    79,   -45,   -45,   185,
+     -337,   434,  -392,   143,   327,  -950,  1560, -1899,  1637,  -300, -3364, 22643,
+    17083, -5483,  1806,   132, -1089,  1349, -1147,   717,  -257,   -94,   281,  -313,
+      242,  -133,    34,    28,   -50,    45,   -27,    11,    -1,    -2,     1,     0,
+        0,     2,    -4,     5,     2,   -19,    46,   -73,    81,   -48,   -42,   182,
+     -336,   437,  -400,   157,   312,  -938,  1558, -1917,  1682,  -375, -3264, 22789,
+    16889, -5515,  1860,    85, -1059,  1336, -1148,   725,  -268,   -85,   275,  -311,
+      243,  -135,    36,    26,   -49,    44,   -27,    11,    -1,    -2,     1,     0,
+        0,     2,    -5,     5,     1,   -19,    46,   -73,    82,   -50,   -38,   179,
+     -335,   440,  -409,   170,   296,  -926,  1557, -1935,  1726,  -450, -3161, 22932,
+    16694, -5545,  1913,    39, -1028,  1322, -1147,   733,  -280,   -75,   269,  -308,
+      243,  -136,    38,    25,   -48,    44,   -28,    11,    -2,    -2,     1,     0,
+        0,     2,    -5,     5,     1,   -18,    46,   -73,    83,   -53,   -35,   176,
+     -334,   443,  -417,   183,   281,  -913,  1555, -1952,  1770,  -526, -3057, 23074,
+    16495, -5573,  1965,    -8,  -997,  1307, -1147,   741,  -290,   -65,   262,  -305,
+      244,  -138,    40,    23,   -47,    44,   -28,    12,    -2,    -2,     1,     0,
+        0,     2,    -5,     5,     1,   -18,    45,   -74,    85,   -55,   -31,   172,
+     -333,   445,  -425,   196,   265,  -900,  1552, -1968,  1814,  -602, -2950, 23214,
+    16295, -5599,  2016,   -54,  -965,  1293, -1146,   749,  -301,   -55,   256,  -303,
+      244,  -140,    43,    21,   -46,    43,   -28,    12,    -2,    -1,     1,     0,
+        0,     2,    -5,     6,     0,   -17,    45,   -74,    86,   -58,   -28,   169,
+     -331,   448,  -432,   209,   249,  -887,  1549, -1984,  1857,  -678, -2841, 23351,
+    16097, -5624,  2066,  -100,  -934,  1278, -1145,   756,  -312,   -46,   249,  -300,
+      244,  -142,    45,    20,   -45,    43,   -28,    12,    -2,    -1,     1,     0,
+        0,     2,    -5,     6,     0,   -17,    45,   -74,    87,   -60,   -25,   166,
+     -330,   450,  -440,   222,   233,  -873,  1545, -2000,  1900,  -754, -2731, 23486,
+    15897, -5646,  2115,  -145,  -902,  1262, -1143,   763,  -322,   -36,   243,  -297,
+      244,  -144,    47,    18,   -44,    43,   -28,    12,    -2,    -1,     1,     0,
+        0,     2,    -5,     6,     0,   -17,    45,   -75,    89,   -63,   -21,   162,
+     -328,   452,  -448,   235,   217,  -859,  1541, -2015,  1942,  -831, -2618, 23619,
+    15699, -5666,  2163,  -191,  -870,  1247, -1141,   770,  -333,   -26,   236,  -294,
+      244,  -145,    49,    16,   -44,    42,   -28,    12,    -2,    -1,     1,     0,
+        0,     2,    -5,     6,    -1,   -16,    44,   -75,    90,   -65,   -18,   159,
+     -326,   454,  -455,   249,   200,  -845,  1537, -2029,  1984,  -908, -2503, 23750,
+    15497, -5684,  2210,  -236,  -838,  1230, -1139,   777,  -343,   -17,   229,  -291,
+      244,  -147,    51,    14,   -42,    42,   -28,    12,    -2,    -1,     1,     0,
+        0,     2,    -5,     6,    -1,   -16,    44,   -75,    91,   -68,   -14,   155,
+     -325,   456,  -463,   262,   184,  -830,  1531, -2043,  2026,  -985, -2386, 23879,
+    15294, -5701,  2257,  -281,  -806,  1214, -1136,   783,  -353,    -7,   223,  -288,
+      244,  -149,    53,    13,   -41,    42,   -28,    13,    -3,    -1,     1,     0,
+        0,     2,    -5,     7,    -1,   -15,    44,   -75,    92,   -70,   -11,   152,
+     -323,   458,  -470,   275,   167,  -815,  1526, -2056,  2067, -1063, -2268, 24006,
+    15090, -5715,  2302,  -326,  -774,  1197, -1133,   789,  -363,     3,   216,  -285,
+      244,  -150,    55,    11,   -40,    41,   -28,    13,    -3,    -1,     1,     0,
+        0,     2,    -5,     7,    -2,   -15,    43,   -75,    93,   -73,    -7,   148,
+     -320,   460,  -477,   287,   151,  -800,  1520, -2068,  2108, -1140, -2147, 24130,
+    14888, -5728,  2346,  -370,  -742,  1180, -1129,   795,  -373,    12,   209,  -282,
+      244,  -152,    57,     9,   -39,    41,   -28,    13,    -3,    -1,     1,     0,
+        0,     2,    -5,     7,    -2,   -14,    43,   -76,    95,   -75,    -3,   144,
+     -318,   461,  -484,   300,   134,  -784,  1513, -2080,  2148, -1218, -2024, 24252,
+    14683, -5738,  2390,  -414,  -709,  1163, -1126,   800,  -383,    22,   202,  -279,
+      243,  -153,    59,     8,   -38,    40,   -28,    13,    -3,    -1,     1,     0,
+        0,     2,    -5,     7,    -3,   -14,    42,   -76,    96,   -78,     0,   140,
+     -316,   463,  -491,   313,   117,  -768,  1506, -2091,  2188, -1295, -1900, 24372,
+    14479, -5747,  2432,  -458,  -676,  1145, -1122,   805,  -392,    31,   196,  -275,
+      243,  -154,    61,     6,   -37,    40,   -28,    13,    -3,    -1,     1,     0,
+        0,     2,    -5,     7,    -3,   -13,    42,   -76,    97,   -80,     4,   136,
+     -314,   464,  -498,   326,   100,  -752,  1498, -2102,  2227, -1373, -1773, 24489,
+    14274, -5754,  2474,  -501,  -644,  1127, -1117,   810,  -401,    41,   189,  -272,
+      242,  -156,    63,     4,   -36,    40,   -28,    13,    -3,    -1,     1,     0,
+        0,     2,    -5,     8,    -3,   -13,    42,   -76,    98,   -83,     7,   133,
+     -311,   465,  -504,   339,    83,  -736,  1490, -2112,  2266, -1451, -1645, 24604,
+    14066, -5759,  2514,  -544,  -611,  1109, -1112,   815,  -411,    50,   182,  -268,
+      242,  -157,    65,     3,   -35,    39,   -28,    13,    -3,    -1,     1,     0,
+        0,     2,    -6,     8,    -4,   -12,    41,   -76,    99,   -85,    11,   129,
+     -308,   466,  -511,   351,    66,  -719,  1482, -2121,  2304, -1529, -1514, 24717,
+    13860, -5762,  2553,  -587,  -578,  1091, -1107,   820,  -420,    60,   175,  -265,
+      241,  -158,    67,     1,   -34,    39,   -28,    13,    -4,    -1,     1,     0,
+        0,     2,    -6,     8,    -4,   -12,    41,   -76,   100,   -87,    15,   124,
+     -306,   467,  -517,   364,    49,  -702,  1473, -2130,  2341, -1607, -1382, 24827,
+    13654, -5764,  2592,  -629,  -545,  1072, -1102,   824,  -429,    69,   168,  -261,
+      240,  -159,    69,    -1,   -33,    38,   -28,    14,    -4,     0,     1,     0,
+        0,     2,    -6,     8,    -4,   -11,    40,   -76,   101,   -90,    18,   120,
+     -303,   467,  -523,   376,    32,  -685,  1463, -2138,  2379, -1685, -1248, 24935,
+    13446, -5763,  2629,  -671,  -512,  1053, -1096,   828,  -437,    78,   161,  -257,
+      240,  -160,    70,    -2,   -32,    38,   -28,    14,    -4,     0,     1,     0,
+        0,     2,    -6,     8,    -5,   -11,    40,   -76,   102,   -92,    22,   116,
+     -300,   468,  -529,   389,    14,  -667,  1453, -2146,  2415, -1763, -1112, 25040,
+    13242, -5761,  2665,  -712,  -479,  1033, -1090,   831,  -446,    87,   154,  -253,
+      239,  -162,    72,    -4,   -31,    37,   -27,    14,    -4,     0,     1,     0,
+        0,     2,    -6,     9,    -5,   -10,    39,   -76,   103,   -94,    26,   112,
+     -297,   468,  -535,   401,    -3,  -649,  1442, -2153,  2451, -1840,  -974, 25143,
+    13031, -5757,  2701,  -754,  -446,  1014, -1084,   835,  -454,    96,   147,  -249,
+      238,  -163,    74,    -6,   -30,    37,   -27,    14,    -4,     0,     1,     0,
+        0,     2,    -6,     9,    -6,   -10,    39,   -76,   104,   -97,    29,   108,
+     -294,   468,  -541,   414,   -20,  -631,  1431, -2159,  2486, -1918,  -834, 25244,
+    12822, -5751,  2735,  -794,  -413,   994, -1077,   838,  -462,   106,   139,  -245,
+      237,  -163,    76,    -7,   -29,    36,   -27,    14,    -4,     0,     1,     0,
+        0,     2,    -6,     9,    -6,    -9,    38,   -76,   105,   -99,    33,   103,
+     -290,   469,  -547,   426,   -38,  -613,  1419, -2164,  2521, -1996,  -693, 25342,
+    12615, -5743,  2768,  -834,  -380,   974, -1070,   840,  -470,   115,   132,  -241,
+      236,  -164,    77,    -9,   -28,    36,   -27,    14,    -4,     0,     1,     0,
+        0,     2,    -6,     9,    -6,    -8,    38,   -76,   105,  -101,    37,    99,
+     -287,   468,  -552,   438,   -55,  -594,  1407, -2169,  2555, -2073,  -549, 25438,
+    12404, -5734,  2800,  -874,  -347,   954, -1063,   843,  -478,   124,   125,  -237,
+      235,  -165,    79,   -10,   -27,    35,   -27,    14,    -4,     0,     1,     0,
+        0,     2,    -6,     9,    -7,    -8,    37,   -75,   106,  -103,    40,    95,
+     -284,   468,  -557,   450,   -73,  -575,  1395, -2174,  2589, -2151,  -404, 25531,
+    12200, -5723,  2831,  -914,  -314,   933, -1055,   845,  -486,   132,   118,  -233,
+      233,  -166,    81,   -12,   -26,    35,   -27,    14,    -4,     0,     1,     0,
+        0,     2,    -6,     9,    -7,    -7,    36,   -75,   107,  -106,    44,    90,
+     -280,   468,  -563,   462,   -91,  -556,  1382, -2177,  2621, -2228,  -257, 25621,
+    11994, -5710,  2861,  -953,  -281,   912, -1047,   847,  -493,   141,   111,  -229,
+      232,  -167,    82,   -14,   -24,    34,   -27,    14,    -5,     0,     1,     0,
+        0,     2,    -6,    10,    -7,    -7,    36,   -75,   108,  -108,    48,    86,
+     -276,   467,  -567,   473,  -108,  -537,  1368, -2180,  2654, -2305,  -108, 25709,
+    11780, -5696,  2890,  -991,  -248,   891, -1039,   849,  -501,   150,   104,  -225,
+      231,  -167,    84,   -15,   -23,    34,   -27,    14,    -5,     0,     1,     0,
+        0,     2,    -6,    10,    -8,    -6,    35,   -75,   109,  -110,    51,    81,
+     -272,   467,  -572,   485,  -126,  -517,  1354, -2182,  2685, -2382,    42, 25794,
+    11576, -5680,  2918, -1029,  -216,   870, -1030,   850,  -508,   159,    97,  -220,
+      229,  -168,    85,   -17,   -22,    33,   -27,    14,    -5,     0,     0,     0,
+        0,     2,    -6,    10,    -8,    -5,    35,   -75,   109,  -112,    55,    77,
+     -269,   466,  -577,   497,  -144,  -497,  1340, -2184,  2716, -2458,   194, 25877,
+    11363, -5662,  2945, -1067,  -183,   849, -1021,   851,  -515,   167,    89,  -216,
+      228,  -168,    87,   -18,   -21,    33,   -26,    15,    -5,     0,     0,     0,
+        0,     2,    -6,    10,    -9,    -5,    34,   -74,   110,  -114,    59,    72,
+     -265,   465,  -581,   508,  -161,  -477,  1325, -2185,  2746, -2535,   348, 25957,
+    11157, -5643,  2971, -1103,  -150,   827, -1012,   852,  -522,   176,    82,  -212,
+      226,  -169,    88,   -20,   -20,    32,   -26,    15,    -5,     0,     0,     0,
+        0,     2,    -6,    10,    -9,    -4,    33,   -74,   110,  -116,    63,    67,
+     -261,   464,  -586,   519,  -179,  -457,  1309, -2185,  2775, -2611,   504, 26035,
+    10949, -5622,  2995, -1140,  -117,   805, -1003,   853,  -528,   184,    75,  -207,
+      225,  -169,    90,   -21,   -19,    31,   -26,    15,    -5,     0,     0,     0,
+        0,     2,    -6,    11,    -9,    -4,    33,   -74,   111,  -118,    66,    63,
+     -256,   462,  -590,   531,  -197,  -436,  1293, -2184,  2804, -2686,   661, 26109,
+    10740, -5599,  3019, -1176,   -85,   783,  -993,   853,  -535,   192,    68,  -203,
+      223,  -170,    91,   -23,   -18,    31,   -26,    15,    -5,     0,     0,     0,
+        0,     2,    -6,    11,   -10,    -3,    32,   -73,   112,  -120,    70,    58,
+     -252,   461,  -594,   542,  -214,  -416,  1277, -2183,  2832, -2762,   820, 26182,
+    10527, -5575,  3042, -1211,   -52,   761,  -983,   853,  -541,   201,    61,  -198,
+      221,  -170,    92,   -24,   -17,    30,   -26,    15,    -5,     1,     0,     0,
+        0,     2,    -6,    11,   -10,    -2,    31,   -73,   112,  -122,    74,    53,
+     -248,   459,  -598,   553,  -232,  -395,  1260, -2181,  2859, -2837,   980, 26251,
+    10323, -5549,  3063, -1246,   -20,   739,  -973,   853,  -547,   209,    53,  -194,
+      219,  -170,    94,   -26,   -16,    30,   -26,    15,    -5,     1,     0,     0,
+        0,     2,    -6,    11,   -11,    -2,    31,   -73,   113,  -124,    77,    48,
+     -243,   458,  -601,   563,  -250,  -374,  1243, -2179,  2885, -2911,  1142, 26318,
+    10114, -5522,  3084, -1281,    13,   716,  -962,   853,  -553,   217,    46,  -189,
+      217,  -170,    95,   -27,   -15,    29,   -25,    15,    -5,     1,     0,     0,
+        0,     2,    -6,    11,   -11,    -1,    30,   -72,   113,  -126,    81,    43,
+     -239,   456,  -605,   574,  -267,  -352,  1225, -2175,  2911, -2985,  1306, 26382,
+     9904, -5493,  3103, -1315,    45,   694,  -951,   852,  -558,   225,    39,  -184,
+      216,  -171,    96,   -29,   -13,    28,   -25,    15,    -6,     1,     0,     0,
+        0,     2,    -6,    11,   -11,    -1,    29,   -72,   114,  -128,    84,    39,
+     -234,   454,  -608,   585,  -285,  -331,  1207, -2171,  2935, -3059,  1472, 26444,
+     9697, -5463,  3121, -1348,    77,   671,  -940,   851,  -564,   233,    32,  -180,
+      214,  -171,    97,   -30,   -12,    28,   -25,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    11,   -12,     0,    28,   -71,   114,  -130,    88,    34,
+     -229,   452,  -611,   595,  -303,  -309,  1188, -2167,  2959, -3132,  1638, 26503,
+     9494, -5431,  3138, -1381,   109,   648,  -929,   850,  -569,   240,    25,  -175,
+      211,  -171,    98,   -31,   -11,    27,   -25,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    12,   -12,     1,    28,   -71,   114,  -132,    92,    29,
+     -225,   449,  -614,   605,  -320,  -287,  1169, -2161,  2983, -3205,  1807, 26559,
+     9283, -5398,  3154, -1413,   140,   625,  -917,   848,  -574,   248,    18,  -170,
+      209,  -171,   100,   -33,   -10,    27,   -24,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    12,   -12,     1,    27,   -70,   115,  -134,    95,    24,
+     -220,   447,  -617,   615,  -338,  -265,  1150, -2155,  3005, -3277,  1977, 26612,
+     9076, -5363,  3169, -1444,   172,   602,  -906,   846,  -579,   256,    11,  -165,
+      207,  -171,   101,   -34,    -9,    26,   -24,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    12,   -13,     2,    26,   -70,   115,  -135,    99,    19,
+     -215,   444,  -619,   625,  -355,  -243,  1130, -2148,  3026, -3349,  2148, 26662,
+     8871, -5327,  3183, -1475,   203,   579,  -893,   844,  -584,   263,     4,  -160,
+      205,  -171,   102,   -35,    -8,    25,   -24,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    12,   -13,     3,    25,   -69,   115,  -137,   102,    14,
+     -210,   441,  -622,   635,  -373,  -221,  1109, -2141,  3047, -3420,  2321, 26710,
+     8667, -5290,  3196, -1506,   235,   556,  -881,   842,  -588,   270,    -4,  -155,
+      203,  -170,   103,   -37,    -7,    25,   -24,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    12,   -14,     3,    24,   -68,   115,  -139,   106,     9,
+     -204,   438,  -624,   644,  -390,  -198,  1089, -2133,  3067, -3491,  2495, 26755,
+     8462, -5251,  3208, -1535,   266,   532,  -869,   839,  -592,   278,   -11,  -150,
+      200,  -170,   104,   -38,    -6,    24,   -24,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    12,   -14,     4,    24,   -68,   116,  -141,   110,     4,
+     -199,   435,  -626,   654,  -407,  -176,  1067, -2124,  3086, -3561,  2671, 26798,
+     8253, -5211,  3219, -1564,   296,   509,  -856,   837,  -596,   285,   -18,  -145,
+      198,  -170,   105,   -39,    -5,    23,   -23,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    12,   -14,     5,    23,   -67,   116,  -142,   113,    -1,
+     -194,   432,  -627,   663,  -425,  -153,  1046, -2114,  3104, -3630,  2848, 26837,
+     8047, -5169,  3229, -1593,   327,   485,  -843,   834,  -600,   292,   -24,  -140,
+      195,  -170,   106,   -41,    -4,    23,   -23,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    13,   -15,     5,    22,   -66,   116,  -144,   116,    -7,
+     -188,   429,  -629,   672,  -442,  -130,  1024, -2104,  3121, -3699,  3026, 26874,
+     7848, -5127,  3237, -1621,   357,   462,  -830,   830,  -604,   299,   -31,  -135,
+      193,  -169,   106,   -42,    -3,    22,   -23,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    13,   -15,     6,    21,   -66,   116,  -145,   120,   -12,
+     -183,   425,  -630,   681,  -459,  -107,  1001, -2093,  3137, -3766,  3206, 26908,
+     7642, -5083,  3245, -1648,   388,   438,  -816,   827,  -607,   305,   -38,  -130,
+      190,  -169,   107,   -43,    -1,    21,   -23,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    13,   -15,     7,    20,   -65,   116,  -147,   123,   -17,
+     -177,   421,  -632,   689,  -476,   -84,   978, -2081,  3153, -3834,  3387, 26939,
+     7439, -5037,  3251, -1675,   417,   414,  -802,   823,  -610,   312,   -45,  -125,
+      188,  -168,   108,   -44,     0,    21,   -22,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    13,   -16,     7,    19,   -64,   116,  -148,   127,   -22,
+     -172,   418,  -633,   698,  -493,   -61,   955, -2069,  3167, -3900,  3569, 26967,
+     7240, -4991,  3257, -1701,   447,   390,  -789,   819,  -613,   319,   -52,  -120,
+      185,  -168,   109,   -46,     1,    20,   -22,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    13,   -16,     8,    18,   -64,   116,  -150,   130,   -27,
+     -166,   414,  -633,   706,  -509,   -38,   931, -2055,  3181, -3966,  3753, 26993,
+     7036, -4943,  3261, -1726,   477,   367,  -774,   814,  -616,   325,   -59,  -115,
+      182,  -167,   110,   -47,     2,    19,   -22,    15,    -6,     1,     0,     0,
+        0,     2,    -7,    13,   -16,     9,    17,   -63,   116,  -151,   134,   -32,
+     -160,   410,  -634,   714,  -526,   -14,   907, -2042,  3193, -4031,  3937, 27015,
+     6835, -4894,  3265, -1751,   506,   343,  -760,   810,  -619,   331,   -65,  -110,
+      180,  -166,   110,   -48,     3,    19,   -21,    14,    -6,     1,     0,     0,
+        0,     2,    -7,    13,   -17,     9,    17,   -62,   116,  -152,   137,   -37,
+     -154,   405,  -634,   722,  -543,     9,   883, -2027,  3205, -4095,  4123, 27035,
+     6637, -4844,  3267, -1775,   535,   319,  -746,   805,  -621,   337,   -72,  -105,
+      177,  -166,   111,   -49,     4,    18,   -21,    14,    -6,     1,     0,     0,
+        0,     2,    -7,    13,   -17,    10,    16,   -61,   116,  -154,   140,   -43,
+     -148,   401,  -635,   730,  -559,    33,   858, -2012,  3215, -4158,  4311, 27052,
+     6441, -4792,  3268, -1799,   563,   295,  -731,   800,  -624,   343,   -79,  -100,
+      174,  -165,   111,   -50,     5,    17,   -21,    14,    -6,     1,     0,     0,
+        0,     2,    -7,    14,   -18,    11,    15,   -60,   115,  -155,   143,   -48,
+     -142,   396,  -635,   737,  -576,    56,   833, -1996,  3225, -4221,  4499, 27066,
+     6241, -4740,  3268, -1821,   592,   271,  -716,   795,  -626,   349,   -85,   -95,
+      171,  -164,   112,   -51,     6,    17,   -20,    14,    -6,     2,     0,     0,
+        0,     2,    -7,    14,   -18,    11,    14,   -59,   115,  -156,   147,   -53,
+     -136,   392,  -634,   745,  -592,    80,   808, -1979,  3234, -4282,  4688, 27078,
+     6038, -4686,  3268, -1844,   620,   247,  -701,   789,  -627,   355,   -92,   -89,
+      168,  -163,   113,   -52,     7,    16,   -20,    14,    -7,     2,     0,     0,
+        0,     2,    -7,    14,   -18,    12,    13,   -58,   115,  -157,   150,   -58,
+     -130,   387,  -634,   752,  -608,   104,   782, -1962,  3242, -4343,  4879, 27086,
+     5843, -4632,  3266, -1865,   648,   223,  -686,   784,  -629,   361,   -98,   -84,
+      165,  -163,   113,   -53,     8,    15,   -20,    14,    -7,     2,     0,     0,
+        0,     2,    -7,    14,   -19,    13,    12,   -57,   115,  -159,   153,   -63,
+     -124,   382,  -633,   758,  -624,   128,   756, -1944,  3249, -4403,  5070, 27092,
+     5652, -4576,  3263, -1886,   675,   199,  -671,   778,  -630,   366,  -105,   -79,
+      162,  -162,   113,   -55,     9,    15,   -20,    14,    -7,     2,     0,     0,
+        0,     2,    -7,    14,   -19,    13,    11,   -56,   114,  -160,   156,   -69,
+     -118,   377,  -633,   765,  -640,   151,   729, -1925,  3254, -4461,  5263, 27095,
+     5460, -4519,  3259, -1906,   702,   175,  -655,   771,  -632,   372,  -111,   -74,
+      159,  -161,   114,   -56,    10,    14,   -19,    14,    -7,     2,     0,     0,
+};
+
+/* 24 taps per branch: 48000 to 88200 Hz */
+const int16_t audio_src_coef_147_80[3528] =
+{
+        0,    -2,     0,    23,   -98,   265,  -561,  1003, -1569,  2194, -2779,  3238,
+    29490,  3030, -2695,  2157, -1554,   999,  -562,   268,  -101,    24,     0,    -2,
+        0,    -2,     1,    22,   -96,   262,  -559,  1006, -1584,  2232, -2863,  3448,
+    29487,  2824, -2611,  2118, -1539,   996,  -564,   270,  -103,    26,    -1,    -2,
+        0,    -2,     1,    21,   -94,   260,  -558,  1009, -1598,  2268, -2946,  3659,
+    29482,  2619, -2527,  2079, -1523,   991,  -565,   273,  -105,    27,    -1,    -2,
+        0,    -2,     2,    19,   -92,   257,  -555,  1011, -1611,  2305, -3029,  3873,
+    29467,  2417, -2442,  2040, -1507,   987,  -565,   275,  -107,    28,    -2,    -1,
+        0,    -2,     3,    18,   -89,   254,  -553,  1013, -1624,  2340, -3111,  4088,
+    29452,  2216, -2357,  2000, -1490,   982,  -566,   277,  -109,    29,    -2,    -1,
+        0,    -3,     3,    16,   -87,   250,  -551,  1015, -1636,  2375, -3193,  4304,
+    29437,  2018, -2272,  1959, -1473,   977,  -566,   279,  -110,    30,    -3,    -1,
+        0,    -3,     4,    15,   -84,   247,  -548,  1016, -1648,  2409, -3274,  4522,
+    29413,  1821, -2186,  1918, -1455,   971,  -566,   281,  -112,    31,    -3,    -1,
+        0,    -3,     4,    14,   -82,   243,  -545,  1017, -1659,  2443, -3355,  4742,
+    29388,  1627, -2101,  1877, -1437,   965,  -566,   282,  -114,    33,    -4,    -1,
+        0,    -3,     5,    12,   -79,   240,  -542,  1017, -1670,  2476, -3435,  4963,
+    29358,  1434, -2015,  1835, -1418,   959,  -566,   284,  -116,    34,    -4,    -1,
+        0,    -3,     5,    11,   -76,   236,  -538,  1017, -1680,  2508, -3514,  5186,
+    29322,  1244, -1930,  1793, -1399,   953,  -565,   286,  -117,    35,    -5,    -1,
+        0,    -3,     6,     9,   -74,   232,  -534,  1017, -1690,  2539, -3593,  5411,
+    29287,  1055, -1844,  1750, -1380,   946,  -564,   287,  -119,    36,    -5,    -1,
+        0,    -4,     7,     8,   -71,   228,  -530,  1016, -1699,  2570, -3671,  5636,
+    29246,   869, -1759,  1707, -1360,   939,  -563,   288,  -120,    37,    -6,     0,
+        0,    -4,     7,     6,   -68,   224,  -526,  1015, -1707,  2600, -3749,  5863,
+    29202,   685, -1673,  1664, -1339,   931,  -562,   289,  -122,    38,    -6,     0,
+        0,    -4,     8,     5,   -65,   220,  -522,  1014, -1715,  2629, -3826,  6092,
+    29154,   503, -1587,  1620, -1319,   923,  -561,   290,  -123,    38,    -6,     0,
+        0,    -4,     9,     3,   -62,   216,  -517,  1012, -1722,  2657, -3902,  6321,
+    29102,   324, -1502,  1576, -1298,   915,  -559,   291,  -124,    39,    -7,     0,
+        0,    -4,     9,     1,   -59,   211,  -512,  1009, -1729,  2684, -3977,  6552,
+    29049,   146, -1417,  1532, -1277,   907,  -557,   292,  -125,    40,    -7,     0,
+        0,    -4,    10,     0,   -56,   207,  -507,  1007, -1735,  2711, -4051,  6784,
+    28990,   -29, -1332,  1487, -1255,   898,  -555,   292,  -127,    41,    -8,     0,
+        0,    -5,    11,    -2,   -53,   202,  -502,  1004, -1740,  2737, -4124,  7018,
+    28927,  -202, -1247,  1442, -1233,   889,  -553,   293,  -128,    42,    -8,     0,
+        0,    -5,    11,    -4,   -50,   197,  -496,  1000, -1745,  2762, -4197,  7252,
+    28862,  -372, -1162,  1397, -1211,   880,  -550,   293,  -129,    43,    -8,     0,
+        0,    -5,    12,    -5,   -47,   192,  -490,   996, -1749,  2786, -4268,  7487,
+    28792,  -541, -1077,  1352, -1188,   871,  -548,   294,  -130,    43,    -9,     0,
+        0,    -5,    13,    -7,   -43,   187,  -484,   992, -1752,  2809, -4339,  7724,
+    28718,  -707,  -993,  1306, -1165,   861,  -545,   294,  -131,    44,    -9,     0,
+        0,    -5,    13,    -9,   -40,   182,  -478,   987, -1755,  2831, -4408,  7961,
+    28641,  -870,  -909,  1261, -1142,   851,  -542,   294,  -131,    45,    -9,     0,
+        0,    -6,    14,   -10,   -37,   177,  -471,   982, -1757,  2853, -4476,  8200,
+    28558, -1031,  -825,  1215, -1118,   841,  -539,   294,  -132,    46,   -10,     0,
+        0,    -6,    15,   -12,   -33,   171,  -465,   976, -1759,  2873, -4544,  8439,
+    28479, -1190,  -742,  1169, -1095,   830,  -535,   293,  -133,    46,   -10,     1,
+        0,    -6,    15,   -14,   -30,   166,  -458,   970, -1759,  2892, -4610,  8679,
+    28392, -1346,  -659,  1123, -1071,   819,  -532,   293,  -134,    47,   -10,     1,
+        0,    -6,    16,   -16,   -26,   160,  -450,   964, -1760,  2911, -4675,  8920,
+    28301, -1500,  -577,  1076, -1046,   808,  -528,   293,  -134,    47,   -11,     1,
+        0,    -6,    17,   -17,   -23,   154,  -443,   957, -1759,  2929, -4738,  9162,
+    28205, -1651,  -495,  1030, -1022,   797,  -524,   292,  -135,    48,   -11,     1,
+        0,    -6,    18,   -19,   -19,   148,  -435,   950, -1758,  2945, -4801,  9404,
+    28105, -1800,  -413,   984,  -997,   786,  -520,   292,  -135,    49,   -11,     1,
+        0,    -7,    18,   -21,   -16,   143,  -427,   942, -1756,  2961, -4862,  9647,
+    28008, -1946,  -332,   937,  -972,   774,  -516,   291,  -136,    49,   -12,     1,
+        0,    -7,    19,   -23,   -12,   136,  -419,   934, -1753,  2975, -4922,  9891,
+    27903, -2090,  -252,   891,  -947,   762,  -511,   290,  -136,    50,   -12,     1,
+        0,    -7,    20,   -25,    -8,   130,  -411,   926, -1750,  2989, -4981, 10135,
+    27795, -2231,  -171,   844,  -922,   750,  -507,   289,  -136,    50,   -12,     1,
+        0,    -7,    20,   -27,    -4,   124,  -402,   917, -1746,  3001, -5038, 10380,
+    27685, -2370,   -92,   797,  -896,   738,  -502,   288,  -137,    50,   -12,     1,
+        0,    -7,    21,   -28,    -1,   118,  -393,   907, -1742,  3012, -5094, 10625,
+    27570, -2506,   -13,   751,  -870,   725,  -497,   287,  -137,    51,   -12,     1,
+        0,    -8,    22,   -30,     3,   111,  -384,   898, -1736,  3023, -5148, 10871,
+    27455, -2640,    65,   704,  -845,   712,  -492,   285,  -137,    51,   -13,     1,
+        0,    -8,    23,   -32,     7,   105,  -375,   888, -1730,  3032, -5201, 11117,
+    27331, -2771,   143,   658,  -819,   700,  -487,   284,  -137,    52,   -13,     1,
+        0,    -8,    23,   -34,    11,    98,  -366,   877, -1723,  3040, -5253, 11363,
+    27208, -2899,   220,   612,  -792,   686,  -481,   283,  -137,    52,   -13,     1,
+        0,    -8,    24,   -36,    15,    91,  -356,   866, -1716,  3047, -5303, 11610,
+    27083, -3025,   296,   565,  -766,   673,  -476,   281,  -137,    52,   -13,     1,
+        0,    -8,    25,   -38,    19,    84,  -346,   855, -1708,  3053, -5351, 11857,
+    26950, -3148,   372,   519,  -740,   660,  -470,   279,  -137,    53,   -13,     1,
+        0,    -9,    25,   -40,    23,    78,  -336,   843, -1699,  3058, -5398, 12104,
+    26817, -3268,   447,   473,  -713,   646,  -464,   278,  -137,    53,   -14,     1,
+        0,    -9,    26,   -42,    27,    71,  -326,   831, -1689,  3062, -5443, 12351,
+    26681, -3386,   521,   427,  -687,   633,  -459,   276,  -137,    53,   -14,     1,
+        0,    -9,    27,   -44,    31,    63,  -315,   818, -1679,  3064, -5487, 12598,
+    26543, -3501,   594,   381,  -660,   619,  -453,   274,  -136,    53,   -14,     1,
+        0,    -9,    28,   -45,    35,    56,  -305,   805, -1668,  3065, -5529, 12846,
+    26398, -3614,   667,   336,  -633,   605,  -446,   272,  -136,    53,   -14,     1,
+        0,    -9,    28,   -47,    39,    49,  -294,   792, -1657,  3066, -5569, 13093,
+    26253, -3724,   738,   290,  -606,   591,  -440,   270,  -136,    54,   -14,     1,
+        0,   -10,    29,   -49,    43,    42,  -283,   778, -1644,  3065, -5607, 13340,
+    26105, -3831,   809,   245,  -579,   576,  -434,   267,  -135,    54,   -14,     1,
+        0,   -10,    30,   -51,    47,    34,  -272,   764, -1631,  3063, -5644, 13587,
+    25955, -3936,   879,   200,  -553,   562,  -427,   265,  -135,    54,   -14,     1,
+        1,   -10,    30,   -53,    51,    27,  -260,   750, -1617,  3059, -5679, 13834,
+    25799, -4038,   949,   155,  -526,   547,  -420,   263,  -134,    54,   -15,     1,
+        1,   -10,    31,   -55,    56,    19,  -249,   735, -1603,  3055, -5712, 14080,
+    25644, -4137,  1017,   110,  -499,   533,  -414,   260,  -134,    54,   -15,     1,
+        1,   -10,    32,   -57,    60,    12,  -237,   719, -1587,  3049, -5743, 14327,
+    25482, -4234,  1084,    66,  -472,   518,  -407,   258,  -133,    54,   -15,     1,
+        1,   -10,    33,   -59,    64,     4,  -225,   704, -1572,  3042, -5772, 14572,
+    25320, -4327,  1151,    22,  -445,   503,  -400,   255,  -133,    54,   -15,     1,
+        1,   -11,    33,   -61,    68,    -4,  -213,   688, -1555,  3034, -5800, 14818,
+    25157, -4419,  1216,   -22,  -418,   489,  -393,   252,  -132,    54,   -15,     1,
+        1,   -11,    34,   -63,    72,   -12,  -200,   671, -1538,  3025, -5825, 15063,
+    24986, -4507,  1281,   -65,  -391,   474,  -386,   250,  -131,    54,   -15,     1,
+        1,   -11,    35,   -65,    77,   -20,  -188,   654, -1519,  3015, -5848, 15308,
+    24812, -4593,  1345,  -108,  -364,   458,  -378,   247,  -130,    54,   -15,     1,
+        1,   -11,    35,   -67,    81,   -28,  -175,   637, -1501,  3003, -5870, 15552,
+    24641, -4676,  1407,  -151,  -337,   443,  -371,   244,  -130,    54,   -15,     2,
+        1,   -11,    36,   -68,    85,   -36,  -162,   620, -1481,  2990, -5889, 15795,
+    24462, -4757,  1469,  -194,  -310,   428,  -363,   241,  -129,    54,   -15,     2,
+        1,   -12,    37,   -70,    89,   -44,  -149,   602, -1461,  2976, -5907, 16038,
+    24286, -4835,  1529,  -236,  -283,   413,  -356,   238,  -128,    54,   -15,     1,
+        1,   -12,    37,   -72,    94,   -52,  -136,   584, -1440,  2960, -5922, 16280,
+    24105, -4910,  1589,  -278,  -257,   398,  -348,   235,  -127,    53,   -15,     1,
+        1,   -12,    38,   -74,    98,   -60,  -123,   565, -1419,  2944, -5935, 16522,
+    23922, -4982,  1647,  -319,  -230,   382,  -341,   231,  -126,    53,   -15,     1,
+        1,   -12,    39,   -76,   102,   -68,  -110,   546, -1397,  2926, -5946, 16762,
+    23736, -5052,  1705,  -360,  -204,   367,  -333,   228,  -125,    53,   -15,     1,
+        1,   -12,    39,   -78,   106,   -76,   -96,   527, -1374,  2907, -5955, 17002,
+    23546, -5119,  1761,  -401,  -177,   352,  -325,   225,  -124,    53,   -15,     1,
+        1,   -12,    40,   -80,   111,   -84,   -82,   507, -1350,  2886, -5962, 17241,
+    23355, -5184,  1817,  -441,  -151,   336,  -317,   221,  -123,    53,   -15,     1,
+        1,   -13,    40,   -81,   115,   -93,   -69,   487, -1326,  2865, -5966, 17479,
+    23163, -5246,  1871,  -480,  -125,   321,  -309,   218,  -122,    52,   -15,     1,
+        1,   -13,    41,   -83,   119,  -101,   -55,   467, -1301,  2842, -5968, 17715,
+    22968, -5305,  1924,  -520,   -99,   305,  -301,   214,  -120,    52,   -15,     1,
+        1,   -13,    42,   -85,   123,  -109,   -40,   446, -1275,  2818, -5968, 17951,
+    22768, -5362,  1976,  -559,   -73,   290,  -293,   211,  -119,    52,   -15,     1,
+        1,   -13,    42,   -87,   128,  -118,   -26,   426, -1249,  2792, -5966, 18186,
+    22569, -5416,  2027,  -597,   -47,   274,  -285,   207,  -118,    52,   -15,     1,
+        1,   -13,    43,   -89,   132,  -126,   -12,   404, -1222,  2766, -5962, 18419,
+    22368, -5467,  2076,  -635,   -21,   259,  -277,   204,  -117,    51,   -15,     1,
+        1,   -13,    43,   -90,   136,  -134,     2,   383, -1195,  2738, -5955, 18652,
+    22163, -5516,  2125,  -672,     4,   243,  -269,   200,  -115,    51,   -15,     1,
+        1,   -13,    44,   -92,   140,  -143,    17,   361, -1166,  2709, -5946, 18883,
+    21955, -5562,  2172,  -709,    30,   228,  -260,   196,  -114,    51,   -15,     1,
+        1,   -14,    45,   -94,   144,  -151,    32,   339, -1138,  2678, -5934, 19112,
+    21749, -5606,  2218,  -745,    55,   213,  -252,   193,  -113,    50,   -15,     1,
+        1,   -14,    45,   -95,   149,  -160,    46,   317, -1108,  2647, -5920, 19341,
+    21537, -5647,  2263,  -781,    80,   197,  -244,   189,  -111,    50,   -15,     1,
+        1,   -14,    46,   -97,   153,  -168,    61,   294, -1078,  2614, -5904, 19568,
+    21327, -5686,  2307,  -816,   104,   182,  -236,   185,  -110,    49,   -15,     1,
+        1,   -14,    46,   -99,   157,  -177,    76,   271, -1047,  2580, -5885, 19793,
+    21112, -5722,  2350,  -851,   129,   167,  -227,   181,  -108,    49,   -15,     1,
+        1,   -14,    47,  -100,   161,  -185,    91,   248, -1016,  2545, -5864, 20017,
+    20895, -5755,  2391,  -885,   153,   151,  -219,   177,  -107,    49,   -14,     1,
+        1,   -14,    47,  -102,   165,  -194,   106,   225,  -984,  2508, -5841, 20239,
+    20680, -5786,  2431,  -919,   177,   136,  -210,   173,  -105,    48,   -14,     1,
+        1,   -14,    48,  -104,   169,  -202,   121,   201,  -952,  2470, -5815, 20460,
+    20462, -5815,  2470,  -952,   201,   121,  -202,   169,  -104,    48,   -14,     1,
+        1,   -14,    48,  -105,   173,  -210,   136,   177,  -919,  2431, -5786, 20679,
+    20240, -5841,  2508,  -984,   225,   106,  -194,   165,  -102,    47,   -14,     1,
+        1,   -14,    49,  -107,   177,  -219,   151,   153,  -885,  2391, -5755, 20897,
+    20015, -5864,  2545, -1016,   248,    91,  -185,   161,  -100,    47,   -14,     1,
+        1,   -15,    49,  -108,   181,  -227,   167,   129,  -851,  2350, -5722, 21112,
+    19793, -5885,  2580, -1047,   271,    76,  -177,   157,   -99,    46,   -14,     1,
+        1,   -15,    49,  -110,   185,  -236,   182,   104,  -816,  2307, -5686, 21326,
+    19569, -5904,  2614, -1078,   294,    61,  -168,   153,   -97,    46,   -14,     1,
+        1,   -15,    50,  -111,   189,  -244,   197,    80,  -781,  2263, -5647, 21538,
+    19340, -5920,  2647, -1108,   317,    46,  -160,   149,   -95,    45,   -14,     1,
+        1,   -15,    50,  -113,   193,  -252,   213,    55,  -745,  2218, -5606, 21748,
+    19113, -5934,  2678, -1138,   339,    32,  -151,   144,   -94,    45,   -14,     1,
+        1,   -15,    51,  -114,   196,  -260,   228,    30,  -709,  2172, -5562, 21956,
+    18882, -5946,  2709, -1166,   361,    17,  -143,   140,   -92,    44,   -13,     1,
+        1,   -15,    51,  -115,   200,  -269,   243,     4,  -672,  2125, -5516, 22163,
+    18652, -5955,  2738, -1195,   383,     2,  -134,   136,   -90,    43,   -13,     1,
+        1,   -15,    51,  -117,   204,  -277,   259,   -21,  -635,  2076, -5467, 22367,
+    18420, -5962,  2766, -1222,   404,   -12,  -126,   132,   -89,    43,   -13,     1,
+        1,   -15,    52,  -118,   207,  -285,   274,   -47,  -597,  2027, -5416, 22569,
+    18186, -5966,  2792, -1249,   426,   -26,  -118,   128,   -87,    42,   -13,     1,
+        1,   -15,    52,  -119,   211,  -293,   290,   -73,  -559,  1976, -5362, 22769,
+    17950, -5968,  2818, -1275,   446,   -40,  -109,   123,   -85,    42,   -13,     1,
+        1,   -15,    52,  -120,   214,  -301,   305,   -99,  -520,  1924, -5305, 22966,
+    17717, -5968,  2842, -1301,   467,   -55,  -101,   119,   -83,    41,   -13,     1,
+        1,   -15,    52,  -122,   218,  -309,   321,  -125,  -480,  1871, -5246, 23162,
+    17480, -5966,  2865, -1326,   487,   -69,   -93,   115,   -81,    40,   -13,     1,
+        1,   -15,    53,  -123,   221,  -317,   336,  -151,  -441,  1817, -5184, 23355,
+    17241, -5962,  2886, -1350,   507,   -82,   -84,   111,   -80,    40,   -12,     1,
+        1,   -15,    53,  -124,   225,  -325,   352,  -177,  -401,  1761, -5119, 23546,
+    17002, -5955,  2907, -1374,   527,   -96,   -76,   106,   -78,    39,   -12,     1,
+        1,   -15,    53,  -125,   228,  -333,   367,  -204,  -360,  1705, -5052, 23735,
+    16763, -5946,  2926, -1397,   546,  -110,   -68,   102,   -76,    39,   -12,     1,
+        1,   -15,    53,  -126,   231,  -341,   382,  -230,  -319,  1647, -4982, 23921,
+    16523, -5935,  2944, -1419,   565,  -123,   -60,    98,   -74,    38,   -12,     1,
+        1,   -15,    53,  -127,   235,  -348,   398,  -257,  -278,  1589, -4910, 24105,
+    16280, -5922,  2960, -1440,   584,  -136,   -52,    94,   -72,    37,   -12,     1,
+        1,   -15,    54,  -128,   238,  -356,   413,  -283,  -236,  1529, -4835, 24286,
+    16038, -5907,  2976, -1461,   602,  -149,   -44,    89,   -70,    37,   -12,     1,
+        2,   -15,    54,  -129,   241,  -363,   428,  -310,  -194,  1469, -4757, 24465,
+    15792, -5889,  2990, -1481,   620,  -162,   -36,    85,   -68,    36,   -11,     1,
+        2,   -15,    54,  -130,   244,  -371,   443,  -337,  -151,  1407, -4676, 24641,
+    15552, -5870,  3003, -1501,   637,  -175,   -28,    81,   -67,    35,   -11,     1,
+        1,   -15,    54,  -130,   247,  -378,   458,  -364,  -108,  1345, -4593, 24814,
+    15306, -5848,  3015, -1519,   654,  -188,   -20,    77,   -65,    35,   -11,     1,
+        1,   -15,    54,  -131,   250,  -386,   474,  -391,   -65,  1281, -4507, 24985,
+    15064, -5825,  3025, -1538,   671,  -200,   -12,    72,   -63,    34,   -11,     1,
+        1,   -15,    54,  -132,   252,  -393,   489,  -418,   -22,  1216, -4419, 25154,
+    14821, -5800,  3034, -1555,   688,  -213,    -4,    68,   -61,    33,   -11,     1,
+        1,   -15,    54,  -133,   255,  -400,   503,  -445,    22,  1151, -4327, 25319,
+    14573, -5772,  3042, -1572,   704,  -225,     4,    64,   -59,    33,   -10,     1,
+        1,   -15,    54,  -133,   258,  -407,   518,  -472,    66,  1084, -4234, 25482,
+    14327, -5743,  3049, -1587,   719,  -237,    12,    60,   -57,    32,   -10,     1,
+        1,   -15,    54,  -134,   260,  -414,   533,  -499,   110,  1017, -4137, 25642,
+    14082, -5712,  3055, -1603,   735,  -249,    19,    56,   -55,    31,   -10,     1,
+        1,   -15,    54,  -134,   263,  -420,   547,  -526,   155,   949, -4038, 25799,
+    13834, -5679,  3059, -1617,   750,  -260,    27,    51,   -53,    30,   -10,     1,
+        1,   -14,    54,  -135,   265,  -427,   562,  -553,   200,   879, -3936, 25954,
+    13588, -5644,  3063, -1631,   764,  -272,    34,    47,   -51,    30,   -10,     0,
+        1,   -14,    54,  -135,   267,  -434,   576,  -579,   245,   809, -3831, 26105,
+    13340, -5607,  3065, -1644,   778,  -283,    42,    43,   -49,    29,   -10,     0,
+        1,   -14,    54,  -136,   270,  -440,   591,  -606,   290,   738, -3724, 26254,
+    13092, -5569,  3066, -1657,   792,  -294,    49,    39,   -47,    28,    -9,     0,
+        1,   -14,    53,  -136,   272,  -446,   605,  -633,   336,   667, -3614, 26399,
+    12845, -5529,  3065, -1668,   805,  -305,    56,    35,   -45,    28,    -9,     0,
+        1,   -14,    53,  -136,   274,  -453,   619,  -660,   381,   594, -3501, 26542,
+    12599, -5487,  3064, -1679,   818,  -315,    63,    31,   -44,    27,    -9,     0,
+        1,   -14,    53,  -137,   276,  -459,   633,  -687,   427,   521, -3386, 26681,
+    12351, -5443,  3062, -1689,   831,  -326,    71,    27,   -42,    26,    -9,     0,
+        1,   -14,    53,  -137,   278,  -464,   646,  -713,   473,   447, -3268, 26818,
+    12103, -5398,  3058, -1699,   843,  -336,    78,    23,   -40,    25,    -9,     0,
+        1,   -13,    53,  -137,   279,  -470,   660,  -740,   519,   372, -3148, 26951,
+    11856, -5351,  3053, -1708,   855,  -346,    84,    19,   -38,    25,    -8,     0,
+        1,   -13,    52,  -137,   281,  -476,   673,  -766,   565,   296, -3025, 27081,
+    11612, -5303,  3047, -1716,   866,  -356,    91,    15,   -36,    24,    -8,     0,
+        1,   -13,    52,  -137,   283,  -481,   686,  -792,   612,   220, -2899, 27208,
+    11363, -5253,  3040, -1723,   877,  -366,    98,    11,   -34,    23,    -8,     0,
+        1,   -13,    52,  -137,   284,  -487,   700,  -819,   658,   143, -2771, 27332,
+    11116, -5201,  3032, -1730,   888,  -375,   105,     7,   -32,    23,    -8,     0,
+        1,   -13,    51,  -137,   285,  -492,   712,  -845,   704,    65, -2640, 27453,
+    10873, -5148,  3023, -1736,   898,  -384,   111,     3,   -30,    22,    -8,     0,
+        1,   -12,    51,  -137,   287,  -497,   725,  -870,   751,   -13, -2506, 27570,
+    10625, -5094,  3012, -1742,   907,  -393,   118,    -1,   -28,    21,    -7,     0,
+        1,   -12,    50,  -137,   288,  -502,   738,  -896,   797,   -92, -2370, 27684,
+    10381, -5038,  3001, -1746,   917,  -402,   124,    -4,   -27,    20,    -7,     0,
+        1,   -12,    50,  -136,   289,  -507,   750,  -922,   844,  -171, -2231, 27795,
+    10135, -4981,  2989, -1750,   926,  -411,   130,    -8,   -25,    20,    -7,     0,
+        1,   -12,    50,  -136,   290,  -511,   762,  -947,   891,  -252, -2090, 27903,
+     9891, -4922,  2975, -1753,   934,  -419,   136,   -12,   -23,    19,    -7,     0,
+        1,   -12,    49,  -136,   291,  -516,   774,  -972,   937,  -332, -1946, 28007,
+     9648, -4862,  2961, -1756,   942,  -427,   143,   -16,   -21,    18,    -7,     0,
+        1,   -11,    49,  -135,   292,  -520,   786,  -997,   984,  -413, -1800, 28108,
+     9401, -4801,  2945, -1758,   950,  -435,   148,   -19,   -19,    18,    -6,     0,
+        1,   -11,    48,  -135,   292,  -524,   797, -1022,  1030,  -495, -1651, 28205,
+     9162, -4738,  2929, -1759,   957,  -443,   154,   -23,   -17,    17,    -6,     0,
+        1,   -11,    47,  -134,   293,  -528,   808, -1046,  1076,  -577, -1500, 28299,
+     8922, -4675,  2911, -1760,   964,  -450,   160,   -26,   -16,    16,    -6,     0,
+        1,   -10,    47,  -134,   293,  -532,   819, -1071,  1123,  -659, -1346, 28390,
+     8681, -4610,  2892, -1759,   970,  -458,   166,   -30,   -14,    15,    -6,     0,
+        1,   -10,    46,  -133,   293,  -535,   830, -1095,  1169,  -742, -1190, 28477,
+     8441, -4544,  2873, -1759,   976,  -465,   171,   -33,   -12,    15,    -6,     0,
+        0,   -10,    46,  -132,   294,  -539,   841, -1118,  1215,  -825, -1031, 28561,
+     8197, -4476,  2853, -1757,   982,  -471,   177,   -37,   -10,    14,    -6,     0,
+        0,    -9,    45,  -131,   294,  -542,   851, -1142,  1261,  -909,  -870, 28641,
+     7961, -4408,  2831, -1755,   987,  -478,   182,   -40,    -9,    13,    -5,     0,
+        0,    -9,    44,  -131,   294,  -545,   861, -1165,  1306,  -993,  -707, 28718,
+     7724, -4339,  2809, -1752,   992,  -484,   187,   -43,    -7,    13,    -5,     0,
+        0,    -9,    43,  -130,   294,  -548,   871, -1188,  1352, -1077,  -541, 28791,
+     7488, -4268,  2786, -1749,   996,  -490,   192,   -47,    -5,    12,    -5,     0,
+        0,    -8,    43,  -129,   293,  -550,   880, -1211,  1397, -1162,  -372, 28860,
+     7254, -4197,  2762, -1745,  1000,  -496,   197,   -50,    -4,    11,    -5,     0,
+        0,    -8,    42,  -128,   293,  -553,   889, -1233,  1442, -1247,  -202, 28926,
+     7019, -4124,  2737, -1740,  1004,  -502,   202,   -53,    -2,    11,    -5,     0,
+        0,    -8,    41,  -127,   292,  -555,   898, -1255,  1487, -1332,   -29, 28989,
+     6785, -4051,  2711, -1735,  1007,  -507,   207,   -56,     0,    10,    -4,     0,
+        0,    -7,    40,  -125,   292,  -557,   907, -1277,  1532, -1417,   146, 29048,
+     6553, -3977,  2684, -1729,  1009,  -512,   211,   -59,     1,     9,    -4,     0,
+        0,    -7,    39,  -124,   291,  -559,   915, -1298,  1576, -1502,   324, 29103,
+     6320, -3902,  2657, -1722,  1012,  -517,   216,   -62,     3,     9,    -4,     0,
+        0,    -6,    38,  -123,   290,  -561,   923, -1319,  1620, -1587,   503, 29154,
+     6092, -3826,  2629, -1715,  1014,  -522,   220,   -65,     5,     8,    -4,     0,
+        0,    -6,    38,  -122,   289,  -562,   931, -1339,  1664, -1673,   685, 29202,
+     5863, -3749,  2600, -1707,  1015,  -526,   224,   -68,     6,     7,    -4,     0,
+        0,    -6,    37,  -120,   288,  -563,   939, -1360,  1707, -1759,   869, 29247,
+     5635, -3671,  2570, -1699,  1016,  -530,   228,   -71,     8,     7,    -4,     0,
+       -1,    -5,    36,  -119,   287,  -564,   946, -1380,  1750, -1844,  1055, 29287,
+     5411, -3593,  2539, -1690,  1017,  -534,   232,   -74,     9,     6,    -3,     0,
+       -1,    -5,    35,  -117,   286,  -565,   953, -1399,  1793, -1930,  1244, 29324,
+     5184, -3514,  2508, -1680,  1017,  -538,   236,   -76,    11,     5,    -3,     0,
+       -1,    -4,    34,  -116,   284,  -566,   959, -1418,  1835, -2015,  1434, 29357,
+     4964, -3435,  2476, -1670,  1017,  -542,   240,   -79,    12,     5,    -3,     0,
+       -1,    -4,    33,  -114,   282,  -566,   965, -1437,  1877, -2101,  1627, 29387,
+     4743, -3355,  2443, -1659,  1017,  -545,   243,   -82,    14,     4,    -3,     0,
+       -1,    -3,    31,  -112,   281,  -566,   971, -1455,  1918, -2186,  1821, 29413,
+     4522, -3274,  2409, -1648,  1016,  -548,   247,   -84,    15,     4,    -3,     0,
+       -1,    -3,    30,  -110,   279,  -566,   977, -1473,  1959, -2272,  2018, 29435,
+     4306, -3193,  2375, -1636,  1015,  -551,   250,   -87,    16,     3,    -3,     0,
+       -1,    -2,    29,  -109,   277,  -566,   982, -1490,  2000, -2357,  2216, 29454,
+     4086, -3111,  2340, -1624,  1013,  -553,   254,   -89,    18,     3,    -2,     0,
+       -1,    -2,    28,  -107,   275,  -565,   987, -1507,  2040, -2442,  2417, 29469,
+     3871, -3029,  2305, -1611,  1011,  -555,   257,   -92,    19,     2,    -2,     0,
+       -2,    -1,    27,  -105,   273,  -565,   991, -1523,  2079, -2527,  2619, 29480,
+     3661, -2946,  2268, -1598,  1009,  -558,   260,   -94,    21,     1,    -2,     0,
+       -2,    -1,    26,  -103,   270,  -564,   996, -1539,  2118, -2611,  2824, 29487,
+     3448, -2863,  2232, -1584,  1006,  -559,   262,   -96,    22,     1,    -2,     0,
+       -2,     0,    24,  -101,   268,  -562,   999, -1554,  2157, -2695,  3030, 29491,
+     3237, -2779,  2194, -1569,  1003,  -561,   265,   -98,    23,     0,    -2,     0,
+};
+
+/* 96 taps per branch: 88200 to 16000 Hz */
+const int16_t audio_src_coef_80_441[7680] =
+{
+        0,     0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     2,
+       -7,   -19,   -29,   -33,   -27,   -10,    19,    52,    80,    92,    77,    32,
+      -38,  -118,  -186,  -215,  -185,   -89,    62,   237,   386,   458,   409,   221,
+      -88,  -460,  -800, -1000,  -954,  -590,   110,  1096,  2255,  3427,  4434,  5112,
+     5352,  5106,  4423,  3413,  2240,  1082,    99,  -596,  -956,  -999,  -797,  -455,
+      -84,   224,   411,   458,   385,   235,    60,   -90,  -186,  -215,  -185,  -117,
+      -37,    33,    78,    92,    80,    52,    19,   -10,   -28,   -33,   -29,   -19,
+       -7,     2,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     2,
+       -7,   -19,   -29,   -33,   -27,    -9,    19,    53,    81,    92,    77,    31,
+      -39,  -119,  -186,  -215,  -184,   -87,    65,   239,   388,   458,   408,   218,
+      -93,  -464,  -804, -1001,  -951,  -583,   121,  1110,  2270,  3441,  4444,  5118,
+     5346,  5100,  4412,  3399,  2225,  1068,    89,  -603,  -958,  -998,  -793,  -450,
+      -79,   227,   412,   458,   383,   232,    58,   -92,  -186,  -215,  -184,  -116,
+      -36,    34,    78,    92,    80,    51,    18,   -10,   -28,   -33,   -29,   -18,
+       -7,     2,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     2,
+       -8,   -19,   -29,   -33,   -27,    -9,    20,    53,    81,    92,    76,    31,
+      -40,  -120,  -187,  -215,  -183,   -85,    67,   241,   389,   458,   406,   215,
+      -97,  -469,  -808, -1002,  -949,  -576,   131,  1123,  2285,  3455,  4455,  5124,
+     5349,  5094,  4401,  3385,  2210,  1055,    78,  -609,  -961,  -996,  -789,  -446,
+      -75,   230,   413,   457,   382,   230,    56,   -93,  -187,  -215,  -184,  -115,
+      -35,    34,    78,    92,    80,    51,    18,   -10,   -28,   -33,   -28,   -18,
+       -7,     2,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     2,
+       -8,   -19,   -29,   -33,   -27,    -9,    20,    54,    81,    92,    76,    30,
+      -41,  -121,  -188,  -215,  -183,   -84,    69,   243,   391,   459,   405,   211,
+     -101,  -474,  -811, -1003,  -946,  -569,   142,  1137,  2300,  3469,  4466,  5129,
+     5351,  5088,  4390,  3371,  2195,  1041,    67,  -616,  -963,  -995,  -786,  -441,
+      -71,   234,   415,   457,   380,   228,    54,   -95,  -188,  -215,  -183,  -114,
+      -34,    35,    79,    92,    79,    51,    17,   -11,   -28,   -33,   -28,   -18,
+       -7,     2,     7,     9,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     2,
+       -8,   -19,   -29,   -33,   -27,    -8,    21,    54,    82,    92,    76,    29,
+      -42,  -122,  -188,  -215,  -182,   -82,    71,   245,   392,   459,   403,   208,
+     -106,  -478,  -815, -1004,  -943,  -562,   153,  1151,  2315,  3483,  4477,  5135,
+     5345,  5082,  4379,  3357,  2180,  1028,    57,  -622,  -965,  -994,  -782,  -436,
+      -66,   237,   416,   457,   379,   226,    52,   -97,  -189,  -215,  -182,  -113,
+      -33,    36,    79,    92,    79,    50,    17,   -11,   -28,   -33,   -28,   -18,
+       -7,     2,     7,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     1,
+       -8,   -19,   -29,   -33,   -27,    -8,    21,    54,    82,    92,    75,    28,
+      -43,  -123,  -189,  -215,  -181,   -81,    73,   247,   393,   459,   401,   205,
+     -110,  -483,  -818, -1005,  -941,  -556,   164,  1165,  2330,  3497,  4487,  5141,
+     5349,  5075,  4368,  3343,  2165,  1014,    46,  -629,  -968,  -992,  -778,  -431,
+      -62,   240,   418,   456,   377,   224,    50,   -98,  -189,  -214,  -182,  -112,
+      -32,    37,    79,    92,    79,    50,    17,   -11,   -28,   -33,   -28,   -18,
+       -6,     2,     7,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     1,
+       -8,   -20,   -29,   -33,   -26,    -8,    21,    55,    82,    92,    75,    28,
+      -44,  -124,  -190,  -215,  -180,   -79,    75,   249,   395,   459,   400,   201,
+     -115,  -488,  -822, -1006,  -938,  -549,   175,  1178,  2345,  3511,  4498,  5146,
+     5350,  5069,  4357,  3329,  2151,  1001,    36,  -635,  -970,  -991,  -775,  -427,
+      -58,   243,   419,   456,   375,   222,    48,  -100,  -190,  -214,  -181,  -111,
+      -31,    37,    80,    92,    79,    49,    16,   -12,   -28,   -33,   -28,   -18,
+       -6,     3,     7,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     1,
+       -8,   -20,   -29,   -33,   -26,    -7,    22,    55,    82,    92,    74,    27,
+      -45,  -125,  -190,  -215,  -179,   -77,    77,   251,   396,   459,   398,   198,
+     -119,  -492,  -825, -1007,  -935,  -542,   186,  1192,  2360,  3524,  4508,  5152,
+     5346,  5063,  4345,  3315,  2136,   987,    26,  -641,  -972,  -989,  -771,  -422,
+      -53,   246,   420,   456,   374,   219,    46,  -101,  -191,  -214,  -180,  -110,
+      -30,    38,    80,    92,    78,    49,    16,   -12,   -28,   -33,   -28,   -18,
+       -6,     3,     7,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     7,     1,
+       -8,   -20,   -30,   -33,   -26,    -7,    22,    56,    83,    92,    74,    26,
+      -46,  -126,  -191,  -215,  -178,   -76,    80,   254,   398,   459,   397,   195,
+     -124,  -497,  -829, -1008,  -932,  -534,   197,  1206,  2375,  3538,  4519,  5157,
+     5345,  5056,  4334,  3300,  2121,   974,    15,  -647,  -974,  -988,  -767,  -417,
+      -49,   249,   421,   455,   372,   217,    44,  -103,  -192,  -214,  -180,  -109,
+      -29,    39,    80,    92,    78,    49,    15,   -12,   -29,   -33,   -28,   -17,
+       -6,     3,     8,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     7,     1,
+       -9,   -20,   -30,   -33,   -26,    -7,    23,    56,    83,    92,    74,    25,
+      -47,  -127,  -191,  -215,  -177,   -74,    82,   256,   399,   459,   395,   191,
+     -128,  -501,  -832, -1009,  -929,  -527,   208,  1220,  2390,  3552,  4529,  5162,
+     5342,  5050,  4323,  3286,  2106,   960,     5,  -654,  -976,  -986,  -763,  -413,
+      -45,   252,   423,   455,   371,   215,    42,  -104,  -192,  -214,  -179,  -108,
+      -28,    39,    81,    92,    78,    48,    15,   -12,   -29,   -33,   -28,   -17,
+       -6,     3,     8,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     7,     1,
+       -9,   -20,   -30,   -33,   -26,    -6,    23,    56,    83,    92,    73,    25,
+      -48,  -128,  -192,  -215,  -176,   -72,    84,   258,   400,   459,   393,   188,
+     -133,  -506,  -835, -1009,  -926,  -520,   219,  1234,  2404,  3566,  4539,  5167,
+     5345,  5043,  4311,  3272,  2091,   947,    -5,  -660,  -978,  -985,  -759,  -408,
+      -40,   255,   424,   455,   369,   213,    39,  -106,  -193,  -214,  -178,  -107,
+      -27,    40,    81,    92,    77,    48,    15,   -13,   -29,   -33,   -28,   -17,
+       -6,     3,     8,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     7,     1,
+       -9,   -20,   -30,   -33,   -26,    -6,    24,    57,    83,    92,    73,    24,
+      -49,  -129,  -193,  -215,  -176,   -71,    86,   260,   402,   459,   391,   185,
+     -137,  -511,  -839, -1010,  -923,  -513,   230,  1248,  2419,  3579,  4550,  5173,
+     5347,  5036,  4300,  3258,  2076,   933,   -15,  -666,  -980,  -983,  -756,  -403,
+      -36,   258,   425,   454,   367,   211,    37,  -107,  -194,  -214,  -177,  -106,
+      -26,    41,    81,    92,    77,    47,    14,   -13,   -29,   -33,   -28,   -17,
+       -6,     3,     8,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     7,     1,
+       -9,   -20,   -30,   -33,   -25,    -6,    24,    57,    84,    92,    72,    23,
+      -50,  -130,  -193,  -214,  -175,   -69,    88,   262,   403,   459,   390,   181,
+     -142,  -515,  -842, -1011,  -920,  -506,   242,  1262,  2434,  3593,  4560,  5178,
+     5341,  5030,  4289,  3243,  2061,   920,   -25,  -672,  -981,  -982,  -752,  -399,
+      -32,   261,   426,   454,   366,   209,    35,  -109,  -194,  -214,  -177,  -105,
+      -25,    41,    82,    92,    77,    47,    14,   -13,   -29,   -33,   -27,   -17,
+       -6,     3,     8,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     7,     1,
+       -9,   -21,   -30,   -33,   -25,    -5,    24,    58,    84,    92,    72,    22,
+      -51,  -131,  -194,  -214,  -174,   -67,    90,   264,   404,   459,   388,   178,
+     -146,  -520,  -845, -1012,  -917,  -498,   253,  1276,  2449,  3607,  4570,  5183,
+     5338,  5023,  4277,  3229,  2046,   907,   -35,  -678,  -983,  -980,  -748,  -394,
+      -27,   264,   428,   453,   364,   206,    33,  -110,  -195,  -213,  -176,  -104,
+      -24,    42,    82,    92,    76,    47,    13,   -13,   -29,   -33,   -27,   -17,
+       -5,     3,     8,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     7,     1,
+       -9,   -21,   -30,   -33,   -25,    -5,    25,    58,    84,    92,    72,    21,
+      -52,  -132,  -194,  -214,  -173,   -66,    93,   266,   406,   459,   386,   174,
+     -151,  -524,  -849, -1012,  -914,  -491,   264,  1290,  2464,  3620,  4580,  5188,
+     5339,  5016,  4266,  3215,  2031,   894,   -46,  -684,  -985,  -978,  -744,  -389,
+      -23,   267,   429,   453,   362,   204,    31,  -112,  -196,  -213,  -175,  -103,
+      -23,    43,    82,    92,    76,    46,    13,   -14,   -29,   -33,   -27,   -17,
+       -5,     3,     8,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     7,     0,
+       -9,   -21,   -30,   -33,   -25,    -5,    25,    58,    84,    91,    71,    21,
+      -53,  -133,  -195,  -214,  -172,   -64,    95,   268,   407,   459,   384,   171,
+     -155,  -529,  -852, -1013,  -911,  -483,   276,  1304,  2479,  3634,  4590,  5192,
+     5338,  5009,  4254,  3200,  2017,   880,   -55,  -690,  -987,  -977,  -740,  -384,
+      -19,   269,   430,   452,   361,   202,    29,  -113,  -196,  -213,  -174,  -102,
+      -22,    44,    83,    92,    76,    46,    13,   -14,   -29,   -33,   -27,   -16,
+       -5,     3,     8,     8,     7,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     6,     0,
+       -9,   -21,   -30,   -33,   -25,    -5,    26,    59,    84,    91,    71,    20,
+      -54,  -134,  -195,  -214,  -171,   -62,    97,   270,   408,   459,   383,   168,
+     -160,  -534,  -855, -1013,  -908,  -476,   287,  1318,  2494,  3647,  4600,  5197,
+     5343,  5002,  4242,  3186,  2002,   867,   -65,  -695,  -988,  -975,  -736,  -380,
+      -15,   272,   431,   452,   359,   200,    27,  -114,  -197,  -213,  -174,  -101,
+      -22,    44,    83,    91,    75,    45,    12,   -14,   -30,   -33,   -27,   -16,
+       -5,     3,     8,     8,     6,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     7,     9,     6,     0,
+      -10,   -21,   -30,   -33,   -25,    -4,    26,    59,    85,    91,    70,    19,
+      -55,  -135,  -196,  -214,  -170,   -60,    99,   272,   410,   459,   381,   164,
+     -165,  -538,  -858, -1014,  -904,  -468,   298,  1333,  2509,  3661,  4610,  5202,
+     5339,  4995,  4231,  3172,  1987,   854,   -75,  -701,  -990,  -973,  -732,  -375,
+      -10,   275,   432,   451,   357,   198,    25,  -116,  -197,  -213,  -173,  -100,
+      -21,    45,    83,    91,    75,    45,    12,   -15,   -30,   -33,   -27,   -16,
+       -5,     3,     8,     8,     6,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     9,     6,     0,
+      -10,   -21,   -30,   -33,   -24,    -4,    26,    59,    85,    91,    70,    18,
+      -56,  -135,  -196,  -214,  -169,   -59,   101,   274,   411,   459,   379,   160,
+     -169,  -543,  -862, -1014,  -901,  -461,   310,  1347,  2524,  3674,  4620,  5207,
+     5335,  4988,  4219,  3157,  1972,   841,   -85,  -707,  -991,  -971,  -728,  -370,
+       -6,   278,   433,   451,   356,   196,    23,  -117,  -198,  -213,  -172,   -99,
+      -20,    46,    83,    91,    75,    44,    12,   -15,   -30,   -33,   -27,   -16,
+       -5,     4,     8,     8,     6,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     9,     6,     0,
+      -10,   -21,   -30,   -33,   -24,    -4,    27,    60,    85,    91,    69,    17,
+      -57,  -136,  -197,  -214,  -168,   -57,   103,   276,   412,   459,   377,   157,
+     -174,  -547,  -865, -1015,  -898,  -453,   321,  1361,  2539,  3688,  4630,  5211,
+     5337,  4980,  4207,  3143,  1957,   828,   -95,  -712,  -993,  -969,  -724,  -366,
+       -2,   281,   434,   450,   354,   193,    21,  -119,  -199,  -212,  -171,   -98,
+      -19,    46,    84,    91,    75,    44,    11,   -15,   -30,   -33,   -27,   -16,
+       -5,     4,     8,     8,     6,     4,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     9,     6,     0,
+      -10,   -21,   -31,   -33,   -24,    -3,    27,    60,    85,    91,    69,    17,
+      -58,  -137,  -198,  -213,  -167,   -55,   106,   278,   413,   458,   375,   153,
+     -178,  -552,  -868, -1015,  -894,  -445,   333,  1375,  2554,  3701,  4639,  5216,
+     5335,  4973,  4195,  3128,  1942,   815,  -105,  -718,  -994,  -967,  -720,  -361,
+        2,   284,   435,   449,   352,   191,    19,  -120,  -199,  -212,  -171,   -97,
+      -18,    47,    84,    91,    74,    44,    11,   -15,   -30,   -33,   -26,   -16,
+       -5,     4,     8,     8,     6,     3,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     9,     6,     0,
+      -10,   -22,   -31,   -33,   -24,    -3,    28,    61,    86,    91,    68,    16,
+      -59,  -138,  -198,  -213,  -166,   -53,   108,   280,   415,   458,   373,   150,
+     -183,  -556,  -871, -1015,  -891,  -438,   344,  1389,  2569,  3715,  4649,  5220,
+     5331,  4966,  4183,  3114,  1928,   802,  -114,  -724,  -996,  -965,  -716,  -356,
+        6,   286,   436,   449,   351,   189,    17,  -121,  -200,  -212,  -170,   -96,
+      -17,    47,    84,    91,    74,    43,    10,   -16,   -30,   -33,   -26,   -15,
+       -4,     4,     8,     8,     6,     3,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     9,     6,     0,
+      -10,   -22,   -31,   -33,   -24,    -3,    28,    61,    86,    91,    68,    15,
+      -60,  -139,  -199,  -213,  -165,   -52,   110,   282,   416,   458,   371,   146,
+     -188,  -561,  -874, -1016,  -887,  -430,   356,  1403,  2584,  3728,  4659,  5224,
+     5333,  4958,  4171,  3099,  1913,   789,  -124,  -729,  -997,  -964,  -712,  -351,
+       10,   289,   437,   448,   349,   187,    15,  -123,  -200,  -212,  -169,   -95,
+      -16,    48,    85,    91,    74,    43,    10,   -16,   -30,   -33,   -26,   -15,
+       -4,     4,     8,     8,     6,     3,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     8,     6,     0,
+      -10,   -22,   -31,   -33,   -23,    -2,    28,    61,    86,    91,    67,    14,
+      -61,  -140,  -199,  -213,  -164,   -50,   112,   284,   417,   458,   369,   143,
+     -192,  -565,  -877, -1016,  -883,  -422,   368,  1418,  2599,  3741,  4668,  5229,
+     5325,  4951,  4159,  3085,  1898,   776,  -134,  -734,  -998,  -961,  -708,  -347,
+       15,   292,   438,   448,   347,   185,    13,  -124,  -201,  -211,  -168,   -94,
+      -15,    49,    85,    91,    73,    42,    10,   -16,   -30,   -33,   -26,   -15,
+       -4,     4,     8,     8,     6,     3,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     8,     6,     0,
+      -11,   -22,   -31,   -33,   -23,    -2,    29,    62,    86,    91,    67,    13,
+      -62,  -141,  -200,  -213,  -163,   -48,   114,   287,   418,   457,   367,   139,
+     -197,  -570,  -880, -1016,  -880,  -414,   380,  1432,  2613,  3755,  4678,  5233,
+     5331,  4943,  4147,  3070,  1883,   763,  -143,  -740, -1000,  -959,  -704,  -342,
+       19,   294,   439,   447,   345,   182,    11,  -126,  -201,  -211,  -168,   -93,
+      -14,    49,    85,    91,    73,    42,     9,   -16,   -30,   -33,   -26,   -15,
+       -4,     4,     8,     8,     6,     3,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     8,     6,    -1,
+      -11,   -22,   -31,   -33,   -23,    -2,    29,    62,    86,    91,    66,    12,
+      -63,  -142,  -200,  -212,  -162,   -46,   116,   289,   419,   457,   365,   135,
+     -201,  -574,  -883, -1016,  -876,  -406,   391,  1446,  2628,  3768,  4687,  5237,
+     5330,  4936,  4135,  3056,  1868,   750,  -153,  -745, -1001,  -957,  -700,  -337,
+       23,   297,   440,   446,   344,   180,     9,  -127,  -202,  -211,  -167,   -92,
+      -13,    50,    85,    91,    73,    42,     9,   -17,   -31,   -33,   -26,   -15,
+       -4,     4,     8,     8,     6,     3,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     8,     6,    -1,
+      -11,   -22,   -31,   -32,   -23,    -1,    30,    63,    87,    90,    66,    12,
+      -64,  -143,  -201,  -212,  -161,   -44,   119,   291,   420,   457,   363,   132,
+     -206,  -579,  -886, -1016,  -872,  -398,   403,  1461,  2643,  3781,  4697,  5241,
+     5321,  4928,  4123,  3041,  1854,   737,  -162,  -750, -1002,  -955,  -696,  -332,
+       27,   300,   441,   445,   342,   178,     7,  -128,  -202,  -211,  -166,   -91,
+      -12,    51,    86,    91,    72,    41,     8,   -17,   -31,   -33,   -26,   -15,
+       -4,     4,     8,     8,     6,     3,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     8,     6,    -1,
+      -11,   -22,   -31,   -32,   -23,    -1,    30,    63,    87,    90,    65,    11,
+      -65,  -144,  -201,  -212,  -160,   -43,   121,   293,   422,   457,   361,   128,
+     -211,  -583,  -889, -1016,  -868,  -390,   415,  1475,  2658,  3794,  4706,  5245,
+     5321,  4920,  4111,  3027,  1839,   724,  -171,  -756, -1003,  -953,  -691,  -328,
+       31,   302,   442,   445,   340,   176,     5,  -130,  -203,  -210,  -165,   -90,
+      -11,    51,    86,    91,    72,    41,     8,   -17,   -31,   -33,   -26,   -15,
+       -4,     4,     8,     8,     6,     3,     1,     0,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     8,     6,    -1,
+      -11,   -23,   -31,   -32,   -23,    -1,    31,    63,    87,    90,    65,    10,
+      -66,  -145,  -201,  -212,  -159,   -41,   123,   294,   423,   456,   359,   124,
+     -215,  -588,  -892, -1016,  -865,  -382,   427,  1489,  2673,  3807,  4716,  5249,
+     5321,  4913,  4099,  3012,  1824,   711,  -181,  -761, -1004,  -951,  -687,  -323,
+       35,   305,   443,   444,   338,   174,     3,  -131,  -203,  -210,  -164,   -89,
+      -10,    52,    86,    90,    72,    40,     8,   -17,   -31,   -32,   -26,   -14,
+       -4,     4,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     2,     5,     8,     8,     6,    -1,
+      -11,   -23,   -31,   -32,   -22,     0,    31,    64,    87,    90,    64,     9,
+      -67,  -146,  -202,  -212,  -158,   -39,   125,   296,   424,   456,   357,   121,
+     -220,  -592,  -895, -1016,  -861,  -374,   439,  1504,  2688,  3820,  4725,  5253,
+     5320,  4905,  4087,  2997,  1809,   698,  -190,  -766, -1005,  -949,  -683,  -318,
+       39,   308,   443,   443,   336,   171,     1,  -132,  -204,  -210,  -164,   -88,
+       -9,    53,    86,    90,    71,    40,     7,   -18,   -31,   -32,   -25,   -14,
+       -3,     4,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     3,     5,     8,     8,     6,    -1,
+      -11,   -23,   -31,   -32,   -22,     0,    31,    64,    87,    90,    64,     8,
+      -68,  -146,  -202,  -211,  -156,   -37,   127,   298,   425,   456,   355,   117,
+     -225,  -597,  -898, -1016,  -857,  -365,   451,  1518,  2703,  3834,  4734,  5257,
+     5313,  4897,  4074,  2983,  1795,   686,  -199,  -771, -1006,  -946,  -679,  -314,
+       43,   310,   444,   443,   335,   169,    -1,  -134,  -204,  -210,  -163,   -87,
+       -9,    53,    86,    90,    71,    39,     7,   -18,   -31,   -32,   -25,   -14,
+       -3,     4,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,     0,    -1,    -1,     0,     3,     5,     8,     8,     6,    -1,
+      -12,   -23,   -31,   -32,   -22,     1,    32,    64,    88,    90,    63,     7,
+      -69,  -147,  -203,  -211,  -155,   -35,   130,   300,   426,   455,   353,   113,
+     -229,  -601,  -901, -1016,  -853,  -357,   463,  1532,  2718,  3847,  4743,  5260,
+     5309,  4889,  4062,  2968,  1780,   673,  -209,  -776, -1007,  -944,  -675,  -309,
+       47,   313,   445,   442,   333,   167,    -3,  -135,  -205,  -209,  -162,   -86,
+       -8,    54,    87,    90,    71,    39,     7,   -18,   -31,   -32,   -25,   -14,
+       -3,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     0,     3,     5,     8,     8,     6,    -1,
+      -12,   -23,   -31,   -32,   -22,     1,    32,    65,    88,    90,    63,     7,
+      -70,  -148,  -203,  -211,  -154,   -33,   132,   302,   427,   455,   350,   109,
+     -234,  -606,  -903, -1016,  -849,  -349,   475,  1547,  2732,  3860,  4752,  5264,
+     5308,  4881,  4050,  2954,  1765,   660,  -218,  -781, -1008,  -942,  -670,  -304,
+       51,   315,   446,   441,   331,   165,    -5,  -136,  -205,  -209,  -161,   -85,
+       -7,    54,    87,    90,    70,    39,     6,   -18,   -31,   -32,   -25,   -14,
+       -3,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     0,     3,     5,     8,     8,     6,    -1,
+      -12,   -23,   -32,   -32,   -21,     1,    33,    65,    88,    89,    62,     6,
+      -71,  -149,  -204,  -210,  -153,   -32,   134,   304,   428,   454,   348,   106,
+     -239,  -610,  -906, -1016,  -844,  -340,   487,  1561,  2747,  3873,  4761,  5268,
+     5307,  4873,  4037,  2939,  1751,   648,  -227,  -786, -1009,  -940,  -666,  -299,
+       55,   318,   447,   440,   329,   163,    -7,  -137,  -206,  -209,  -160,   -84,
+       -6,    55,    87,    90,    70,    38,     6,   -19,   -31,   -32,   -25,   -14,
+       -3,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     0,     3,     5,     8,     8,     5,    -2,
+      -12,   -23,   -32,   -32,   -21,     2,    33,    66,    88,    89,    62,     5,
+      -72,  -150,  -204,  -210,  -152,   -30,   136,   306,   429,   454,   346,   102,
+     -243,  -614,  -909, -1015,  -840,  -332,   499,  1576,  2762,  3885,  4770,  5271,
+     5307,  4864,  4025,  2924,  1736,   635,  -236,  -791, -1010,  -937,  -662,  -295,
+       59,   320,   447,   439,   327,   160,    -9,  -139,  -206,  -208,  -159,   -83,
+       -5,    56,    87,    90,    70,    38,     6,   -19,   -31,   -32,   -25,   -14,
+       -3,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     0,     3,     6,     8,     8,     5,    -2,
+      -12,   -24,   -32,   -32,   -21,     2,    34,    66,    88,    89,    61,     4,
+      -73,  -151,  -205,  -210,  -151,   -28,   138,   308,   430,   453,   344,    98,
+     -248,  -619,  -912, -1015,  -836,  -324,   511,  1590,  2777,  3898,  4779,  5274,
+     5310,  4856,  4012,  2910,  1721,   623,  -245,  -795, -1011,  -935,  -658,  -290,
+       63,   323,   448,   438,   325,   158,   -11,  -140,  -207,  -208,  -159,   -82,
+       -4,    56,    88,    90,    69,    37,     5,   -19,   -31,   -32,   -25,   -13,
+       -3,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     0,     3,     6,     8,     8,     5,    -2,
+      -12,   -24,   -32,   -32,   -21,     2,    34,    66,    88,    89,    61,     3,
+      -74,  -152,  -205,  -209,  -150,   -26,   141,   310,   431,   453,   342,    94,
+     -253,  -623,  -914, -1015,  -832,  -315,   523,  1605,  2792,  3911,  4788,  5278,
+     5299,  4848,  4000,  2895,  1707,   610,  -254,  -800, -1011,  -932,  -653,  -285,
+       67,   325,   449,   438,   323,   156,   -13,  -141,  -207,  -208,  -158,   -81,
+       -3,    57,    88,    89,    69,    37,     5,   -19,   -31,   -32,   -25,   -13,
+       -3,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -2,
+      -12,   -24,   -32,   -32,   -21,     3,    34,    67,    89,    89,    60,     2,
+      -75,  -153,  -205,  -209,  -148,   -24,   143,   312,   432,   452,   339,    90,
+     -257,  -628,  -917, -1014,  -827,  -306,   536,  1619,  2806,  3924,  4797,  5281,
+     5298,  4839,  3987,  2880,  1692,   598,  -263,  -805, -1012,  -930,  -649,  -281,
+       71,   327,   449,   437,   322,   154,   -15,  -142,  -207,  -207,  -157,   -80,
+       -2,    57,    88,    89,    68,    36,     4,   -20,   -32,   -32,   -24,   -13,
+       -2,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -2,
+      -13,   -24,   -32,   -32,   -20,     3,    35,    67,    89,    89,    60,     1,
+      -76,  -153,  -206,  -209,  -147,   -22,   145,   314,   433,   452,   337,    87,
+     -262,  -632,  -920, -1014,  -823,  -298,   548,  1634,  2821,  3937,  4805,  5284,
+     5291,  4831,  3975,  2865,  1678,   585,  -272,  -809, -1012,  -927,  -645,  -276,
+       75,   330,   450,   436,   320,   152,   -16,  -144,  -208,  -207,  -156,   -79,
+       -1,    58,    88,    89,    68,    36,     4,   -20,   -32,   -32,   -24,   -13,
+       -2,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -2,
+      -13,   -24,   -32,   -32,   -20,     3,    35,    67,    89,    89,    59,     0,
+      -77,  -154,  -206,  -208,  -146,   -20,   147,   316,   434,   451,   335,    83,
+     -267,  -636,  -922, -1014,  -818,  -289,   560,  1648,  2836,  3949,  4814,  5287,
+     5290,  4822,  3962,  2851,  1663,   573,  -280,  -814, -1013,  -925,  -641,  -271,
+       79,   332,   451,   435,   318,   149,   -18,  -145,  -208,  -207,  -155,   -78,
+        0,    58,    88,    89,    68,    36,     4,   -20,   -32,   -32,   -24,   -13,
+       -2,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -2,
+      -13,   -24,   -32,   -32,   -20,     4,    36,    68,    89,    88,    58,     0,
+      -78,  -155,  -207,  -208,  -145,   -18,   149,   318,   435,   451,   332,    79,
+     -271,  -641,  -925, -1013,  -814,  -280,   573,  1663,  2851,  3962,  4822,  5290,
+     5287,  4814,  3949,  2836,  1648,   560,  -289,  -818, -1014,  -922,  -636,  -267,
+       83,   335,   451,   434,   316,   147,   -20,  -146,  -208,  -206,  -154,   -77,
+        0,    59,    89,    89,    67,    35,     3,   -20,   -32,   -32,   -24,   -13,
+       -2,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -2,
+      -13,   -24,   -32,   -32,   -20,     4,    36,    68,    89,    88,    58,    -1,
+      -79,  -156,  -207,  -208,  -144,   -16,   152,   320,   436,   450,   330,    75,
+     -276,  -645,  -927, -1012,  -809,  -272,   585,  1678,  2865,  3975,  4831,  5293,
+     5282,  4805,  3937,  2821,  1634,   548,  -298,  -823, -1014,  -920,  -632,  -262,
+       87,   337,   452,   433,   314,   145,   -22,  -147,  -209,  -206,  -153,   -76,
+        1,    60,    89,    89,    67,    35,     3,   -20,   -32,   -32,   -24,   -13,
+       -2,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -2,
+      -13,   -24,   -32,   -32,   -20,     4,    36,    68,    89,    88,    57,    -2,
+      -80,  -157,  -207,  -207,  -142,   -15,   154,   322,   437,   449,   327,    71,
+     -281,  -649,  -930, -1012,  -805,  -263,   598,  1692,  2880,  3987,  4839,  5296,
+     5283,  4797,  3924,  2806,  1619,   536,  -306,  -827, -1014,  -917,  -628,  -257,
+       90,   339,   452,   432,   312,   143,   -24,  -148,  -209,  -205,  -153,   -75,
+        2,    60,    89,    89,    67,    34,     3,   -21,   -32,   -32,   -24,   -12,
+       -2,     5,     8,     8,     6,     3,     1,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -3,
+      -13,   -25,   -32,   -31,   -19,     5,    37,    69,    89,    88,    57,    -3,
+      -81,  -158,  -208,  -207,  -141,   -13,   156,   323,   438,   449,   325,    67,
+     -285,  -653,  -932, -1011,  -800,  -254,   610,  1707,  2895,  4000,  4848,  5299,
+     5278,  4788,  3911,  2792,  1605,   523,  -315,  -832, -1015,  -914,  -623,  -253,
+       94,   342,   453,   431,   310,   141,   -26,  -150,  -209,  -205,  -152,   -74,
+        3,    61,    89,    88,    66,    34,     2,   -21,   -32,   -32,   -24,   -12,
+       -2,     5,     8,     8,     6,     3,     0,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -3,
+      -13,   -25,   -32,   -31,   -19,     5,    37,    69,    90,    88,    56,    -4,
+      -82,  -159,  -208,  -207,  -140,   -11,   158,   325,   438,   448,   323,    63,
+     -290,  -658,  -935, -1011,  -795,  -245,   623,  1721,  2910,  4012,  4856,  5302,
+     5282,  4779,  3898,  2777,  1590,   511,  -324,  -836, -1015,  -912,  -619,  -248,
+       98,   344,   453,   430,   308,   138,   -28,  -151,  -210,  -205,  -151,   -73,
+        4,    61,    89,    88,    66,    34,     2,   -21,   -32,   -32,   -24,   -12,
+       -2,     5,     8,     8,     6,     3,     0,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -3,
+      -14,   -25,   -32,   -31,   -19,     6,    38,    70,    90,    87,    56,    -5,
+      -83,  -159,  -208,  -206,  -139,    -9,   160,   327,   439,   447,   320,    59,
+     -295,  -662,  -937, -1010,  -791,  -236,   635,  1736,  2924,  4025,  4864,  5304,
+     5274,  4770,  3885,  2762,  1576,   499,  -332,  -840, -1015,  -909,  -614,  -243,
+      102,   346,   454,   429,   306,   136,   -30,  -152,  -210,  -204,  -150,   -72,
+        5,    62,    89,    88,    66,    33,     2,   -21,   -32,   -32,   -23,   -12,
+       -2,     5,     8,     8,     5,     3,     0,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -3,
+      -14,   -25,   -32,   -31,   -19,     6,    38,    70,    90,    87,    55,    -6,
+      -84,  -160,  -209,  -206,  -137,    -7,   163,   329,   440,   447,   318,    55,
+     -299,  -666,  -940, -1009,  -786,  -227,   648,  1751,  2939,  4037,  4873,  5307,
+     5268,  4761,  3873,  2747,  1561,   487,  -340,  -844, -1016,  -906,  -610,  -239,
+      106,   348,   454,   428,   304,   134,   -32,  -153,  -210,  -204,  -149,   -71,
+        6,    62,    89,    88,    65,    33,     1,   -21,   -32,   -32,   -23,   -12,
+       -1,     6,     8,     8,     5,     3,     0,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -3,
+      -14,   -25,   -32,   -31,   -18,     6,    39,    70,    90,    87,    54,    -7,
+      -85,  -161,  -209,  -205,  -136,    -5,   165,   331,   441,   446,   315,    51,
+     -304,  -670,  -942, -1008,  -781,  -218,   660,  1765,  2954,  4050,  4881,  5309,
+     5263,  4752,  3860,  2732,  1547,   475,  -349,  -849, -1016,  -903,  -606,  -234,
+      109,   350,   455,   427,   302,   132,   -33,  -154,  -211,  -203,  -148,   -70,
+        7,    63,    90,    88,    65,    32,     1,   -22,   -32,   -31,   -23,   -12,
+       -1,     6,     8,     8,     5,     3,     0,    -1,    -1,    -1,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     5,    -3,
+      -14,   -25,   -32,   -31,   -18,     7,    39,    71,    90,    87,    54,    -8,
+      -86,  -162,  -209,  -205,  -135,    -3,   167,   333,   442,   445,   313,    47,
+     -309,  -675,  -944, -1007,  -776,  -209,   673,  1780,  2968,  4062,  4889,  5312,
+     5257,  4743,  3847,  2718,  1532,   463,  -357,  -853, -1016,  -901,  -601,  -229,
+      113,   353,   455,   426,   300,   130,   -35,  -155,  -211,  -203,  -147,   -69,
+        7,    63,    90,    88,    64,    32,     1,   -22,   -32,   -31,   -23,   -12,
+       -1,     6,     8,     8,     5,     3,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     4,    -3,
+      -14,   -25,   -32,   -31,   -18,     7,    39,    71,    90,    86,    53,    -9,
+      -87,  -163,  -210,  -204,  -134,    -1,   169,   335,   443,   444,   310,    43,
+     -314,  -679,  -946, -1006,  -771,  -199,   686,  1795,  2983,  4074,  4897,  5314,
+     5256,  4734,  3834,  2703,  1518,   451,  -365,  -857, -1016,  -898,  -597,  -225,
+      117,   355,   456,   425,   298,   127,   -37,  -156,  -211,  -202,  -146,   -68,
+        8,    64,    90,    87,    64,    31,     0,   -22,   -32,   -31,   -23,   -11,
+       -1,     6,     8,     8,     5,     3,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     4,    -3,
+      -14,   -25,   -32,   -31,   -18,     7,    40,    71,    90,    86,    53,    -9,
+      -88,  -164,  -210,  -204,  -132,     1,   171,   336,   443,   443,   308,    39,
+     -318,  -683,  -949, -1005,  -766,  -190,   698,  1809,  2997,  4087,  4905,  5316,
+     5257,  4725,  3820,  2688,  1504,   439,  -374,  -861, -1016,  -895,  -592,  -220,
+      121,   357,   456,   424,   296,   125,   -39,  -158,  -212,  -202,  -146,   -67,
+        9,    64,    90,    87,    64,    31,     0,   -22,   -32,   -31,   -23,   -11,
+       -1,     6,     8,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,    -1,     1,     3,     6,     8,     8,     4,    -4,
+      -14,   -26,   -32,   -31,   -17,     8,    40,    72,    90,    86,    52,   -10,
+      -89,  -164,  -210,  -203,  -131,     3,   174,   338,   444,   443,   305,    35,
+     -323,  -687,  -951, -1004,  -761,  -181,   711,  1824,  3012,  4099,  4913,  5319,
+     5251,  4716,  3807,  2673,  1489,   427,  -382,  -865, -1016,  -892,  -588,  -215,
+      124,   359,   456,   423,   294,   123,   -41,  -159,  -212,  -201,  -145,   -66,
+       10,    65,    90,    87,    63,    31,    -1,   -23,   -32,   -31,   -23,   -11,
+       -1,     6,     8,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     3,     6,     8,     8,     4,    -4,
+      -15,   -26,   -33,   -31,   -17,     8,    41,    72,    91,    86,    51,   -11,
+      -90,  -165,  -210,  -203,  -130,     5,   176,   340,   445,   442,   302,    31,
+     -328,  -691,  -953, -1003,  -756,  -171,   724,  1839,  3027,  4111,  4920,  5321,
+     5245,  4706,  3794,  2658,  1475,   415,  -390,  -868, -1016,  -889,  -583,  -211,
+      128,   361,   457,   422,   293,   121,   -43,  -160,  -212,  -201,  -144,   -65,
+       11,    65,    90,    87,    63,    30,    -1,   -23,   -32,   -31,   -22,   -11,
+       -1,     6,     8,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     3,     6,     8,     8,     4,    -4,
+      -15,   -26,   -33,   -31,   -17,     8,    41,    72,    91,    86,    51,   -12,
+      -91,  -166,  -211,  -202,  -128,     7,   178,   342,   445,   441,   300,    27,
+     -332,  -696,  -955, -1002,  -750,  -162,   737,  1854,  3041,  4123,  4928,  5323,
+     5239,  4697,  3781,  2643,  1461,   403,  -398,  -872, -1016,  -886,  -579,  -206,
+      132,   363,   457,   420,   291,   119,   -44,  -161,  -212,  -201,  -143,   -64,
+       12,    66,    90,    87,    63,    30,    -1,   -23,   -32,   -31,   -22,   -11,
+       -1,     6,     8,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     3,     6,     8,     8,     4,    -4,
+      -15,   -26,   -33,   -31,   -17,     9,    42,    73,    91,    85,    50,   -13,
+      -92,  -167,  -211,  -202,  -127,     9,   180,   344,   446,   440,   297,    23,
+     -337,  -700,  -957, -1001,  -745,  -153,   750,  1868,  3056,  4135,  4936,  5325,
+     5242,  4687,  3768,  2628,  1446,   391,  -406,  -876, -1016,  -883,  -574,  -201,
+      135,   365,   457,   419,   289,   116,   -46,  -162,  -212,  -200,  -142,   -63,
+       12,    66,    91,    86,    62,    29,    -2,   -23,   -33,   -31,   -22,   -11,
+       -1,     6,     8,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     3,     6,     8,     8,     4,    -4,
+      -15,   -26,   -33,   -30,   -16,     9,    42,    73,    91,    85,    49,   -14,
+      -93,  -168,  -211,  -201,  -126,    11,   182,   345,   447,   439,   294,    19,
+     -342,  -704,  -959, -1000,  -740,  -143,   763,  1883,  3070,  4147,  4943,  5327,
+     5237,  4678,  3755,  2613,  1432,   380,  -414,  -880, -1016,  -880,  -570,  -197,
+      139,   367,   457,   418,   287,   114,   -48,  -163,  -213,  -200,  -141,   -62,
+       13,    67,    91,    86,    62,    29,    -2,   -23,   -33,   -31,   -22,   -11,
+        0,     6,     8,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     3,     6,     8,     8,     4,    -4,
+      -15,   -26,   -33,   -30,   -16,    10,    42,    73,    91,    85,    49,   -15,
+      -94,  -168,  -211,  -201,  -124,    13,   185,   347,   448,   438,   292,    15,
+     -347,  -708,  -961,  -998,  -734,  -134,   776,  1898,  3085,  4159,  4951,  5329,
+     5225,  4668,  3741,  2599,  1418,   368,  -422,  -883, -1016,  -877,  -565,  -192,
+      143,   369,   458,   417,   284,   112,   -50,  -164,  -213,  -199,  -140,   -61,
+       14,    67,    91,    86,    61,    28,    -2,   -23,   -33,   -31,   -22,   -10,
+        0,     6,     8,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     3,     6,     8,     8,     4,    -4,
+      -15,   -26,   -33,   -30,   -16,    10,    43,    74,    91,    85,    48,   -16,
+      -95,  -169,  -212,  -200,  -123,    15,   187,   349,   448,   437,   289,    10,
+     -351,  -712,  -964,  -997,  -729,  -124,   789,  1913,  3099,  4171,  4958,  5330,
+     5227,  4659,  3728,  2584,  1403,   356,  -430,  -887, -1016,  -874,  -561,  -188,
+      146,   371,   458,   416,   282,   110,   -52,  -165,  -213,  -199,  -139,   -60,
+       15,    68,    91,    86,    61,    28,    -3,   -24,   -33,   -31,   -22,   -10,
+        0,     6,     9,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     3,     6,     8,     8,     4,    -4,
+      -15,   -26,   -33,   -30,   -16,    10,    43,    74,    91,    84,    47,   -17,
+      -96,  -170,  -212,  -200,  -121,    17,   189,   351,   449,   436,   286,     6,
+     -356,  -716,  -965,  -996,  -724,  -114,   802,  1928,  3114,  4183,  4966,  5332,
+     5219,  4649,  3715,  2569,  1389,   344,  -438,  -891, -1015,  -871,  -556,  -183,
+      150,   373,   458,   415,   280,   108,   -53,  -166,  -213,  -198,  -138,   -59,
+       16,    68,    91,    86,    61,    28,    -3,   -24,   -33,   -31,   -22,   -10,
+        0,     6,     9,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     3,     6,     8,     8,     4,    -5,
+      -16,   -26,   -33,   -30,   -15,    11,    44,    74,    91,    84,    47,   -18,
+      -97,  -171,  -212,  -199,  -120,    19,   191,   352,   449,   435,   284,     2,
+     -361,  -720,  -967,  -994,  -718,  -105,   815,  1942,  3128,  4195,  4973,  5334,
+     5217,  4639,  3701,  2554,  1375,   333,  -445,  -894, -1015,  -868,  -552,  -178,
+      153,   375,   458,   413,   278,   106,   -55,  -167,  -213,  -198,  -137,   -58,
+       17,    69,    91,    85,    60,    27,    -3,   -24,   -33,   -31,   -21,   -10,
+        0,     6,     9,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     6,     8,     8,     4,    -5,
+      -16,   -27,   -33,   -30,   -15,    11,    44,    75,    91,    84,    46,   -19,
+      -98,  -171,  -212,  -199,  -119,    21,   193,   354,   450,   434,   281,    -2,
+     -366,  -724,  -969,  -993,  -712,   -95,   828,  1957,  3143,  4207,  4980,  5335,
+     5213,  4630,  3688,  2539,  1361,   321,  -453,  -898, -1015,  -865,  -547,  -174,
+      157,   377,   459,   412,   276,   103,   -57,  -168,  -214,  -197,  -136,   -57,
+       17,    69,    91,    85,    60,    27,    -4,   -24,   -33,   -30,   -21,   -10,
+        0,     6,     9,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     6,     8,     8,     4,    -5,
+      -16,   -27,   -33,   -30,   -15,    12,    44,    75,    91,    83,    46,   -20,
+      -99,  -172,  -213,  -198,  -117,    23,   196,   356,   451,   433,   278,    -6,
+     -370,  -728,  -971,  -991,  -707,   -85,   841,  1972,  3157,  4219,  4988,  5337,
+     5205,  4620,  3674,  2524,  1347,   310,  -461,  -901, -1014,  -862,  -543,  -169,
+      160,   379,   459,   411,   274,   101,   -59,  -169,  -214,  -196,  -135,   -56,
+       18,    70,    91,    85,    59,    26,    -4,   -24,   -33,   -30,   -21,   -10,
+        0,     6,     9,     8,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     6,     8,     8,     3,    -5,
+      -16,   -27,   -33,   -30,   -15,    12,    45,    75,    91,    83,    45,   -21,
+     -100,  -173,  -213,  -197,  -116,    25,   198,   357,   451,   432,   275,   -10,
+     -375,  -732,  -973,  -990,  -701,   -75,   854,  1987,  3172,  4231,  4995,  5338,
+     5203,  4610,  3661,  2509,  1333,   298,  -468,  -904, -1014,  -858,  -538,  -165,
+      164,   381,   459,   410,   272,    99,   -60,  -170,  -214,  -196,  -135,   -55,
+       19,    70,    91,    85,    59,    26,    -4,   -25,   -33,   -30,   -21,   -10,
+        0,     6,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     6,     8,     8,     3,    -5,
+      -16,   -27,   -33,   -30,   -14,    12,    45,    75,    91,    83,    44,   -22,
+     -101,  -174,  -213,  -197,  -114,    27,   200,   359,   452,   431,   272,   -15,
+     -380,  -736,  -975,  -988,  -695,   -65,   867,  2002,  3186,  4242,  5002,  5339,
+     5201,  4600,  3647,  2494,  1318,   287,  -476,  -908, -1013,  -855,  -534,  -160,
+      168,   383,   459,   408,   270,    97,   -62,  -171,  -214,  -195,  -134,   -54,
+       20,    71,    91,    84,    59,    26,    -5,   -25,   -33,   -30,   -21,    -9,
+        0,     6,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     8,     3,    -5,
+      -16,   -27,   -33,   -29,   -14,    13,    46,    76,    92,    83,    44,   -22,
+     -102,  -174,  -213,  -196,  -113,    29,   202,   361,   452,   430,   269,   -19,
+     -384,  -740,  -977,  -987,  -690,   -55,   880,  2017,  3200,  4254,  5009,  5340,
+     5190,  4590,  3634,  2479,  1304,   276,  -483,  -911, -1013,  -852,  -529,  -155,
+      171,   384,   459,   407,   268,    95,   -64,  -172,  -214,  -195,  -133,   -53,
+       21,    71,    91,    84,    58,    25,    -5,   -25,   -33,   -30,   -21,    -9,
+        0,     7,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     8,     3,    -5,
+      -17,   -27,   -33,   -29,   -14,    13,    46,    76,    92,    82,    43,   -23,
+     -103,  -175,  -213,  -196,  -112,    31,   204,   362,   453,   429,   267,   -23,
+     -389,  -744,  -978,  -985,  -684,   -46,   894,  2031,  3215,  4266,  5016,  5342,
+     5185,  4580,  3620,  2464,  1290,   264,  -491,  -914, -1012,  -849,  -524,  -151,
+      174,   386,   459,   406,   266,    93,   -66,  -173,  -214,  -194,  -132,   -52,
+       21,    72,    92,    84,    58,    25,    -5,   -25,   -33,   -30,   -21,    -9,
+        1,     7,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     8,     3,    -5,
+      -17,   -27,   -33,   -29,   -13,    13,    47,    76,    92,    82,    42,   -24,
+     -104,  -176,  -213,  -195,  -110,    33,   206,   364,   453,   428,   264,   -27,
+     -394,  -748,  -980,  -983,  -678,   -35,   907,  2046,  3229,  4277,  5023,  5343,
+     5178,  4570,  3607,  2449,  1276,   253,  -498,  -917, -1012,  -845,  -520,  -146,
+      178,   388,   459,   404,   264,    90,   -67,  -174,  -214,  -194,  -131,   -51,
+       22,    72,    92,    84,    58,    24,    -5,   -25,   -33,   -30,   -21,    -9,
+        1,     7,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     8,     3,    -6,
+      -17,   -27,   -33,   -29,   -13,    14,    47,    77,    92,    82,    41,   -25,
+     -105,  -177,  -214,  -194,  -109,    35,   209,   366,   454,   426,   261,   -32,
+     -399,  -752,  -982,  -981,  -672,   -25,   920,  2061,  3243,  4289,  5030,  5344,
+     5175,  4560,  3593,  2434,  1262,   242,  -506,  -920, -1011,  -842,  -515,  -142,
+      181,   390,   459,   403,   262,    88,   -69,  -175,  -214,  -193,  -130,   -50,
+       23,    72,    92,    84,    57,    24,    -6,   -25,   -33,   -30,   -20,    -9,
+        1,     7,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     8,     3,    -6,
+      -17,   -28,   -33,   -29,   -13,    14,    47,    77,    92,    81,    41,   -26,
+     -106,  -177,  -214,  -194,  -107,    37,   211,   367,   454,   425,   258,   -36,
+     -403,  -756,  -983,  -980,  -666,   -15,   933,  2076,  3258,  4300,  5036,  5345,
+     5175,  4550,  3579,  2419,  1248,   230,  -513,  -923, -1010,  -839,  -511,  -137,
+      185,   391,   459,   402,   260,    86,   -71,  -176,  -215,  -193,  -129,   -49,
+       24,    73,    92,    83,    57,    24,    -6,   -26,   -33,   -30,   -20,    -9,
+        1,     7,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     8,     3,    -6,
+      -17,   -28,   -33,   -29,   -13,    15,    48,    77,    92,    81,    40,   -27,
+     -107,  -178,  -214,  -193,  -106,    39,   213,   369,   455,   424,   255,   -40,
+     -408,  -759,  -985,  -978,  -660,    -5,   947,  2091,  3272,  4311,  5043,  5345,
+     5167,  4539,  3566,  2404,  1234,   219,  -520,  -926, -1009,  -835,  -506,  -133,
+      188,   393,   459,   400,   258,    84,   -72,  -176,  -215,  -192,  -128,   -48,
+       25,    73,    92,    83,    56,    23,    -6,   -26,   -33,   -30,   -20,    -9,
+        1,     7,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     8,     3,    -6,
+      -17,   -28,   -33,   -29,   -12,    15,    48,    78,    92,    81,    39,   -28,
+     -108,  -179,  -214,  -192,  -104,    42,   215,   371,   455,   423,   252,   -45,
+     -413,  -763,  -986,  -976,  -654,     5,   960,  2106,  3286,  4323,  5050,  5346,
+     5158,  4529,  3552,  2390,  1220,   208,  -527,  -929, -1009,  -832,  -501,  -128,
+      191,   395,   459,   399,   256,    82,   -74,  -177,  -215,  -191,  -127,   -47,
+       25,    74,    92,    83,    56,    23,    -7,   -26,   -33,   -30,   -20,    -9,
+        1,     7,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     8,     3,    -6,
+      -17,   -28,   -33,   -29,   -12,    15,    49,    78,    92,    80,    39,   -29,
+     -109,  -180,  -214,  -192,  -103,    44,   217,   372,   455,   421,   249,   -49,
+     -417,  -767,  -988,  -974,  -647,    15,   974,  2121,  3300,  4334,  5056,  5347,
+     5155,  4519,  3538,  2375,  1206,   197,  -534,  -932, -1008,  -829,  -497,  -124,
+      195,   397,   459,   398,   254,    80,   -76,  -178,  -215,  -191,  -126,   -46,
+       26,    74,    92,    83,    56,    22,    -7,   -26,   -33,   -30,   -20,    -8,
+        1,     7,     9,     7,     5,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     7,     3,    -6,
+      -18,   -28,   -33,   -28,   -12,    16,    49,    78,    92,    80,    38,   -30,
+     -110,  -180,  -214,  -191,  -101,    46,   219,   374,   456,   420,   246,   -53,
+     -422,  -771,  -989,  -972,  -641,    26,   987,  2136,  3315,  4345,  5063,  5347,
+     5151,  4508,  3524,  2360,  1192,   186,  -542,  -935, -1007,  -825,  -492,  -119,
+      198,   398,   459,   396,   251,    77,   -77,  -179,  -215,  -190,  -125,   -45,
+       27,    74,    92,    82,    55,    22,    -7,   -26,   -33,   -29,   -20,    -8,
+        1,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     7,     3,    -6,
+      -18,   -28,   -33,   -28,   -12,    16,    49,    79,    92,    80,    37,   -31,
+     -111,  -181,  -214,  -190,  -100,    48,   222,   375,   456,   419,   243,   -58,
+     -427,  -775,  -991,  -970,  -635,    36,  1001,  2151,  3329,  4357,  5069,  5348,
+     5148,  4498,  3511,  2345,  1178,   175,  -549,  -938, -1006,  -822,  -488,  -115,
+      201,   400,   459,   395,   249,    75,   -79,  -180,  -215,  -190,  -124,   -44,
+       28,    75,    92,    82,    55,    21,    -8,   -26,   -33,   -29,   -20,    -8,
+        1,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     7,     2,    -6,
+      -18,   -28,   -33,   -28,   -11,    17,    50,    79,    92,    79,    37,   -32,
+     -112,  -182,  -214,  -189,   -98,    50,   224,   377,   456,   418,   240,   -62,
+     -431,  -778,  -992,  -968,  -629,    46,  1014,  2165,  3343,  4368,  5075,  5348,
+     5142,  4487,  3497,  2330,  1165,   164,  -556,  -941, -1005,  -818,  -483,  -110,
+      205,   401,   459,   393,   247,    73,   -81,  -181,  -215,  -189,  -123,   -43,
+       28,    75,    92,    82,    54,    21,    -8,   -27,   -33,   -29,   -19,    -8,
+        1,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     8,     7,     2,    -7,
+      -18,   -28,   -33,   -28,   -11,    17,    50,    79,    92,    79,    36,   -33,
+     -113,  -182,  -215,  -189,   -97,    52,   226,   379,   457,   416,   237,   -66,
+     -436,  -782,  -994,  -965,  -622,    57,  1028,  2180,  3357,  4379,  5082,  5349,
+     5131,  4477,  3483,  2315,  1151,   153,  -562,  -943, -1004,  -815,  -478,  -106,
+      208,   403,   459,   392,   245,    71,   -82,  -182,  -215,  -188,  -122,   -42,
+       29,    76,    92,    82,    54,    21,    -8,   -27,   -33,   -29,   -19,    -8,
+        2,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     1,     4,     7,     9,     7,     2,    -7,
+      -18,   -28,   -33,   -28,   -11,    17,    51,    79,    92,    79,    35,   -34,
+     -114,  -183,  -215,  -188,   -95,    54,   228,   380,   457,   415,   234,   -71,
+     -441,  -786,  -995,  -963,  -616,    67,  1041,  2195,  3371,  4390,  5088,  5349,
+     5131,  4466,  3469,  2300,  1137,   142,  -569,  -946, -1003,  -811,  -474,  -101,
+      211,   405,   459,   391,   243,    69,   -84,  -183,  -215,  -188,  -121,   -41,
+       30,    76,    92,    81,    54,    20,    -9,   -27,   -33,   -29,   -19,    -8,
+        2,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     2,    -7,
+      -18,   -28,   -33,   -28,   -10,    18,    51,    80,    92,    78,    34,   -35,
+     -115,  -184,  -215,  -187,   -93,    56,   230,   382,   457,   413,   230,   -75,
+     -446,  -789,  -996,  -961,  -609,    78,  1055,  2210,  3385,  4401,  5094,  5349,
+     5124,  4455,  3455,  2285,  1123,   131,  -576,  -949, -1002,  -808,  -469,   -97,
+      215,   406,   458,   389,   241,    67,   -85,  -183,  -215,  -187,  -120,   -40,
+       31,    76,    92,    81,    53,    20,    -9,   -27,   -33,   -29,   -19,    -8,
+        2,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     2,    -7,
+      -18,   -29,   -33,   -28,   -10,    18,    51,    80,    92,    78,    34,   -36,
+     -116,  -184,  -215,  -186,   -92,    58,   232,   383,   458,   412,   227,   -79,
+     -450,  -793,  -998,  -958,  -603,    89,  1068,  2225,  3399,  4412,  5100,  5349,
+     5115,  4444,  3441,  2270,  1110,   121,  -583,  -951, -1001,  -804,  -464,   -93,
+      218,   408,   458,   388,   239,    65,   -87,  -184,  -215,  -186,  -119,   -39,
+       31,    77,    92,    81,    53,    19,    -9,   -27,   -33,   -29,   -19,    -7,
+        2,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,     0,
+        0,     0,    -1,    -1,     0,     2,     4,     7,     9,     7,     2,    -7,
+      -19,   -29,   -33,   -28,   -10,    19,    52,    80,    92,    78,    33,   -37,
+     -117,  -185,  -215,  -186,   -90,    60,   235,   385,   458,   411,   224,   -84,
+     -455,  -797,  -999,  -956,  -596,    99,  1082,  2240,  3413,  4423,  5106,  5350,
+     5114,  4434,  3427,  2255,  1096,   110,  -590,  -954, -1000,  -800,  -460,   -88,
+      221,   409,   458,   386,   237,    62,   -89,  -185,  -215,  -186,  -118,   -38,
+       32,    77,    92,    80,    52,    19,   -10,   -27,   -33,   -29,   -19,    -7,
+        2,     7,     9,     7,     4,     2,     0,    -1,    -1,     0,     0,     0,
+};
+
+/* 96 taps per branch: 88200 to 22050 Hz */
+const int16_t audio_src_coef_1_4[48] =
+{
+        0,     0,     0,     0,    -1,    -2,    -3,    -2,     3,     8,    12,    10,
+       -1,   -17,   -30,   -31,   -12,    22,    57,    71,    48,   -12,   -85,  -134,
+     -121,   -35,    99,   217,   246,   146,   -66,  -300,  -432,  -359,   -65,   349,
+      686,   739,   390,  -292, -1045, -1477, -1219,   -88,  1805,  4046,  6043,  7216,
+};
+
+/* 48 taps per branch: 88200 to 48000 Hz */
+const int16_t audio_src_coef_80_147[3840] =
+{
+        0,    -1,     2,     6,    -9,   -20,    21,    50,   -42,  -106,    73,   203,
+     -114,  -362,   163,   615,  -216, -1021,   270,  1724,  -321, -3252,   375, 10414,
+    16050, 10289,   275, -3243,  -275,  1724,   244, -1023,  -200,   617,   153,  -364,
+     -108,   204,    70,  -106,   -41,    50,    21,   -20,    -8,     6,     2,    -1,
+        0,    -1,     2,     6,    -9,   -20,    22,    49,   -44,  -105,    76,   202,
+     -119,  -361,   172,   613,  -232, -1020,   296,  1724,  -366, -3260,   475, 10538,
+    16050, 10164,   177, -3233,  -230,  1723,   218, -1024,  -184,   618,   143,  -365,
+     -102,   205,    67,  -107,   -39,    50,    20,   -20,    -8,     6,     2,    -1,
+        0,    -1,     2,     6,    -9,   -19,    23,    49,   -46,  -104,    79,   201,
+     -125,  -359,   182,   611,  -248, -1017,   323,  1723,  -412, -3267,   577, 10662,
+    16042, 10038,    80, -3221,  -185,  1721,   192, -1024,  -169,   619,   134,  -366,
+      -97,   206,    64,  -107,   -38,    50,    19,   -20,    -8,     6,     2,    -1,
+        0,    -1,     2,     6,    -9,   -19,    24,    48,   -47,  -104,    82,   199,
+     -131,  -357,   191,   609,  -264, -1015,   349,  1722,  -459, -3273,   680, 10784,
+    16038,  9911,   -16, -3209,  -140,  1719,   166, -1024,  -153,   620,   124,  -367,
+      -91,   206,    61,  -108,   -36,    51,    18,   -20,    -7,     6,     2,     0,
+        0,    -1,     2,     5,   -10,   -19,    24,    48,   -49,  -103,    86,   198,
+     -136,  -355,   201,   606,  -280, -1012,   375,  1720,  -505, -3278,   784, 10906,
+    16029,  9783,  -110, -3195,   -95,  1716,   140, -1024,  -137,   621,   114,  -368,
+      -85,   207,    57,  -108,   -34,    51,    18,   -20,    -7,     6,     2,     0,
+        0,    -1,     2,     5,   -10,   -19,    25,    48,   -50,  -102,    89,   197,
+     -142,  -353,   211,   604,  -296, -1009,   402,  1717,  -552, -3281,   890, 11027,
+    16018,  9655,  -204, -3180,   -51,  1712,   114, -1024,  -121,   621,   105,  -368,
+      -80,   208,    54,  -109,   -33,    51,    17,   -20,    -7,     6,     2,     0,
+        0,    -1,     2,     5,   -10,   -19,    26,    47,   -52,  -101,    92,   195,
+     -147,  -351,   220,   600,  -312, -1005,   428,  1714,  -598, -3283,   996, 11147,
+    16008,  9526,  -296, -3164,    -7,  1708,    89, -1023,  -106,   622,    95,  -369,
+      -74,   208,    51,  -109,   -31,    51,    16,   -20,    -7,     6,     1,     0,
+        0,    -1,     2,     5,   -10,   -18,    26,    47,   -53,  -100,    95,   194,
+     -153,  -348,   230,   597,  -328, -1001,   455,  1709,  -645, -3284,  1103, 11266,
+    15993,  9397,  -387, -3148,    36,  1703,    63, -1021,   -90,   621,    86,  -369,
+      -69,   208,    48,  -109,   -29,    52,    15,   -21,    -6,     6,     1,     0,
+        0,    -1,     3,     5,   -11,   -18,    27,    46,   -55,   -99,    98,   192,
+     -158,  -346,   239,   594,  -344,  -996,   481,  1705,  -692, -3284,  1212, 11384,
+    15976,  9267,  -476, -3130,    79,  1697,    38, -1019,   -74,   621,    76,  -369,
+      -63,   209,    45,  -110,   -28,    52,    15,   -21,    -6,     6,     1,     0,
+        0,    -1,     3,     5,   -11,   -18,    28,    45,   -57,   -98,   101,   190,
+     -164,  -343,   249,   590,  -359,  -991,   508,  1699,  -739, -3282,  1321, 11501,
+    15956,  9137,  -564, -3111,   122,  1691,    13, -1017,   -59,   621,    67,  -369,
+      -57,   209,    42,  -110,   -26,    52,    14,   -21,    -6,     6,     1,     0,
+        0,    -1,     3,     5,   -11,   -18,    29,    45,   -58,   -97,   104,   188,
+     -170,  -340,   258,   586,  -375,  -986,   534,  1693,  -786, -3279,  1432, 11617,
+    15939,  9006,  -651, -3091,   165,  1684,   -13, -1015,   -43,   620,    57,  -369,
+      -52,   209,    39,  -110,   -25,    52,    13,   -21,    -6,     6,     1,     0,
+        0,    -1,     3,     5,   -12,   -17,    29,    44,   -60,   -96,   107,   186,
+     -175,  -337,   268,   581,  -391,  -980,   560,  1686,  -834, -3275,  1544, 11732,
+    15916,  8875,  -737, -3070,   207,  1677,   -37, -1012,   -28,   619,    48,  -369,
+      -46,   209,    36,  -110,   -23,    52,    13,   -21,    -5,     6,     1,     0,
+        0,    -1,     3,     5,   -12,   -17,    30,    44,   -61,   -95,   110,   184,
+     -180,  -334,   277,   577,  -407,  -974,   587,  1679,  -881, -3270,  1656, 11846,
+    15893,  8743,  -821, -3048,   249,  1669,   -62, -1009,   -13,   618,    39,  -369,
+      -41,   209,    32,  -110,   -22,    52,    12,   -21,    -5,     6,     1,     0,
+        0,    -1,     3,     5,   -12,   -17,    31,    43,   -63,   -93,   113,   182,
+     -186,  -331,   286,   572,  -422,  -967,   613,  1670,  -928, -3263,  1770, 11959,
+    15866,  8611,  -904, -3025,   290,  1661,   -87, -1005,     3,   616,    29,  -368,
+      -35,   209,    29,  -110,   -20,    52,    11,   -21,    -5,     6,     1,     0,
+        0,    -1,     3,     5,   -12,   -17,    31,    42,   -64,   -92,   116,   180,
+     -191,  -327,   296,   567,  -438,  -960,   639,  1661,  -976, -3255,  1884, 12071,
+    15838,  8479,  -986, -3002,   331,  1652,  -111, -1001,    18,   615,    20,  -368,
+      -30,   209,    26,  -110,   -18,    52,    10,   -21,    -4,     6,     1,     0,
+        0,    -1,     3,     5,   -13,   -16,    32,    42,   -66,   -91,   119,   178,
+     -197,  -324,   305,   561,  -453,  -953,   665,  1652, -1023, -3246,  2000, 12182,
+    15808,  8346, -1066, -2977,   371,  1642,  -135,  -997,    33,   613,    11,  -367,
+      -24,   209,    23,  -110,   -17,    52,    10,   -21,    -4,     6,     1,     0,
+        0,    -1,     3,     5,   -13,   -16,    33,    41,   -67,   -89,   122,   175,
+     -202,  -320,   314,   556,  -469,  -945,   691,  1642, -1070, -3236,  2116, 12292,
+    15776,  8213, -1145, -2952,   411,  1632,  -159,  -992,    48,   611,     2,  -366,
+      -19,   208,    20,  -110,   -15,    52,     9,   -21,    -4,     6,     1,     0,
+        0,     0,     3,     5,   -13,   -16,    33,    40,   -69,   -88,   125,   173,
+     -207,  -316,   323,   550,  -484,  -937,   717,  1631, -1118, -3224,  2234, 12400,
+    15745,  8079, -1222, -2925,   451,  1621,  -183,  -987,    62,   608,    -8,  -365,
+      -13,   208,    17,  -110,   -14,    52,     8,   -21,    -4,     6,     1,     0,
+        0,     0,     3,     4,   -13,   -15,    34,    40,   -70,   -86,   127,   170,
+     -212,  -312,   332,   544,  -499,  -928,   743,  1619, -1165, -3210,  2352, 12508,
+    15704,  7946, -1298, -2898,   490,  1610,  -206,  -982,    77,   606,   -17,  -364,
+       -8,   207,    14,  -110,   -12,    52,     8,   -21,    -3,     6,     1,     0,
+        0,     0,     3,     4,   -14,   -15,    35,    39,   -72,   -85,   130,   168,
+     -217,  -308,   341,   538,  -514,  -919,   769,  1606, -1212, -3196,  2471, 12614,
+    15669,  7812, -1373, -2870,   529,  1598,  -230,  -976,    92,   603,   -26,  -362,
+       -3,   207,    11,  -110,   -11,    52,     7,   -21,    -3,     6,     1,     0,
+        0,     0,     3,     4,   -14,   -15,    35,    38,   -73,   -83,   133,   165,
+     -223,  -303,   350,   531,  -530,  -910,   795,  1593, -1259, -3180,  2591, 12719,
+    15630,  7678, -1446, -2841,   567,  1586,  -253,  -970,   106,   600,   -35,  -361,
+        3,   206,     8,  -109,    -9,    52,     6,   -21,    -3,     6,     1,     0,
+        0,     0,     4,     4,   -14,   -14,    36,    37,   -74,   -82,   136,   162,
+     -228,  -299,   359,   524,  -544,  -900,   820,  1580, -1306, -3163,  2712, 12823,
+    15585,  7544, -1518, -2811,   604,  1573,  -276,  -964,   120,   597,   -43,  -359,
+        8,   206,     5,  -109,    -8,    52,     6,   -21,    -3,     6,     1,     0,
+        0,     0,     4,     4,   -15,   -14,    37,    36,   -76,   -80,   139,   159,
+     -233,  -294,   368,   517,  -559,  -889,   845,  1565, -1353, -3144,  2833, 12925,
+    15542,  7410, -1588, -2781,   642,  1560,  -298,  -957,   134,   593,   -52,  -358,
+       13,   205,     2,  -109,    -6,    52,     5,   -21,    -2,     6,     1,     0,
+        0,     0,     4,     4,   -15,   -14,    37,    35,   -77,   -78,   141,   156,
+     -238,  -290,   376,   510,  -574,  -879,   871,  1550, -1400, -3124,  2956, 13026,
+    15499,  7275, -1657, -2749,   678,  1546,  -321,  -950,   149,   590,   -61,  -356,
+       18,   204,     0,  -108,    -5,    51,     4,   -21,    -2,     6,     1,     0,
+        0,     0,     4,     4,   -15,   -13,    38,    34,   -79,   -77,   144,   153,
+     -243,  -285,   385,   502,  -589,  -868,   896,  1534, -1447, -3102,  3079, 13126,
+    15452,  7141, -1725, -2717,   714,  1532,  -343,  -943,   162,   586,   -69,  -354,
+       23,   203,    -3,  -108,    -3,    51,     4,   -20,    -2,     6,     0,     0,
+        0,     0,     4,     4,   -15,   -13,    39,    34,   -80,   -75,   147,   150,
+     -247,  -280,   393,   495,  -603,  -856,   920,  1518, -1493, -3080,  3203, 13224,
+    15399,  7006, -1791, -2685,   750,  1517,  -364,  -935,   176,   582,   -78,  -352,
+       29,   202,    -6,  -107,    -2,    51,     3,   -20,    -2,     6,     0,     0,
+        0,     0,     4,     3,   -15,   -12,    39,    33,   -81,   -73,   149,   147,
+     -252,  -274,   402,   487,  -617,  -844,   945,  1500, -1539, -3055,  3327, 13321,
+    15347,  6872, -1856, -2651,   785,  1502,  -386,  -928,   190,   578,   -86,  -350,
+       34,   201,    -9,  -107,     0,    51,     2,   -20,    -2,     6,     0,     0,
+        0,     0,     4,     3,   -16,   -12,    40,    32,   -83,   -71,   152,   144,
+     -257,  -269,   410,   478,  -631,  -832,   970,  1482, -1586, -3030,  3452, 13417,
+    15298,  6737, -1919, -2617,   819,  1486,  -407,  -919,   203,   573,   -95,  -347,
+       39,   200,   -12,  -106,     1,    51,     2,   -20,    -1,     5,     0,     0,
+        0,     0,     4,     3,   -16,   -12,    40,    31,   -84,   -69,   154,   140,
+     -262,  -264,   418,   470,  -645,  -820,   994,  1464, -1631, -3003,  3578, 13511,
+    15245,  6603, -1981, -2582,   853,  1470,  -428,  -911,   217,   569,  -103,  -345,
+       44,   199,   -15,  -106,     3,    50,     1,   -20,    -1,     5,     0,     0,
+        0,     0,     4,     3,   -16,   -11,    41,    30,   -85,   -67,   157,   137,
+     -266,  -258,   426,   461,  -659,  -807,  1018,  1444, -1677, -2974,  3705, 13604,
+    15187,  6468, -2041, -2546,   887,  1453,  -449,  -902,   230,   564,  -111,  -343,
+       48,   197,   -17,  -105,     4,    50,     0,   -20,    -1,     5,     0,     0,
+        0,     0,     4,     3,   -16,   -11,    42,    29,   -86,   -65,   159,   133,
+     -271,  -252,   434,   452,  -673,  -793,  1042,  1424, -1722, -2944,  3832, 13695,
+    15128,  6334, -2100, -2510,   920,  1436,  -469,  -893,   243,   559,  -119,  -340,
+       53,   196,   -20,  -105,     5,    50,     0,   -20,    -1,     5,     0,     0,
+        0,     0,     4,     3,   -17,   -10,    42,    28,   -88,   -63,   162,   130,
+     -275,  -246,   442,   443,  -686,  -779,  1065,  1404, -1767, -2913,  3960, 13785,
+    15065,  6200, -2158, -2473,   952,  1419,  -489,  -884,   255,   554,  -127,  -337,
+       58,   195,   -23,  -104,     7,    50,    -1,   -20,     0,     5,     0,     0,
+        0,     0,     4,     3,   -17,   -10,    43,    27,   -89,   -61,   164,   126,
+     -279,  -240,   450,   434,  -700,  -765,  1088,  1382, -1812, -2880,  4088, 13874,
+    15005,  6066, -2214, -2436,   983,  1401,  -509,  -874,   268,   549,  -135,  -334,
+       63,   193,   -25,  -103,     8,    49,    -2,   -20,     0,     5,     0,     0,
+        0,     0,     4,     2,   -17,    -9,    43,    25,   -90,   -59,   166,   122,
+     -284,  -234,   457,   424,  -713,  -751,  1111,  1360, -1857, -2846,  4217, 13960,
+    14948,  5932, -2269, -2398,  1014,  1382,  -529,  -864,   280,   543,  -143,  -331,
+       67,   192,   -28,  -102,    10,    49,    -2,   -19,     0,     5,     0,     0,
+        0,     0,     4,     2,   -17,    -9,    44,    24,   -91,   -57,   169,   119,
+     -288,  -228,   465,   414,  -726,  -736,  1134,  1338, -1901, -2810,  4347, 14046,
+    14878,  5798, -2322, -2359,  1045,  1364,  -548,  -854,   293,   537,  -151,  -328,
+       72,   190,   -31,  -102,    11,    49,    -3,   -19,     0,     5,     0,     0,
+        0,     0,     5,     2,   -18,    -8,    44,    23,   -92,   -55,   171,   115,
+     -292,  -221,   472,   404,  -739,  -720,  1157,  1314, -1945, -2773,  4476, 14130,
+    14809,  5664, -2373, -2320,  1075,  1345,  -567,  -843,   305,   532,  -158,  -325,
+       77,   188,   -33,  -101,    12,    48,    -3,   -19,     0,     5,     0,     0,
+        0,     0,     5,     2,   -18,    -8,    45,    22,   -93,   -52,   173,   111,
+     -296,  -215,   479,   394,  -751,  -705,  1179,  1290, -1988, -2734,  4607, 14212,
+    14740,  5531, -2424, -2280,  1104,  1325,  -585,  -833,   317,   526,  -166,  -322,
+       81,   187,   -36,  -100,    13,    48,    -4,   -19,     1,     5,     0,     0,
+        0,     0,     5,     2,   -18,    -7,    45,    21,   -94,   -50,   175,   107,
+     -300,  -208,   486,   384,  -763,  -689,  1201,  1266, -2031, -2694,  4738, 14292,
+    14667,  5398, -2472, -2240,  1132,  1305,  -603,  -822,   328,   519,  -173,  -318,
+       86,   185,   -38,   -99,    15,    47,    -4,   -19,     1,     5,     0,     0,
+        0,     0,     5,     2,   -18,    -7,    46,    20,   -95,   -48,   177,   103,
+     -304,  -202,   493,   373,  -775,  -672,  1222,  1240, -2074, -2653,  4869, 14371,
+    14598,  5265, -2520, -2199,  1160,  1285,  -621,  -810,   340,   513,  -180,  -315,
+       90,   183,   -41,   -98,    16,    47,    -5,   -19,     1,     5,     0,     0,
+        0,     0,     5,     1,   -18,    -6,    46,    18,   -96,   -46,   179,    98,
+     -308,  -195,   500,   362,  -787,  -656,  1244,  1214, -2116, -2610,  5001, 14449,
+    14525,  5133, -2566, -2158,  1188,  1264,  -638,  -799,   351,   507,  -188,  -311,
+       94,   181,   -43,   -97,    17,    47,    -6,   -18,     1,     5,     0,     0,
+        0,     0,     5,     1,   -18,    -6,    47,    17,   -97,   -43,   181,    94,
+     -311,  -188,   507,   351,  -799,  -638,  1264,  1188, -2158, -2566,  5133, 14524,
+    14450,  5001, -2610, -2116,  1214,  1244,  -656,  -787,   362,   500,  -195,  -308,
+       98,   179,   -46,   -96,    18,    46,    -6,   -18,     1,     5,     0,     0,
+        0,     0,     5,     1,   -19,    -5,    47,    16,   -98,   -41,   183,    90,
+     -315,  -180,   513,   340,  -810,  -621,  1285,  1160, -2199, -2520,  5265, 14598,
+    14371,  4869, -2653, -2074,  1240,  1222,  -672,  -775,   373,   493,  -202,  -304,
+      103,   177,   -48,   -95,    20,    46,    -7,   -18,     2,     5,     0,     0,
+        0,     0,     5,     1,   -19,    -4,    47,    15,   -99,   -38,   185,    86,
+     -318,  -173,   519,   328,  -822,  -603,  1305,  1132, -2240, -2472,  5398, 14671,
+    14288,  4738, -2694, -2031,  1266,  1201,  -689,  -763,   384,   486,  -208,  -300,
+      107,   175,   -50,   -94,    21,    45,    -7,   -18,     2,     5,     0,     0,
+        0,     0,     5,     1,   -19,    -4,    48,    13,  -100,   -36,   187,    81,
+     -322,  -166,   526,   317,  -833,  -585,  1325,  1104, -2280, -2424,  5531, 14742,
+    14210,  4607, -2734, -1988,  1290,  1179,  -705,  -751,   394,   479,  -215,  -296,
+      111,   173,   -52,   -93,    22,    45,    -8,   -18,     2,     5,     0,     0,
+        0,     0,     5,     0,   -19,    -3,    48,    12,  -101,   -33,   188,    77,
+     -325,  -158,   532,   305,  -843,  -567,  1345,  1075, -2320, -2373,  5664, 14811,
+    14128,  4476, -2773, -1945,  1314,  1157,  -720,  -739,   404,   472,  -221,  -292,
+      115,   171,   -55,   -92,    23,    44,    -8,   -18,     2,     5,     0,     0,
+        0,     0,     5,     0,   -19,    -3,    49,    11,  -102,   -31,   190,    72,
+     -328,  -151,   537,   293,  -854,  -548,  1364,  1045, -2359, -2322,  5798, 14878,
+    14046,  4347, -2810, -1901,  1338,  1134,  -736,  -726,   414,   465,  -228,  -288,
+      119,   169,   -57,   -91,    24,    44,    -9,   -17,     2,     4,     0,     0,
+        0,     0,     5,     0,   -19,    -2,    49,    10,  -102,   -28,   192,    67,
+     -331,  -143,   543,   280,  -864,  -529,  1382,  1014, -2398, -2269,  5932, 14943,
+    13965,  4217, -2846, -1857,  1360,  1111,  -751,  -713,   424,   457,  -234,  -284,
+      122,   166,   -59,   -90,    25,    43,    -9,   -17,     2,     4,     0,     0,
+        0,     0,     5,     0,   -20,    -2,    49,     8,  -103,   -25,   193,    63,
+     -334,  -135,   549,   268,  -874,  -509,  1401,   983, -2436, -2214,  6066, 15007,
+    13872,  4088, -2880, -1812,  1382,  1088,  -765,  -700,   434,   450,  -240,  -279,
+      126,   164,   -61,   -89,    27,    43,   -10,   -17,     3,     4,     0,     0,
+        0,     0,     5,     0,   -20,    -1,    50,     7,  -104,   -23,   195,    58,
+     -337,  -127,   554,   255,  -884,  -489,  1419,   952, -2473, -2158,  6200, 15069,
+    13781,  3960, -2913, -1767,  1404,  1065,  -779,  -686,   443,   442,  -246,  -275,
+      130,   162,   -63,   -88,    28,    42,   -10,   -17,     3,     4,     0,     0,
+        0,     0,     5,    -1,   -20,     0,    50,     5,  -105,   -20,   196,    53,
+     -340,  -119,   559,   243,  -893,  -469,  1436,   920, -2510, -2100,  6334, 15129,
+    13694,  3832, -2944, -1722,  1424,  1042,  -793,  -673,   452,   434,  -252,  -271,
+      133,   159,   -65,   -86,    29,    42,   -11,   -16,     3,     4,     0,     0,
+        0,     0,     5,    -1,   -20,     0,    50,     4,  -105,   -17,   197,    48,
+     -343,  -111,   564,   230,  -902,  -449,  1453,   887, -2546, -2041,  6468, 15187,
+    13604,  3705, -2974, -1677,  1444,  1018,  -807,  -659,   461,   426,  -258,  -266,
+      137,   157,   -67,   -85,    30,    41,   -11,   -16,     3,     4,     0,     0,
+        0,     0,     5,    -1,   -20,     1,    50,     3,  -106,   -15,   199,    44,
+     -345,  -103,   569,   217,  -911,  -428,  1470,   853, -2582, -1981,  6603, 15244,
+    13512,  3578, -3003, -1631,  1464,   994,  -820,  -645,   470,   418,  -264,  -262,
+      140,   154,   -69,   -84,    31,    40,   -12,   -16,     3,     4,     0,     0,
+        0,     0,     5,    -1,   -20,     2,    51,     1,  -106,   -12,   200,    39,
+     -347,   -95,   573,   203,  -919,  -407,  1486,   819, -2617, -1919,  6737, 15299,
+    13416,  3452, -3030, -1586,  1482,   970,  -832,  -631,   478,   410,  -269,  -257,
+      144,   152,   -71,   -83,    32,    40,   -12,   -16,     3,     4,     0,     0,
+        0,     0,     6,    -2,   -20,     2,    51,     0,  -107,    -9,   201,    34,
+     -350,   -86,   578,   190,  -928,  -386,  1502,   785, -2651, -1856,  6872, 15352,
+    13316,  3327, -3055, -1539,  1500,   945,  -844,  -617,   487,   402,  -274,  -252,
+      147,   149,   -73,   -81,    33,    39,   -12,   -15,     3,     4,     0,     0,
+        0,     0,     6,    -2,   -20,     3,    51,    -2,  -107,    -6,   202,    29,
+     -352,   -78,   582,   176,  -935,  -364,  1517,   750, -2685, -1791,  7006, 15403,
+    13220,  3203, -3080, -1493,  1518,   920,  -856,  -603,   495,   393,  -280,  -247,
+      150,   147,   -75,   -80,    34,    39,   -13,   -15,     4,     4,     0,     0,
+        0,     0,     6,    -2,   -20,     4,    51,    -3,  -108,    -3,   203,    23,
+     -354,   -69,   586,   162,  -943,  -343,  1532,   714, -2717, -1725,  7141, 15452,
+    13126,  3079, -3102, -1447,  1534,   896,  -868,  -589,   502,   385,  -285,  -243,
+      153,   144,   -77,   -79,    34,    38,   -13,   -15,     4,     4,     0,     0,
+        0,     1,     6,    -2,   -21,     4,    51,    -5,  -108,     0,   204,    18,
+     -356,   -61,   590,   149,  -950,  -321,  1546,   678, -2749, -1657,  7275, 15499,
+    13026,  2956, -3124, -1400,  1550,   871,  -879,  -574,   510,   376,  -290,  -238,
+      156,   141,   -78,   -77,    35,    37,   -14,   -15,     4,     4,     0,     0,
+        0,     1,     6,    -2,   -21,     5,    52,    -6,  -109,     2,   205,    13,
+     -358,   -52,   593,   134,  -957,  -298,  1560,   642, -2781, -1588,  7410, 15544,
+    12923,  2833, -3144, -1353,  1565,   845,  -889,  -559,   517,   368,  -294,  -233,
+      159,   139,   -80,   -76,    36,    37,   -14,   -15,     4,     4,     0,     0,
+        0,     1,     6,    -3,   -21,     6,    52,    -8,  -109,     5,   206,     8,
+     -359,   -43,   597,   120,  -964,  -276,  1573,   604, -2811, -1518,  7544, 15588,
+    12820,  2712, -3163, -1306,  1580,   820,  -900,  -544,   524,   359,  -299,  -228,
+      162,   136,   -82,   -74,    37,    36,   -14,   -14,     4,     4,     0,     0,
+        0,     1,     6,    -3,   -21,     6,    52,    -9,  -109,     8,   206,     3,
+     -361,   -35,   600,   106,  -970,  -253,  1586,   567, -2841, -1446,  7678, 15630,
+    12719,  2591, -3180, -1259,  1593,   795,  -910,  -530,   531,   350,  -303,  -223,
+      165,   133,   -83,   -73,    38,    35,   -15,   -14,     4,     3,     0,     0,
+        0,     1,     6,    -3,   -21,     7,    52,   -11,  -110,    11,   207,    -3,
+     -362,   -26,   603,    92,  -976,  -230,  1598,   529, -2870, -1373,  7812, 15669,
+    12614,  2471, -3196, -1212,  1606,   769,  -919,  -514,   538,   341,  -308,  -217,
+      168,   130,   -85,   -72,    39,    35,   -15,   -14,     4,     3,     0,     0,
+        0,     1,     6,    -3,   -21,     8,    52,   -12,  -110,    14,   207,    -8,
+     -364,   -17,   606,    77,  -982,  -206,  1610,   490, -2898, -1298,  7946, 15707,
+    12505,  2352, -3210, -1165,  1619,   743,  -928,  -499,   544,   332,  -312,  -212,
+      170,   127,   -86,   -70,    40,    34,   -15,   -13,     4,     3,     0,     0,
+        0,     1,     6,    -4,   -21,     8,    52,   -14,  -110,    17,   208,   -13,
+     -365,    -8,   608,    62,  -987,  -183,  1621,   451, -2925, -1222,  8079, 15743,
+    12402,  2234, -3224, -1118,  1631,   717,  -937,  -484,   550,   323,  -316,  -207,
+      173,   125,   -88,   -69,    40,    33,   -16,   -13,     5,     3,     0,     0,
+        0,     1,     6,    -4,   -21,     9,    52,   -15,  -110,    20,   208,   -19,
+     -366,     2,   611,    48,  -992,  -159,  1632,   411, -2952, -1145,  8213, 15777,
+    12291,  2116, -3236, -1070,  1642,   691,  -945,  -469,   556,   314,  -320,  -202,
+      175,   122,   -89,   -67,    41,    33,   -16,   -13,     5,     3,    -1,     0,
+        0,     1,     6,    -4,   -21,    10,    52,   -17,  -110,    23,   209,   -24,
+     -367,    11,   613,    33,  -997,  -135,  1642,   371, -2977, -1066,  8346, 15809,
+    12181,  2000, -3246, -1023,  1652,   665,  -953,  -453,   561,   305,  -324,  -197,
+      178,   119,   -91,   -66,    42,    32,   -16,   -13,     5,     3,    -1,     0,
+        0,     1,     6,    -4,   -21,    10,    52,   -18,  -110,    26,   209,   -30,
+     -368,    20,   615,    18, -1001,  -111,  1652,   331, -3002,  -986,  8479, 15838,
+    12071,  1884, -3255,  -976,  1661,   639,  -960,  -438,   567,   296,  -327,  -191,
+      180,   116,   -92,   -64,    42,    31,   -17,   -12,     5,     3,    -1,     0,
+        0,     1,     6,    -5,   -21,    11,    52,   -20,  -110,    29,   209,   -35,
+     -368,    29,   616,     3, -1005,   -87,  1661,   290, -3025,  -904,  8611, 15866,
+    11959,  1770, -3263,  -928,  1670,   613,  -967,  -422,   572,   286,  -331,  -186,
+      182,   113,   -93,   -63,    43,    31,   -17,   -12,     5,     3,    -1,     0,
+        0,     1,     6,    -5,   -21,    12,    52,   -22,  -110,    32,   209,   -41,
+     -369,    39,   618,   -13, -1009,   -62,  1669,   249, -3048,  -821,  8743, 15893,
+    11846,  1656, -3270,  -881,  1679,   587,  -974,  -407,   577,   277,  -334,  -180,
+      184,   110,   -95,   -61,    44,    30,   -17,   -12,     5,     3,    -1,     0,
+        0,     1,     6,    -5,   -21,    13,    52,   -23,  -110,    36,   209,   -46,
+     -369,    48,   619,   -28, -1012,   -37,  1677,   207, -3070,  -737,  8875, 15917,
+    11731,  1544, -3275,  -834,  1686,   560,  -980,  -391,   581,   268,  -337,  -175,
+      186,   107,   -96,   -60,    44,    29,   -17,   -12,     5,     3,    -1,     0,
+        0,     1,     6,    -6,   -21,    13,    52,   -25,  -110,    39,   209,   -52,
+     -369,    57,   620,   -43, -1015,   -13,  1684,   165, -3091,  -651,  9006, 15939,
+    11617,  1432, -3279,  -786,  1693,   534,  -986,  -375,   586,   258,  -340,  -170,
+      188,   104,   -97,   -58,    45,    29,   -18,   -11,     5,     3,    -1,     0,
+        0,     1,     6,    -6,   -21,    14,    52,   -26,  -110,    42,   209,   -57,
+     -369,    67,   621,   -59, -1017,    13,  1691,   122, -3111,  -564,  9137, 15959,
+    11498,  1321, -3282,  -739,  1699,   508,  -991,  -359,   590,   249,  -343,  -164,
+      190,   101,   -98,   -57,    45,    28,   -18,   -11,     5,     3,    -1,     0,
+        0,     1,     6,    -6,   -21,    15,    52,   -28,  -110,    45,   209,   -63,
+     -369,    76,   621,   -74, -1019,    38,  1697,    79, -3130,  -476,  9267, 15977,
+    11383,  1212, -3284,  -692,  1705,   481,  -996,  -344,   594,   239,  -346,  -158,
+      192,    98,   -99,   -55,    46,    27,   -18,   -11,     5,     3,    -1,     0,
+        0,     1,     6,    -6,   -21,    15,    52,   -29,  -109,    48,   208,   -69,
+     -369,    86,   621,   -90, -1021,    63,  1703,    36, -3148,  -387,  9397, 15993,
+    11266,  1103, -3284,  -645,  1709,   455, -1001,  -328,   597,   230,  -348,  -153,
+      194,    95,  -100,   -53,    47,    26,   -18,   -10,     5,     2,    -1,     0,
+        0,     1,     6,    -7,   -20,    16,    51,   -31,  -109,    51,   208,   -74,
+     -369,    95,   622,  -106, -1023,    89,  1708,    -7, -3164,  -296,  9526, 16007,
+    11148,   996, -3283,  -598,  1714,   428, -1005,  -312,   600,   220,  -351,  -147,
+      195,    92,  -101,   -52,    47,    26,   -19,   -10,     5,     2,    -1,     0,
+        0,     2,     6,    -7,   -20,    17,    51,   -33,  -109,    54,   208,   -80,
+     -368,   105,   621,  -121, -1024,   114,  1712,   -51, -3180,  -204,  9655, 16019,
+    11026,   890, -3281,  -552,  1717,   402, -1009,  -296,   604,   211,  -353,  -142,
+      197,    89,  -102,   -50,    48,    25,   -19,   -10,     5,     2,    -1,     0,
+        0,     2,     6,    -7,   -20,    18,    51,   -34,  -108,    57,   207,   -85,
+     -368,   114,   621,  -137, -1024,   140,  1716,   -95, -3195,  -110,  9783, 16029,
+    10906,   784, -3278,  -505,  1720,   375, -1012,  -280,   606,   201,  -355,  -136,
+      198,    86,  -103,   -49,    48,    24,   -19,   -10,     5,     2,    -1,     0,
+        0,     2,     6,    -7,   -20,    18,    51,   -36,  -108,    61,   206,   -91,
+     -367,   124,   620,  -153, -1024,   166,  1719,  -140, -3209,   -16,  9911, 16037,
+    10785,   680, -3273,  -459,  1722,   349, -1015,  -264,   609,   191,  -357,  -131,
+      199,    82,  -104,   -47,    48,    24,   -19,    -9,     6,     2,    -1,     0,
+       -1,     2,     6,    -8,   -20,    19,    50,   -38,  -107,    64,   206,   -97,
+     -366,   134,   619,  -169, -1024,   192,  1721,  -185, -3221,    80, 10038, 16043,
+    10661,   577, -3267,  -412,  1723,   323, -1017,  -248,   611,   182,  -359,  -125,
+      201,    79,  -104,   -46,    49,    23,   -19,    -9,     6,     2,    -1,     0,
+       -1,     2,     6,    -8,   -20,    20,    50,   -39,  -107,    67,   205,  -102,
+     -365,   143,   618,  -184, -1024,   218,  1723,  -230, -3233,   177, 10164, 16047,
+    10541,   475, -3260,  -366,  1724,   296, -1020,  -232,   613,   172,  -361,  -119,
+      202,    76,  -105,   -44,    49,    22,   -20,    -9,     6,     2,    -1,     0,
+       -1,     2,     6,    -8,   -20,    21,    50,   -41,  -106,    70,   204,  -108,
+     -364,   153,   617,  -200, -1023,   244,  1724,  -275, -3243,   275, 10289, 16049,
+    10415,   375, -3252,  -321,  1724,   270, -1021,  -216,   615,   163,  -362,  -114,
+      203,    73,  -106,   -42,    50,    21,   -20,    -9,     6,     2,    -1,     0,
+};
+
+/* 96 taps per branch: 96000 to 16000 Hz */
+const int16_t audio_src_coef_1_6[48] =
+{
+        0,     0,     0,     1,     2,     2,     2,     1,    -2,    -6,   -12,   -16,
+      -17,   -13,    -2,    14,    34,    51,    61,    56,    33,    -8,   -61,  -115,
+     -154,  -164,  -132,   -54,    61,   194,   312,   381,   369,   256,    43,  -240,
+     -542,  -791,  -907,  -819,  -481,   117,   938,  1906,  2907,  3812,  4498,  4869,
+};
+
+/* 52 taps per branch: 96000 to 22050 Hz */
+const int16_t audio_src_coef_147_640[7644] =
+{
+        0,     0,     0,     4,    11,    16,    12,   -10,   -48,   -87,   -98,   -49,
+       69,   227,   349,   337,   116,  -300,  -782, -1091,  -956,  -185,  1231,  3069,
+     4911,  6274,  6775,  6267,  4899,  3056,  1220,  -193,  -959, -1090,  -779,  -297,
+      119,   337,   349,   226,    68,   -50,   -98,   -87,   -48,   -10,    12,    16,
+       11,     4,     0,     0,     0,     0,     0,     4,    11,    16,    12,   -10,
+      -48,   -87,   -98,   -49,    70,   228,   350,   336,   114,  -303,  -785, -1092,
+     -953,  -178,  1243,  3082,  4922,  6280,  6775,  6260,  4888,  3043,  1208,  -200,
+     -962, -1089,  -776,  -294,   121,   338,   348,   225,    67,   -51,   -98,   -87,
+      -47,    -9,    12,    16,    11,     4,     0,     0,     0,     0,     0,     4,
+       11,    16,    12,   -10,   -49,   -88,   -98,   -48,    71,   229,   350,   335,
+      112,  -307,  -788, -1092,  -950,  -170,  1254,  3095,  4933,  6287,  6775,  6254,
+     4876,  3030,  1197,  -208,  -965, -1088,  -773,  -290,   123,   339,   348,   224,
+       66,   -51,   -98,   -87,   -47,    -9,    12,    16,    11,     4,     0,     0,
+        0,     0,     0,     4,    11,    16,    12,   -10,   -49,   -88,   -98,   -48,
+       72,   231,   351,   334,   110,  -310,  -791, -1093,  -947,  -162,  1266,  3108,
+     4945,  6294,  6772,  6247,  4865,  3017,  1186,  -215,  -968, -1087,  -770,  -287,
+      125,   340,   347,   223,    65,   -52,   -98,   -86,   -47,    -9,    12,    16,
+       10,     4,     0,     0,     0,     0,     0,     4,    11,    16,    11,   -11,
+      -49,   -88,   -98,   -47,    73,   232,   351,   334,   107,  -313,  -794, -1094,
+     -944,  -155,  1277,  3121,  4956,  6300,  6779,  6240,  4853,  3003,  1174,  -223,
+     -971, -1086,  -767,  -284,   127,   340,   347,   222,    64,   -52,   -98,   -86,
+      -47,    -9,    12,    16,    10,     4,     0,     0,     0,     0,     0,     4,
+       11,    16,    11,   -11,   -49,   -88,   -97,   -46,    74,   233,   352,   333,
+      105,  -317,  -797, -1095,  -941,  -147,  1289,  3134,  4968,  6307,  6773,  6233,
+     4842,  2990,  1163,  -230,  -973, -1085,  -764,  -281,   130,   341,   346,   221,
+       63,   -53,   -98,   -86,   -46,    -9,    12,    16,    10,     4,     0,     0,
+        0,     0,     0,     4,    11,    16,    11,   -11,   -50,   -88,   -97,   -46,
+       75,   234,   352,   332,   103,  -320,  -799, -1096,  -938,  -139,  1300,  3147,
+     4979,  6313,  6772,  6226,  4830,  2977,  1152,  -237,  -976, -1084,  -760,  -277,
+      132,   342,   346,   220,    62,   -53,   -99,   -86,   -46,    -8,    12,    16,
+       10,     4,     0,     0,     0,     0,     0,     4,    11,    16,    11,   -11,
+      -50,   -89,   -97,   -45,    76,   235,   353,   331,   100,  -323,  -802, -1096,
+     -935,  -132,  1312,  3160,  4990,  6319,  6776,  6219,  4819,  2964,  1140,  -245,
+     -979, -1083,  -757,  -274,   134,   342,   345,   219,    61,   -54,   -99,   -86,
+      -46,    -8,    12,    16,    10,     4,     0,     0,     0,     0,     0,     4,
+       11,    16,    11,   -12,   -50,   -89,   -97,   -45,    77,   236,   353,   330,
+       98,  -326,  -805, -1097,  -932,  -124,  1324,  3173,  5001,  6326,  6774,  6212,
+     4807,  2951,  1129,  -252,  -982, -1082,  -754,  -271,   136,   343,   345,   218,
+       60,   -54,   -99,   -85,   -45,    -8,    12,    16,    10,     4,     0,     0,
+        0,     0,     0,     4,    11,    16,    11,   -12,   -51,   -89,   -97,   -44,
+       78,   237,   354,   330,    96,  -330,  -808, -1098,  -928,  -116,  1335,  3186,
+     5013,  6332,  6772,  6205,  4795,  2938,  1118,  -259,  -984, -1081,  -751,  -268,
+      138,   344,   344,   217,    59,   -55,   -99,   -85,   -45,    -8,    13,    16,
+       10,     4,     0,     0,     0,     0,     0,     4,    11,    16,    11,   -12,
+      -51,   -89,   -97,   -43,    79,   238,   354,   329,    93,  -333,  -811, -1098,
+     -925,  -108,  1347,  3199,  5024,  6338,  6771,  6198,  4784,  2925,  1107,  -266,
+     -987, -1080,  -748,  -264,   140,   344,   344,   216,    58,   -56,   -99,   -85,
+      -45,    -8,    13,    16,    10,     4,     0,     0,     0,     0,     0,     4,
+       11,    16,    11,   -12,   -51,   -89,   -97,   -43,    80,   239,   354,   328,
+       91,  -336,  -814, -1099,  -922,  -100,  1358,  3212,  5035,  6345,  6772,  6191,
+     4772,  2912,  1095,  -274,  -989, -1079,  -745,  -261,   143,   345,   343,   215,
+       57,   -56,   -99,   -85,   -45,    -7,    13,    16,    10,     3,     0,     0,
+        0,     0,     0,     4,    11,    16,    11,   -12,   -52,   -90,   -97,   -42,
+       81,   240,   355,   327,    89,  -340,  -817, -1100,  -919,   -92,  1370,  3225,
+     5046,  6351,  6773,  6184,  4760,  2899,  1084,  -281,  -992, -1077,  -742,  -258,
+      145,   345,   343,   213,    56,   -57,   -99,   -84,   -44,    -7,    13,    16,
+       10,     3,     0,     0,     0,     0,     0,     4,    11,    16,    11,   -13,
+      -52,   -90,   -96,   -42,    82,   241,   355,   326,    86,  -343,  -820, -1100,
+     -915,   -84,  1382,  3239,  5057,  6357,  6772,  6177,  4748,  2886,  1073,  -288,
+     -995, -1076,  -739,  -255,   147,   346,   342,   212,    55,   -57,   -99,   -84,
+      -44,    -7,    13,    16,    10,     3,     0,     0,     0,     0,     0,     4,
+       11,    16,    11,   -13,   -52,   -90,   -96,   -41,    83,   242,   356,   325,
+       84,  -346,  -823, -1101,  -912,   -76,  1394,  3252,  5068,  6363,  6769,  6169,
+     4737,  2873,  1062,  -295,  -997, -1075,  -736,  -251,   149,   347,   342,   211,
+       54,   -58,   -99,   -84,   -44,    -7,    13,    16,    10,     3,     0,     0,
+        0,     0,     0,     5,    11,    16,    10,   -13,   -52,   -90,   -96,   -40,
+       84,   243,   356,   324,    82,  -350,  -826, -1102,  -909,   -68,  1405,  3265,
+     5080,  6369,  6770,  6162,  4725,  2860,  1051,  -302, -1000, -1074,  -733,  -248,
+      151,   347,   341,   210,    53,   -58,   -99,   -84,   -43,    -7,    13,    16,
+       10,     3,     0,     0,     0,     0,     1,     5,    11,    16,    10,   -13,
+      -53,   -90,   -96,   -40,    85,   244,   356,   323,    79,  -353,  -829, -1102,
+     -905,   -60,  1417,  3278,  5091,  6375,  6768,  6155,  4713,  2847,  1040,  -309,
+    -1002, -1073,  -730,  -245,   153,   348,   340,   209,    52,   -59,   -99,   -83,
+      -43,    -6,    13,    16,    10,     3,     0,     0,     0,     0,     1,     5,
+       11,    16,    10,   -14,   -53,   -91,   -96,   -39,    86,   245,   357,   323,
+       77,  -356,  -831, -1103,  -902,   -52,  1429,  3291,  5102,  6381,  6765,  6147,
+     4701,  2834,  1029,  -316, -1004, -1071,  -726,  -242,   155,   348,   340,   208,
+       51,   -59,   -99,   -83,   -43,    -6,    13,    16,    10,     3,     0,     0,
+        0,     0,     1,     5,    12,    16,    10,   -14,   -53,   -91,   -96,   -38,
+       88,   246,   357,   322,    74,  -360,  -834, -1103,  -898,   -44,  1441,  3304,
+     5113,  6387,  6764,  6140,  4690,  2821,  1017,  -323, -1007, -1070,  -723,  -239,
+      157,   349,   339,   207,    50,   -60,   -99,   -83,   -43,    -6,    13,    16,
+       10,     3,     0,     0,     0,     0,     1,     5,    12,    16,    10,   -14,
+      -54,   -91,   -96,   -38,    89,   247,   357,   321,    72,  -363,  -837, -1104,
+     -895,   -36,  1452,  3317,  5124,  6393,  6762,  6133,  4678,  2808,  1006,  -330,
+    -1009, -1069,  -720,  -235,   159,   350,   339,   206,    50,   -60,   -99,   -83,
+      -42,    -6,    13,    16,    10,     3,     0,     0,     0,     0,     1,     5,
+       12,    16,    10,   -14,   -54,   -91,   -95,   -37,    90,   248,   358,   320,
+       70,  -366,  -840, -1104,  -891,   -28,  1464,  3330,  5135,  6399,  6760,  6125,
+     4666,  2795,   995,  -337, -1011, -1068,  -717,  -232,   161,   350,   338,   205,
+       49,   -61,   -99,   -83,   -42,    -6,    13,    16,    10,     3,     0,     0,
+        0,     0,     1,     5,    12,    16,    10,   -14,   -54,   -91,   -95,   -37,
+       91,   249,   358,   319,    67,  -370,  -843, -1105,  -888,   -20,  1476,  3343,
+     5146,  6405,  6760,  6118,  4654,  2782,   984,  -344, -1014, -1066,  -714,  -229,
+      163,   351,   337,   204,    48,   -61,   -99,   -82,   -42,    -5,    13,    16,
+       10,     3,     0,     0,     0,     0,     1,     5,    12,    16,    10,   -15,
+      -54,   -91,   -95,   -36,    92,   250,   358,   318,    65,  -373,  -846, -1105,
+     -884,   -11,  1488,  3356,  5156,  6410,  6761,  6110,  4642,  2769,   973,  -351,
+    -1016, -1065,  -711,  -226,   165,   351,   337,   203,    47,   -62,  -100,   -82,
+      -41,    -5,    13,    16,    10,     3,     0,     0,     0,     0,     1,     5,
+       12,    16,    10,   -15,   -55,   -92,   -95,   -35,    93,   251,   359,   317,
+       62,  -376,  -848, -1105,  -880,    -3,  1500,  3369,  5167,  6416,  6760,  6102,
+     4630,  2756,   962,  -358, -1018, -1064,  -708,  -223,   167,   352,   336,   202,
+       46,   -62,  -100,   -82,   -41,    -5,    14,    16,     9,     3,     0,     0,
+        0,     0,     1,     5,    12,    16,    10,   -15,   -55,   -92,   -95,   -35,
+       94,   252,   359,   316,    60,  -380,  -851, -1106,  -877,     5,  1512,  3382,
+     5178,  6422,  6761,  6095,  4618,  2743,   952,  -365, -1021, -1062,  -704,  -220,
+      169,   352,   336,   200,    45,   -63,  -100,   -82,   -41,    -5,    14,    16,
+        9,     3,     0,     0,     0,     0,     1,     5,    12,    16,     9,   -15,
+      -55,   -92,   -95,   -34,    95,   253,   359,   315,    57,  -383,  -854, -1106,
+     -873,    13,  1524,  3395,  5189,  6427,  6759,  6087,  4606,  2730,   941,  -371,
+    -1023, -1061,  -701,  -216,   171,   353,   335,   199,    44,   -63,  -100,   -81,
+      -41,    -5,    14,    16,     9,     3,     0,     0,     0,     0,     1,     5,
+       12,    16,     9,   -16,   -56,   -92,   -94,   -33,    96,   254,   360,   314,
+       55,  -386,  -857, -1106,  -869,    22,  1536,  3408,  5200,  6433,  6756,  6079,
+     4594,  2717,   930,  -378, -1025, -1060,  -698,  -213,   173,   353,   334,   198,
+       43,   -64,  -100,   -81,   -40,    -4,    14,    16,     9,     3,     0,     0,
+        0,     0,     1,     5,    12,    16,     9,   -16,   -56,   -92,   -94,   -33,
+       97,   255,   360,   313,    52,  -390,  -859, -1107,  -866,    30,  1547,  3421,
+     5211,  6439,  6756,  6072,  4582,  2704,   919,  -385, -1027, -1058,  -695,  -210,
+      175,   354,   334,   197,    42,   -64,  -100,   -81,   -40,    -4,    14,    16,
+        9,     3,     0,     0,     0,     0,     1,     5,    12,    16,     9,   -16,
+      -56,   -92,   -94,   -32,    98,   256,   360,   312,    50,  -393,  -862, -1107,
+     -862,    38,  1559,  3434,  5221,  6444,  6758,  6064,  4570,  2691,   908,  -391,
+    -1029, -1057,  -692,  -207,   177,   354,   333,   196,    41,   -65,  -100,   -81,
+      -40,    -4,    14,    15,     9,     3,     0,     0,     0,     0,     1,     5,
+       12,    16,     9,   -16,   -56,   -93,   -94,   -31,    99,   257,   361,   311,
+       47,  -396,  -865, -1107,  -858,    47,  1571,  3447,  5232,  6450,  6753,  6056,
+     4558,  2678,   897,  -398, -1031, -1055,  -689,  -204,   179,   355,   332,   195,
+       40,   -65,  -100,   -80,   -39,    -4,    14,    15,     9,     3,     0,     0,
+        0,     0,     1,     5,    12,    16,     9,   -17,   -57,   -93,   -94,   -31,
+      100,   258,   361,   310,    45,  -400,  -868, -1107,  -854,    55,  1583,  3460,
+     5243,  6455,  6755,  6048,  4546,  2665,   887,  -405, -1033, -1054,  -685,  -201,
+      181,   355,   332,   194,    39,   -66,  -100,   -80,   -39,    -4,    14,    15,
+        9,     3,     0,     0,     0,     0,     1,     5,    12,    16,     9,   -17,
+      -57,   -93,   -93,   -30,   101,   259,   361,   309,    42,  -403,  -870, -1108,
+     -850,    64,  1595,  3473,  5253,  6460,  6752,  6040,  4534,  2652,   876,  -411,
+    -1035, -1052,  -682,  -198,   183,   356,   331,   193,    38,   -66,  -100,   -80,
+      -39,    -4,    14,    15,     9,     3,     0,     0,     0,     0,     1,     5,
+       12,    16,     9,   -17,   -57,   -93,   -93,   -29,   102,   260,   361,   308,
+       40,  -406,  -873, -1108,  -846,    72,  1607,  3486,  5264,  6466,  6750,  6032,
+     4522,  2639,   865,  -418, -1037, -1051,  -679,  -194,   185,   356,   330,   192,
+       37,   -67,  -100,   -80,   -39,    -3,    14,    15,     9,     3,     0,     0,
+        0,     0,     1,     5,    12,    16,     9,   -17,   -58,   -93,   -93,   -29,
+      103,   261,   362,   307,    37,  -410,  -876, -1108,  -842,    81,  1620,  3499,
+     5275,  6471,  6746,  6024,  4510,  2626,   854,  -424, -1039, -1049,  -676,  -191,
+      187,   356,   330,   191,    36,   -67,  -100,   -79,   -38,    -3,    14,    15,
+        9,     3,     0,     0,     0,     0,     1,     5,    12,    16,     8,   -18,
+      -58,   -93,   -93,   -28,   104,   262,   362,   305,    35,  -413,  -879, -1108,
+     -838,    89,  1632,  3512,  5285,  6476,  6748,  6016,  4498,  2613,   844,  -431,
+    -1041, -1048,  -672,  -188,   189,   357,   329,   189,    35,   -67,  -100,   -79,
+      -38,    -3,    14,    15,     9,     3,     0,     0,     0,     0,     1,     5,
+       12,    16,     8,   -18,   -58,   -94,   -93,   -27,   105,   263,   362,   304,
+       32,  -416,  -881, -1108,  -834,    98,  1644,  3525,  5296,  6481,  6747,  6008,
+     4486,  2600,   833,  -437, -1043, -1046,  -669,  -185,   191,   357,   328,   188,
+       34,   -68,  -100,   -79,   -38,    -3,    14,    15,     9,     3,     0,     0,
+        0,     0,     1,     5,    12,    16,     8,   -18,   -58,   -94,   -92,   -26,
+      106,   264,   362,   303,    30,  -420,  -884, -1108,  -830,   107,  1656,  3538,
+     5306,  6487,  6741,  6000,  4474,  2587,   822,  -444, -1045, -1044,  -666,  -182,
+      193,   358,   328,   187,    34,   -68,  -100,   -79,   -37,    -3,    14,    15,
+        9,     3,     0,     0,     0,     0,     1,     5,    12,    16,     8,   -18,
+      -59,   -94,   -92,   -26,   107,   265,   363,   302,    27,  -423,  -887, -1108,
+     -826,   115,  1668,  3551,  5317,  6492,  6742,  5992,  4461,  2574,   812,  -450,
+    -1047, -1043,  -663,  -179,   194,   358,   327,   186,    33,   -69,  -100,   -78,
+      -37,    -2,    14,    15,     9,     3,     0,     0,     0,     0,     1,     5,
+       12,    16,     8,   -18,   -59,   -94,   -92,   -25,   109,   266,   363,   301,
+       24,  -426,  -889, -1109,  -822,   124,  1680,  3564,  5327,  6497,  6740,  5984,
+     4449,  2561,   801,  -456, -1049, -1041,  -660,  -176,   196,   358,   326,   185,
+       32,   -69,  -100,   -78,   -37,    -2,    14,    15,     9,     3,     0,     0,
+        0,     0,     1,     5,    13,    16,     8,   -19,   -59,   -94,   -92,   -24,
+      110,   267,   363,   300,    22,  -430,  -892, -1109,  -818,   133,  1692,  3577,
+     5338,  6502,  6737,  5976,  4437,  2548,   791,  -463, -1050, -1040,  -656,  -173,
+      198,   359,   325,   184,    31,   -70,  -100,   -78,   -37,    -2,    14,    15,
+        9,     3,     0,     0,     0,     0,     1,     6,    13,    16,     8,   -19,
+      -60,   -94,   -92,   -24,   111,   268,   363,   299,    19,  -433,  -894, -1109,
+     -814,   141,  1704,  3590,  5348,  6507,  6736,  5967,  4425,  2535,   780,  -469,
+    -1052, -1038,  -653,  -170,   200,   359,   325,   183,    30,   -70,  -100,   -78,
+      -36,    -2,    14,    15,     9,     3,     0,     0,     0,     0,     1,     6,
+       13,    16,     8,   -19,   -60,   -95,   -91,   -23,   112,   269,   364,   298,
+       17,  -437,  -897, -1109,  -810,   150,  1717,  3603,  5359,  6512,  6731,  5959,
+     4413,  2522,   769,  -475, -1054, -1036,  -650,  -166,   202,   359,   324,   182,
+       29,   -71,  -100,   -77,   -36,    -2,    15,    15,     9,     2,     0,     0,
+        0,     0,     1,     6,    13,    16,     8,   -19,   -60,   -95,   -91,   -22,
+      113,   270,   364,   296,    14,  -440,  -900, -1108,  -805,   159,  1729,  3616,
+     5369,  6517,  6728,  5951,  4400,  2510,   759,  -481, -1056, -1035,  -647,  -163,
+      204,   360,   323,   181,    28,   -71,  -100,   -77,   -36,    -2,    15,    15,
+        9,     2,     0,     0,     0,     0,     1,     6,    13,    16,     7,   -20,
+      -61,   -95,   -91,   -22,   114,   271,   364,   295,    11,  -443,  -902, -1108,
+     -801,   168,  1741,  3629,  5379,  6521,  6730,  5942,  4388,  2497,   748,  -488,
+    -1057, -1033,  -643,  -160,   205,   360,   323,   180,    27,   -71,  -100,   -77,
+      -35,    -1,    15,    15,     8,     2,     0,     0,     0,     0,     1,     6,
+       13,    16,     7,   -20,   -61,   -95,   -91,   -21,   115,   272,   364,   294,
+        9,  -447,  -905, -1108,  -797,   177,  1753,  3642,  5390,  6526,  6729,  5934,
+     4376,  2484,   738,  -494, -1059, -1031,  -640,  -157,   207,   360,   322,   178,
+       26,   -72,  -100,   -77,   -35,    -1,    15,    15,     8,     2,     0,     0,
+        0,     0,     1,     6,    13,    16,     7,   -20,   -61,   -95,   -90,   -20,
+      116,   273,   364,   293,     6,  -450,  -907, -1108,  -793,   186,  1765,  3655,
+     5400,  6531,  6723,  5926,  4363,  2471,   728,  -500, -1060, -1029,  -637,  -154,
+      209,   361,   321,   177,    25,   -72,  -100,   -76,   -35,    -1,    15,    15,
+        8,     2,     0,     0,     0,     0,     1,     6,    13,    16,     7,   -20,
+      -61,   -95,   -90,   -19,   117,   274,   364,   292,     3,  -453,  -910, -1108,
+     -788,   195,  1778,  3668,  5410,  6536,  6722,  5917,  4351,  2458,   717,  -506,
+    -1062, -1028,  -634,  -151,   211,   361,   320,   176,    25,   -73,  -100,   -76,
+      -35,    -1,    15,    15,     8,     2,     0,     0,     0,     0,     1,     6,
+       13,    16,     7,   -21,   -62,   -95,   -90,   -19,   118,   275,   365,   290,
+        1,  -457,  -912, -1108,  -784,   204,  1790,  3680,  5420,  6540,  6721,  5909,
+     4339,  2445,   707,  -512, -1064, -1026,  -630,  -148,   213,   361,   320,   175,
+       24,   -73,  -100,   -76,   -34,    -1,    15,    15,     8,     2,     0,     0,
+        0,     0,     1,     6,    13,    16,     7,   -21,   -62,   -96,   -90,   -18,
+      119,   276,   365,   289,    -2,  -460,  -915, -1108,  -779,   212,  1802,  3693,
+     5431,  6545,  6720,  5900,  4326,  2432,   696,  -518, -1065, -1024,  -627,  -145,
+      214,   362,   319,   174,    23,   -73,  -100,   -76,   -34,     0,    15,    15,
+        8,     2,     0,     0,     0,     0,     1,     6,    13,    16,     7,   -21,
+      -62,   -96,   -90,   -17,   120,   277,   365,   288,    -5,  -463,  -917, -1107,
+     -775,   222,  1814,  3706,  5441,  6550,  6715,  5892,  4314,  2419,   686,  -524,
+    -1067, -1022,  -624,  -142,   216,   362,   318,   173,    22,   -74,  -100,   -75,
+      -34,     0,    15,    15,     8,     2,     0,     0,     0,     0,     1,     6,
+       13,    16,     7,   -21,   -63,   -96,   -89,   -16,   121,   278,   365,   287,
+       -7,  -467,  -920, -1107,  -770,   231,  1827,  3719,  5451,  6554,  6710,  5883,
+     4302,  2407,   676,  -530, -1068, -1020,  -620,  -139,   218,   362,   317,   172,
+       21,   -74,  -100,   -75,   -34,     0,    15,    15,     8,     2,     0,     0,
+        0,     0,     1,     6,    13,    16,     6,   -22,   -63,   -96,   -89,   -16,
+      123,   279,   365,   285,   -10,  -470,  -922, -1107,  -766,   240,  1839,  3732,
+     5461,  6559,  6712,  5874,  4289,  2394,   666,  -536, -1070, -1019,  -617,  -136,
+      220,   362,   317,   171,    20,   -75,  -100,   -75,   -33,     0,    15,    15,
+        8,     2,     0,     0,     0,     0,     1,     6,    13,    16,     6,   -22,
+      -63,   -96,   -89,   -15,   124,   280,   365,   284,   -13,  -474,  -925, -1107,
+     -761,   249,  1851,  3745,  5471,  6563,  6710,  5866,  4277,  2381,   655,  -542,
+    -1071, -1017,  -614,  -133,   221,   363,   316,   170,    19,   -75,   -99,   -75,
+      -33,     0,    15,    15,     8,     2,     0,     0,     0,     0,     1,     6,
+       13,    16,     6,   -22,   -63,   -96,   -89,   -14,   125,   281,   365,   283,
+      -15,  -477,  -927, -1106,  -757,   258,  1864,  3758,  5481,  6567,  6704,  5857,
+     4265,  2368,   645,  -548, -1072, -1015,  -611,  -130,   223,   363,   315,   169,
+       18,   -75,   -99,   -74,   -33,     0,    15,    15,     8,     2,     0,     0,
+        0,     0,     1,     6,    13,    16,     6,   -22,   -64,   -96,   -88,   -13,
+      126,   282,   365,   282,   -18,  -480,  -930, -1106,  -752,   267,  1876,  3771,
+     5491,  6572,  6702,  5848,  4252,  2355,   635,  -554, -1074, -1013,  -607,  -127,
+      225,   363,   314,   167,    17,   -76,   -99,   -74,   -32,     1,    15,    15,
+        8,     2,     0,     0,     0,     0,     1,     6,    13,    16,     6,   -23,
+      -64,   -96,   -88,   -13,   127,   283,   366,   280,   -21,  -484,  -932, -1106,
+     -748,   276,  1889,  3784,  5501,  6576,  6701,  5839,  4240,  2343,   625,  -560,
+    -1075, -1011,  -604,  -124,   226,   363,   313,   166,    17,   -76,   -99,   -74,
+      -32,     1,    15,    15,     8,     2,     0,     0,     0,     0,     1,     6,
+       13,    16,     6,   -23,   -64,   -97,   -88,   -12,   128,   283,   366,   279,
+      -24,  -487,  -935, -1105,  -743,   285,  1901,  3796,  5511,  6580,  6699,  5831,
+     4227,  2330,   615,  -565, -1076, -1009,  -601,  -121,   228,   364,   313,   165,
+       16,   -77,   -99,   -74,   -32,     1,    15,    15,     8,     2,     0,     0,
+        0,     0,     1,     6,    13,    16,     6,   -23,   -64,   -97,   -87,   -11,
+      129,   284,   366,   278,   -26,  -490,  -937, -1105,  -738,   295,  1913,  3809,
+     5521,  6585,  6692,  5822,  4215,  2317,   604,  -571, -1078, -1007,  -597,  -118,
+      230,   364,   312,   164,    15,   -77,   -99,   -73,   -32,     1,    15,    15,
+        8,     2,     0,     0,     0,     0,     1,     6,    13,    16,     6,   -23,
+      -65,   -97,   -87,   -10,   130,   285,   366,   276,   -29,  -494,  -940, -1104,
+     -734,   304,  1926,  3822,  5531,  6589,  6693,  5813,  4202,  2304,   594,  -577,
+    -1079, -1005,  -594,  -115,   231,   364,   311,   163,    14,   -77,   -99,   -73,
+      -31,     1,    15,    15,     8,     2,     0,     0,     0,     0,     1,     6,
+       13,    16,     5,   -24,   -65,   -97,   -87,   -10,   131,   286,   366,   275,
+      -32,  -497,  -942, -1104,  -729,   313,  1938,  3835,  5541,  6593,  6693,  5804,
+     4190,  2291,   584,  -582, -1080, -1003,  -591,  -112,   233,   364,   310,   162,
+       13,   -78,   -99,   -73,   -31,     1,    15,    15,     8,     2,     0,     0,
+        0,     0,     1,     6,    13,    16,     5,   -24,   -65,   -97,   -87,    -9,
+      132,   287,   366,   274,   -35,  -500,  -944, -1103,  -724,   322,  1951,  3848,
+     5551,  6597,  6688,  5795,  4177,  2279,   574,  -588, -1081, -1001,  -587,  -109,
+      235,   364,   309,   161,    12,   -78,   -99,   -73,   -31,     1,    15,    14,
+        8,     2,     0,     0,     0,     0,     1,     6,    13,    16,     5,   -24,
+      -66,   -97,   -86,    -8,   133,   288,   366,   272,   -37,  -504,  -947, -1103,
+     -719,   332,  1963,  3860,  5560,  6601,  6688,  5786,  4165,  2266,   564,  -594,
+    -1083,  -999,  -584,  -106,   236,   364,   309,   160,    11,   -79,   -99,   -72,
+      -31,     2,    15,    14,     8,     2,     0,     0,     0,     0,     1,     7,
+       14,    16,     5,   -24,   -66,   -97,   -86,    -7,   134,   289,   366,   271,
+      -40,  -507,  -949, -1102,  -714,   341,  1976,  3873,  5570,  6605,  6678,  5777,
+     4152,  2253,   554,  -599, -1084,  -997,  -581,  -103,   238,   365,   308,   159,
+       11,   -79,   -99,   -72,   -30,     2,    15,    14,     8,     2,     0,     0,
+        0,     0,     1,     7,    14,    16,     5,   -25,   -66,   -97,   -86,    -6,
+      136,   290,   366,   269,   -43,  -511,  -951, -1102,  -709,   351,  1988,  3886,
+     5580,  6609,  6675,  5768,  4140,  2240,   544,  -605, -1085,  -995,  -577,  -100,
+      240,   365,   307,   158,    10,   -79,   -99,   -72,   -30,     2,    15,    14,
+        8,     2,     0,     0,     0,     0,     1,     7,    14,    16,     5,   -25,
+      -66,   -97,   -85,    -6,   137,   291,   366,   268,   -46,  -514,  -954, -1101,
+     -704,   360,  2001,  3899,  5590,  6613,  6673,  5759,  4127,  2228,   534,  -610,
+    -1086,  -993,  -574,   -97,   241,   365,   306,   156,     9,   -80,   -99,   -71,
+      -30,     2,    15,    14,     7,     2,     0,     0,     0,     0,     1,     7,
+       14,    16,     5,   -25,   -67,   -97,   -85,    -5,   138,   292,   366,   267,
+      -49,  -517,  -956, -1101,  -700,   369,  2013,  3912,  5599,  6617,  6673,  5750,
+     4114,  2215,   524,  -616, -1087,  -991,  -571,   -94,   243,   365,   305,   155,
+        8,   -80,   -99,   -71,   -29,     2,    15,    14,     7,     2,     0,     0,
+        0,     0,     1,     7,    14,    16,     4,   -25,   -67,   -98,   -85,    -4,
+      139,   292,   366,   265,   -51,  -521,  -958, -1100,  -695,   379,  2026,  3924,
+     5609,  6621,  6668,  5741,  4102,  2202,   515,  -621, -1088,  -989,  -567,   -91,
+      244,   365,   305,   154,     7,   -80,   -99,   -71,   -29,     2,    16,    14,
+        7,     2,     0,     0,     0,     0,     1,     7,    14,    16,     4,   -26,
+      -67,   -98,   -85,    -3,   140,   293,   366,   264,   -54,  -524,  -961, -1099,
+     -690,   388,  2038,  3937,  5619,  6624,  6669,  5731,  4089,  2190,   505,  -627,
+    -1089,  -987,  -564,   -89,   246,   365,   304,   153,     6,   -81,   -99,   -71,
+      -29,     3,    16,    14,     7,     2,     0,     0,     0,     0,     2,     7,
+       14,    16,     4,   -26,   -68,   -98,   -84,    -3,   141,   294,   366,   262,
+      -57,  -527,  -963, -1099,  -684,   398,  2051,  3950,  5628,  6628,  6663,  5722,
+     4077,  2177,   495,  -632, -1090,  -985,  -561,   -86,   247,   365,   303,   152,
+        6,   -81,   -99,   -70,   -29,     3,    16,    14,     7,     2,     0,     0,
+        0,     0,     2,     7,    14,    16,     4,   -26,   -68,   -98,   -84,    -2,
+      142,   295,   366,   261,   -60,  -531,  -965, -1098,  -679,   408,  2063,  3963,
+     5638,  6632,  6658,  5713,  4064,  2164,   485,  -638, -1091,  -983,  -557,   -83,
+      249,   365,   302,   151,     5,   -81,   -99,   -70,   -28,     3,    16,    14,
+        7,     2,     0,     0,     0,     0,     2,     7,    14,    16,     4,   -27,
+      -68,   -98,   -84,    -1,   143,   296,   366,   259,   -63,  -534,  -967, -1097,
+     -674,   417,  2076,  3975,  5647,  6635,  6656,  5704,  4051,  2152,   475,  -643,
+    -1092,  -980,  -554,   -80,   250,   366,   301,   150,     4,   -82,   -98,   -70,
+      -28,     3,    16,    14,     7,     2,     0,     0,     0,     0,     2,     7,
+       14,    16,     4,   -27,   -68,   -98,   -83,     0,   144,   297,   366,   258,
+      -66,  -537,  -970, -1096,  -669,   427,  2089,  3988,  5657,  6639,  6650,  5694,
+     4039,  2139,   465,  -648, -1093,  -978,  -551,   -77,   252,   366,   300,   149,
+        3,   -82,   -98,   -70,   -28,     3,    16,    14,     7,     2,     0,     0,
+        0,     0,     2,     7,    14,    16,     4,   -27,   -69,   -98,   -83,     1,
+      145,   298,   366,   257,   -68,  -541,  -972, -1095,  -664,   436,  2101,  4001,
+     5666,  6643,  6645,  5685,  4026,  2126,   456,  -653, -1094,  -976,  -547,   -74,
+      254,   366,   299,   148,     2,   -82,   -98,   -69,   -28,     3,    16,    14,
+        7,     2,     0,     0,     0,     0,     2,     7,    14,    16,     3,   -27,
+      -69,   -98,   -83,     1,   147,   299,   366,   255,   -71,  -544,  -974, -1095,
+     -659,   446,  2114,  4013,  5676,  6646,  6644,  5676,  4013,  2114,   446,  -659,
+    -1095,  -974,  -544,   -71,   255,   366,   299,   147,     1,   -83,   -98,   -69,
+      -27,     3,    16,    14,     7,     2,     0,     0,     0,     0,     2,     7,
+       14,    16,     3,   -28,   -69,   -98,   -82,     2,   148,   299,   366,   254,
+      -74,  -547,  -976, -1094,  -653,   456,  2126,  4026,  5685,  6649,  6639,  5666,
+     4001,  2101,   436,  -664, -1095,  -972,  -541,   -68,   257,   366,   298,   145,
+        1,   -83,   -98,   -69,   -27,     4,    16,    14,     7,     2,     0,     0,
+        0,     0,     2,     7,    14,    16,     3,   -28,   -70,   -98,   -82,     3,
+      149,   300,   366,   252,   -77,  -551,  -978, -1093,  -648,   465,  2139,  4039,
+     5694,  6653,  6636,  5657,  3988,  2089,   427,  -669, -1096,  -970,  -537,   -66,
+      258,   366,   297,   144,     0,   -83,   -98,   -68,   -27,     4,    16,    14,
+        7,     2,     0,     0,     0,     0,     2,     7,    14,    16,     3,   -28,
+      -70,   -98,   -82,     4,   150,   301,   366,   250,   -80,  -554,  -980, -1092,
+     -643,   475,  2152,  4051,  5704,  6656,  6635,  5647,  3975,  2076,   417,  -674,
+    -1097,  -967,  -534,   -63,   259,   366,   296,   143,    -1,   -84,   -98,   -68,
+      -27,     4,    16,    14,     7,     2,     0,     0,     0,     0,     2,     7,
+       14,    16,     3,   -28,   -70,   -99,   -81,     5,   151,   302,   365,   249,
+      -83,  -557,  -983, -1091,  -638,   485,  2164,  4064,  5713,  6660,  6630,  5638,
+     3963,  2063,   408,  -679, -1098,  -965,  -531,   -60,   261,   366,   295,   142,
+       -2,   -84,   -98,   -68,   -26,     4,    16,    14,     7,     2,     0,     0,
+        0,     0,     2,     7,    14,    16,     3,   -29,   -70,   -99,   -81,     6,
+      152,   303,   365,   247,   -86,  -561,  -985, -1090,  -632,   495,  2177,  4077,
+     5722,  6663,  6628,  5628,  3950,  2051,   398,  -684, -1099,  -963,  -527,   -57,
+      262,   366,   294,   141,    -3,   -84,   -98,   -68,   -26,     4,    16,    14,
+        7,     2,     0,     0,     0,     0,     2,     7,    14,    16,     3,   -29,
+      -71,   -99,   -81,     6,   153,   304,   365,   246,   -89,  -564,  -987, -1089,
+     -627,   505,  2190,  4089,  5731,  6666,  6627,  5619,  3937,  2038,   388,  -690,
+    -1099,  -961,  -524,   -54,   264,   366,   293,   140,    -3,   -85,   -98,   -67,
+      -26,     4,    16,    14,     7,     1,     0,     0,     0,     0,     2,     7,
+       14,    16,     2,   -29,   -71,   -99,   -80,     7,   154,   305,   365,   244,
+      -91,  -567,  -989, -1088,  -621,   515,  2202,  4102,  5741,  6669,  6620,  5609,
+     3924,  2026,   379,  -695, -1100,  -958,  -521,   -51,   265,   366,   292,   139,
+       -4,   -85,   -98,   -67,   -25,     4,    16,    14,     7,     1,     0,     0,
+        0,     0,     2,     7,    14,    15,     2,   -29,   -71,   -99,   -80,     8,
+      155,   305,   365,   243,   -94,  -571,  -991, -1087,  -616,   524,  2215,  4114,
+     5750,  6672,  6618,  5599,  3912,  2013,   369,  -700, -1101,  -956,  -517,   -49,
+      267,   366,   292,   138,    -5,   -85,   -97,   -67,   -25,     5,    16,    14,
+        7,     1,     0,     0,     0,     0,     2,     7,    14,    15,     2,   -30,
+      -71,   -99,   -80,     9,   156,   306,   365,   241,   -97,  -574,  -993, -1086,
+     -610,   534,  2228,  4127,  5759,  6675,  6611,  5590,  3899,  2001,   360,  -704,
+    -1101,  -954,  -514,   -46,   268,   366,   291,   137,    -6,   -85,   -97,   -66,
+      -25,     5,    16,    14,     7,     1,     0,     0,     0,     0,     2,     8,
+       14,    15,     2,   -30,   -72,   -99,   -79,    10,   158,   307,   365,   240,
+     -100,  -577,  -995, -1085,  -605,   544,  2240,  4140,  5768,  6678,  6606,  5580,
+     3886,  1988,   351,  -709, -1102,  -951,  -511,   -43,   269,   366,   290,   136,
+       -6,   -86,   -97,   -66,   -25,     5,    16,    14,     7,     1,     0,     0,
+        0,     0,     2,     8,    14,    15,     2,   -30,   -72,   -99,   -79,    11,
+      159,   308,   365,   238,  -103,  -581,  -997, -1084,  -599,   554,  2253,  4152,
+     5777,  6681,  6602,  5570,  3873,  1976,   341,  -714, -1102,  -949,  -507,   -40,
+      271,   366,   289,   134,    -7,   -86,   -97,   -66,   -24,     5,    16,    14,
+        7,     1,     0,     0,     0,     0,     2,     8,    14,    15,     2,   -31,
+      -72,   -99,   -79,    11,   160,   309,   364,   236,  -106,  -584,  -999, -1083,
+     -594,   564,  2266,  4165,  5786,  6684,  6605,  5560,  3860,  1963,   332,  -719,
+    -1103,  -947,  -504,   -37,   272,   366,   288,   133,    -8,   -86,   -97,   -66,
+      -24,     5,    16,    13,     6,     1,     0,     0,     0,     0,     2,     8,
+       14,    15,     1,   -31,   -73,   -99,   -78,    12,   161,   309,   364,   235,
+     -109,  -587, -1001, -1081,  -588,   574,  2279,  4177,  5795,  6687,  6598,  5551,
+     3848,  1951,   322,  -724, -1103,  -944,  -500,   -35,   274,   366,   287,   132,
+       -9,   -87,   -97,   -65,   -24,     5,    16,    13,     6,     1,     0,     0,
+        0,     0,     2,     8,    15,    15,     1,   -31,   -73,   -99,   -78,    13,
+      162,   310,   364,   233,  -112,  -591, -1003, -1080,  -582,   584,  2291,  4190,
+     5804,  6690,  6596,  5541,  3835,  1938,   313,  -729, -1104,  -942,  -497,   -32,
+      275,   366,   286,   131,   -10,   -87,   -97,   -65,   -24,     5,    16,    13,
+        6,     1,     0,     0,     0,     0,     2,     8,    15,    15,     1,   -31,
+      -73,   -99,   -77,    14,   163,   311,   364,   231,  -115,  -594, -1005, -1079,
+     -577,   594,  2304,  4202,  5813,  6693,  6589,  5531,  3822,  1926,   304,  -734,
+    -1104,  -940,  -494,   -29,   276,   366,   285,   130,   -10,   -87,   -97,   -65,
+      -23,     6,    16,    13,     6,     1,     0,     0,     0,     0,     2,     8,
+       15,    15,     1,   -32,   -73,   -99,   -77,    15,   164,   312,   364,   230,
+     -118,  -597, -1007, -1078,  -571,   604,  2317,  4215,  5822,  6696,  6581,  5521,
+     3809,  1913,   295,  -738, -1105,  -937,  -490,   -26,   278,   366,   284,   129,
+      -11,   -87,   -97,   -64,   -23,     6,    16,    13,     6,     1,     0,     0,
+        0,     0,     2,     8,    15,    15,     1,   -32,   -74,   -99,   -77,    16,
+      165,   313,   364,   228,  -121,  -601, -1009, -1076,  -565,   615,  2330,  4227,
+     5831,  6698,  6581,  5511,  3796,  1901,   285,  -743, -1105,  -935,  -487,   -24,
+      279,   366,   283,   128,   -12,   -88,   -97,   -64,   -23,     6,    16,    13,
+        6,     1,     0,     0,     0,     0,     2,     8,    15,    15,     1,   -32,
+      -74,   -99,   -76,    17,   166,   313,   363,   226,  -124,  -604, -1011, -1075,
+     -560,   625,  2343,  4240,  5839,  6701,  6576,  5501,  3784,  1889,   276,  -748,
+    -1106,  -932,  -484,   -21,   280,   366,   283,   127,   -13,   -88,   -96,   -64,
+      -23,     6,    16,    13,     6,     1,     0,     0,     0,     0,     2,     8,
+       15,    15,     1,   -32,   -74,   -99,   -76,    17,   167,   314,   363,   225,
+     -127,  -607, -1013, -1074,  -554,   635,  2355,  4252,  5848,  6704,  6570,  5491,
+     3771,  1876,   267,  -752, -1106,  -930,  -480,   -18,   282,   365,   282,   126,
+      -13,   -88,   -96,   -64,   -22,     6,    16,    13,     6,     1,     0,     0,
+        0,     0,     2,     8,    15,    15,     0,   -33,   -74,   -99,   -75,    18,
+      169,   315,   363,   223,  -130,  -611, -1015, -1072,  -548,   645,  2368,  4265,
+     5857,  6706,  6565,  5481,  3758,  1864,   258,  -757, -1106,  -927,  -477,   -15,
+      283,   365,   281,   125,   -14,   -89,   -96,   -63,   -22,     6,    16,    13,
+        6,     1,     0,     0,     0,     0,     2,     8,    15,    15,     0,   -33,
+      -75,   -99,   -75,    19,   170,   316,   363,   221,  -133,  -614, -1017, -1071,
+     -542,   655,  2381,  4277,  5866,  6709,  6564,  5471,  3745,  1851,   249,  -761,
+    -1107,  -925,  -474,   -13,   284,   365,   280,   124,   -15,   -89,   -96,   -63,
+      -22,     6,    16,    13,     6,     1,     0,     0,     0,     0,     2,     8,
+       15,    15,     0,   -33,   -75,  -100,   -75,    20,   171,   317,   362,   220,
+     -136,  -617, -1019, -1070,  -536,   666,  2394,  4289,  5874,  6711,  6560,  5461,
+     3732,  1839,   240,  -766, -1107,  -922,  -470,   -10,   285,   365,   279,   123,
+      -16,   -89,   -96,   -63,   -22,     6,    16,    13,     6,     1,     0,     0,
+        0,     0,     2,     8,    15,    15,     0,   -34,   -75,  -100,   -74,    21,
+      172,   317,   362,   218,  -139,  -620, -1020, -1068,  -530,   676,  2407,  4302,
+     5883,  6714,  6550,  5451,  3719,  1827,   231,  -770, -1107,  -920,  -467,    -7,
+      287,   365,   278,   121,   -16,   -89,   -96,   -63,   -21,     7,    16,    13,
+        6,     1,     0,     0,     0,     0,     2,     8,    15,    15,     0,   -34,
+      -75,  -100,   -74,    22,   173,   318,   362,   216,  -142,  -624, -1022, -1067,
+     -524,   686,  2419,  4314,  5892,  6716,  6549,  5441,  3706,  1814,   222,  -775,
+    -1107,  -917,  -463,    -5,   288,   365,   277,   120,   -17,   -90,   -96,   -62,
+      -21,     7,    16,    13,     6,     1,     0,     0,     0,     0,     2,     8,
+       15,    15,     0,   -34,   -76,  -100,   -73,    23,   174,   319,   362,   214,
+     -145,  -627, -1024, -1065,  -518,   696,  2432,  4326,  5900,  6718,  6547,  5431,
+     3693,  1802,   212,  -779, -1108,  -915,  -460,    -2,   289,   365,   276,   119,
+      -18,   -90,   -96,   -62,   -21,     7,    16,    13,     6,     1,     0,     0,
+        0,     0,     2,     8,    15,    15,    -1,   -34,   -76,  -100,   -73,    24,
+      175,   320,   361,   213,  -148,  -630, -1026, -1064,  -512,   707,  2445,  4339,
+     5909,  6721,  6540,  5420,  3680,  1790,   204,  -784, -1108,  -912,  -457,     1,
+      290,   365,   275,   118,   -19,   -90,   -95,   -62,   -21,     7,    16,    13,
+        6,     1,     0,     0,     0,     0,     2,     8,    15,    15,    -1,   -35,
+      -76,  -100,   -73,    25,   176,   320,   361,   211,  -151,  -634, -1028, -1062,
+     -506,   717,  2458,  4351,  5917,  6723,  6535,  5410,  3668,  1778,   195,  -788,
+    -1108,  -910,  -453,     3,   292,   364,   274,   117,   -19,   -90,   -95,   -61,
+      -20,     7,    16,    13,     6,     1,     0,     0,     0,     0,     2,     8,
+       15,    15,    -1,   -35,   -76,  -100,   -72,    25,   177,   321,   361,   209,
+     -154,  -637, -1029, -1060,  -500,   728,  2471,  4363,  5926,  6725,  6529,  5400,
+     3655,  1765,   186,  -793, -1108,  -907,  -450,     6,   293,   364,   273,   116,
+      -20,   -90,   -95,   -61,   -20,     7,    16,    13,     6,     1,     0,     0,
+        0,     0,     2,     8,    15,    15,    -1,   -35,   -77,  -100,   -72,    26,
+      178,   322,   360,   207,  -157,  -640, -1031, -1059,  -494,   738,  2484,  4376,
+     5934,  6727,  6528,  5390,  3642,  1753,   177,  -797, -1108,  -905,  -447,     9,
+      294,   364,   272,   115,   -21,   -91,   -95,   -61,   -20,     7,    16,    13,
+        6,     1,     0,     0,     0,     0,     2,     8,    15,    15,    -1,   -35,
+      -77,  -100,   -71,    27,   180,   323,   360,   205,  -160,  -643, -1033, -1057,
+     -488,   748,  2497,  4388,  5942,  6729,  6522,  5379,  3629,  1741,   168,  -801,
+    -1108,  -902,  -443,    11,   295,   364,   271,   114,   -22,   -91,   -95,   -61,
+      -20,     7,    16,    13,     6,     1,     0,     0,     0,     0,     2,     9,
+       15,    15,    -2,   -36,   -77,  -100,   -71,    28,   181,   323,   360,   204,
+     -163,  -647, -1035, -1056,  -481,   759,  2510,  4400,  5951,  6731,  6514,  5369,
+     3616,  1729,   159,  -805, -1108,  -900,  -440,    14,   296,   364,   270,   113,
+      -22,   -91,   -95,   -60,   -19,     8,    16,    13,     6,     1,     0,     0,
+        0,     0,     2,     9,    15,    15,    -2,   -36,   -77,  -100,   -71,    29,
+      182,   324,   359,   202,  -166,  -650, -1036, -1054,  -475,   769,  2522,  4413,
+     5959,  6733,  6510,  5359,  3603,  1717,   150,  -810, -1109,  -897,  -437,    17,
+      298,   364,   269,   112,   -23,   -91,   -95,   -60,   -19,     8,    16,    13,
+        6,     1,     0,     0,     0,     0,     3,     9,    15,    14,    -2,   -36,
+      -78,  -100,   -70,    30,   183,   325,   359,   200,  -170,  -653, -1038, -1052,
+     -469,   780,  2535,  4425,  5967,  6735,  6508,  5348,  3590,  1704,   141,  -814,
+    -1109,  -894,  -433,    19,   299,   363,   268,   111,   -24,   -92,   -94,   -60,
+      -19,     8,    16,    13,     6,     1,     0,     0,     0,     0,     3,     9,
+       15,    14,    -2,   -37,   -78,  -100,   -70,    31,   184,   325,   359,   198,
+     -173,  -656, -1040, -1050,  -463,   791,  2548,  4437,  5976,  6737,  6502,  5338,
+     3577,  1692,   133,  -818, -1109,  -892,  -430,    22,   300,   363,   267,   110,
+      -24,   -92,   -94,   -59,   -19,     8,    16,    13,     5,     1,     0,     0,
+        0,     0,     3,     9,    15,    14,    -2,   -37,   -78,  -100,   -69,    32,
+      185,   326,   358,   196,  -176,  -660, -1041, -1049,  -456,   801,  2561,  4449,
+     5984,  6739,  6498,  5327,  3564,  1680,   124,  -822, -1109,  -889,  -426,    24,
+      301,   363,   266,   109,   -25,   -92,   -94,   -59,   -18,     8,    16,    12,
+        5,     1,     0,     0,     0,     0,     3,     9,    15,    14,    -2,   -37,
+      -78,  -100,   -69,    33,   186,   327,   358,   194,  -179,  -663, -1043, -1047,
+     -450,   812,  2574,  4461,  5992,  6741,  6493,  5317,  3551,  1668,   115,  -826,
+    -1108,  -887,  -423,    27,   302,   363,   265,   107,   -26,   -92,   -94,   -59,
+      -18,     8,    16,    12,     5,     1,     0,     0,     0,     0,     3,     9,
+       15,    14,    -3,   -37,   -79,  -100,   -68,    34,   187,   328,   358,   193,
+     -182,  -666, -1044, -1045,  -444,   822,  2587,  4474,  6000,  6743,  6485,  5306,
+     3538,  1656,   107,  -830, -1108,  -884,  -420,    30,   303,   362,   264,   106,
+      -26,   -92,   -94,   -58,   -18,     8,    16,    12,     5,     1,     0,     0,
+        0,     0,     3,     9,    15,    14,    -3,   -38,   -79,  -100,   -68,    34,
+      188,   328,   357,   191,  -185,  -669, -1046, -1043,  -437,   833,  2600,  4486,
+     6008,  6744,  6484,  5296,  3525,  1644,    98,  -834, -1108,  -881,  -416,    32,
+      304,   362,   263,   105,   -27,   -93,   -94,   -58,   -18,     8,    16,    12,
+        5,     1,     0,     0,     0,     0,     3,     9,    15,    14,    -3,   -38,
+      -79,  -100,   -67,    35,   189,   329,   357,   189,  -188,  -672, -1048, -1041,
+     -431,   844,  2613,  4498,  6016,  6746,  6478,  5285,  3512,  1632,    89,  -838,
+    -1108,  -879,  -413,    35,   305,   362,   262,   104,   -28,   -93,   -93,   -58,
+      -18,     8,    16,    12,     5,     1,     0,     0,     0,     0,     3,     9,
+       15,    14,    -3,   -38,   -79,  -100,   -67,    36,   191,   330,   356,   187,
+     -191,  -676, -1049, -1039,  -424,   854,  2626,  4510,  6024,  6748,  6469,  5275,
+     3499,  1620,    81,  -842, -1108,  -876,  -410,    37,   307,   362,   261,   103,
+      -29,   -93,   -93,   -58,   -17,     9,    16,    12,     5,     1,     0,     0,
+        0,     0,     3,     9,    15,    14,    -3,   -39,   -80,  -100,   -67,    37,
+      192,   330,   356,   185,  -194,  -679, -1051, -1037,  -418,   865,  2639,  4522,
+     6032,  6749,  6467,  5264,  3486,  1607,    72,  -846, -1108,  -873,  -406,    40,
+      308,   361,   260,   102,   -29,   -93,   -93,   -57,   -17,     9,    16,    12,
+        5,     1,     0,     0,     0,     0,     3,     9,    15,    14,    -4,   -39,
+      -80,  -100,   -66,    38,   193,   331,   356,   183,  -198,  -682, -1052, -1035,
+     -411,   876,  2652,  4534,  6040,  6751,  6461,  5253,  3473,  1595,    64,  -850,
+    -1108,  -870,  -403,    42,   309,   361,   259,   101,   -30,   -93,   -93,   -57,
+      -17,     9,    16,    12,     5,     1,     0,     0,     0,     0,     3,     9,
+       15,    14,    -4,   -39,   -80,  -100,   -66,    39,   194,   332,   355,   181,
+     -201,  -685, -1054, -1033,  -405,   887,  2665,  4546,  6048,  6752,  6458,  5243,
+     3460,  1583,    55,  -854, -1107,  -868,  -400,    45,   310,   361,   258,   100,
+      -31,   -94,   -93,   -57,   -17,     9,    16,    12,     5,     1,     0,     0,
+        0,     0,     3,     9,    15,    14,    -4,   -39,   -80,  -100,   -65,    40,
+      195,   332,   355,   179,  -204,  -689, -1055, -1031,  -398,   897,  2678,  4558,
+     6056,  6754,  6449,  5232,  3447,  1571,    47,  -858, -1107,  -865,  -396,    47,
+      311,   361,   257,    99,   -31,   -94,   -93,   -56,   -16,     9,    16,    12,
+        5,     1,     0,     0,     0,     0,     3,     9,    15,    14,    -4,   -40,
+      -81,  -100,   -65,    41,   196,   333,   354,   177,  -207,  -692, -1057, -1029,
+     -391,   908,  2691,  4570,  6064,  6755,  6447,  5221,  3434,  1559,    38,  -862,
+    -1107,  -862,  -393,    50,   312,   360,   256,    98,   -32,   -94,   -92,   -56,
+      -16,     9,    16,    12,     5,     1,     0,     0,     0,     0,     3,     9,
+       16,    14,    -4,   -40,   -81,  -100,   -64,    42,   197,   334,   354,   175,
+     -210,  -695, -1058, -1027,  -385,   919,  2704,  4582,  6072,  6756,  6439,  5211,
+     3421,  1547,    30,  -866, -1107,  -859,  -390,    52,   313,   360,   255,    97,
+      -33,   -94,   -92,   -56,   -16,     9,    16,    12,     5,     1,     0,     0,
+        0,     0,     3,     9,    16,    14,    -4,   -40,   -81,  -100,   -64,    43,
+      198,   334,   353,   173,  -213,  -698, -1060, -1025,  -378,   930,  2717,  4594,
+     6079,  6758,  6431,  5200,  3408,  1536,    22,  -869, -1106,  -857,  -386,    55,
+      314,   360,   254,    96,   -33,   -94,   -92,   -56,   -16,     9,    16,    12,
+        5,     1,     0,     0,     0,     0,     3,     9,    16,    14,    -5,   -41,
+      -81,  -100,   -63,    44,   199,   335,   353,   171,  -216,  -701, -1061, -1023,
+     -371,   941,  2730,  4606,  6087,  6759,  6427,  5189,  3395,  1524,    13,  -873,
+    -1106,  -854,  -383,    57,   315,   359,   253,    95,   -34,   -95,   -92,   -55,
+      -15,     9,    16,    12,     5,     1,     0,     0,     0,     0,     3,     9,
+       16,    14,    -5,   -41,   -82,  -100,   -63,    45,   200,   336,   352,   169,
+     -220,  -704, -1062, -1021,  -365,   952,  2743,  4618,  6095,  6760,  6423,  5178,
+     3382,  1512,     5,  -877, -1106,  -851,  -380,    60,   316,   359,   252,    94,
+      -35,   -95,   -92,   -55,   -15,    10,    16,    12,     5,     1,     0,     0,
+        0,     0,     3,     9,    16,    14,    -5,   -41,   -82,  -100,   -62,    46,
+      202,   336,   352,   167,  -223,  -708, -1064, -1018,  -358,   962,  2756,  4630,
+     6102,  6761,  6415,  5167,  3369,  1500,    -3,  -880, -1105,  -848,  -376,    62,
+      317,   359,   251,    93,   -35,   -95,   -92,   -55,   -15,    10,    16,    12,
+        5,     1,     0,     0,     0,     0,     3,    10,    16,    13,    -5,   -41,
+      -82,  -100,   -62,    47,   203,   337,   351,   165,  -226,  -711, -1065, -1016,
+     -351,   973,  2769,  4642,  6110,  6762,  6409,  5156,  3356,  1488,   -11,  -884,
+    -1105,  -846,  -373,    65,   318,   358,   250,    92,   -36,   -95,   -91,   -54,
+      -15,    10,    16,    12,     5,     1,     0,     0,     0,     0,     3,    10,
+       16,    13,    -5,   -42,   -82,   -99,   -61,    48,   204,   337,   351,   163,
+     -229,  -714, -1066, -1014,  -344,   984,  2782,  4654,  6118,  6763,  6402,  5146,
+     3343,  1476,   -20,  -888, -1105,  -843,  -370,    67,   319,   358,   249,    91,
+      -37,   -95,   -91,   -54,   -14,    10,    16,    12,     5,     1,     0,     0,
+        0,     0,     3,    10,    16,    13,    -6,   -42,   -83,   -99,   -61,    49,
+      205,   338,   350,   161,  -232,  -717, -1068, -1011,  -337,   995,  2795,  4666,
+     6125,  6764,  6395,  5135,  3330,  1464,   -28,  -891, -1104,  -840,  -366,    70,
+      320,   358,   248,    90,   -37,   -95,   -91,   -54,   -14,    10,    16,    12,
+        5,     1,     0,     0,     0,     0,     3,    10,    16,    13,    -6,   -42,
+      -83,   -99,   -60,    50,   206,   339,   350,   159,  -235,  -720, -1069, -1009,
+     -330,  1006,  2808,  4678,  6133,  6765,  6390,  5124,  3317,  1452,   -36,  -895,
+    -1104,  -837,  -363,    72,   321,   357,   247,    89,   -38,   -96,   -91,   -54,
+      -14,    10,    16,    12,     5,     1,     0,     0,     0,     0,     3,    10,
+       16,    13,    -6,   -43,   -83,   -99,   -60,    50,   207,   339,   349,   157,
+     -239,  -723, -1070, -1007,  -323,  1017,  2821,  4690,  6140,  6766,  6385,  5113,
+     3304,  1441,   -44,  -898, -1103,  -834,  -360,    74,   322,   357,   246,    88,
+      -38,   -96,   -91,   -53,   -14,    10,    16,    12,     5,     1,     0,     0,
+        0,     0,     3,    10,    16,    13,    -6,   -43,   -83,   -99,   -59,    51,
+      208,   340,   348,   155,  -242,  -726, -1071, -1004,  -316,  1029,  2834,  4701,
+     6147,  6767,  6379,  5102,  3291,  1429,   -52,  -902, -1103,  -831,  -356,    77,
+      323,   357,   245,    86,   -39,   -96,   -91,   -53,   -14,    10,    16,    11,
+        5,     1,     0,     0,     0,     0,     3,    10,    16,    13,    -6,   -43,
+      -83,   -99,   -59,    52,   209,   340,   348,   153,  -245,  -730, -1073, -1002,
+     -309,  1040,  2847,  4713,  6155,  6768,  6375,  5091,  3278,  1417,   -60,  -905,
+    -1102,  -829,  -353,    79,   323,   356,   244,    85,   -40,   -96,   -90,   -53,
+      -13,    10,    16,    11,     5,     1,     0,     0,     0,     0,     3,    10,
+       16,    13,    -7,   -43,   -84,   -99,   -58,    53,   210,   341,   347,   151,
+     -248,  -733, -1074, -1000,  -302,  1051,  2860,  4725,  6162,  6769,  6370,  5080,
+     3265,  1405,   -68,  -909, -1102,  -826,  -350,    82,   324,   356,   243,    84,
+      -40,   -96,   -90,   -52,   -13,    10,    16,    11,     5,     0,     0,     0,
+        0,     0,     3,    10,    16,    13,    -7,   -44,   -84,   -99,   -58,    54,
+      211,   342,   347,   149,  -251,  -736, -1075,  -997,  -295,  1062,  2873,  4737,
+     6169,  6769,  6363,  5068,  3252,  1394,   -76,  -912, -1101,  -823,  -346,    84,
+      325,   356,   242,    83,   -41,   -96,   -90,   -52,   -13,    11,    16,    11,
+        4,     0,     0,     0,     0,     0,     3,    10,    16,    13,    -7,   -44,
+      -84,   -99,   -57,    55,   212,   342,   346,   147,  -255,  -739, -1076,  -995,
+     -288,  1073,  2886,  4749,  6177,  6770,  6358,  5057,  3239,  1382,   -84,  -915,
+    -1100,  -820,  -343,    86,   326,   355,   241,    82,   -42,   -96,   -90,   -52,
+      -13,    11,    16,    11,     4,     0,     0,     0,     0,     0,     3,    10,
+       16,    13,    -7,   -44,   -84,   -99,   -57,    56,   213,   343,   345,   145,
+     -258,  -742, -1077,  -992,  -281,  1084,  2899,  4760,  6184,  6771,  6353,  5046,
+     3225,  1370,   -92,  -919, -1100,  -817,  -340,    89,   327,   355,   240,    81,
+      -42,   -97,   -90,   -52,   -12,    11,    16,    11,     4,     0,     0,     0,
+        0,     0,     3,    10,    16,    13,    -7,   -45,   -85,   -99,   -56,    57,
+      215,   343,   345,   143,  -261,  -745, -1079,  -989,  -274,  1095,  2912,  4772,
+     6191,  6771,  6346,  5035,  3212,  1358,  -100,  -922, -1099,  -814,  -336,    91,
+      328,   354,   239,    80,   -43,   -97,   -89,   -51,   -12,    11,    16,    11,
+        4,     0,     0,     0,     0,     0,     4,    10,    16,    13,    -8,   -45,
+      -85,   -99,   -56,    58,   216,   344,   344,   140,  -264,  -748, -1080,  -987,
+     -266,  1107,  2925,  4784,  6198,  6772,  6337,  5024,  3199,  1347,  -108,  -925,
+    -1098,  -811,  -333,    93,   329,   354,   238,    79,   -43,   -97,   -89,   -51,
+      -12,    11,    16,    11,     4,     0,     0,     0,     0,     0,     4,    10,
+       16,    13,    -8,   -45,   -85,   -99,   -55,    59,   217,   344,   344,   138,
+     -268,  -751, -1081,  -984,  -259,  1118,  2938,  4795,  6205,  6772,  6332,  5013,
+     3186,  1335,  -116,  -928, -1098,  -808,  -330,    96,   330,   354,   237,    78,
+      -44,   -97,   -89,   -51,   -12,    11,    16,    11,     4,     0,     0,     0,
+        0,     0,     4,    10,    16,    12,    -8,   -45,   -85,   -99,   -54,    60,
+      218,   345,   343,   136,  -271,  -754, -1082,  -982,  -252,  1129,  2951,  4807,
+     6212,  6773,  6328,  5001,  3173,  1323,  -124,  -932, -1097,  -805,  -326,    98,
+      330,   353,   236,    77,   -45,   -97,   -89,   -50,   -12,    11,    16,    11,
+        4,     0,     0,     0,     0,     0,     4,    10,    16,    12,    -8,   -46,
+      -86,   -99,   -54,    61,   219,   345,   342,   134,  -274,  -757, -1083,  -979,
+     -245,  1140,  2964,  4819,  6219,  6773,  6322,  4990,  3160,  1312,  -132,  -935,
+    -1096,  -802,  -323,   100,   331,   353,   235,    76,   -45,   -97,   -89,   -50,
+      -11,    11,    16,    11,     4,     0,     0,     0,     0,     0,     4,    10,
+       16,    12,    -8,   -46,   -86,   -99,   -53,    62,   220,   346,   342,   132,
+     -277,  -760, -1084,  -976,  -237,  1152,  2977,  4830,  6226,  6773,  6312,  4979,
+     3147,  1300,  -139,  -938, -1096,  -799,  -320,   103,   332,   352,   234,    75,
+      -46,   -97,   -88,   -50,   -11,    11,    16,    11,     4,     0,     0,     0,
+        0,     0,     4,    10,    16,    12,    -9,   -46,   -86,   -98,   -53,    63,
+      221,   346,   341,   130,  -281,  -764, -1085,  -973,  -230,  1163,  2990,  4842,
+     6233,  6774,  6306,  4968,  3134,  1289,  -147,  -941, -1095,  -797,  -317,   105,
+      333,   352,   233,    74,   -46,   -97,   -88,   -49,   -11,    11,    16,    11,
+        4,     0,     0,     0,     0,     0,     4,    10,    16,    12,    -9,   -47,
+      -86,   -98,   -52,    64,   222,   347,   340,   127,  -284,  -767, -1086,  -971,
+     -223,  1174,  3003,  4853,  6240,  6774,  6305,  4956,  3121,  1277,  -155,  -944,
+    -1094,  -794,  -313,   107,   334,   351,   232,    73,   -47,   -98,   -88,   -49,
+      -11,    11,    16,    11,     4,     0,     0,     0,     0,     0,     4,    10,
+       16,    12,    -9,   -47,   -86,   -98,   -52,    65,   223,   347,   340,   125,
+     -287,  -770, -1087,  -968,  -215,  1186,  3017,  4865,  6247,  6774,  6292,  4945,
+     3108,  1266,  -162,  -947, -1093,  -791,  -310,   110,   334,   351,   231,    72,
+      -48,   -98,   -88,   -49,   -10,    12,    16,    11,     4,     0,     0,     0,
+        0,     0,     4,    11,    16,    12,    -9,   -47,   -87,   -98,   -51,    66,
+      224,   348,   339,   123,  -290,  -773, -1088,  -965,  -208,  1197,  3030,  4876,
+     6254,  6774,  6288,  4933,  3095,  1254,  -170,  -950, -1092,  -788,  -307,   112,
+      335,   350,   229,    71,   -48,   -98,   -88,   -49,   -10,    12,    16,    11,
+        4,     0,     0,     0,     0,     0,     4,    11,    16,    12,    -9,   -47,
+      -87,   -98,   -51,    67,   225,   348,   338,   121,  -294,  -776, -1089,  -962,
+     -200,  1208,  3043,  4888,  6260,  6774,  6281,  4922,  3082,  1243,  -178,  -953,
+    -1092,  -785,  -303,   114,   336,   350,   228,    70,   -49,   -98,   -87,   -48,
+      -10,    12,    16,    11,     4,     0,     0,     0,     0,     0,     4,    11,
+       16,    12,   -10,   -48,   -87,   -98,   -50,    68,   226,   349,   337,   119,
+     -297,  -779, -1090,  -959,  -193,  1220,  3056,  4899,  6267,  6774,  6275,  4911,
+     3069,  1231,  -185,  -956, -1091,  -782,  -300,   116,   337,   349,   227,    69,
+      -49,   -98,   -87,   -48,   -10,    12,    16,    11,     4,     0,     0,     0,
+};
+
+/*******************************************************************************
+* Audio SRC Ratios
+*******************************************************************************/
+const audio_src_ratio_t audio_src_ratios[] =
+{
+    { 160u, 441u, 48u, audio_src_coef_160_441 },
+    {   1u,   2u, 48u, audio_src_coef_1_2 },
+    { 320u, 441u, 24u, audio_src_coef_320_441 },
+    { 160u, 147u, 24u, audio_src_coef_160_147 },
+    {   2u,   1u, 24u, audio_src_coef_2_1 },
+    { 320u, 147u, 24u, audio_src_coef_320_147 },
+    {   1u,   3u, 72u, audio_src_coef_1_3 },
+    { 147u, 320u, 52u, audio_src_coef_147_320 },
+    {   2u,   3u, 48u, audio_src_coef_2_3 },
+    { 147u, 160u, 48u, audio_src_coef_147_160 },
+    { 147u,  80u, 24u, audio_src_coef_147_80 },
+    {  80u, 441u, 96u, audio_src_coef_80_441 },
+    {   1u,   4u, 96u, audio_src_coef_1_4 },
+    {  80u, 147u, 48u, audio_src_coef_80_147 },
+    {   1u,   6u, 96u, audio_src_coef_1_6 },
+    { 147u, 640u, 52u, audio_src_coef_147_640 },
+};
+
+const uint32_t audio_src_ratios_number = sizeof(audio_src_ratios) / sizeof(audio_src_ratios[0]);
+
+/* [] END OF FILE */
@@ -0,0 +1,472 @@
+/*******************************************************************************
+* File Name: codec_queue.c
+*
+* Description: This file contains the asynchronous codec command queue.
+*  Register writes are enqueued without blocking and sent by the codec task
+*  with interrupt-driven transfers. The commands pending when the task wakes
+*  up are batched: a write that covers the registers of the previous one
+*  replaces it, and a write that continues it is merged into the same burst.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "codec_queue.h"
+
+#include "rtos.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Codec Queue Constants
+*******************************************************************************/
+#define CODEC_QUEUE_CMD_WRITE       (0u)
+#define CODEC_QUEUE_CMD_BARRIER     (1u)
+
+/*******************************************************************************
+* Codec Queue Types
+*******************************************************************************/
+/* Command passed to the codec task */
+typedef struct
+{
+    uint8_t  type;
+    uint8_t  reg_addr;
+    uint8_t  length;
+    uint8_t  data[CODEC_QUEUE_BURST_SIZE];
+    codec_queue_callback_t callback;
+    void    *arg;
+    uint32_t sequence;          /* Sequence number of a barrier */
+} codec_queue_cmd_t;
+
+/* Transfer of a batch, register address followed by the data */
+typedef struct
+{
+    uint8_t  length;
+    uint8_t  buffer[1u + CODEC_QUEUE_BURST_SIZE];
+} codec_queue_transfer_t;
+
+/* Completion callback of a batch, called after its transfer */
+typedef struct
+{
+    codec_queue_callback_t callback;
+    void    *arg;
+    uint32_t transfer;
+} codec_queue_done_t;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+bool     codec_queue_batch_add(const codec_queue_cmd_t *cmd);
+void     codec_queue_batch_run(void);
+uint32_t codec_queue_transfer(const codec_queue_transfer_t *transfer);
+
+/*******************************************************************************
+* Codec Queue Variables
+*******************************************************************************/
+QueueHandle_t     codec_queue;
+TaskHandle_t      codec_queue_task;
+SemaphoreHandle_t codec_queue_barrier_sem;
+
+/* Transport registered by the application */
+codec_queue_transport_t codec_queue_transport;
+
+/* Batch being built by the codec task */
+codec_queue_transfer_t codec_queue_batch[CODEC_QUEUE_BATCH_SIZE];
+uint32_t               codec_queue_batch_count;
+codec_queue_done_t     codec_queue_done[CODEC_QUEUE_SIZE];
+uint32_t               codec_queue_done_count;
+
+/* Status of the transfer in progress, set by codec_queue_complete() */
+volatile uint32_t codec_queue_transfer_status;
+
+/* First error since the last barrier */
+uint32_t codec_queue_status;
+
+/* Sequence number of the last barrier enqueued, and of the last one reached
+   by the codec task with the status of the writes before it. A waiter that
+   timed out leaves its barrier behind: the sequence tells the next waiter
+   that the semaphore was given for an older barrier. */
+uint32_t          codec_queue_barrier_next;
+volatile uint32_t codec_queue_barrier_done;
+volatile uint32_t codec_queue_barrier_status;
+
+/*******************************************************************************
+* Function Name: codec_queue_init
+********************************************************************************
+* Summary:
+*   Create the command queue. Should be called before the codec task starts.
+*
+*******************************************************************************/
+void codec_queue_init(void)
+{
+    codec_queue = xQueueCreate(CODEC_QUEUE_SIZE, sizeof(codec_queue_cmd_t));
+    codec_queue_barrier_sem = xSemaphoreCreateBinary();
+}
+
+/*******************************************************************************
+* Function Name: codec_queue_register_transport
+********************************************************************************
+* Summary:
+*   Register the transport used to send the transfers to the codec.
+*
+*******************************************************************************/
+void codec_queue_register_transport(const codec_queue_transport_t *transport)
+{
+    codec_queue_transport = *transport;
+}
+
+/*******************************************************************************
+* Function Name: codec_queue_write
+********************************************************************************
+* Summary:
+*   Enqueue a write of contiguous registers. Returns without waiting for the
+*   transfer.
+*
+* Parameters:
+*   reg_addr: address of the first register
+*   data: register values, copied in the command
+*   length: number of registers, up to CODEC_QUEUE_BURST_SIZE
+*   callback: called from the codec task once the registers are written, or
+*             NULL
+*   arg: argument of the callback
+*
+* Return:
+*   CODEC_QUEUE_SUCCESS, or CODEC_QUEUE_ERROR_FULL if the queue is full.
+*
+*******************************************************************************/
+uint32_t codec_queue_write(uint8_t reg_addr, const uint8_t *data, uint32_t length,
+                           codec_queue_callback_t callback, void *arg)
+{
+    codec_queue_cmd_t cmd;
+
+    if (length > CODEC_QUEUE_BURST_SIZE)
+    {
+        length = CODEC_QUEUE_BURST_SIZE;
+    }
+
+    cmd.type     = CODEC_QUEUE_CMD_WRITE;
+    cmd.reg_addr = reg_addr;
+    cmd.length   = (uint8_t) length;
+    cmd.callback = callback;
+    cmd.arg      = arg;
+    memcpy(cmd.data, data, length);
+
+    if (xQueueSend(codec_queue, &cmd, 0) != pdTRUE)
+    {
+        return CODEC_QUEUE_ERROR_FULL;
+    }
+
+    return CODEC_QUEUE_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: codec_queue_flush
+********************************************************************************
+* Summary:
+*   Wait until all the commands enqueued before are written to the codec. The
+*   commands enqueued after are not batched with the ones before. Only one
+*   task may wait at a time.
+*
+* Parameters:
+*   timeout_ms: maximum time to wait
+*
+* Return:
+*   First error of the commands since the previous flush, or
+*   CODEC_QUEUE_SUCCESS.
+*
+*******************************************************************************/
+uint32_t codec_queue_flush(uint32_t timeout_ms)
+{
+    codec_queue_cmd_t cmd;
+    TickType_t start = xTaskGetTickCount();
+    TickType_t timeout = pdMS_TO_TICKS(timeout_ms);
+    TickType_t elapsed;
+
+    cmd.type     = CODEC_QUEUE_CMD_BARRIER;
+    cmd.sequence = ++codec_queue_barrier_next;
+    cmd.callback = NULL;
+
+    if (xQueueSend(codec_queue, &cmd, timeout) != pdTRUE)
+    {
+        return CODEC_QUEUE_ERROR_FULL;
+    }
+
+    /* Skip the gives left by the barriers of earlier flushes that timed out */
+    while ((int32_t) (codec_queue_barrier_done - cmd.sequence) < 0)
+    {
+        elapsed = xTaskGetTickCount() - start;
+
+        if ((elapsed >= timeout) ||
+            (xSemaphoreTake(codec_queue_barrier_sem, timeout - elapsed) != pdTRUE))
+        {
+            return CODEC_QUEUE_ERROR_TIMEOUT;
+        }
+    }
+
+    return codec_queue_barrier_status;
+}
+
+/*******************************************************************************
+* Function Name: codec_queue_complete
+********************************************************************************
+* Summary:
+*   Report the end of the transfer in progress. Called by the transport from
+*   its interrupt handler.
+*
+* Parameters:
+*   status: CODEC_QUEUE_SUCCESS or an error
+*
+*******************************************************************************/
+void codec_queue_complete(uint32_t status)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    codec_queue_transfer_status = status;
+
+    vTaskNotifyGiveFromISR(codec_queue_task, &xHigherPriorityTaskWoken);
+
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/*******************************************************************************
+* Function Name: codec_queue_service
+********************************************************************************
+* Summary:
+*   Wait for a command, then take all the pending ones in a batch, up to a
+*   barrier, and send the batch. Called in a loop by the codec task; the host
+*   tests call it to run the task one batch at a time.
+*
+* Parameters:
+*   timeout_ms: maximum time to wait for the first command, or
+*               CODEC_QUEUE_WAIT_FOREVER
+*
+* Return:
+*   false if no command was received.
+*
+*******************************************************************************/
+bool codec_queue_service(uint32_t timeout_ms)
+{
+    codec_queue_cmd_t cmd;
+    TickType_t wait = (timeout_ms == CODEC_QUEUE_WAIT_FOREVER) ? portMAX_DELAY :
+                                                                 pdMS_TO_TICKS(timeout_ms);
+
+    if (xQueueReceive(codec_queue, &cmd, wait) != pdTRUE)
+    {
+        return false;
+    }
+
+    codec_queue_batch_count = 0;
+    codec_queue_done_count  = 0;
+
+    do
+    {
+        if (cmd.type == CODEC_QUEUE_CMD_BARRIER)
+        {
+            break;
+        }
+
+        /* Send the batch when it is full */
+        if (codec_queue_batch_add(&cmd) == false)
+        {
+            codec_queue_batch_run();
+            codec_queue_batch_add(&cmd);
+        }
+    }
+    while (xQueueReceive(codec_queue, &cmd, 0) == pdTRUE);
+
+    codec_queue_batch_run();
+
+    if (cmd.type == CODEC_QUEUE_CMD_BARRIER)
+    {
+        /* The status is published before the sequence, the waiter reads
+           them in the opposite order */
+        codec_queue_barrier_status = codec_queue_status;
+        codec_queue_barrier_done   = cmd.sequence;
+        codec_queue_status = CODEC_QUEUE_SUCCESS;
+
+        xSemaphoreGive(codec_queue_barrier_sem);
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: codec_queue_process
+********************************************************************************
+* Summary:
+*   Codec task. Services the commands as they arrive.
+*
+*******************************************************************************/
+void codec_queue_process(void *arg)
+{
+    (void) arg;
+
+    codec_queue_task = xTaskGetCurrentTaskHandle();
+
+    while (1)
+    {
+        codec_queue_service(CODEC_QUEUE_WAIT_FOREVER);
+    }
+}
+
+/*******************************************************************************
+* Function Name: codec_queue_batch_add
+********************************************************************************
+* Summary:
+*   Add a write to the batch. The order of the writes is kept: a write is only
+*   merged in the last transfer, when it falls within its registers or right
+*   after them.
+*
+* Return:
+*   false if the batch is full, the write is not added.
+*
+*******************************************************************************/
+bool codec_queue_batch_add(const codec_queue_cmd_t *cmd)
+{
+    codec_queue_transfer_t *last = NULL;
+    uint32_t first_reg;
+    uint32_t offset;
+
+    if ((cmd->callback != NULL) && (codec_queue_done_count >= CODEC_QUEUE_SIZE))
+    {
+        return false;
+    }
+
+    if (codec_queue_batch_count > 0u)
+    {
+        last = &codec_queue_batch[codec_queue_batch_count - 1u];
+        first_reg = last->buffer[0];
+        offset = (uint32_t) cmd->reg_addr - first_reg;
+
+        /* Same registers, or the next ones within a burst */
+        if ((cmd->reg_addr < first_reg) ||
+            ((offset + cmd->length) > CODEC_QUEUE_BURST_SIZE) ||
+            (offset > last->length))
+        {
+            last = NULL;
+        }
+    }
+
+    if (last == NULL)
+    {
+        if (codec_queue_batch_count >= CODEC_QUEUE_BATCH_SIZE)
+        {
+            return false;
+        }
+
+        last = &codec_queue_batch[codec_queue_batch_count++];
+        last->buffer[0] = cmd->reg_addr;
+        last->length = 0;
+        offset = 0;
+    }
+
+    memcpy(&last->buffer[1u + offset], cmd->data, cmd->length);
+    if ((offset + cmd->length) > last->length)
+    {
+        last->length = (uint8_t) (offset + cmd->length);
+    }
+
+    if (cmd->callback != NULL)
+    {
+        codec_queue_done[codec_queue_done_count].callback = cmd->callback;
+        codec_queue_done[codec_queue_done_count].arg      = cmd->arg;
+        codec_queue_done[codec_queue_done_count].transfer = codec_queue_batch_count - 1u;
+        codec_queue_done_count++;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: codec_queue_batch_run
+********************************************************************************
+* Summary:
+*   Send the transfers of the batch in order and call the completion
+*   callbacks of each transfer. The batch is empty afterwards.
+*
+*******************************************************************************/
+void codec_queue_batch_run(void)
+{
+    uint32_t transfer;
+    uint32_t status;
+    uint32_t done = 0;
+
+    for (transfer = 0; transfer < codec_queue_batch_count; transfer++)
+    {
+        status = codec_queue_transfer(&codec_queue_batch[transfer]);
+
+        if ((status != CODEC_QUEUE_SUCCESS) && (codec_queue_status == CODEC_QUEUE_SUCCESS))
+        {
+            codec_queue_status = status;
+        }
+
+        while ((done < codec_queue_done_count) && (codec_queue_done[done].transfer == transfer))
+        {
+            codec_queue_done[done].callback(status, codec_queue_done[done].arg);
+            done++;
+        }
+    }
+
+    codec_queue_batch_count = 0;
+    codec_queue_done_count  = 0;
+}
+
+/*******************************************************************************
+* Function Name: codec_queue_transfer
+********************************************************************************
+* Summary:
+*   Start a transfer and block the codec task until it completes or times out.
+*
+*******************************************************************************/
+uint32_t codec_queue_transfer(const codec_queue_transfer_t *transfer)
+{
+    if (codec_queue_transport.start == NULL)
+    {
+        return CODEC_QUEUE_ERROR_TRANSFER;
+    }
+
+    /* Discard a completion left by an aborted transfer */
+    (void) ulTaskNotifyTake(pdTRUE, 0);
+
+    if (codec_queue_transport.start(transfer->buffer, 1u + transfer->length) != 0u)
+    {
+        return CODEC_QUEUE_ERROR_TRANSFER;
+    }
+
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CODEC_QUEUE_TIMEOUT_MS)) == 0u)
+    {
+        codec_queue_transport.abort();
+        return CODEC_QUEUE_ERROR_TIMEOUT;
+    }
+
+    return codec_queue_transfer_status;
+}
+
+/* [] END OF FILE */
@@ -48,6 +48,7 @@
 #include "audio_out.h"
 #include "audio_in.h"
 #include "touch.h"
+#include "codec_queue.h"
 
 #include "rtos.h"
 
@@ -59,6 +60,7 @@ TaskHandle_t rtos_audio_app_task;
 TaskHandle_t rtos_audio_in_task;
 TaskHandle_t rtos_audio_out_task;
 TaskHandle_t rtos_touch_task;
+TaskHandle_t rtos_codec_task;
 
 /* RTOS Event Group */
 EventGroupHandle_t rtos_events;
@@ -108,6 +110,13 @@ int main(void)
                 RTOS_STACK_DEPTH, NULL, RTOS_TASK_PRIORITY,
                 &rtos_touch_task);
 
+    /* Create the codec command queue and its task, used by every backend */
+    codec_queue_init();
+
+    xTaskCreate(codec_queue_process, "Codec Task",
+                RTOS_STACK_DEPTH, NULL, RTOS_TASK_PRIORITY,
+                &rtos_codec_task);
+
     /* Create RTOS Event Group */
     rtos_events = xEventGroupCreate();
 
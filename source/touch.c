@@ -55,6 +55,7 @@
 *******************************************************************************/
 static void capsense_isr(void);
 static void capsense_eos(cy_stc_active_scan_sns_t* active_scan_sns_ptr);
+static void touch_release_pause(void);
 
 /*******************************************************************************
 * Global Variables
@@ -68,6 +69,10 @@ uint8_t  touch_prev_report = 0;
 uint32_t touch_volume_threshold = 0;
 
 TaskHandle_t     touch_task;
+SemaphoreHandle_t touch_pause_sem = NULL;
+volatile bool    touch_pause_waiting = false;
+volatile bool    touch_paused = false;
+volatile bool    touch_scanning = false;
 touch_callback_t touch_callback = NULL;
 touch_status_t   touch_current_state = {0};
 touch_status_t   touch_previous_state = {0};
@@ -85,6 +90,10 @@ void touch_init(void)
     /* Get this task handler */
     touch_task = xTaskGetCurrentTaskHandle();
 
+    /* Given to the task waiting in touch_pause(), created before the first
+       scan is announced */
+    touch_pause_sem = xSemaphoreCreateBinary();
+
     /* CapSense interrupt configuration */
     const cy_stc_sysint_t CapSense_interrupt_config =
     {
@@ -149,6 +158,63 @@ void touch_stop_scan(void)
     touch_scan_enable = false;
 }
 
+/*******************************************************************************
+* Function Name: touch_pause
+********************************************************************************
+* Summary:
+*   Pause the scans, for instance while the clocks are changed. If a scan is
+*   in progress, the calling task waits on a semaphore of its own, given as
+*   soon as the scan completes, so the notifications of the calling task are
+*   left untouched. The scans are resumed with touch_resume().
+*
+* Parameters:
+*   timeout_ms: maximum time to wait for the scan in progress
+*
+* Return:
+*   True if no scan is in progress, false if the wait timed out.
+*
+*******************************************************************************/
+bool touch_pause(uint32_t timeout_ms)
+{
+    /* Discard a give left by a previous pause that timed out. The semaphore
+       exists before the touch task announces its first scan */
+    if (touch_pause_sem != NULL)
+    {
+        (void) xSemaphoreTake(touch_pause_sem, 0);
+    }
+
+    touch_pause_waiting = true;
+
+    /* The touch task checks this flag after setting touch_scanning, so either
+       it does not start a scan, or the scan is seen here */
+    touch_paused = true;
+
+    if (touch_scanning == true)
+    {
+        (void) xSemaphoreTake(touch_pause_sem, pdMS_TO_TICKS(timeout_ms));
+    }
+
+    touch_pause_waiting = false;
+
+    return touch_is_ready();
+}
+
+/*******************************************************************************
+* Function Name: touch_resume
+********************************************************************************
+* Summary:
+*   Resume the scans paused by touch_pause(). The baseline is refreshed, as the
+*   clocks might have changed in the meantime.
+*
+*******************************************************************************/
+void touch_resume(void)
+{
+    touch_update_baseline();
+
+    touch_paused = false;
+    xTaskNotify(touch_task, 0, eNoAction);
+}
+
 /*******************************************************************************
 * Function Name: touch_get_state
 ********************************************************************************
@@ -233,11 +299,18 @@ void touch_process(void *arg)
 
     while (1)
     {
-        /* Check if should keeping scanning */
-        if (touch_scan_enable == false)
+        /* Announce the scan, then check if should keep scanning */
+        touch_scanning = true;
+
+        while ((touch_scan_enable == false) || (touch_paused == true))
         {
+            touch_scanning = false;
+            touch_release_pause();
+
             /* Wait for start of scan */
             xTaskNotifyWait(0, 0, NULL, portMAX_DELAY);
+
+            touch_scanning = true;
         }
 
         /* Start a scan */
@@ -367,15 +440,37 @@ static void capsense_isr(void)
 *******************************************************************************/
 void capsense_eos(cy_stc_active_scan_sns_t* active_scan_sns_ptr)
 {
-    BaseType_t xYieldRequired;
+    BaseType_t xYieldRequired = pdFALSE;
 
     (void)active_scan_sns_ptr;
 
     xTaskNotifyFromISR(touch_task, 0, eNoAction, &xYieldRequired);
 
+    /* Release a task waiting for the scan to pause */
+    touch_scanning = false;
+    if (touch_pause_waiting == true)
+    {
+        (void) xSemaphoreGiveFromISR(touch_pause_sem, &xYieldRequired);
+    }
+
     portYIELD_FROM_ISR(xYieldRequired);
 }
 
+/*******************************************************************************
+* Function Name: touch_release_pause
+********************************************************************************
+* Summary:
+*  Release the task waiting in touch_pause(): no scan is in progress.
+*
+*******************************************************************************/
+static void touch_release_pause(void)
+{
+    if (touch_pause_waiting == true)
+    {
+        (void) xSemaphoreGive(touch_pause_sem);
+    }
+}
+
 
 /* [] END OF FILE */
 
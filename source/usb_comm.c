@@ -51,6 +51,39 @@
 *******************************************************************************/
 #define USBCOMM_DEVICE_ID     0
 
+/* Control map dimensions: entities, control selectors and channels */
+#define USB_COMM_ENTITY_FEATURE_UNIT    (0U)
+#define USB_COMM_ENTITY_OUT_ENDPOINT    (1U)
+#define USB_COMM_ENTITY_IN_ENDPOINT     (2U)
+#define USB_COMM_ENTITIES_NUMBER        (3U)
+#define USB_COMM_SELECTORS_NUMBER       (3U)
+#define USB_COMM_CHANNELS_NUMBER        (AUDIO_FEATURE_UNIT_CHANNELS)
+
+#define USB_COMM_CONTROLS_NUMBER        (sizeof(usb_comm_controls) / sizeof(usb_comm_controls[0]))
+
+/* Mute and volume controls of one feature unit channel. The volume range
+   and resolution are shared by all the channels. */
+#define USB_COMM_FEATURE_UNIT_CONTROLS(ch)                                                          \
+    {                                                                                               \
+        .entity    = AUDIO_CONTROL_FEATURE_UNIT,                                                    \
+        .selector  = CY_USB_DEV_AUDIO_CS_MUTE_CONTROL,                                              \
+        .channel   = (ch),                                                                          \
+        .size      = sizeof(usb_comm_mute[0]),                                                      \
+        .requests  = USB_COMM_RQST_GET_CUR | USB_COMM_RQST_SET_CUR,                                 \
+        .data      = {&usb_comm_mute[(ch)], NULL, NULL, NULL},                                      \
+        .on_change = NULL,                                                                          \
+    },                                                                                              \
+    {                                                                                               \
+        .entity    = AUDIO_CONTROL_FEATURE_UNIT,                                                    \
+        .selector  = CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL,                                            \
+        .channel   = (ch),                                                                          \
+        .size      = AUDIO_VOLUME_SIZE,                                                             \
+        .requests  = USB_COMM_RQST_GET_CUR | USB_COMM_RQST_GET_MIN | USB_COMM_RQST_GET_MAX | USB_COMM_RQST_GET_RES | \
+                     USB_COMM_RQST_SET_CUR | USB_COMM_RQST_SET_MIN | USB_COMM_RQST_SET_MAX | USB_COMM_RQST_SET_RES, \
+        .data      = {usb_comm_cur_volume[(ch)], usb_comm_min_volume, usb_comm_max_volume, usb_comm_res_volume}, \
+        .on_change = NULL,                                                                          \
+    }
+
 /*******************************************************************************
 * Local USB Callbacks
 *******************************************************************************/
@@ -71,6 +104,18 @@ static cy_en_usb_dev_status_t usb_comm_set_configuration(uint32_t config,
                                                          void *classContext,
                                                          cy_stc_usb_dev_context_t *devContext);
 
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void usb_comm_control_build(void);
+static const usb_comm_control_t *usb_comm_control_find(const cy_stc_usb_dev_setup_packet_t *setup);
+static uint32_t usb_comm_control_entity(uint32_t wIndex);
+static uint32_t usb_comm_control_request(uint32_t bRequest);
+static uint32_t usb_comm_control_attribute(uint32_t bRequest);
+static void usb_comm_out_rate_changed(void);
+static void usb_comm_in_rate_changed(void);
+static void usb_comm_signal_event(void);
+
 /***************************************************************************
 * Interrupt configuration
 ***************************************************************************/
@@ -81,8 +126,9 @@ static void usb_low_isr(void);
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
-uint8_t usb_comm_mute;
-uint8_t usb_comm_cur_volume[AUDIO_VOLUME_SIZE]; 
+/* Feature unit controls, indexed by channel: master, left and right */
+uint8_t usb_comm_mute[AUDIO_FEATURE_UNIT_CHANNELS];
+uint8_t usb_comm_cur_volume[AUDIO_FEATURE_UNIT_CHANNELS][AUDIO_VOLUME_SIZE];
 uint8_t usb_comm_min_volume[AUDIO_VOLUME_SIZE] = {CY_USB_DEV_AUDIO_VOLUME_MIN_LSB, CY_USB_DEV_AUDIO_VOLUME_MIN_MSB};
 uint8_t usb_comm_max_volume[AUDIO_VOLUME_SIZE] = {CY_USB_DEV_AUDIO_VOLUME_MAX_LSB, CY_USB_DEV_AUDIO_VOLUME_MAX_MSB};
 uint8_t usb_comm_res_volume[AUDIO_VOLUME_SIZE] = {AUDIO_VOL_RES_LSB, AUDIO_VOL_RES_MSB};
@@ -90,12 +136,45 @@ uint8_t usb_comm_res_volume[AUDIO_VOLUME_SIZE] = {AUDIO_VOL_RES_LSB, AUDIO_VOL_R
 uint8_t usb_comm_ep_map[] = {0U, 0U, 1U};
 uint8_t usb_comm_sample_frequency[AUDIO_STREAMING_EPS_NUMBER][AUDIO_SAMPLE_FREQ_SIZE];
 
-volatile uint32_t usb_comm_new_sample_rate = 0;
+volatile uint32_t usb_comm_new_out_sample_rate = 0;
+volatile uint32_t usb_comm_new_in_sample_rate = 0;
 volatile bool     usb_comm_enable_out_streaming = false;
 volatile bool     usb_comm_enable_in_streaming = false;
+volatile uint32_t usb_comm_out_subframe_size = AUDIO_SAMPLE_DATA_SIZE;
+volatile uint32_t usb_comm_in_subframe_size = AUDIO_SAMPLE_DATA_SIZE;
 volatile bool     usb_comm_enable_feedback = false;
 volatile bool     usb_comm_clock_configured = false;
 
+/* Audio controls handled by the class request callbacks. A new control is one
+   row; usb_comm_control_build() compiles the table into usb_comm_control_map. */
+static const usb_comm_control_t usb_comm_controls[] =
+{
+    USB_COMM_FEATURE_UNIT_CONTROLS(AUDIO_FEATURE_UNIT_MASTER_CHANNEL),
+    USB_COMM_FEATURE_UNIT_CONTROLS(AUDIO_FEATURE_UNIT_LEFT_CHANNEL),
+    USB_COMM_FEATURE_UNIT_CONTROLS(AUDIO_FEATURE_UNIT_RIGHT_CHANNEL),
+    {
+        .entity    = AUDIO_STREAMING_OUT_ENDPOINT_ADDR,
+        .selector  = CY_USB_DEV_AUDIO_CS_SAMPLING_FREQ_CTRL,
+        .channel   = USB_COMM_CONTROL_ANY_CHANNEL,
+        .size      = AUDIO_SAMPLE_FREQ_SIZE,
+        .requests  = USB_COMM_RQST_GET_CUR | USB_COMM_RQST_SET_CUR,
+        .data      = {usb_comm_sample_frequency[0], NULL, NULL, NULL},
+        .on_change = usb_comm_out_rate_changed,
+    },
+    {
+        .entity    = AUDIO_STREAMING_IN_ENDPOINT_ADDR,
+        .selector  = CY_USB_DEV_AUDIO_CS_SAMPLING_FREQ_CTRL,
+        .channel   = USB_COMM_CONTROL_ANY_CHANNEL,
+        .size      = AUDIO_SAMPLE_FREQ_SIZE,
+        .requests  = USB_COMM_RQST_GET_CUR | USB_COMM_RQST_SET_CUR,
+        .data      = {usb_comm_sample_frequency[1], NULL, NULL, NULL},
+        .on_change = usb_comm_in_rate_changed,
+    },
+};
+
+/* Row of usb_comm_controls plus one for each entity, selector and channel */
+static uint8_t usb_comm_control_map[USB_COMM_ENTITIES_NUMBER][USB_COMM_SELECTORS_NUMBER][USB_COMM_CHANNELS_NUMBER];
+
 static usb_comm_interface_t usb_comm_interface = {
     .disable_in = NULL,
     .disable_out = NULL,
@@ -135,6 +214,9 @@ cy_stc_usb_dev_hid_context_t    usb_hidContext;
 *******************************************************************************/
 void usb_comm_init(void)
 {
+    /* Compile the audio control table */
+    usb_comm_control_build();
+
     /* Start the USB Block */
     Cy_USB_Dev_Init(CYBSP_USBDEV_HW,
                     &CYBSP_USBDEV_config,
@@ -234,11 +316,44 @@ uint32_t usb_comm_get_sample_rate(uint32_t endpoint)
     return newFrequency;
 }
 
+/*******************************************************************************
+* Function Name: usb_comm_get_volume
+********************************************************************************
+* Summary:
+*   Returns a volume control value, in 1/256 dB.
+*
+* Parameters:
+*   volume: volume control (current, minimum, maximum or resolution)
+*
+*******************************************************************************/
+int16_t usb_comm_get_volume(const uint8_t *volume)
+{
+    return (int16_t) (((uint16_t) volume[1] << 8) | volume[0]);
+}
+
+/*******************************************************************************
+* Function Name: usb_comm_set_volume
+********************************************************************************
+* Summary:
+*   Sets a volume control value, in 1/256 dB.
+*
+* Parameters:
+*   volume: volume control (current, minimum, maximum or resolution)
+*   value: new value
+*
+*******************************************************************************/
+void usb_comm_set_volume(uint8_t *volume, int16_t value)
+{
+    volume[0] = CY_LO8((uint16_t) value);
+    volume[1] = CY_HI8((uint16_t) value);
+}
+
 /*******************************************************************************
 * Function Name: usb_comm_request_received
 ********************************************************************************
 * Summary:
-*   Callback implementation for the Audio Request Received.
+*   Callback implementation for the Audio Request Received. Looks up the
+*   control in the control map and points the data stage at its storage.
 *
 *******************************************************************************/
 cy_en_usb_dev_status_t usb_comm_request_received(cy_stc_usb_dev_control_transfer_t *transfer,
@@ -251,240 +366,40 @@ cy_en_usb_dev_status_t usb_comm_request_received(cy_stc_usb_dev_control_transfer
 
     if (transfer->setup.bmRequestType.type == CY_USB_DEV_CLASS_TYPE)
     {
-        /* Feature Unit */
-        if (AUDIO_CONTROL_FEATURE_UNIT == transfer->setup.wIndex)
+        const usb_comm_control_t *control = usb_comm_control_find(&transfer->setup);
+        uint32_t request = usb_comm_control_request(transfer->setup.bRequest);
+
+        if ((NULL != control) && (0U != (control->requests & request)))
         {
-            /* Control selector */
-            switch (CY_HI8(transfer->setup.wValue))
+            if (request >= USB_COMM_RQST_GET_CUR)
             {
-                /* Handle the Audio Mute Control Request */
-                case CY_USB_DEV_AUDIO_MUTE_CONTROL:
-                {
-                    /* Select channel number */
-                    switch (CY_LO8(transfer->setup.wValue))
-                    {
-                        case AUDIO_FEATURE_UNIT_MASTER_CHANNEL:
-                        {
-                            switch (transfer->setup.bRequest)
-                            {
-                                case CY_USB_DEV_AUDIO_RQST_GET_CUR:
-                                {
-                                    /* Get current audio mute control */
-                                    transfer->ptr       = &usb_comm_mute;
-                                    transfer->remaining = sizeof(usb_comm_mute);
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_SET_CUR:
-                                {
-                                    /* Set audio mute control */
-                                    transfer->ptr       = transfer->buffer;
-                                    transfer->remaining = sizeof(usb_comm_mute);
-                                    transfer->notify    = true;
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-                            }
-                        }
-                        break;
-
-                        default:
-                            /* Only Master channel is supported */
-                        break;
-                    }
-                }
-                break;
-
-                /* Handle the Audio Volume Control Request */
-                case CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL:
-                {
-                    /* Select channel number */
-                    switch (CY_LO8(transfer->setup.wValue))
-                    {
-                        case AUDIO_FEATURE_UNIT_MASTER_CHANNEL:
-                        {
-                            switch (transfer->setup.bRequest)
-                            {
-                                case CY_USB_DEV_AUDIO_RQST_GET_CUR:
-                                {
-                                    /* Get current audio volume */
-                                    transfer->ptr       = usb_comm_cur_volume;
-                                    transfer->remaining = sizeof(usb_comm_cur_volume);
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_GET_MIN:
-                                {
-                                    /* Get current minimum volume */
-                                    transfer->ptr       = usb_comm_min_volume;
-                                    transfer->remaining = sizeof(usb_comm_min_volume);
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_GET_MAX:
-                                {
-                                    /* Get current maximum volume */
-                                    transfer->ptr       = usb_comm_max_volume;
-                                    transfer->remaining = sizeof(usb_comm_max_volume);
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_GET_RES:
-                                {
-                                    /* Get current volume resolution */
-                                    transfer->ptr       = usb_comm_res_volume;
-                                    transfer->remaining = sizeof(usb_comm_res_volume);
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_SET_CUR:
-                                {
-                                    /* Set audio volume  */
-                                    transfer->remaining = AUDIO_VOLUME_SIZE;
-                                    transfer->notify    = true;
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_SET_MIN:
-                                {
-                                    /* Set mininum volume */
-                                    transfer->remaining = AUDIO_VOLUME_SIZE;
-                                    transfer->notify    = true;
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_SET_MAX:
-                                {
-                                    /* Set maximum volume */
-                                    transfer->remaining = AUDIO_VOLUME_SIZE;
-                                    transfer->notify    = true;
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_SET_RES:
-                                {
-                                    /* Set volume resolution */
-                                    transfer->remaining = AUDIO_VOLUME_SIZE;
-                                    transfer->notify    = true;
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                default:
-                                break;
-                            } /* switch (transfer->setup.bRequest) */
-                        }
-                        break;
-
-                        default:
-                        break;
-                    } /* switch (CY_LO8(transfer->setup.wValue)) */
-                }
-                break;
-
-                default:
-                break;
-            }    /* switch (CY_HI8(transfer->setup.wValue)) */
-        }
-        /* Endpoint */
-        else if ((AUDIO_STREAMING_OUT_ENDPOINT_ADDR == transfer->setup.wIndex) ||
-                 (AUDIO_STREAMING_IN_ENDPOINT_ADDR  == transfer->setup.wIndex))
-        {
-            /* Switch control selector */
-            switch (CY_HI8(transfer->setup.wValue))
+                /* Get the attribute from its storage */
+                transfer->ptr = control->data[usb_comm_control_attribute(transfer->setup.bRequest)];
+            }
+            else
             {
-                /* Handle audio sampling frequency control */
-                case CY_USB_DEV_AUDIO_CS_SAMPLING_FREQ_CTRL:
-                {
-                    switch (transfer->setup.bRequest)
-                    {
-                        case CY_USB_DEV_AUDIO_RQST_GET_CUR:
-                        {
-                            /* Get endpoint number */
-                            uint32_t endpoint = usb_comm_ep_map[(transfer->setup.wIndex & 0x0FU)];
-
-                            /* Get current sampling frequency */
-                            transfer->ptr       = usb_comm_sample_frequency[endpoint];
-                            transfer->remaining = AUDIO_SAMPLE_FREQ_SIZE;
-
-                            retStatus = CY_USB_DEV_SUCCESS;
-                        }
-                        break;
-
-                        case CY_USB_DEV_AUDIO_RQST_SET_CUR:
-                        {
-                            /* Set sampling frequency */
-                            transfer->remaining = AUDIO_SAMPLE_FREQ_SIZE;
-                            transfer->notify    = true;
-
-                            retStatus = CY_USB_DEV_SUCCESS;
-                        }
-                        break;
-
-                        default:
-                        break;
-                    } /* switch (transfer->setup.bRequest) */
-                }
-                break;
-
-                default:
-                break;
-            } /* switch (CY_HI8(transfer->setup.wValue)) */
-        }
-        else
-        {
-            /* Unknown */
-        }
-
-        BaseType_t xHigherPriorityTaskWoken, xResult;
-
-        /* xHigherPriorityTaskWoken must be initialised to pdFALSE. */
-        xHigherPriorityTaskWoken = pdFALSE;
+                /* Receive the attribute, stored once the data stage completes */
+                transfer->ptr    = transfer->buffer;
+                transfer->notify = true;
+            }
 
-        /* Set USB Event bit in the RTOS Events Group */
-        xResult = xEventGroupSetBitsFromISR(
-                              rtos_events,
-                              RTOS_EVENT_USB,
-                              &xHigherPriorityTaskWoken );
+            transfer->remaining = control->size;
 
-        /* Was the message posted successfully? */
-        if( xResult != pdFAIL )
-        {
-            /* If xHigherPriorityTaskWoken is now set to pdTRUE then a context
-            switch should be requested.  The macro used is port specific and will
-            be either portYIELD_FROM_ISR() or portEND_SWITCHING_ISR() - refer to
-            the documentation page for the port being used. */
-            portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+            retStatus = CY_USB_DEV_SUCCESS;
         }
+
+        usb_comm_signal_event();
     }
 
     return retStatus;
 }
 
-
 /*******************************************************************************
 * Function Name: usb_comm_request_completed
 ********************************************************************************
 * Summary:
-*   Callback implementation for the Audio Request Completed.
+*   Callback implementation for the Audio Request Completed. Stores the
+*   attribute received from the host and calls the on-change hook.
 *
 *******************************************************************************/
 cy_en_usb_dev_status_t usb_comm_request_completed(cy_stc_usb_dev_control_transfer_t *transfer,
@@ -497,166 +412,223 @@ cy_en_usb_dev_status_t usb_comm_request_completed(cy_stc_usb_dev_control_transfe
 
     if (transfer->setup.bmRequestType.type == CY_USB_DEV_CLASS_TYPE)
     {
-        /* Feature Unit */
-        if (AUDIO_CONTROL_FEATURE_UNIT == transfer->setup.wIndex)
+        const usb_comm_control_t *control = usb_comm_control_find(&transfer->setup);
+        uint32_t request = usb_comm_control_request(transfer->setup.bRequest);
+
+        if ((NULL != control) && (0U != (control->requests & request)) &&
+            (request < USB_COMM_RQST_GET_CUR))
         {
-            /* Control selector */
-            switch (CY_HI8(transfer->setup.wValue))
+            memcpy(control->data[usb_comm_control_attribute(transfer->setup.bRequest)],
+                   transfer->buffer, control->size);
+
+            if (NULL != control->on_change)
             {
-                case CY_USB_DEV_AUDIO_CS_MUTE_CONTROL:
-                {
-                    /* Select channel number */
-                    switch (CY_LO8(transfer->setup.wValue))
-                    {
-                        case AUDIO_FEATURE_UNIT_MASTER_CHANNEL:
-                        {
-                            switch (transfer->setup.bRequest)
-                            {
-                                case CY_USB_DEV_AUDIO_RQST_SET_CUR:
-                                {
-                                    /* Update mute control */
-                                    memcpy(&usb_comm_mute, transfer->buffer, sizeof(usb_comm_mute));
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-                            }
-                        }
-                        break;
-
-                        default:
-                            /* Only Master channel is supported */
-                        break;
-                    }
-                }
-                break;
-
-                case CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL:
-                {
-                    /* Select channel number */
-                    switch (CY_LO8(transfer->setup.wValue))
-                    {
-                        case AUDIO_FEATURE_UNIT_MASTER_CHANNEL:
-                        {
-                            switch (transfer->setup.bRequest)
-                            {
-                                case CY_USB_DEV_AUDIO_RQST_SET_CUR:
-                                {
-                                    /* Update audio volume */
-                                    memcpy(usb_comm_cur_volume, transfer->buffer, sizeof(usb_comm_cur_volume));
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_SET_MIN:
-                                {
-                                    /* Update minimum volume */
-                                    memcpy(usb_comm_min_volume, transfer->buffer, sizeof(usb_comm_min_volume));
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_SET_MAX:
-                                {
-                                    /* Update maximum volume */
-                                    memcpy(usb_comm_max_volume, transfer->buffer, sizeof(usb_comm_max_volume));
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                case CY_USB_DEV_AUDIO_RQST_SET_RES:
-                                {
-                                    /* Update resolution volume */
-                                    memcpy(usb_comm_res_volume, transfer->buffer, sizeof(usb_comm_res_volume));
-
-                                    retStatus = CY_USB_DEV_SUCCESS;
-                                }
-                                break;
-
-                                default:
-                                break;
-                            } /* switch (transfer->setup.bRequest) */
-                        }
-                        break;
-
-                        default:
-                        break;
-                    } /* switch (CY_LO8(transfer->setup.wValue)) */
-                }
-                break;
-
-                default:
-                break;
-            } /* switch (CY_HI8(transfer->setup.wValue)) */
+                control->on_change();
+            }
+
+            retStatus = CY_USB_DEV_SUCCESS;
         }
-        else if ((AUDIO_STREAMING_OUT_ENDPOINT_ADDR == transfer->setup.wIndex) ||
-                 (AUDIO_STREAMING_IN_ENDPOINT_ADDR  == transfer->setup.wIndex))
+
+        usb_comm_signal_event();
+    }
+
+    return retStatus;
+}
+
+/*******************************************************************************
+* Function Name: usb_comm_control_build
+********************************************************************************
+* Summary:
+*   Compiles the control table into the control map, indexed by entity,
+*   control selector and channel.
+*
+*******************************************************************************/
+static void usb_comm_control_build(void)
+{
+    memset(usb_comm_control_map, 0, sizeof(usb_comm_control_map));
+
+    for (uint32_t row = 0; row < USB_COMM_CONTROLS_NUMBER; row++)
+    {
+        const usb_comm_control_t *control = &usb_comm_controls[row];
+        uint32_t entity = usb_comm_control_entity(control->entity);
+
+        CY_ASSERT((entity < USB_COMM_ENTITIES_NUMBER) &&
+                  (control->selector < USB_COMM_SELECTORS_NUMBER));
+
+        for (uint32_t channel = 0; channel < USB_COMM_CHANNELS_NUMBER; channel++)
         {
-            /* Switch control selector */
-            switch (CY_HI8(transfer->setup.wValue))
+            if ((USB_COMM_CONTROL_ANY_CHANNEL == control->channel) ||
+                (channel == control->channel))
             {
-                case CY_USB_DEV_AUDIO_CS_SAMPLING_FREQ_CTRL:
-                {
-                    /* Get endpoint number */
-                    uint32_t endpoint = usb_comm_ep_map[(transfer->setup.wIndex & 0x0FU)];
-
-                    switch (transfer->setup.bRequest)
-                    {
-                        case CY_USB_DEV_AUDIO_RQST_SET_CUR:
-                        {
-                            memcpy(usb_comm_sample_frequency[endpoint], transfer->ptr, AUDIO_SAMPLE_FREQ_SIZE);
-
-                            /* Configure feedback endpoint data */
-                            usb_comm_new_sample_rate = usb_comm_get_sample_rate(endpoint);
-
-                            /* Clear Sync bit */
-                            xEventGroupClearBitsFromISR(rtos_events,
-                                                        RTOS_EVENT_SYNC);
-
-                            retStatus = CY_USB_DEV_SUCCESS;
-                        }
-                        break;
-
-                        default:
-                        break;
-                    }
-                }
-                break;
-
-                default:
-                break;
-            } /* switch (CY_HI8(transfer->setup.wValue)) */
-        }
-        else
-        {
-            /* Unknown */
+                /* Zero marks an empty slot */
+                usb_comm_control_map[entity][control->selector][channel] = (uint8_t) (row + 1U);
+            }
         }
+    }
+}
 
-        BaseType_t xHigherPriorityTaskWoken, xResult;
+/*******************************************************************************
+* Function Name: usb_comm_control_find
+********************************************************************************
+* Summary:
+*   Looks up the control addressed by a setup packet.
+*
+* Parameters:
+*   setup: setup packet of the request
+*
+* Return:
+*   Control table row, or NULL if the control is not supported.
+*
+*******************************************************************************/
+static const usb_comm_control_t *usb_comm_control_find(const cy_stc_usb_dev_setup_packet_t *setup)
+{
+    uint32_t entity   = usb_comm_control_entity(setup->wIndex);
+    uint32_t selector = CY_HI8(setup->wValue);
+    uint32_t channel  = CY_LO8(setup->wValue);
+    uint32_t row;
+
+    if ((entity   >= USB_COMM_ENTITIES_NUMBER)  ||
+        (selector >= USB_COMM_SELECTORS_NUMBER) ||
+        (channel  >= USB_COMM_CHANNELS_NUMBER))
+    {
+        return NULL;
+    }
 
-        /* xHigherPriorityTaskWoken must be initialised to pdFALSE. */
-        xHigherPriorityTaskWoken = pdFALSE;
+    row = usb_comm_control_map[entity][selector][channel];
 
-        /* Set USB Event bit in the RTOS Events Group */
-        xResult = xEventGroupSetBitsFromISR(
-                              rtos_events,
-                              RTOS_EVENT_USB,
-                              &xHigherPriorityTaskWoken );
+    return (0U == row) ? NULL : &usb_comm_controls[row - 1U];
+}
 
-        /* Was the message posted successfully? */
-        if( xResult != pdFAIL )
-        {
-            /* If xHigherPriorityTaskWoken is now set to pdTRUE then a context
-            switch should be requested.  The macro used is port specific and will
-            be either portYIELD_FROM_ISR() or portEND_SWITCHING_ISR() - refer to
-            the documentation page for the port being used. */
-            portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
-        }
+/*******************************************************************************
+* Function Name: usb_comm_control_entity
+********************************************************************************
+* Summary:
+*   Maps the wIndex of a request to an index in the control map.
+*
+* Parameters:
+*   wIndex: unit ID and interface, or endpoint address
+*
+* Return:
+*   Entity index, or USB_COMM_ENTITIES_NUMBER if the entity is unknown.
+*
+*******************************************************************************/
+static uint32_t usb_comm_control_entity(uint32_t wIndex)
+{
+    switch (wIndex)
+    {
+        case AUDIO_CONTROL_FEATURE_UNIT:
+            return USB_COMM_ENTITY_FEATURE_UNIT;
+
+        case AUDIO_STREAMING_OUT_ENDPOINT_ADDR:
+            return USB_COMM_ENTITY_OUT_ENDPOINT;
+
+        case AUDIO_STREAMING_IN_ENDPOINT_ADDR:
+            return USB_COMM_ENTITY_IN_ENDPOINT;
+
+        default:
+            return USB_COMM_ENTITIES_NUMBER;
     }
+}
 
-    return retStatus;
+/*******************************************************************************
+* Function Name: usb_comm_control_request
+********************************************************************************
+* Summary:
+*   Converts an audio class bRequest to its USB_COMM_RQST_* bit.
+*
+* Parameters:
+*   bRequest: audio class request code
+*
+* Return:
+*   Request bit, or zero if the request is not supported.
+*
+*******************************************************************************/
+static uint32_t usb_comm_control_request(uint32_t bRequest)
+{
+    uint32_t attribute = (bRequest & 0x0FU);
+
+    if ((0U == attribute) || (attribute > USB_COMM_CONTROL_ATTRIBUTES))
+    {
+        return 0U;
+    }
+
+    /* GET requests have bit 7 set and use the upper nibble */
+    return (1UL << (attribute - 1U)) << ((0U != (bRequest & 0x80U)) ? 4U : 0U);
+}
+
+/*******************************************************************************
+* Function Name: usb_comm_control_attribute
+********************************************************************************
+* Summary:
+*   Returns the attribute (current, minimum, maximum or resolution) addressed
+*   by a supported audio class bRequest.
+*
+*******************************************************************************/
+static uint32_t usb_comm_control_attribute(uint32_t bRequest)
+{
+    return ((bRequest & 0x0FU) - 1U);
+}
+
+/*******************************************************************************
+* Function Name: usb_comm_out_rate_changed
+********************************************************************************
+* Summary:
+*   On-change hook of the Audio OUT sampling frequency control.
+*
+*******************************************************************************/
+static void usb_comm_out_rate_changed(void)
+{
+    usb_comm_new_out_sample_rate = usb_comm_get_sample_rate(usb_comm_ep_map[AUDIO_STREAMING_OUT_ENDPOINT_ADDR & 0x0FU]);
+
+    /* Clear Sync bit */
+    xEventGroupClearBitsFromISR(rtos_events, RTOS_EVENT_SYNC);
+}
+
+/*******************************************************************************
+* Function Name: usb_comm_in_rate_changed
+********************************************************************************
+* Summary:
+*   On-change hook of the Audio IN sampling frequency control.
+*
+*******************************************************************************/
+static void usb_comm_in_rate_changed(void)
+{
+    usb_comm_new_in_sample_rate = usb_comm_get_sample_rate(usb_comm_ep_map[AUDIO_STREAMING_IN_ENDPOINT_ADDR & 0x0FU]);
+
+    /* Clear Sync bit */
+    xEventGroupClearBitsFromISR(rtos_events, RTOS_EVENT_SYNC);
+}
+
+/*******************************************************************************
+* Function Name: usb_comm_signal_event
+********************************************************************************
+* Summary:
+*   Sets the USB event bit from the USB interrupt, so the audio task handles
+*   the new control values.
+*
+*******************************************************************************/
+static void usb_comm_signal_event(void)
+{
+    BaseType_t xHigherPriorityTaskWoken, xResult;
+
+    /* xHigherPriorityTaskWoken must be initialised to pdFALSE. */
+    xHigherPriorityTaskWoken = pdFALSE;
+
+    /* Set USB Event bit in the RTOS Events Group */
+    xResult = xEventGroupSetBitsFromISR(
+                          rtos_events,
+                          RTOS_EVENT_USB,
+                          &xHigherPriorityTaskWoken );
+
+    /* Was the message posted successfully? */
+    if( xResult != pdFAIL )
+    {
+        /* If xHigherPriorityTaskWoken is now set to pdTRUE then a context
+        switch should be requested.  The macro used is port specific and will
+        be either portYIELD_FROM_ISR() or portEND_SWITCHING_ISR() - refer to
+        the documentation page for the port being used. */
+        portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+    }
 }
 
 /*******************************************************************************
@@ -681,7 +653,9 @@ cy_en_usb_dev_status_t usb_comm_set_configuration(uint32_t config,
 * Function Name: usb_comm_set_interface
 ********************************************************************************
 * Summary:
-*   Callback implementation for the Audio Set Interface.
+*   Callback implementation for the Audio Set Interface. Each streaming
+*   interface has a 24-bit and a 16-bit alternate, the subframe size of the
+*   selected one is recorded for the audio paths.
 *
 *******************************************************************************/
 cy_en_usb_dev_status_t usb_comm_set_interface(uint32_t interface,
@@ -695,7 +669,17 @@ cy_en_usb_dev_status_t usb_comm_set_interface(uint32_t interface,
     if (AUDIO_STREAMING_OUT_INTERFACE == interface)
     {
         /* Check interface OUT Streaming alternate */
-        usb_comm_enable_out_streaming = (AUDIO_STREAMING_OUT_ALTERNATE == alternate);
+        if (AUDIO_STREAMING_OUT_ALTERNATE_16BIT == alternate)
+        {
+            usb_comm_out_subframe_size = AUDIO_SAMPLE_DATA_SIZE_16BIT;
+        }
+        else
+        {
+            usb_comm_out_subframe_size = AUDIO_SAMPLE_DATA_SIZE;
+        }
+
+        usb_comm_enable_out_streaming = ((AUDIO_STREAMING_OUT_ALTERNATE == alternate) ||
+                                         (AUDIO_STREAMING_OUT_ALTERNATE_16BIT == alternate));
 
         if (usb_comm_enable_out_streaming)
         {
@@ -716,7 +700,17 @@ cy_en_usb_dev_status_t usb_comm_set_interface(uint32_t interface,
     if (AUDIO_STREAMING_IN_INTERFACE == interface)
     {
         /* Check interface IN Streaming alternate */
-        usb_comm_enable_in_streaming = (AUDIO_STREAMING_IN_ALTERNATE == alternate);
+        if (AUDIO_STREAMING_IN_ALTERNATE_16BIT == alternate)
+        {
+            usb_comm_in_subframe_size = AUDIO_SAMPLE_DATA_SIZE_16BIT;
+        }
+        else
+        {
+            usb_comm_in_subframe_size = AUDIO_SAMPLE_DATA_SIZE;
+        }
+
+        usb_comm_enable_in_streaming = ((AUDIO_STREAMING_IN_ALTERNATE == alternate) ||
+                                        (AUDIO_STREAMING_IN_ALTERNATE_16BIT == alternate));
 
         if (usb_comm_enable_in_streaming)
         {
@@ -0,0 +1,199 @@
+/*******************************************************************************
+* File Name: bench_audio_convert.c
+*
+* Description: Host benchmark of the packing routines against their byte-wise
+*  references, in ns per sample, on one 1-ms stereo frame at 96 kHz. The
+*  outputs are compared before timing.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio.h"
+#include "audio_convert.h"
+#include "audio_convert_ref.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*******************************************************************************
+* Bench Constants
+*******************************************************************************/
+/* Samples in a frame, and frames converted per measure */
+#define BENCH_LENGTH        (AUDIO_MAX_FRAME_DATA_SIZE)
+#define BENCH_ITERATIONS    (200000u)
+
+/*******************************************************************************
+* Bench Types
+*******************************************************************************/
+typedef void (*bench_to_32_t)(const uint8_t *src, uint32_t *dst, uint32_t length);
+typedef void (*bench_from_32_t)(const uint32_t *src, uint8_t *dst, uint32_t length);
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static double bench_now_ns(void);
+static double bench_to_32(bench_to_32_t convert);
+static double bench_from_32(bench_from_32_t convert);
+static int    bench_report(const char *name, double fast_ns, double ref_ns, int exact);
+
+/*******************************************************************************
+* Bench Variables
+*******************************************************************************/
+/* USB packet, used at an odd address for the worst case of the unaligned
+   accesses, and I2S words */
+uint8_t  bench_usb[4u * BENCH_LENGTH + 1u];
+uint8_t  bench_usb_ref[4u * BENCH_LENGTH + 1u];
+uint32_t bench_i2s[BENCH_LENGTH];
+uint32_t bench_i2s_ref[BENCH_LENGTH];
+
+/*******************************************************************************
+* Function Name: bench_now_ns
+********************************************************************************
+* Summary:
+*   Return the monotonic time in ns.
+*
+*******************************************************************************/
+static double bench_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double) now.tv_sec * 1e9) + (double) now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: bench_to_32
+********************************************************************************
+* Summary:
+*   Time a USB to I2S routine, in ns per sample.
+*
+*******************************************************************************/
+static double bench_to_32(bench_to_32_t convert)
+{
+    double start = bench_now_ns();
+
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        convert(&bench_usb[1], bench_i2s, BENCH_LENGTH);
+    }
+
+    return (bench_now_ns() - start) / ((double) BENCH_ITERATIONS * BENCH_LENGTH);
+}
+
+/*******************************************************************************
+* Function Name: bench_from_32
+********************************************************************************
+* Summary:
+*   Time an I2S to USB routine, in ns per sample.
+*
+*******************************************************************************/
+static double bench_from_32(bench_from_32_t convert)
+{
+    double start = bench_now_ns();
+
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        convert(bench_i2s, &bench_usb[1], BENCH_LENGTH);
+    }
+
+    return (bench_now_ns() - start) / ((double) BENCH_ITERATIONS * BENCH_LENGTH);
+}
+
+/*******************************************************************************
+* Function Name: bench_report
+********************************************************************************
+* Summary:
+*   Print one line of results. Returns 1 if the outputs differ.
+*
+*******************************************************************************/
+static int bench_report(const char *name, double fast_ns, double ref_ns, int exact)
+{
+    printf("  %-12s %8.3f %8.3f %7.2fx  %s\n", name, fast_ns, ref_ns,
+           ref_ns / fast_ns, exact ? "bit-exact" : "MISMATCH");
+
+    return exact ? 0 : 1;
+}
+
+int main(void)
+{
+    int errors = 0;
+    int exact;
+    double fast_ns;
+    double ref_ns;
+
+    srand(1u);
+    for (uint32_t i = 0; i < sizeof(bench_usb); i++)
+    {
+        bench_usb[i] = (uint8_t) (rand() >> 7);
+    }
+    for (uint32_t i = 0; i < BENCH_LENGTH; i++)
+    {
+        bench_i2s[i] = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+    }
+
+    printf("bench_audio_convert: %u samples per frame, ns/sample\n", BENCH_LENGTH);
+    printf("  %-12s %8s %8s %8s\n", "routine", "word", "byte", "speedup");
+
+    audio_convert_24_to_32(&bench_usb[1], bench_i2s, BENCH_LENGTH);
+    audio_convert_ref_24_to_32(&bench_usb[1], bench_i2s_ref, BENCH_LENGTH);
+    exact = (memcmp(bench_i2s, bench_i2s_ref, sizeof(bench_i2s)) == 0);
+    fast_ns = bench_to_32(audio_convert_24_to_32);
+    ref_ns  = bench_to_32(audio_convert_ref_24_to_32);
+    errors += bench_report("24 to 32", fast_ns, ref_ns, exact);
+
+    audio_convert_16_to_32(&bench_usb[1], bench_i2s, BENCH_LENGTH);
+    audio_convert_ref_16_to_32(&bench_usb[1], bench_i2s_ref, BENCH_LENGTH);
+    exact = (memcmp(bench_i2s, bench_i2s_ref, sizeof(bench_i2s)) == 0);
+    fast_ns = bench_to_32(audio_convert_16_to_32);
+    ref_ns  = bench_to_32(audio_convert_ref_16_to_32);
+    errors += bench_report("16 to 32", fast_ns, ref_ns, exact);
+
+    audio_convert_32_to_24(bench_i2s, &bench_usb[1], BENCH_LENGTH);
+    audio_convert_ref_32_to_24(bench_i2s, &bench_usb_ref[1], BENCH_LENGTH);
+    exact = (memcmp(&bench_usb[1], &bench_usb_ref[1], 3u * BENCH_LENGTH) == 0);
+    fast_ns = bench_from_32(audio_convert_32_to_24);
+    ref_ns  = bench_from_32(audio_convert_ref_32_to_24);
+    errors += bench_report("32 to 24", fast_ns, ref_ns, exact);
+
+    audio_convert_32_to_16(bench_i2s, &bench_usb[1], BENCH_LENGTH);
+    audio_convert_ref_32_to_16(bench_i2s, &bench_usb_ref[1], BENCH_LENGTH);
+    exact = (memcmp(&bench_usb[1], &bench_usb_ref[1], 2u * BENCH_LENGTH) == 0);
+    fast_ns = bench_from_32(audio_convert_32_to_16);
+    ref_ns  = bench_from_32(audio_convert_ref_32_to_16);
+    errors += bench_report("32 to 16", fast_ns, ref_ns, exact);
+
+    return (errors == 0) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,131 @@
+/*******************************************************************************
+* File Name: bench_audio_gain.c
+*
+* Description: Host benchmark of the software gain stage, in ns per sample,
+*  at unity, at a fixed gain, and while ramping.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio.h"
+#include "audio_gain.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*******************************************************************************
+* Bench Constants
+*******************************************************************************/
+/* Samples in a frame, and frames processed per measure */
+#define BENCH_LENGTH        (AUDIO_MAX_FRAME_DATA_SIZE)
+#define BENCH_ITERATIONS    (200000u)
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static double bench_now_ns(void);
+static double bench_gain(int32_t target, bool ramp);
+
+/*******************************************************************************
+* Bench Variables
+*******************************************************************************/
+uint32_t bench_samples[BENCH_LENGTH];
+
+/*******************************************************************************
+* Function Name: bench_now_ns
+********************************************************************************
+* Summary:
+*   Return the monotonic time in ns.
+*
+*******************************************************************************/
+static double bench_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double) now.tv_sec * 1e9) + (double) now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: bench_gain
+********************************************************************************
+* Summary:
+*   Time the gain stage, in ns per sample. When ramp is set, the target
+*   alternates every frame so each frame is a full ramp.
+*
+*******************************************************************************/
+static double bench_gain(int32_t target, bool ramp)
+{
+    audio_gain_t gain;
+    double start;
+
+    audio_gain_init(&gain);
+    audio_gain_set_target(&gain, 0u, target);
+    audio_gain_set_target(&gain, 1u, target);
+    audio_gain_start_frame(&gain, BENCH_LENGTH);
+    audio_gain_process(&gain, bench_samples, BENCH_LENGTH);
+
+    start = bench_now_ns();
+
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        if (ramp)
+        {
+            target = (i & 1u) ? (AUDIO_GAIN_UNITY / 2) : (AUDIO_GAIN_UNITY / 4);
+            audio_gain_set_target(&gain, 0u, target);
+            audio_gain_set_target(&gain, 1u, target);
+        }
+        audio_gain_start_frame(&gain, BENCH_LENGTH);
+        audio_gain_process(&gain, bench_samples, BENCH_LENGTH);
+    }
+
+    return (bench_now_ns() - start) / ((double) BENCH_ITERATIONS * BENCH_LENGTH);
+}
+
+int main(void)
+{
+    srand(1u);
+    for (uint32_t i = 0; i < BENCH_LENGTH; i++)
+    {
+        bench_samples[i] = (uint32_t) rand() & 0x00FFFFFFu;
+    }
+
+    printf("bench_audio_gain: %u samples per frame, ns/sample\n", BENCH_LENGTH);
+    printf("  %-12s %8.3f\n", "unity", bench_gain(AUDIO_GAIN_UNITY, false));
+    printf("  %-12s %8.3f\n", "fixed", bench_gain(AUDIO_GAIN_UNITY / 2, false));
+    printf("  %-12s %8.3f\n", "ramp", bench_gain(AUDIO_GAIN_UNITY / 2, true));
+
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* File Name: bench_audio_src.c
+*
+* Description: Host benchmark of the polyphase sample-rate converter, in ns
+*  per output sample, at the rate pairs of the playback and capture streams.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio.h"
+#include "audio_src.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*******************************************************************************
+* Bench Constants
+*******************************************************************************/
+/* Frames converted per measure */
+#define BENCH_FRAMES        (2000000u)
+
+/* Frames of input taken per call, one 1-ms frame at the highest rate */
+#define BENCH_BLOCK         (AUDIO_MAX_FRAME_DATA_SIZE / AUDIO_SRC_CHANNELS)
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static double bench_now_ns(void);
+static void   bench_src(uint32_t in_rate, uint32_t out_rate);
+
+/*******************************************************************************
+* Bench Variables
+*******************************************************************************/
+audio_src_t bench_src_state;
+uint32_t bench_in[AUDIO_SRC_CHANNELS * BENCH_BLOCK];
+uint32_t bench_out[AUDIO_SRC_BUFFER_SIZE * 4u];
+
+/*******************************************************************************
+* Function Name: bench_now_ns
+********************************************************************************
+* Summary:
+*   Return the monotonic time in ns.
+*
+*******************************************************************************/
+static double bench_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double) now.tv_sec * 1e9) + (double) now.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: bench_src
+********************************************************************************
+* Summary:
+*   Time the conversion of a pair of rates and print one line of results, in
+*   ns per output sample (one channel of one frame).
+*
+*******************************************************************************/
+static void bench_src(uint32_t in_rate, uint32_t out_rate)
+{
+    uint32_t produced = 0;
+    double start;
+    double elapsed;
+
+    if (audio_src_init(&bench_src_state, in_rate, out_rate) == false)
+    {
+        printf("  %6u %6u  unsupported\n", in_rate, out_rate);
+        return;
+    }
+
+    start = bench_now_ns();
+
+    for (uint32_t i = 0; i < (BENCH_FRAMES / BENCH_BLOCK); i++)
+    {
+        produced += audio_src_process(&bench_src_state, bench_in, BENCH_BLOCK, bench_out,
+                                      sizeof(bench_out) / sizeof(bench_out[0]) / AUDIO_SRC_CHANNELS);
+    }
+
+    elapsed = bench_now_ns() - start;
+
+    printf("  %6u %6u %5u %5u %8.3f\n", in_rate, out_rate, bench_src_state.up,
+           bench_src_state.taps, elapsed / ((double) produced * AUDIO_SRC_CHANNELS));
+}
+
+int main(void)
+{
+    srand(1u);
+    for (uint32_t i = 0; i < (AUDIO_SRC_CHANNELS * BENCH_BLOCK); i++)
+    {
+        bench_in[i] = (uint32_t) rand() & 0x00FFFFFFu;
+    }
+
+    printf("bench_audio_src: ns/output sample\n");
+    printf("  %6s %6s %5s %5s %8s\n", "in", "out", "L", "taps", "ns");
+
+    bench_src(44100u, 48000u);
+    bench_src(48000u, 44100u);
+    bench_src(48000u, 16000u);
+    bench_src(48000u, 22050u);
+    bench_src(48000u, 32000u);
+    bench_src(96000u, 16000u);
+    bench_src(44100u, 96000u);
+
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,398 @@
+/*******************************************************************************
+* File Name: gen_audio_src_coef.c
+*
+* Description: Host generator of the coefficient tables of the polyphase sample-
+*  rate converter. It designs the branches of each rate ratio the Audio OUT and
+*  Audio IN streams use and prints source/audio_src_coef.c, so the converter
+*  only selects a table when the sample rate changes. Run make -C test coef
+*  after changing the design.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio_src.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+* Generator Constants
+*******************************************************************************/
+#define GEN_PI                  (3.14159265f)
+
+/* Coefficients are stored in Q15 */
+#define GEN_COEF_ONE            (1L << 15)
+
+/* Rates of each stream, as in the USB descriptors, and the I2S rate of the
+   fixed-rate mode */
+#define GEN_OUT_RATES           (4u)
+#define GEN_IN_RATES            (7u)
+#define GEN_FIXED_RATE          (AUDIO_SAMPLING_RATE_48KHZ)
+
+/* Most ratios the streams use, and rate pairs sharing one ratio */
+#define GEN_RATIOS              (32u)
+#define GEN_PAIRS               (8u)
+
+/* Coefficients printed per line */
+#define GEN_COEF_PER_LINE       (12u)
+
+/*******************************************************************************
+* Generator Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t up;
+    uint32_t down;
+    uint32_t taps;
+    uint32_t pairs;
+    uint32_t in_rate[GEN_PAIRS];
+    uint32_t out_rate[GEN_PAIRS];
+} gen_ratio_t;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static uint32_t gen_gcd(uint32_t a, uint32_t b);
+static void     gen_add_pair(uint32_t in_rate, uint32_t out_rate);
+static void     gen_design(const gen_ratio_t *ratio, int16_t *coef);
+static void     gen_print_table(const gen_ratio_t *ratio);
+
+/*******************************************************************************
+* Generator Variables
+*******************************************************************************/
+const uint32_t gen_out_rates[GEN_OUT_RATES] =
+{
+    AUDIO_SAMPLING_RATE_44KHZ, AUDIO_SAMPLING_RATE_48KHZ,
+    AUDIO_SAMPLING_RATE_88KHZ, AUDIO_SAMPLING_RATE_96KHZ
+};
+
+const uint32_t gen_in_rates[GEN_IN_RATES] =
+{
+    AUDIO_SAMPLING_RATE_16KHZ, AUDIO_SAMPLING_RATE_22KHZ, AUDIO_SAMPLING_RATE_32KHZ,
+    AUDIO_SAMPLING_RATE_44KHZ, AUDIO_SAMPLING_RATE_48KHZ,
+    AUDIO_SAMPLING_RATE_88KHZ, AUDIO_SAMPLING_RATE_96KHZ
+};
+
+const char *gen_license[] =
+{
+    "******************************************************************************",
+    "* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.",
+    "*******************************************************************************",
+    "* This software, including source code, documentation and related materials",
+    "* (\"Software\"), is owned by Cypress Semiconductor Corporation or one of its",
+    "* subsidiaries (\"Cypress\") and is protected by and subject to worldwide patent",
+    "* protection (United States and foreign), United States copyright laws and",
+    "* international treaty provisions. Therefore, you may use this Software only",
+    "* as provided in the license agreement accompanying the software package from",
+    "* which you obtained this Software (\"EULA\").",
+    "*",
+    "* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,",
+    "* non-transferable license to copy, modify, and compile the Software source",
+    "* code solely for use in connection with Cypress's integrated circuit products.",
+    "* Any reproduction, modification, translation, compilation, or representation",
+    "* of this Software except as specified above is prohibited without the express",
+    "* written permission of Cypress.",
+    "*",
+    "* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,",
+    "* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED",
+    "* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress",
+    "* reserves the right to make changes to the Software without notice. Cypress",
+    "* does not assume any liability arising out of the application or use of the",
+    "* Software or any product or circuit described in the Software. Cypress does",
+    "* not authorize its products for use in any products where a malfunction or",
+    "* failure of the Cypress product may reasonably be expected to result in",
+    "* significant property damage, injury or death (\"High Risk Product\"). By",
+    "* including Cypress's product in a High Risk Product, the manufacturer of such",
+    "* system or application assumes all risk of such use and in doing so agrees to",
+    "* indemnify Cypress against all liability.",
+    "*****************************************************************************/"
+};
+
+gen_ratio_t gen_ratios[GEN_RATIOS];
+uint32_t    gen_ratios_number;
+
+/* Prototype taps of a branch, and the coefficients of a table */
+float   gen_prototype[AUDIO_SRC_MAX_TAPS];
+int16_t gen_coef[AUDIO_SRC_MAX_PHASES * AUDIO_SRC_TAPS];
+
+/*******************************************************************************
+* Function Name: gen_gcd
+********************************************************************************
+* Summary:
+*   Greatest common divisor of two rates.
+*
+*******************************************************************************/
+static uint32_t gen_gcd(uint32_t a, uint32_t b)
+{
+    uint32_t t;
+
+    while (0u != b)
+    {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+}
+
+/*******************************************************************************
+* Function Name: gen_add_pair
+********************************************************************************
+* Summary:
+*   Add the ratio of a pair of rates to the tables, unless the rates are equal
+*   or the ratio needs more branches than AUDIO_SRC_MAX_PHASES. The branches
+*   are lengthened when decimating, so the transition band stays as narrow
+*   relative to the output rate, within the coefficient table.
+*
+*******************************************************************************/
+static void gen_add_pair(uint32_t in_rate, uint32_t out_rate)
+{
+    uint32_t gcd = gen_gcd(in_rate, out_rate);
+    uint32_t up = out_rate / gcd;
+    uint32_t down = in_rate / gcd;
+    gen_ratio_t *ratio;
+    uint32_t i;
+    uint32_t j;
+
+    if ((in_rate == out_rate) || (up > AUDIO_SRC_MAX_PHASES))
+    {
+        return;
+    }
+
+    for (i = 0; i < gen_ratios_number; i++)
+    {
+        ratio = &gen_ratios[i];
+
+        if ((ratio->up == up) && (ratio->down == down))
+        {
+            for (j = 0; j < ratio->pairs; j++)
+            {
+                if ((ratio->in_rate[j] == in_rate) && (ratio->out_rate[j] == out_rate))
+                {
+                    return;
+                }
+            }
+
+            ratio->in_rate[ratio->pairs]  = in_rate;
+            ratio->out_rate[ratio->pairs] = out_rate;
+            ratio->pairs++;
+            return;
+        }
+    }
+
+    ratio = &gen_ratios[gen_ratios_number++];
+
+    ratio->up          = up;
+    ratio->down        = down;
+    ratio->pairs       = 1;
+    ratio->in_rate[0]  = in_rate;
+    ratio->out_rate[0] = out_rate;
+
+    ratio->taps = AUDIO_SRC_TAPS * ((down + up - 1u) / up);
+    if (ratio->taps > AUDIO_SRC_MAX_TAPS)
+    {
+        ratio->taps = AUDIO_SRC_MAX_TAPS;
+    }
+    if (ratio->taps > ((AUDIO_SRC_MAX_PHASES * AUDIO_SRC_TAPS) / up))
+    {
+        ratio->taps = ((AUDIO_SRC_MAX_PHASES * AUDIO_SRC_TAPS) / up) & ~1u;
+    }
+}
+
+/*******************************************************************************
+* Function Name: gen_design
+********************************************************************************
+* Summary:
+*   Compute the coefficients of the branches from a Blackman-windowed sinc of
+*   up x taps, which runs at in_rate x up and cuts below the lowest of the two
+*   Nyquist frequencies. Each branch is normalized to a unity DC gain and
+*   quantized to Q15, with the rounding error put on the center taps. The
+*   single branch of an integer decimation is symmetric, only its first half
+*   is kept.
+*
+*******************************************************************************/
+static void gen_design(const gen_ratio_t *ratio, int16_t *coef)
+{
+    uint32_t length = ratio->taps * ratio->up;
+    float    center = (float) (length - 1u) / 2.0f;
+    float    cutoff = AUDIO_SRC_BANDWIDTH * 0.5f *
+                      (float) ((ratio->down < ratio->up) ? ratio->down : ratio->up) /
+                      ((float) ratio->down * (float) ratio->up);
+    uint32_t phase;
+    uint32_t tap;
+    float    x;
+    float    sum;
+    int32_t  total;
+
+    for (phase = 0; phase < ratio->up; phase++)
+    {
+        sum = 0.0f;
+
+        for (tap = 0; tap < ratio->taps; tap++)
+        {
+            x = (float) ((tap * ratio->up) + phase) - center;
+
+            gen_prototype[tap] = (x == 0.0f) ? 1.0f :
+                (sinf(2.0f * GEN_PI * cutoff * x) / (2.0f * GEN_PI * cutoff * x));
+
+            x = 2.0f * GEN_PI * (float) ((tap * ratio->up) + phase) / (float) (length - 1u);
+            gen_prototype[tap] *= 0.42f - (0.5f * cosf(x)) + (0.08f * cosf(2.0f * x));
+
+            sum += gen_prototype[tap];
+        }
+
+        if (1u == ratio->up)
+        {
+            total = 0;
+            for (tap = 0; tap < (ratio->taps / 2u); tap++)
+            {
+                coef[tap] = (int16_t) lrintf(gen_prototype[tap] * (float) GEN_COEF_ONE / sum);
+                total += 2 * coef[tap];
+            }
+            coef[(ratio->taps / 2u) - 1u] += (int16_t) ((GEN_COEF_ONE - total) / 2);
+        }
+        else
+        {
+            total = 0;
+            for (tap = 0; tap < ratio->taps; tap++)
+            {
+                coef[tap] = (int16_t) lrintf(gen_prototype[tap] * (float) GEN_COEF_ONE / sum);
+                total += coef[tap];
+            }
+            coef[ratio->taps / 2u] += (int16_t) (GEN_COEF_ONE - total);
+
+            coef += ratio->taps;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: gen_print_table
+********************************************************************************
+* Summary:
+*   Print the coefficient table of a ratio.
+*
+*******************************************************************************/
+static void gen_print_table(const gen_ratio_t *ratio)
+{
+    uint32_t size = (1u == ratio->up) ? (ratio->taps / 2u) : (ratio->taps * ratio->up);
+    uint32_t i;
+
+    gen_design(ratio, gen_coef);
+
+    printf("/* %u taps per branch:", (unsigned) ratio->taps);
+    for (i = 0; i < ratio->pairs; i++)
+    {
+        printf("%s %u to %u Hz", (i == 0u) ? "" : ",",
+               (unsigned) ratio->in_rate[i], (unsigned) ratio->out_rate[i]);
+    }
+    printf(" */\n");
+
+    printf("const int16_t audio_src_coef_%u_%u[%u] =\n{",
+           (unsigned) ratio->up, (unsigned) ratio->down, (unsigned) size);
+
+    for (i = 0; i < size; i++)
+    {
+        printf("%s%6d,", ((i % GEN_COEF_PER_LINE) == 0u) ? "\n   " : "", gen_coef[i]);
+    }
+
+    printf("\n};\n\n");
+}
+
+int main(void)
+{
+    uint32_t i;
+    uint32_t j;
+
+    /* The I2S follows the playback rate and capture is converted from it,
+       or the I2S is fixed and both streams are converted */
+    for (i = 0; i < GEN_OUT_RATES; i++)
+    {
+        for (j = 0; j < GEN_IN_RATES; j++)
+        {
+            gen_add_pair(gen_out_rates[i], gen_in_rates[j]);
+        }
+    }
+
+    for (i = 0; i < GEN_OUT_RATES; i++)
+    {
+        gen_add_pair(gen_out_rates[i], GEN_FIXED_RATE);
+    }
+
+    for (j = 0; j < GEN_IN_RATES; j++)
+    {
+        gen_add_pair(GEN_FIXED_RATE, gen_in_rates[j]);
+    }
+
+    printf("/*******************************************************************************\n");
+    printf("* File Name: audio_src_coef.c\n");
+    printf("*\n");
+    printf("* Description: Coefficients of the polyphase sample-rate converter, in Q15,\n");
+    printf("*  for each rate ratio of the Audio OUT and Audio IN streams. The branches of\n");
+    printf("*  a ratio are stored one after the other; the single branch of an integer\n");
+    printf("*  decimation is symmetric and only its first half is stored.\n");
+    printf("*  Generated by test/gen_audio_src_coef.c (make -C test coef), do not edit.\n");
+    printf("*\n");
+    for (i = 0; i < (sizeof(gen_license) / sizeof(gen_license[0])); i++)
+    {
+        printf("%s\n", gen_license[i]);
+    }
+    printf("\n#include \"audio_src.h\"\n\n");
+
+    printf("/*******************************************************************************\n");
+    printf("* Audio SRC Coefficients\n");
+    printf("*******************************************************************************/\n");
+    for (i = 0; i < gen_ratios_number; i++)
+    {
+        gen_print_table(&gen_ratios[i]);
+    }
+
+    printf("/*******************************************************************************\n");
+    printf("* Audio SRC Ratios\n");
+    printf("*******************************************************************************/\n");
+    printf("const audio_src_ratio_t audio_src_ratios[] =\n{\n");
+    for (i = 0; i < gen_ratios_number; i++)
+    {
+        printf("    { %3uu, %3uu, %2uu, audio_src_coef_%u_%u },\n",
+               (unsigned) gen_ratios[i].up, (unsigned) gen_ratios[i].down,
+               (unsigned) gen_ratios[i].taps,
+               (unsigned) gen_ratios[i].up, (unsigned) gen_ratios[i].down);
+    }
+    printf("};\n\n");
+    printf("const uint32_t audio_src_ratios_number = sizeof(audio_src_ratios) / sizeof(audio_src_ratios[0]);\n\n");
+    printf("/* [] END OF FILE */\n");
+
+    return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,431 @@
+/*******************************************************************************
+* File Name: host_rtos.c
+*
+* Description: Single-threaded host implementation of the FreeRTOS calls used by
+*  the modules under test. A call that would block runs the idle hook once,
+*  which stands for the other tasks, then times out by advancing the tick
+*  count.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "host_rtos.h"
+
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Host RTOS Types
+*******************************************************************************/
+struct host_rtos_queue
+{
+    uint8_t *items;
+    uint32_t length;
+    uint32_t item_size;
+    uint32_t head;
+    uint32_t count;
+};
+
+struct host_rtos_semaphore
+{
+    uint32_t count;
+};
+
+struct host_rtos_event_group
+{
+    EventBits_t bits;
+};
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void host_rtos_block(void);
+
+/*******************************************************************************
+* Host RTOS Variables
+*******************************************************************************/
+TickType_t       host_rtos_ticks;
+uint32_t         host_rtos_notification;
+host_rtos_hook_t host_rtos_idle_hook;
+int              host_rtos_in_hook;
+
+/*******************************************************************************
+* Function Name: host_rtos_set_idle_hook
+********************************************************************************
+* Summary:
+*   Set the function run when the task under test blocks, or NULL.
+*
+*******************************************************************************/
+void host_rtos_set_idle_hook(host_rtos_hook_t hook)
+{
+    host_rtos_idle_hook = hook;
+}
+
+/*******************************************************************************
+* Function Name: host_rtos_block
+********************************************************************************
+* Summary:
+*   Let the other tasks run once. Calls made by the hook itself do not run it
+*   again.
+*
+*******************************************************************************/
+static void host_rtos_block(void)
+{
+    if ((host_rtos_idle_hook != NULL) && (host_rtos_in_hook == 0))
+    {
+        host_rtos_in_hook = 1;
+        host_rtos_idle_hook();
+        host_rtos_in_hook = 0;
+    }
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetTickCount
+********************************************************************************
+* Summary:
+*   Return the host tick count, advanced by the calls that time out.
+*
+*******************************************************************************/
+TickType_t xTaskGetTickCount(void)
+{
+    return host_rtos_ticks;
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetCurrentTaskHandle
+********************************************************************************
+* Summary:
+*   There is a single task.
+*
+*******************************************************************************/
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: xTaskNotifyGive
+********************************************************************************
+* Summary:
+*   All the tasks share one notification value: only the codec task waits
+*   on it in the modules under test.
+*
+*******************************************************************************/
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void) task;
+
+    host_rtos_notification++;
+
+    return pdPASS;
+}
+
+/*******************************************************************************
+* Function Name: vTaskNotifyGiveFromISR
+********************************************************************************
+* Summary:
+*   Same as xTaskNotifyGive().
+*
+*******************************************************************************/
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken)
+{
+    (void) task;
+
+    host_rtos_notification++;
+    *woken = pdFALSE;
+}
+
+/*******************************************************************************
+* Function Name: ulTaskNotifyTake
+********************************************************************************
+* Summary:
+*   Take the notification. Nothing else can complete a transfer, so a wait
+*   times out at once.
+*
+*******************************************************************************/
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait)
+{
+    uint32_t value = host_rtos_notification;
+
+    if ((0u == value) && (0u != wait))
+    {
+        host_rtos_ticks += wait;
+        return 0u;
+    }
+
+    host_rtos_notification = (clear == pdTRUE) ? 0u : (value - ((value > 0u) ? 1u : 0u));
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: xQueueCreate
+********************************************************************************
+* Summary:
+*   Create a queue of items copied by value.
+*
+*******************************************************************************/
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    QueueHandle_t queue = calloc(1, sizeof(*queue));
+
+    queue->items     = calloc(length, item_size);
+    queue->length    = (uint32_t) length;
+    queue->item_size = (uint32_t) item_size;
+
+    return queue;
+}
+
+/*******************************************************************************
+* Function Name: xQueueSend
+********************************************************************************
+* Summary:
+*   Copy an item at the back of the queue, or time out if it is full.
+*
+*******************************************************************************/
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t wait)
+{
+    uint32_t tail;
+
+    if (queue->count == queue->length)
+    {
+        host_rtos_ticks += wait;
+        return pdFALSE;
+    }
+
+    tail = (queue->head + queue->count) % queue->length;
+    memcpy(&queue->items[tail * queue->item_size], item, queue->item_size);
+    queue->count++;
+
+    return pdTRUE;
+}
+
+/*******************************************************************************
+* Function Name: xQueueReceive
+********************************************************************************
+* Summary:
+*   Copy the item at the front of the queue, or time out if it is empty.
+*
+*******************************************************************************/
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait)
+{
+    if (queue->count == 0u)
+    {
+        if (wait != portMAX_DELAY)
+        {
+            host_rtos_ticks += wait;
+        }
+        return pdFALSE;
+    }
+
+    memcpy(item, &queue->items[queue->head * queue->item_size], queue->item_size);
+    queue->head = (queue->head + 1u) % queue->length;
+    queue->count--;
+
+    return pdTRUE;
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreCreateBinary
+********************************************************************************
+* Summary:
+*   Create a binary semaphore, empty.
+*
+*******************************************************************************/
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return calloc(1, sizeof(struct host_rtos_semaphore));
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreTake
+********************************************************************************
+* Summary:
+*   Take the semaphore. If it is empty, the idle hook runs once and may give
+*   it, otherwise the wait times out.
+*
+*******************************************************************************/
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait)
+{
+    if ((semaphore->count == 0u) && (wait != 0u))
+    {
+        host_rtos_block();
+    }
+
+    if (semaphore->count == 0u)
+    {
+        if (wait != portMAX_DELAY)
+        {
+            host_rtos_ticks += wait;
+        }
+        return pdFALSE;
+    }
+
+    semaphore->count = 0u;
+
+    return pdTRUE;
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreGive
+********************************************************************************
+* Summary:
+*   Give the semaphore.
+*
+*******************************************************************************/
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    if (semaphore->count != 0u)
+    {
+        return pdFALSE;
+    }
+
+    semaphore->count = 1u;
+
+    return pdTRUE;
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupCreate
+********************************************************************************
+* Summary:
+*   Create an event group, with all the bits clear.
+*
+*******************************************************************************/
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    return calloc(1, sizeof(struct host_rtos_event_group));
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupGetBits
+********************************************************************************
+* Summary:
+*   Return the bits of the event group.
+*
+*******************************************************************************/
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    return group->bits;
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupSetBitsFromISR
+********************************************************************************
+* Summary:
+*   Set bits of the event group. There is no task to wake.
+*
+*******************************************************************************/
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t group, const EventBits_t bits,
+                                     BaseType_t *woken)
+{
+    group->bits |= bits;
+    *woken = pdFALSE;
+
+    return pdPASS;
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupClearBitsFromISR
+********************************************************************************
+* Summary:
+*   Clear bits of the event group.
+*
+*******************************************************************************/
+BaseType_t xEventGroupClearBitsFromISR(EventGroupHandle_t group, const EventBits_t bits)
+{
+    group->bits &= ~bits;
+
+    return pdPASS;
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupClearBits
+********************************************************************************
+* Summary:
+*   Clear bits of the event group and return the bits before.
+*
+*******************************************************************************/
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, const EventBits_t bits)
+{
+    EventBits_t before = group->bits;
+
+    group->bits &= ~bits;
+
+    return before;
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupWaitBits
+********************************************************************************
+* Summary:
+*   Wait for any or all of the bits. If they are not set, the idle hook runs
+*   once and may set them, otherwise the wait times out.
+*
+*******************************************************************************/
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, const EventBits_t bits,
+                                const BaseType_t clear, const BaseType_t all, TickType_t wait)
+{
+    EventBits_t before;
+    bool        set;
+
+    set = (all != pdFALSE) ? ((group->bits & bits) == bits) : ((group->bits & bits) != 0u);
+
+    if ((set == false) && (wait != 0u))
+    {
+        host_rtos_block();
+        set = (all != pdFALSE) ? ((group->bits & bits) == bits) : ((group->bits & bits) != 0u);
+    }
+
+    before = group->bits;
+
+    if (set == false)
+    {
+        if (wait != portMAX_DELAY)
+        {
+            host_rtos_ticks += wait;
+        }
+    }
+    else if (clear != pdFALSE)
+    {
+        group->bits &= ~bits;
+    }
+
+    return before;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,294 @@
+/*******************************************************************************
+* File Name: host_usb.c
+*
+* Description: Host implementation of the USB device middleware calls used by
+*  the USB communication module. The class callbacks are recorded, so the tests
+*  call them as the middleware would on a control request.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "host_usb.h"
+
+#include "cy_sysint.h"
+#include "cycfg.h"
+#include "cycfg_usbdev.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Host USB Variables
+*******************************************************************************/
+USBFS_Type host_usbfs;
+
+const cy_stc_usbfs_dev_drv_config_t CYBSP_USBDEV_config;
+const cy_stc_usb_dev_device_t       usb_devices[1];
+const cy_stc_usb_dev_config_t       usb_devConfig;
+const cy_stc_usb_dev_hid_config_t   usb_hidConfig;
+
+cy_cb_usb_dev_request_received_t host_usb_request_received;
+cy_cb_usb_dev_request_cmplt_t    host_usb_request_completed;
+cy_cb_usb_dev_set_config_t       host_usb_set_configuration;
+cy_cb_usb_dev_set_interface_t    host_usb_set_interface;
+cy_cb_usbfs_dev_drv_callback_t   host_usb_sof_callback;
+cy_cb_usbfs_dev_drv_ep_callback_t host_usb_ep_callback[HOST_USB_EP_NUMBER];
+
+uint32_t host_usb_ep_endpoint;
+uint32_t host_usb_ep_size;
+uint8_t  host_usb_ep_data[HOST_USB_EP_DATA_SIZE];
+uint32_t host_usb_ep_writes;
+
+/*******************************************************************************
+* Function Name: Cy_USB_Dev_Audio_RegisterUserCallback
+********************************************************************************
+* Summary:
+*   Record the audio class request callbacks.
+*
+*******************************************************************************/
+void Cy_USB_Dev_Audio_RegisterUserCallback(cy_cb_usb_dev_request_received_t requestReceivedHandle,
+                                           cy_cb_usb_dev_request_cmplt_t requestCompletedHandle,
+                                           cy_stc_usb_dev_audio_context_t *context)
+{
+    (void) context;
+
+    host_usb_request_received  = requestReceivedHandle;
+    host_usb_request_completed = requestCompletedHandle;
+}
+
+/*******************************************************************************
+* Function Name: Cy_USB_Dev_RegisterClassSetConfigCallback
+********************************************************************************
+* Summary:
+*   Record the Set Configuration callback.
+*
+*******************************************************************************/
+void Cy_USB_Dev_RegisterClassSetConfigCallback(cy_cb_usb_dev_set_config_t callback,
+                                               cy_stc_usb_dev_class_t *classObj)
+{
+    (void) classObj;
+
+    host_usb_set_configuration = callback;
+}
+
+/*******************************************************************************
+* Function Name: Cy_USB_Dev_RegisterClassSetInterfaceCallback
+********************************************************************************
+* Summary:
+*   Record the Set Interface callback.
+*
+*******************************************************************************/
+void Cy_USB_Dev_RegisterClassSetInterfaceCallback(cy_cb_usb_dev_set_interface_t callback,
+                                                  cy_stc_usb_dev_class_t *classObj)
+{
+    (void) classObj;
+
+    host_usb_set_interface = callback;
+}
+
+/*******************************************************************************
+* Function Name: Cy_USBFS_Dev_Drv_RegisterSofCallback
+********************************************************************************
+* Summary:
+*   Record the SOF callback.
+*
+*******************************************************************************/
+void Cy_USBFS_Dev_Drv_RegisterSofCallback(USBFS_Type *base, cy_cb_usbfs_dev_drv_callback_t callback,
+                                          cy_stc_usbfs_dev_drv_context_t *context)
+{
+    (void) base; (void) context;
+
+    host_usb_sof_callback = callback;
+}
+
+/*******************************************************************************
+* Function Name: Cy_USBFS_Dev_Drv_RegisterEndpointCallback
+********************************************************************************
+* Summary:
+*   Record the data callback of an endpoint.
+*
+*******************************************************************************/
+void Cy_USBFS_Dev_Drv_RegisterEndpointCallback(USBFS_Type *base, uint32_t endpoint,
+                                               cy_cb_usbfs_dev_drv_ep_callback_t callback,
+                                               cy_stc_usbfs_dev_drv_context_t *context)
+{
+    (void) base; (void) context;
+
+    if (endpoint < HOST_USB_EP_NUMBER)
+    {
+        host_usb_ep_callback[endpoint] = callback;
+    }
+}
+
+/*******************************************************************************
+* Function Name: Cy_USB_Dev_WriteEpNonBlocking
+********************************************************************************
+* Summary:
+*   Record the data written to an IN endpoint.
+*
+*******************************************************************************/
+cy_en_usb_dev_status_t Cy_USB_Dev_WriteEpNonBlocking(uint32_t endpoint, uint8_t const *buffer,
+                                                     uint32_t size, cy_stc_usb_dev_context_t *context)
+{
+    (void) context;
+
+    if (size > HOST_USB_EP_DATA_SIZE)
+    {
+        return CY_USB_DEV_BAD_PARAM;
+    }
+
+    host_usb_ep_endpoint = endpoint;
+    host_usb_ep_size     = size;
+    memcpy(host_usb_ep_data, buffer, size);
+    host_usb_ep_writes++;
+
+    return CY_USB_DEV_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_USB_Dev_Audio_GetClass
+********************************************************************************
+* Summary:
+*   Return the class object of the audio context.
+*
+*******************************************************************************/
+cy_stc_usb_dev_class_t *Cy_USB_Dev_Audio_GetClass(cy_stc_usb_dev_audio_context_t *context)
+{
+    return &context->classObj;
+}
+
+/*******************************************************************************
+* Function Name: Cy_USB_Dev_GetConfiguration
+********************************************************************************
+* Summary:
+*   The device is always configured.
+*
+*******************************************************************************/
+uint32_t Cy_USB_Dev_GetConfiguration(const cy_stc_usb_dev_context_t *context)
+{
+    (void) context;
+
+    return 1U;
+}
+
+/*******************************************************************************
+* Function Name: Cy_USB_Dev_Init
+********************************************************************************
+* Summary:
+*   There is no USB block to start. The initialization and interrupt calls
+*   below do nothing either.
+*
+*******************************************************************************/
+cy_en_usb_dev_status_t Cy_USB_Dev_Init(USBFS_Type *base,
+                                       const cy_stc_usbfs_dev_drv_config_t *drvConfig,
+                                       cy_stc_usbfs_dev_drv_context_t *drvContext,
+                                       const cy_stc_usb_dev_device_t *device,
+                                       const cy_stc_usb_dev_config_t *config,
+                                       cy_stc_usb_dev_context_t *context)
+{
+    (void) base; (void) drvConfig; (void) drvContext;
+    (void) device; (void) config; (void) context;
+
+    return CY_USB_DEV_SUCCESS;
+}
+
+cy_en_usb_dev_status_t Cy_USB_Dev_Connect(bool blocking, int32_t timeout,
+                                          cy_stc_usb_dev_context_t *context)
+{
+    (void) blocking; (void) timeout; (void) context;
+
+    return CY_USB_DEV_SUCCESS;
+}
+
+cy_en_usb_dev_status_t Cy_USB_Dev_Audio_Init(void const *config,
+                                             cy_stc_usb_dev_audio_context_t *context,
+                                             cy_stc_usb_dev_context_t *devContext)
+{
+    (void) config; (void) context; (void) devContext;
+
+    return CY_USB_DEV_SUCCESS;
+}
+
+cy_en_usb_dev_status_t Cy_USB_Dev_HID_Init(cy_stc_usb_dev_hid_config_t const *config,
+                                           cy_stc_usb_dev_hid_context_t *context,
+                                           cy_stc_usb_dev_context_t *devContext)
+{
+    (void) config; (void) context; (void) devContext;
+
+    return CY_USB_DEV_SUCCESS;
+}
+
+uint32_t Cy_SysInt_Init(const cy_stc_sysint_t *config, cy_israddress userIsr)
+{
+    (void) config; (void) userIsr;
+
+    return 0U;
+}
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+    (void) irq;
+}
+
+void Cy_USBFS_Dev_Drv_Interrupt(USBFS_Type *base, uint32_t intrCause,
+                                cy_stc_usbfs_dev_drv_context_t *context)
+{
+    (void) base; (void) intrCause; (void) context;
+}
+
+uint32_t Cy_USBFS_Dev_Drv_GetInterruptCauseHi(USBFS_Type const *base)
+{
+    (void) base;
+
+    return 0U;
+}
+
+uint32_t Cy_USBFS_Dev_Drv_GetInterruptCauseMed(USBFS_Type const *base)
+{
+    (void) base;
+
+    return 0U;
+}
+
+uint32_t Cy_USBFS_Dev_Drv_GetInterruptCauseLo(USBFS_Type const *base)
+{
+    (void) base;
+
+    return 0U;
+}
+
+void *Cy_USBFS_Dev_Drv_GetDevContext(USBFS_Type const *base, cy_stc_usbfs_dev_drv_context_t *context)
+{
+    (void) base; (void) context;
+
+    return NULL;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,71 @@
+/*******************************************************************************
+* File Name: host_usb.h
+*
+* Description: Host implementation of the USB device middleware calls used by
+*  the USB communication module.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef HOST_USB_H
+#define HOST_USB_H
+
+#include "cy_usb_dev.h"
+
+/*******************************************************************************
+* Host USB Constants
+*******************************************************************************/
+/* Largest endpoint write recorded */
+#define HOST_USB_EP_DATA_SIZE   (1024u)
+
+/* Endpoints with a data callback */
+#define HOST_USB_EP_NUMBER      (8u)
+
+/*******************************************************************************
+* Host USB Variables
+*******************************************************************************/
+/* Class callbacks registered by the module under test */
+extern cy_cb_usb_dev_request_received_t host_usb_request_received;
+extern cy_cb_usb_dev_request_cmplt_t    host_usb_request_completed;
+extern cy_cb_usb_dev_set_config_t       host_usb_set_configuration;
+extern cy_cb_usb_dev_set_interface_t    host_usb_set_interface;
+extern cy_cb_usbfs_dev_drv_callback_t   host_usb_sof_callback;
+extern cy_cb_usbfs_dev_drv_ep_callback_t host_usb_ep_callback[HOST_USB_EP_NUMBER];
+
+/* Last endpoint write, and number of writes */
+extern uint32_t host_usb_ep_endpoint;
+extern uint32_t host_usb_ep_size;
+extern uint8_t  host_usb_ep_data[HOST_USB_EP_DATA_SIZE];
+extern uint32_t host_usb_ep_writes;
+
+#endif /* HOST_USB_H */
+
+/* [] END OF FILE */
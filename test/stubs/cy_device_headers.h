@@ -0,0 +1,85 @@
+/*******************************************************************************
+* File Name: cy_device_headers.h
+*
+* Description: Host stand-in for the device headers, with the interrupt sources
+*  and the CMSIS barrier and unaligned access macros used by the modules under
+*  test.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef CY_DEVICE_HEADERS_H
+#define CY_DEVICE_HEADERS_H
+
+#include <stdint.h>
+#include <string.h>
+
+/*******************************************************************************
+* Host Interrupt Sources
+*******************************************************************************/
+typedef enum
+{
+    usb_interrupt_hi_IRQn   = 132,
+    usb_interrupt_med_IRQn  = 133,
+    usb_interrupt_lo_IRQn   = 134,
+} IRQn_Type;
+
+/*******************************************************************************
+* Host CMSIS Functions
+*******************************************************************************/
+static inline uint32_t host_unaligned_read(const void *addr)
+{
+    uint32_t value;
+
+    memcpy(&value, addr, sizeof(value));
+
+    return value;
+}
+
+static inline void host_unaligned_write(void *addr, uint32_t value)
+{
+    memcpy(addr, &value, sizeof(value));
+}
+
+/* A single-threaded host only needs the compiler barrier */
+#define __DMB()                                 __sync_synchronize()
+
+#define __UNALIGNED_UINT32_READ(addr)           host_unaligned_read(addr)
+#define __UNALIGNED_UINT32_WRITE(addr, value)   host_unaligned_write((addr), (value))
+
+/* Cortex-M4 DSP extension, for the tests built with __ARM_FEATURE_DSP */
+#define __PKHBT(arg1, arg2, shift)  ((((uint32_t) (arg1)) & 0x0000FFFFu) | \
+                                     ((((uint32_t) (arg2)) << (shift)) & 0xFFFF0000u))
+#define __UXTB16(arg)               (((uint32_t) (arg)) & 0x00FF00FFu)
+
+#endif /* CY_DEVICE_HEADERS_H */
+
+/* [] END OF FILE */
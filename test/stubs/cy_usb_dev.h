@@ -0,0 +1,163 @@
+/*******************************************************************************
+* File Name: cy_usb_dev.h
+*
+* Description: Host stand-in for the USB device middleware: the types, constants
+*  and calls used by the USB communication module.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef CY_USB_DEV_H
+#define CY_USB_DEV_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Host PDL Macros
+*******************************************************************************/
+#define CY_ASSERT(x)                assert(x)
+#define CY_LO8(x)                   ((uint8_t) ((x) & 0xFFU))
+#define CY_HI8(x)                   ((uint8_t) ((uint16_t) (x) >> 8U))
+
+/*******************************************************************************
+* Host USB Device Constants
+*******************************************************************************/
+#define CY_USB_DEV_STANDARD_TYPE    (0U)
+#define CY_USB_DEV_CLASS_TYPE       (1U)
+#define CY_USB_DEV_VENDOR_TYPE      (2U)
+
+#define CY_USB_DEV_WAIT_FOREVER     (0)
+
+#define CY_USB_DEV_ALLOC_ENDPOINT_BUFFER(buf, size)     uint8_t buf[size]
+
+/*******************************************************************************
+* Host USB Device Types
+*******************************************************************************/
+typedef enum
+{
+    CY_USB_DEV_SUCCESS,
+    CY_USB_DEV_BAD_PARAM,
+    CY_USB_DEV_TIMEOUT,
+    CY_USB_DEV_REQUEST_NOT_HANDLED,
+} cy_en_usb_dev_status_t;
+
+typedef struct { uint32_t reserved; } USBFS_Type;
+typedef struct { uint32_t reserved; } cy_stc_usbfs_dev_drv_config_t;
+typedef struct { uint32_t reserved; } cy_stc_usbfs_dev_drv_context_t;
+typedef struct { uint32_t reserved; } cy_stc_usb_dev_device_t;
+typedef struct { uint32_t reserved; } cy_stc_usb_dev_config_t;
+typedef struct { uint32_t reserved; } cy_stc_usb_dev_context_t;
+typedef struct { uint32_t reserved; } cy_stc_usb_dev_class_t;
+
+typedef struct
+{
+    struct
+    {
+        uint8_t recipient;
+        uint8_t type;
+        uint8_t direction;
+    } bmRequestType;
+    uint8_t  bRequest;
+    uint16_t wValue;
+    uint16_t wIndex;
+    uint16_t wLength;
+} cy_stc_usb_dev_setup_packet_t;
+
+typedef struct
+{
+    uint8_t  *ptr;          /* Data stage source or destination */
+    uint8_t  *buffer;       /* Buffer of the middleware for the OUT data stage */
+    uint16_t remaining;     /* Bytes of the data stage */
+    uint16_t size;
+    bool     notify;        /* Call the completed callback after the data stage */
+    cy_stc_usb_dev_setup_packet_t setup;
+} cy_stc_usb_dev_control_transfer_t;
+
+typedef void (* cy_cb_usbfs_dev_drv_callback_t)(USBFS_Type *base,
+                                                cy_stc_usbfs_dev_drv_context_t *context);
+
+typedef void (* cy_cb_usbfs_dev_drv_ep_callback_t)(USBFS_Type *base, uint32_t endpoint, uint32_t errorType,
+                                                   cy_stc_usbfs_dev_drv_context_t *context);
+
+typedef cy_en_usb_dev_status_t (* cy_cb_usb_dev_request_received_t)(cy_stc_usb_dev_control_transfer_t *transfer,
+                                                                     void *classContext,
+                                                                     cy_stc_usb_dev_context_t *devContext);
+
+typedef cy_en_usb_dev_status_t (* cy_cb_usb_dev_request_cmplt_t)(cy_stc_usb_dev_control_transfer_t *transfer,
+                                                                  void *classContext,
+                                                                  cy_stc_usb_dev_context_t *devContext);
+
+typedef cy_en_usb_dev_status_t (* cy_cb_usb_dev_set_config_t)(uint32_t config,
+                                                               void *classContext,
+                                                               cy_stc_usb_dev_context_t *devContext);
+
+typedef cy_en_usb_dev_status_t (* cy_cb_usb_dev_set_interface_t)(uint32_t interface,
+                                                                  uint32_t alternate,
+                                                                  void *classContext,
+                                                                  cy_stc_usb_dev_context_t *devContext);
+
+/*******************************************************************************
+* Host USB Device Functions
+*******************************************************************************/
+cy_en_usb_dev_status_t Cy_USB_Dev_Init(USBFS_Type *base,
+                                       const cy_stc_usbfs_dev_drv_config_t *drvConfig,
+                                       cy_stc_usbfs_dev_drv_context_t *drvContext,
+                                       const cy_stc_usb_dev_device_t *device,
+                                       const cy_stc_usb_dev_config_t *config,
+                                       cy_stc_usb_dev_context_t *context);
+cy_en_usb_dev_status_t Cy_USB_Dev_Connect(bool blocking, int32_t timeout,
+                                          cy_stc_usb_dev_context_t *context);
+uint32_t Cy_USB_Dev_GetConfiguration(const cy_stc_usb_dev_context_t *context);
+cy_en_usb_dev_status_t Cy_USB_Dev_WriteEpNonBlocking(uint32_t endpoint, uint8_t const *buffer,
+                                                     uint32_t size, cy_stc_usb_dev_context_t *context);
+void     Cy_USB_Dev_RegisterClassSetConfigCallback(cy_cb_usb_dev_set_config_t callback,
+                                                   cy_stc_usb_dev_class_t *classObj);
+void     Cy_USB_Dev_RegisterClassSetInterfaceCallback(cy_cb_usb_dev_set_interface_t callback,
+                                                      cy_stc_usb_dev_class_t *classObj);
+
+void     Cy_USBFS_Dev_Drv_Interrupt(USBFS_Type *base, uint32_t intrCause,
+                                    cy_stc_usbfs_dev_drv_context_t *context);
+uint32_t Cy_USBFS_Dev_Drv_GetInterruptCauseHi(USBFS_Type const *base);
+uint32_t Cy_USBFS_Dev_Drv_GetInterruptCauseMed(USBFS_Type const *base);
+uint32_t Cy_USBFS_Dev_Drv_GetInterruptCauseLo(USBFS_Type const *base);
+void     Cy_USBFS_Dev_Drv_RegisterSofCallback(USBFS_Type *base, cy_cb_usbfs_dev_drv_callback_t callback,
+                                              cy_stc_usbfs_dev_drv_context_t *context);
+void     Cy_USBFS_Dev_Drv_RegisterEndpointCallback(USBFS_Type *base, uint32_t endpoint,
+                                                  cy_cb_usbfs_dev_drv_ep_callback_t callback,
+                                                  cy_stc_usbfs_dev_drv_context_t *context);
+void    *Cy_USBFS_Dev_Drv_GetDevContext(USBFS_Type const *base, cy_stc_usbfs_dev_drv_context_t *context);
+
+#endif /* CY_USB_DEV_H */
+
+/* [] END OF FILE */
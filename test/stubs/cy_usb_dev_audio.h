@@ -0,0 +1,74 @@
+/*******************************************************************************
+* File Name: cy_usb_dev_audio.h
+*
+* Description: Host stand-in for the USB device audio class.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef CY_USB_DEV_AUDIO_H
+#define CY_USB_DEV_AUDIO_H
+
+#include "cy_usb_dev.h"
+#include "cy_usb_dev_audio_descr.h"
+
+/*******************************************************************************
+* Host Audio Class Constants
+*******************************************************************************/
+#define CY_USB_DEV_AUDIO_VOLUME_MIN         (0x8001U)
+#define CY_USB_DEV_AUDIO_VOLUME_MAX         (0x7FFFU)
+#define CY_USB_DEV_AUDIO_VOLUME_MIN_MSB     (0x80U)
+#define CY_USB_DEV_AUDIO_VOLUME_MIN_LSB     (0x01U)
+#define CY_USB_DEV_AUDIO_VOLUME_MAX_MSB     (0x7FU)
+#define CY_USB_DEV_AUDIO_VOLUME_MAX_LSB     (0xFFU)
+
+/*******************************************************************************
+* Host Audio Class Types
+*******************************************************************************/
+typedef struct
+{
+    cy_stc_usb_dev_class_t classObj;
+} cy_stc_usb_dev_audio_context_t;
+
+/*******************************************************************************
+* Host Audio Class Functions
+*******************************************************************************/
+cy_en_usb_dev_status_t Cy_USB_Dev_Audio_Init(void const *config,
+                                             cy_stc_usb_dev_audio_context_t *context,
+                                             cy_stc_usb_dev_context_t *devContext);
+void Cy_USB_Dev_Audio_RegisterUserCallback(cy_cb_usb_dev_request_received_t requestReceivedHandle,
+                                           cy_cb_usb_dev_request_cmplt_t requestCompletedHandle,
+                                           cy_stc_usb_dev_audio_context_t *context);
+cy_stc_usb_dev_class_t *Cy_USB_Dev_Audio_GetClass(cy_stc_usb_dev_audio_context_t *context);
+
+#endif /* CY_USB_DEV_AUDIO_H */
+
+/* [] END OF FILE */
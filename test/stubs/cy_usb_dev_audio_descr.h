@@ -0,0 +1,66 @@
+/*******************************************************************************
+* File Name: cy_usb_dev_audio_descr.h
+*
+* Description: Host stand-in for the USB audio class request codes and control
+*  selectors.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef CY_USB_DEV_AUDIO_DESCR_H
+#define CY_USB_DEV_AUDIO_DESCR_H
+
+/*******************************************************************************
+* Host Audio Class Request Codes
+*******************************************************************************/
+#define CY_USB_DEV_AUDIO_RQST_SET_CUR           (0x01U)
+#define CY_USB_DEV_AUDIO_RQST_SET_MIN           (0x02U)
+#define CY_USB_DEV_AUDIO_RQST_SET_MAX           (0x03U)
+#define CY_USB_DEV_AUDIO_RQST_SET_RES           (0x04U)
+#define CY_USB_DEV_AUDIO_RQST_SET_MEM           (0x05U)
+#define CY_USB_DEV_AUDIO_RQST_GET_CUR           (0x81U)
+#define CY_USB_DEV_AUDIO_RQST_GET_MIN           (0x82U)
+#define CY_USB_DEV_AUDIO_RQST_GET_MAX           (0x83U)
+#define CY_USB_DEV_AUDIO_RQST_GET_RES           (0x84U)
+#define CY_USB_DEV_AUDIO_RQST_GET_MEM           (0x85U)
+#define CY_USB_DEV_AUDIO_RQST_GET_STAT          (0xFFU)
+
+/*******************************************************************************
+* Host Audio Class Control Selectors
+*******************************************************************************/
+#define CY_USB_DEV_AUDIO_CS_MUTE_CONTROL        (0x01U)
+#define CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL      (0x02U)
+#define CY_USB_DEV_AUDIO_CS_BASS_CONTROL        (0x03U)
+#define CY_USB_DEV_AUDIO_CS_SAMPLING_FREQ_CTRL  (0x01U)
+
+#endif /* CY_USB_DEV_AUDIO_DESCR_H */
+
+/* [] END OF FILE */
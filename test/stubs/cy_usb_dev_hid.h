@@ -0,0 +1,57 @@
+/*******************************************************************************
+* File Name: cy_usb_dev_hid.h
+*
+* Description: Host stand-in for the USB device HID class.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef CY_USB_DEV_HID_H
+#define CY_USB_DEV_HID_H
+
+#include "cy_usb_dev.h"
+
+/*******************************************************************************
+* Host HID Class Types
+*******************************************************************************/
+typedef struct { uint32_t reserved; } cy_stc_usb_dev_hid_config_t;
+typedef struct { uint32_t reserved; } cy_stc_usb_dev_hid_context_t;
+
+/*******************************************************************************
+* Host HID Class Functions
+*******************************************************************************/
+cy_en_usb_dev_status_t Cy_USB_Dev_HID_Init(cy_stc_usb_dev_hid_config_t const *config,
+                                           cy_stc_usb_dev_hid_context_t *context,
+                                           cy_stc_usb_dev_context_t *devContext);
+
+#endif /* CY_USB_DEV_HID_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,77 @@
+/*******************************************************************************
+* File Name: cyhal.h
+*
+* Description: Host stand-in for the HAL types used by the headers of the
+*  modules under test.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#ifndef CYHAL_H
+#define CYHAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Host HAL Types
+*******************************************************************************/
+typedef struct
+{
+    void *base;
+} cyhal_i2s_t;
+
+typedef enum
+{
+    CYHAL_I2S_TX_HALF_EMPTY     = 1 << 1,
+    CYHAL_I2S_ASYNC_TX_COMPLETE = 1 << 5,
+    CYHAL_I2S_ASYNC_RX_COMPLETE = 1 << 11,
+} cyhal_i2s_event_t;
+
+typedef uint32_t cy_rslt_t;
+
+/*******************************************************************************
+* Host HAL Functions
+*******************************************************************************/
+cy_rslt_t cyhal_i2s_start_rx(cyhal_i2s_t *obj);
+cy_rslt_t cyhal_i2s_stop_rx(cyhal_i2s_t *obj);
+cy_rslt_t cyhal_i2s_read_async(cyhal_i2s_t *obj, void *rx, size_t rx_length);
+cy_rslt_t cyhal_i2s_abort_read_async(cyhal_i2s_t *obj);
+void      cyhal_i2s_enable_event(cyhal_i2s_t *obj, cyhal_i2s_event_t event, uint8_t intr_priority,
+                                 bool enable);
+
+/* PDL call reached through the HAL headers on the target */
+void      Cy_I2S_ClearRxFifo(void *base);
+
+#endif /* CYHAL_H */
+
+/* [] END OF FILE */
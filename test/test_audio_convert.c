@@ -0,0 +1,171 @@
+/*******************************************************************************
+* File Name: test_audio_convert.c
+*
+* Description: Host tests of the packing routines: each word-wide routine must
+*  match its byte-wise reference for every length and alignment, without
+*  writing past the end of the array.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio_convert.h"
+#include "audio_convert_ref.h"
+#include "test.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Test Constants
+*******************************************************************************/
+/* Lengths tested, in samples: several blocks of four and every remainder */
+#define TEST_MAX_LENGTH     (67u)
+
+/* Room for the misalignment and the guard bytes after the array */
+#define TEST_BUFFER_SIZE    (4u * (TEST_MAX_LENGTH + 4u))
+
+/* Fill value of the output buffers, to detect writes past the end */
+#define TEST_GUARD          (0xA5u)
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void test_fill_random(uint8_t *buffer, uint32_t size);
+
+/*******************************************************************************
+* Test Variables
+*******************************************************************************/
+int test_failures;
+
+/* Inputs and outputs, aligned on words; the tests offset them */
+uint32_t test_in[TEST_BUFFER_SIZE / 4u];
+uint32_t test_out[TEST_BUFFER_SIZE / 4u];
+uint32_t test_ref[TEST_BUFFER_SIZE / 4u];
+
+/*******************************************************************************
+* Function Name: test_fill_random
+********************************************************************************
+* Summary:
+*   Fill a buffer with pseudo-random bytes, the same on every run.
+*
+*******************************************************************************/
+static void test_fill_random(uint8_t *buffer, uint32_t size)
+{
+    while (0u != size--)
+    {
+        *(buffer++) = (uint8_t) (rand() >> 7);
+    }
+}
+
+/* USB bytes to I2S words, for every length and source alignment */
+static void test_to_32(void (*convert)(const uint8_t *, uint32_t *, uint32_t),
+                       void (*reference)(const uint8_t *, uint32_t *, uint32_t))
+{
+    uint32_t length;
+    uint32_t offset;
+
+    for (length = 0; length <= TEST_MAX_LENGTH; length++)
+    {
+        for (offset = 0; offset < 4u; offset++)
+        {
+            const uint8_t *src = (const uint8_t *) test_in + offset;
+
+            test_fill_random((uint8_t *) test_in, sizeof(test_in));
+            memset(test_out, TEST_GUARD, sizeof(test_out));
+            memset(test_ref, TEST_GUARD, sizeof(test_ref));
+
+            convert(src, test_out, length);
+            reference(src, test_ref, length);
+
+            TEST_ASSERT(memcmp(test_out, test_ref, sizeof(test_out)) == 0);
+        }
+    }
+}
+
+/* I2S words to USB bytes, for every length and destination alignment. The
+   input words have random upper bytes, which must be dropped. */
+static void test_from_32(void (*convert)(const uint32_t *, uint8_t *, uint32_t),
+                         void (*reference)(const uint32_t *, uint8_t *, uint32_t))
+{
+    uint32_t length;
+    uint32_t offset;
+
+    for (length = 0; length <= TEST_MAX_LENGTH; length++)
+    {
+        for (offset = 0; offset < 4u; offset++)
+        {
+            test_fill_random((uint8_t *) test_in, sizeof(test_in));
+            memset(test_out, TEST_GUARD, sizeof(test_out));
+            memset(test_ref, TEST_GUARD, sizeof(test_ref));
+
+            convert(test_in, (uint8_t *) test_out + offset, length);
+            reference(test_in, (uint8_t *) test_ref + offset, length);
+
+            TEST_ASSERT(memcmp(test_out, test_ref, sizeof(test_out)) == 0);
+        }
+    }
+}
+
+static void test_24_to_32(void)
+{
+    test_to_32(audio_convert_24_to_32, audio_convert_ref_24_to_32);
+}
+
+static void test_32_to_24(void)
+{
+    test_from_32(audio_convert_32_to_24, audio_convert_ref_32_to_24);
+}
+
+static void test_16_to_32(void)
+{
+    test_to_32(audio_convert_16_to_32, audio_convert_ref_16_to_32);
+}
+
+static void test_32_to_16(void)
+{
+    test_from_32(audio_convert_32_to_16, audio_convert_ref_32_to_16);
+}
+
+int main(void)
+{
+    printf("test_audio_convert\n");
+
+    srand(1u);
+
+    TEST_RUN(test_24_to_32);
+    TEST_RUN(test_32_to_24);
+    TEST_RUN(test_16_to_32);
+    TEST_RUN(test_32_to_16);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,328 @@
+/*******************************************************************************
+* File Name: test_audio_feed.c
+*
+* Description: Host tests of the feedback endpoint: encoding of the nominal
+*  rate, and the controller that keeps the jitter buffer level on its target
+*  while the host follows the feedback.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio_feed.h"
+#include "audio_out.h"
+#include "usb_comm.h"
+#include "host_usb.h"
+#include "cycfg.h"
+#include "rtos.h"
+#include "test.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*******************************************************************************
+* Test Constants
+*******************************************************************************/
+/* Frames run by the closed loop, and frames at the end that are checked */
+#define TEST_LOOP_FRAMES        (60000u)
+#define TEST_LOOP_CHECKED       (20000u)
+
+/* Words per sample: stereo */
+#define TEST_WORDS_PER_SAMPLE   (2u)
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static uint32_t test_feedback(void);
+static void     test_start(uint32_t rate, bool playing);
+static void     test_loop(uint32_t rate, int32_t ppm);
+
+/*******************************************************************************
+* Test Variables
+*******************************************************************************/
+int test_failures;
+
+EventGroupHandle_t rtos_events;
+
+/* Audio OUT stand-in: the level returned is set by the tests */
+volatile bool     audio_out_is_playing;
+volatile uint32_t audio_out_prime;
+uint32_t          stub_level;
+
+/*******************************************************************************
+* Function Name: audio_out_get_level
+********************************************************************************
+* Summary:
+*   Audio OUT stand-in: return the level set by the test.
+*
+*******************************************************************************/
+uint32_t audio_out_get_level(void)
+{
+    return stub_level;
+}
+
+/*******************************************************************************
+* Function Name: test_feedback
+********************************************************************************
+* Summary:
+*   Run the SOF callback and return the feedback value written to the
+*   endpoint, or zero if nothing was written.
+*
+*******************************************************************************/
+static uint32_t test_feedback(void)
+{
+    uint32_t writes = host_usb_ep_writes;
+
+    host_usb_sof_callback(CYBSP_USBDEV_HW, &usb_drvContext);
+
+    if (host_usb_ep_writes == writes)
+    {
+        return 0u;
+    }
+
+    TEST_ASSERT(host_usb_ep_endpoint == AUDIO_FEEDBACK_IN_ENDPOINT);
+    TEST_ASSERT(host_usb_ep_size == AUDIO_FEEDBACK_ENDPOINT_SIZE);
+
+    return ((uint32_t) host_usb_ep_data[2] << 16) |
+           ((uint32_t) host_usb_ep_data[1] << 8)  |
+           ((uint32_t) host_usb_ep_data[0]);
+}
+
+/*******************************************************************************
+* Function Name: test_start
+********************************************************************************
+* Summary:
+*   Set the sample rate, with the jitter buffer on its target.
+*
+*******************************************************************************/
+static void test_start(uint32_t rate, bool playing)
+{
+    audio_out_prime          = AUDIO_OUT_BUFFER_PRIME(rate);
+    audio_out_is_playing     = playing;
+    usb_comm_enable_feedback = true;
+    stub_level               = audio_out_prime;
+
+    audio_feed_update_sample_rate(rate);
+}
+
+/* The nominal value is the rate in samples per frame, in 10.14, rounded to
+   the nearest, and fits the 3 bytes of the endpoint */
+static void test_encoding(void)
+{
+    TEST_ASSERT(AUDIO_FEED_RATE_TO_FEEDBACK(AUDIO_SAMPLING_RATE_48KHZ) == 0x0C0000u);
+    TEST_ASSERT(AUDIO_FEED_RATE_TO_FEEDBACK(AUDIO_SAMPLING_RATE_44KHZ) == 0x0B0666u);
+    TEST_ASSERT(AUDIO_FEED_RATE_TO_FEEDBACK(AUDIO_SAMPLING_RATE_96KHZ) == 0x180000u);
+    TEST_ASSERT(AUDIO_FEED_RATE_TO_FEEDBACK(AUDIO_SAMPLING_RATE_88KHZ) == 0x160CCDu);
+
+    for (uint32_t rate = 8000u; rate <= 96000u; rate++)
+    {
+        int64_t error = ((int64_t) AUDIO_FEED_RATE_TO_FEEDBACK(rate) * 1000) - ((int64_t) rate << 14);
+
+        if (llabs(error) > 500)
+        {
+            TEST_ASSERT(llabs(error) <= 500);
+            break;
+        }
+    }
+
+    TEST_ASSERT(AUDIO_FEED_RATE_TO_FEEDBACK(96000u) < (1u << 24));
+}
+
+/* The nominal value is reported while the jitter buffer fills, and nothing is
+   written while the feedback is disabled */
+static void test_nominal(void)
+{
+    test_start(AUDIO_SAMPLING_RATE_44KHZ, false);
+    stub_level = 0u;
+
+    TEST_ASSERT(test_feedback() == 0x0B0666u);
+    TEST_ASSERT(host_usb_ep_data[0] == 0x66u);
+    TEST_ASSERT(host_usb_ep_data[1] == 0x06u);
+    TEST_ASSERT(host_usb_ep_data[2] == 0x0Bu);
+
+    test_start(AUDIO_SAMPLING_RATE_96KHZ, false);
+    TEST_ASSERT(test_feedback() == 0x180000u);
+
+    usb_comm_enable_feedback = false;
+    TEST_ASSERT(test_feedback() == 0u);
+}
+
+/* A low level asks the host for more samples, a high level for fewer, and
+   the correction is bounded */
+static void test_direction(void)
+{
+    uint32_t nominal = AUDIO_FEED_RATE_TO_FEEDBACK(AUDIO_SAMPLING_RATE_48KHZ);
+    uint32_t feedback;
+
+    test_start(AUDIO_SAMPLING_RATE_48KHZ, true);
+    TEST_ASSERT(test_feedback() == nominal);
+
+    stub_level = audio_out_prime - 8u;
+    feedback = test_feedback();
+    TEST_ASSERT(feedback > nominal);
+
+    test_start(AUDIO_SAMPLING_RATE_48KHZ, true);
+    stub_level = audio_out_prime + 8u;
+    feedback = test_feedback();
+    TEST_ASSERT(feedback < nominal);
+
+    test_start(AUDIO_SAMPLING_RATE_48KHZ, true);
+    stub_level = 0u;
+    for (uint32_t frame = 0; frame < 1000u; frame++)
+    {
+        feedback = test_feedback();
+        TEST_ASSERT(feedback <= (nominal + AUDIO_FEED_MAX_DEVIATION));
+    }
+    TEST_ASSERT(feedback == (nominal + AUDIO_FEED_MAX_DEVIATION));
+}
+
+/* The integral does not wind up while the output is saturated: once the
+   level is back on target, the feedback is back near the nominal value */
+static void test_anti_windup(void)
+{
+    uint32_t nominal = AUDIO_FEED_RATE_TO_FEEDBACK(AUDIO_SAMPLING_RATE_48KHZ);
+    uint32_t feedback = 0u;
+
+    test_start(AUDIO_SAMPLING_RATE_48KHZ, true);
+
+    stub_level = 0u;
+    for (uint32_t frame = 0; frame < 5000u; frame++)
+    {
+        (void) test_feedback();
+    }
+
+    stub_level = audio_out_prime;
+    for (uint32_t frame = 0; frame < 200u; frame++)
+    {
+        feedback = test_feedback();
+    }
+
+    TEST_ASSERT(abs((int32_t) (feedback - nominal)) < (int32_t) (AUDIO_FEED_SINGLE_SAMPLE / 4u));
+}
+
+/*******************************************************************************
+* Function Name: test_loop
+********************************************************************************
+* Summary:
+*   Closed loop: the host sends the samples asked by the feedback of the
+*   previous frame, carrying the fraction, and the I2S plays them at the rate
+*   offset by ppm. Once settled, the level stays near its target and the
+*   average feedback matches the I2S rate.
+*
+*******************************************************************************/
+static void test_loop(uint32_t rate, int32_t ppm)
+{
+    /* I2S samples per frame, in 10.14 */
+    double   i2s_rate = (double) rate * (1.0 + (ppm * 1e-6)) * 16384.0 / 1000.0;
+    double   i2s_phase = 0.0;
+    uint32_t host_phase = 0u;
+    uint32_t feedback = AUDIO_FEED_RATE_TO_FEEDBACK(rate);
+    uint64_t feedback_sum = 0u;
+    int32_t  level;
+    int32_t  level_min = INT32_MAX;
+    int32_t  level_max = INT32_MIN;
+
+    test_start(rate, true);
+    level = (int32_t) audio_out_prime;
+
+    for (uint32_t frame = 0; frame < TEST_LOOP_FRAMES; frame++)
+    {
+        uint32_t played;
+
+        /* Host packet of this frame, from the last feedback received */
+        host_phase += feedback;
+        level += (int32_t) ((host_phase >> 14) * TEST_WORDS_PER_SAMPLE);
+        host_phase &= 0x3FFFu;
+
+        /* Samples played by the I2S during the frame */
+        i2s_phase += i2s_rate;
+        played = (uint32_t) (i2s_phase / 16384.0);
+        i2s_phase -= played * 16384.0;
+        level -= (int32_t) (played * TEST_WORDS_PER_SAMPLE);
+
+        TEST_ASSERT(level > 0);
+        stub_level = (uint32_t) level;
+        feedback = test_feedback();
+
+        if (frame >= (TEST_LOOP_FRAMES - TEST_LOOP_CHECKED))
+        {
+            feedback_sum += feedback;
+            level_min = (level < level_min) ? level : level_min;
+            level_max = (level > level_max) ? level : level_max;
+        }
+    }
+
+    /* Within 2 ppm of the I2S rate, and one sample of the target */
+    TEST_ASSERT(fabs(((double) feedback_sum / TEST_LOOP_CHECKED) - i2s_rate) < (i2s_rate * 2e-6));
+    TEST_ASSERT(level_min >= (int32_t) (audio_out_prime - TEST_WORDS_PER_SAMPLE));
+    TEST_ASSERT(level_max <= (int32_t) (audio_out_prime + TEST_WORDS_PER_SAMPLE));
+}
+
+/* The host follows an I2S clock off by up to the crystal tolerance */
+static void test_tracking(void)
+{
+    static const int32_t offsets[] = {0, 100, -100, 500, -500};
+    static const uint32_t rates[] = {AUDIO_SAMPLING_RATE_44KHZ, AUDIO_SAMPLING_RATE_48KHZ,
+                                     AUDIO_SAMPLING_RATE_96KHZ};
+
+    for (uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+    {
+        for (uint32_t o = 0; o < sizeof(offsets) / sizeof(offsets[0]); o++)
+        {
+            uint32_t failures = (uint32_t) test_failures;
+
+            test_loop(rates[r], offsets[o]);
+
+            if ((uint32_t) test_failures != failures)
+            {
+                printf("    at %lu Hz, %ld ppm\n", (unsigned long) rates[r], (long) offsets[o]);
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    printf("test_audio_feed\n");
+
+    rtos_events = xEventGroupCreate();
+
+    audio_feed_init();
+
+    TEST_RUN(test_encoding);
+    TEST_RUN(test_nominal);
+    TEST_RUN(test_direction);
+    TEST_RUN(test_anti_windup);
+    TEST_RUN(test_tracking);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,227 @@
+/*******************************************************************************
+* File Name: test_audio_gain.c
+*
+* Description: Host tests of the software gain stage: volume mapping,
+*  per-channel ramps, and blocks that split a stereo pair.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio.h"
+#include "audio_gain.h"
+#include "test.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Test Constants
+*******************************************************************************/
+/* One 1-ms stereo frame at 48 kHz */
+#define TEST_LENGTH         (AUDIO_FRAME_DATA_SIZE)
+
+/* Full-scale positive and negative 24-bit samples */
+#define TEST_POSITIVE       (0x007FFFFFu)
+#define TEST_NEGATIVE       (0x00800000u)
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static int32_t test_sample(uint32_t sample);
+
+/*******************************************************************************
+* Test Variables
+*******************************************************************************/
+int test_failures;
+
+uint32_t test_samples[TEST_LENGTH];
+uint32_t test_split[TEST_LENGTH];
+
+/*******************************************************************************
+* Function Name: test_sample
+********************************************************************************
+* Summary:
+*   Sign extend a 24-bit sample.
+*
+*******************************************************************************/
+static int32_t test_sample(uint32_t sample)
+{
+    return ((int32_t) (sample << 8)) >> 8;
+}
+
+/* The volume maps to the gain in dB, limited to unity and to silence */
+static void test_from_volume(void)
+{
+    double half = (double) audio_gain_from_volume(-6 * 256, false) / 2147483648.0;
+
+    TEST_ASSERT(audio_gain_from_volume(0, false) == AUDIO_GAIN_UNITY);
+    TEST_ASSERT(audio_gain_from_volume(6 * 256, false) == AUDIO_GAIN_UNITY);
+    TEST_ASSERT(audio_gain_from_volume(0, true) == 0);
+    TEST_ASSERT(audio_gain_from_volume(-AUDIO_GAIN_MIN_DB * 256, false) == 0);
+    TEST_ASSERT(fabs(half - pow(10.0, -6.0 / 20.0)) < 1e-6);
+
+    /* Each 1/16 dB step lowers the gain */
+    for (int32_t volume = -16; volume > (-40 * 256); volume -= 16)
+    {
+        TEST_ASSERT(audio_gain_from_volume((int16_t) volume, false) <
+                    audio_gain_from_volume((int16_t) (volume + 16), false));
+    }
+}
+
+/* At unity the samples are untouched */
+static void test_unity(void)
+{
+    audio_gain_t gain;
+
+    audio_gain_init(&gain);
+
+    for (uint32_t i = 0; i < TEST_LENGTH; i++)
+    {
+        test_samples[i] = (i & 1u) ? TEST_NEGATIVE : TEST_POSITIVE;
+    }
+
+    audio_gain_start_frame(&gain, TEST_LENGTH);
+    audio_gain_process(&gain, test_samples, TEST_LENGTH);
+
+    for (uint32_t i = 0; i < TEST_LENGTH; i++)
+    {
+        TEST_ASSERT(test_samples[i] == ((i & 1u) ? TEST_NEGATIVE : TEST_POSITIVE));
+    }
+}
+
+/* A new gain on the left channel is ramped over one frame, the right channel
+   is untouched, and the next frame is at the target */
+static void test_ramp_one_channel(void)
+{
+    audio_gain_t gain;
+    int32_t previous = test_sample(TEST_POSITIVE);
+    int32_t sample;
+
+    audio_gain_init(&gain);
+    audio_gain_set_target(&gain, 0u, AUDIO_GAIN_UNITY / 2);
+
+    for (uint32_t frame = 0; frame < 2u; frame++)
+    {
+        for (uint32_t i = 0; i < TEST_LENGTH; i++)
+        {
+            test_samples[i] = TEST_POSITIVE;
+        }
+
+        audio_gain_start_frame(&gain, TEST_LENGTH);
+        audio_gain_process(&gain, test_samples, TEST_LENGTH);
+
+        for (uint32_t i = 0; i < TEST_LENGTH; i += 2u)
+        {
+            sample = test_sample(test_samples[i]);
+
+            TEST_ASSERT(sample <= previous);
+            TEST_ASSERT(test_samples[i + 1u] == TEST_POSITIVE);
+            previous = sample;
+        }
+
+        /* The last left sample of the ramp is at the target */
+        TEST_ASSERT(abs(previous - (test_sample(TEST_POSITIVE) / 2)) <= 1);
+    }
+}
+
+/* A frame processed in blocks that split the stereo pairs gives the same
+   samples as in one block */
+static void test_split_blocks(void)
+{
+    audio_gain_t whole;
+    audio_gain_t split;
+    uint32_t done = 0;
+    uint32_t block = 1;
+
+    audio_gain_init(&whole);
+    audio_gain_init(&split);
+    audio_gain_set_target(&whole, 0u, AUDIO_GAIN_UNITY / 4);
+    audio_gain_set_target(&whole, 1u, AUDIO_GAIN_UNITY / 2);
+    audio_gain_set_target(&split, 0u, AUDIO_GAIN_UNITY / 4);
+    audio_gain_set_target(&split, 1u, AUDIO_GAIN_UNITY / 2);
+
+    for (uint32_t i = 0; i < TEST_LENGTH; i++)
+    {
+        test_samples[i] = (i & 2u) ? TEST_NEGATIVE : (TEST_POSITIVE - i);
+    }
+    memcpy(test_split, test_samples, sizeof(test_split));
+
+    audio_gain_start_frame(&whole, TEST_LENGTH);
+    audio_gain_process(&whole, test_samples, TEST_LENGTH);
+
+    audio_gain_start_frame(&split, TEST_LENGTH);
+    while (done < TEST_LENGTH)
+    {
+        if (block > (TEST_LENGTH - done))
+        {
+            block = TEST_LENGTH - done;
+        }
+        audio_gain_process(&split, &test_split[done], block);
+        done  += block;
+        block += 2u;
+    }
+
+    TEST_ASSERT(memcmp(test_samples, test_split, sizeof(test_split)) == 0);
+}
+
+/* A negative sample keeps its sign and stays within 24 bits */
+static void test_negative(void)
+{
+    audio_gain_t gain;
+
+    audio_gain_init(&gain);
+    audio_gain_set_target(&gain, 0u, AUDIO_GAIN_UNITY / 2);
+    audio_gain_set_target(&gain, 1u, AUDIO_GAIN_UNITY / 2);
+    audio_gain_start_frame(&gain, 2u);
+
+    test_samples[0] = TEST_NEGATIVE;
+    test_samples[1] = TEST_NEGATIVE;
+    audio_gain_process(&gain, test_samples, 2u);
+
+    TEST_ASSERT(test_samples[0] == 0x00C00000u);
+    TEST_ASSERT(test_samples[1] == 0x00C00000u);
+}
+
+int main(void)
+{
+    printf("test_audio_gain\n");
+
+    TEST_RUN(test_from_volume);
+    TEST_RUN(test_unity);
+    TEST_RUN(test_ramp_one_channel);
+    TEST_RUN(test_split_blocks);
+    TEST_RUN(test_negative);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,415 @@
+/*******************************************************************************
+* File Name: test_audio_in.c
+*
+* Description: Host tests of the Audio IN endpoint pacing: the packets sent over
+*  1000 frames at each sample rate, with the fractional rates spread over the
+*  long packets, and the drift correction when the I2S clock runs off the USB
+*  clock.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio_in.h"
+#include "audio_app.h"
+#include "usb_comm.h"
+#include "host_usb.h"
+#include "cycfg.h"
+#include "rtos.h"
+#include "test.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Test Constants
+*******************************************************************************/
+/* Frames of the pacing test, one second */
+#define TEST_PACING_FRAMES      (1000u)
+
+/* Frames of the drift test, and the clock offset of the I2S in ppm */
+#define TEST_DRIFT_FRAMES       (10000u)
+#define TEST_DRIFT_PPM          (1000)
+
+/* I2S words per frame are accumulated in 1/TEST_WORD_UNIT of a word */
+#define TEST_WORD_UNIT          (1000000000ull)
+
+/* Words carry a running count in the 24 bits sent to the host */
+#define TEST_WORD_MASK          (0xFFFFFFu)
+
+/*******************************************************************************
+* Test Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t usb_rate;
+    uint32_t i2s_rate;
+} test_rates_t;
+
+typedef struct
+{
+    uint32_t words;         /* Words sent to the host */
+    uint32_t captured;      /* Words captured from the I2S */
+    uint32_t silence;       /* Words of silence sent before the stream */
+    uint32_t first;         /* First word of the stream */
+    bool     ordered;       /* Captured words sent once and in order */
+} test_result_t;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void test_start(uint32_t usb_rate, uint32_t i2s_rate);
+static void test_run(uint32_t usb_rate, uint32_t i2s_rate, int32_t ppm, uint32_t frames,
+                     test_result_t *result);
+static void test_drift(uint32_t rate, int32_t ppm);
+
+/* Audio IN internals driven by the tests */
+void audio_in_start_dma(void);
+extern volatile bool audio_in_is_recording;
+
+/*******************************************************************************
+* Test Variables
+*******************************************************************************/
+int test_failures;
+
+EventGroupHandle_t rtos_events;
+cyhal_i2s_t        i2s;
+
+/* Rate pairs of the IN stream, the I2S runs at the playback rate */
+const test_rates_t test_rates[] =
+{
+    { 48000u, 48000u },
+    { 44100u, 44100u },
+    { 96000u, 96000u },
+    { 88200u, 88200u },
+    { 16000u, 48000u },
+    { 22050u, 48000u },
+    { 32000u, 48000u },
+    { 48000u, 44100u },
+    { 44100u, 96000u },
+};
+
+#define TEST_RATES          (sizeof(test_rates) / sizeof(test_rates[0]))
+
+/* I2S RX stand-in: buffer handed to the DMA, and words captured so far */
+uint32_t *test_dma_buffer;
+uint32_t  test_dma_length;
+uint32_t  test_captured;
+
+/*******************************************************************************
+* Function Name: cyhal_i2s_read_async
+********************************************************************************
+* Summary:
+*   I2S RX stand-in: record the buffer handed to the DMA.
+*
+*******************************************************************************/
+cy_rslt_t cyhal_i2s_read_async(cyhal_i2s_t *obj, void *rx, size_t rx_length)
+{
+    (void) obj;
+
+    test_dma_buffer = (uint32_t *) rx;
+    test_dma_length = (uint32_t) rx_length;
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_i2s_abort_read_async
+********************************************************************************
+* Summary:
+*   I2S RX stand-in: drop the buffer handed to the DMA.
+*
+*******************************************************************************/
+cy_rslt_t cyhal_i2s_abort_read_async(cyhal_i2s_t *obj)
+{
+    (void) obj;
+
+    test_dma_buffer = NULL;
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_i2s_start_rx
+********************************************************************************
+* Summary:
+*   I2S RX stand-in: nothing to do.
+*
+*******************************************************************************/
+cy_rslt_t cyhal_i2s_start_rx(cyhal_i2s_t *obj)
+{
+    (void) obj;
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_i2s_stop_rx
+********************************************************************************
+* Summary:
+*   I2S RX stand-in: nothing to do.
+*
+*******************************************************************************/
+cy_rslt_t cyhal_i2s_stop_rx(cyhal_i2s_t *obj)
+{
+    (void) obj;
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: cyhal_i2s_enable_event
+********************************************************************************
+* Summary:
+*   I2S RX stand-in: nothing to do, the test raises the events.
+*
+*******************************************************************************/
+void cyhal_i2s_enable_event(cyhal_i2s_t *obj, cyhal_i2s_event_t event, uint8_t intr_priority,
+                            bool enable)
+{
+    (void) obj;
+    (void) event;
+    (void) intr_priority;
+    (void) enable;
+}
+
+/*******************************************************************************
+* Function Name: Cy_I2S_ClearRxFifo
+********************************************************************************
+* Summary:
+*   I2S RX stand-in: nothing to do.
+*
+*******************************************************************************/
+void Cy_I2S_ClearRxFifo(void *base)
+{
+    (void) base;
+}
+
+/*******************************************************************************
+* Function Name: test_start
+********************************************************************************
+* Summary:
+*   Start a recording session at the given rates, from an empty capture
+*   buffer.
+*
+*******************************************************************************/
+static void test_start(uint32_t usb_rate, uint32_t i2s_rate)
+{
+    usb_comm_clock_configured = true;
+    usb_comm_in_subframe_size = AUDIO_SAMPLE_DATA_SIZE;
+
+    audio_in_update_sample_rate(usb_rate, i2s_rate);
+    audio_ring_init(&audio_in_ring, audio_in_ring.buffer, audio_in_ring.size);
+    memset((void *) &audio_in_drift, 0, sizeof(audio_in_drift));
+
+    test_captured = 0;
+
+    audio_in_is_recording = true;
+    audio_in_start_dma();
+}
+
+/*******************************************************************************
+* Function Name: test_run
+********************************************************************************
+* Summary:
+*   Run the IN stream for a number of frames. The I2S fills the DMA buffers
+*   with a running count at its rate, off by the given ppm, and the IN
+*   endpoint sends one packet per frame.
+*
+*******************************************************************************/
+static void test_run(uint32_t usb_rate, uint32_t i2s_rate, int32_t ppm, uint32_t frames,
+                     test_result_t *result)
+{
+    uint64_t per_frame = (uint64_t) AUDIO_IN_CHANNELS * i2s_rate * (uint64_t) (1000000 + ppm);
+    uint64_t phase = 0;
+    uint32_t next = 0;
+    uint32_t frame;
+    uint32_t length;
+    uint32_t word;
+    uint32_t i;
+
+    test_start(usb_rate, i2s_rate);
+
+    memset(result, 0, sizeof(*result));
+    result->ordered = true;
+
+    for (frame = 0; frame < frames; frame++)
+    {
+        /* The words of one frame, in DMA buffers */
+        phase += per_frame;
+        while (phase >= ((uint64_t) test_dma_length * TEST_WORD_UNIT))
+        {
+            phase -= (uint64_t) test_dma_length * TEST_WORD_UNIT;
+
+            for (i = 0; i < test_dma_length; i++)
+            {
+                test_dma_buffer[i] = (++test_captured) & TEST_WORD_MASK;
+            }
+
+            audio_in_i2s_event(CYHAL_I2S_ASYNC_RX_COMPLETE);
+        }
+
+        host_usb_ep_callback[AUDIO_STREAMING_IN_ENDPOINT](CYBSP_USBDEV_HW,
+                                                          AUDIO_STREAMING_IN_ENDPOINT,
+                                                          0u, &usb_drvContext);
+
+        TEST_ASSERT(host_usb_ep_endpoint == AUDIO_STREAMING_IN_ENDPOINT);
+        TEST_ASSERT((host_usb_ep_size % AUDIO_SAMPLE_DATA_SIZE) == 0u);
+
+        length = host_usb_ep_size / AUDIO_SAMPLE_DATA_SIZE;
+        result->words += length;
+
+        /* Silence until the capture buffer is primed, then the count from
+           where the stream starts */
+        for (i = 0; i < length; i++)
+        {
+            word = ((uint32_t) host_usb_ep_data[(i * AUDIO_SAMPLE_DATA_SIZE) + 2u] << 16) |
+                   ((uint32_t) host_usb_ep_data[(i * AUDIO_SAMPLE_DATA_SIZE) + 1u] << 8)  |
+                   ((uint32_t) host_usb_ep_data[(i * AUDIO_SAMPLE_DATA_SIZE)]);
+
+            if ((next == 0u) && (word != 0u))
+            {
+                result->first = word;
+                next = word;
+            }
+
+            if (next != 0u)
+            {
+                result->ordered &= (word == (next & TEST_WORD_MASK));
+                next++;
+            }
+            else
+            {
+                result->silence++;
+            }
+        }
+    }
+
+    result->captured = test_captured;
+}
+
+/* Over one second, the packets carry the rate exactly: the fractional rates
+   send one long packet per 1/1000 of the rate, and the clocks being equal no
+   sample is added or removed */
+static void test_pacing(void)
+{
+    test_result_t result;
+    uint32_t i;
+
+    for (i = 0; i < TEST_RATES; i++)
+    {
+        uint32_t usb_rate = test_rates[i].usb_rate;
+
+        test_run(usb_rate, test_rates[i].i2s_rate, 0, TEST_PACING_FRAMES, &result);
+
+        TEST_ASSERT(audio_in_drift.packets == TEST_PACING_FRAMES);
+        TEST_ASSERT(audio_in_drift.long_packets == (usb_rate % AUDIO_IN_FRAMES_PER_SEC));
+        TEST_ASSERT(audio_in_drift.added == 0u);
+        TEST_ASSERT(audio_in_drift.removed == 0u);
+        TEST_ASSERT(result.words == (AUDIO_IN_CHANNELS * usb_rate));
+
+        TEST_ASSERT(audio_in_ring.overruns == 0u);
+        TEST_ASSERT(audio_in_ring.underruns == 0u);
+    }
+}
+
+/* Captured samples are sent once and in order after the silence. The words
+   captured past the target while priming are dropped, the others are sent or
+   still in the capture buffer */
+static void test_order(void)
+{
+    test_result_t result;
+
+    test_run(AUDIO_SAMPLING_RATE_44KHZ, AUDIO_SAMPLING_RATE_44KHZ, 0, TEST_PACING_FRAMES, &result);
+
+    TEST_ASSERT(result.ordered);
+    TEST_ASSERT(result.first > 0u);
+    TEST_ASSERT(result.captured == ((result.first - 1u) + (result.words - result.silence) +
+                                    audio_ring_get_level(&audio_in_ring)));
+}
+
+/*******************************************************************************
+* Function Name: test_drift
+********************************************************************************
+* Summary:
+*   Run the I2S off the USB clock. The samples added minus the samples removed
+*   follow the drift, within the dead band of the correction and one DMA
+*   buffer, with every captured sample sent once and in order.
+*
+*******************************************************************************/
+static void test_drift(uint32_t rate, int32_t ppm)
+{
+    test_result_t result;
+    int32_t expected = (int32_t) (((int64_t) rate * ppm * (int64_t) TEST_DRIFT_FRAMES) /
+                                  (1000000 * (int64_t) AUDIO_IN_FRAMES_PER_SEC));
+    int32_t drift;
+
+    test_run(rate, rate, ppm, TEST_DRIFT_FRAMES, &result);
+
+    drift = (int32_t) audio_in_drift.added - (int32_t) audio_in_drift.removed;
+
+    TEST_ASSERT(result.ordered);
+    TEST_ASSERT(abs(drift - expected) <= (int32_t) ((2u * AUDIO_IN_DMA_HALF_SIZE) / AUDIO_IN_CHANNELS));
+    TEST_ASSERT((ppm > 0) ? (audio_in_drift.removed == 0u) : (audio_in_drift.added == 0u));
+
+    TEST_ASSERT(result.words == (AUDIO_IN_CHANNELS *
+                                 ((rate * (TEST_DRIFT_FRAMES / AUDIO_IN_FRAMES_PER_SEC)) + (uint32_t) drift)));
+
+    TEST_ASSERT(audio_in_ring.overruns == 0u);
+    TEST_ASSERT(audio_in_ring.underruns == 0u);
+}
+
+/* The I2S clock fast or slow by 1000 ppm, the worst the correction absorbs */
+static void test_drift_rates(void)
+{
+    test_drift(AUDIO_SAMPLING_RATE_48KHZ,  TEST_DRIFT_PPM);
+    test_drift(AUDIO_SAMPLING_RATE_48KHZ, -TEST_DRIFT_PPM);
+    test_drift(AUDIO_SAMPLING_RATE_44KHZ,  TEST_DRIFT_PPM);
+    test_drift(AUDIO_SAMPLING_RATE_44KHZ, -TEST_DRIFT_PPM);
+    test_drift(AUDIO_SAMPLING_RATE_96KHZ,  TEST_DRIFT_PPM);
+    test_drift(AUDIO_SAMPLING_RATE_96KHZ, -TEST_DRIFT_PPM);
+}
+
+int main(void)
+{
+    printf("test_audio_in\n");
+
+    rtos_events = xEventGroupCreate();
+
+    audio_in_init();
+
+    TEST_RUN(test_pacing);
+    TEST_RUN(test_order);
+    TEST_RUN(test_drift_rates);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* [] END OF FILE */
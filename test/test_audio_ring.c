@@ -0,0 +1,282 @@
+/*******************************************************************************
+* File Name: test_audio_ring.c
+*
+* Description: Host tests of the jitter buffer ring: copies and in-place blocks
+*  across the wrap-around, and the overrun and underrun counters.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio_ring.h"
+#include "test.h"
+
+/*******************************************************************************
+* Test Constants
+*******************************************************************************/
+/* Words in the storage, one of them is kept free */
+#define TEST_SIZE           (8u)
+#define TEST_CAPACITY       (TEST_SIZE - 1u)
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static void test_reset(uint32_t start);
+
+/*******************************************************************************
+* Test Variables
+*******************************************************************************/
+int test_failures;
+
+audio_ring_t test_ring;
+uint32_t     test_storage[TEST_SIZE];
+
+/* Next word written and next word expected by the reader */
+uint32_t     test_next_write;
+uint32_t     test_next_read;
+
+/*******************************************************************************
+* Function Name: test_reset
+********************************************************************************
+* Summary:
+*   Initialize the ring, empty, with both indexes at start.
+*
+*******************************************************************************/
+static void test_reset(uint32_t start)
+{
+    uint32_t words[TEST_SIZE] = {0};
+
+    audio_ring_init(&test_ring, test_storage, TEST_SIZE);
+
+    /* Move the indexes through the API, as the ISRs would */
+    audio_ring_write(&test_ring, words, start);
+    audio_ring_read(&test_ring, words, start);
+
+    test_next_write = 1000u;
+    test_next_read  = 1000u;
+}
+
+/* An empty ring has no level, all the space but one word, and a read of it
+   is counted as underruns */
+static void test_empty(void)
+{
+    uint32_t words[4];
+
+    test_reset(0u);
+
+    TEST_ASSERT(audio_ring_get_level(&test_ring) == 0u);
+    TEST_ASSERT(audio_ring_get_space(&test_ring) == TEST_CAPACITY);
+    TEST_ASSERT(audio_ring_read(&test_ring, words, 4u) == 0u);
+    TEST_ASSERT(test_ring.underruns == 4u);
+    TEST_ASSERT(test_ring.overruns == 0u);
+}
+
+/* Copies of every length, from every start index, come out in order */
+static void test_copy_wrap(void)
+{
+    uint32_t words[TEST_CAPACITY];
+
+    for (uint32_t start = 0; start < TEST_SIZE; start++)
+    {
+        for (uint32_t length = 1; length <= TEST_CAPACITY; length++)
+        {
+            test_reset(start);
+
+            for (uint32_t round = 0; round < (2u * TEST_SIZE); round++)
+            {
+                for (uint32_t i = 0; i < length; i++)
+                {
+                    words[i] = test_next_write++;
+                }
+
+                TEST_ASSERT(audio_ring_write(&test_ring, words, length) == length);
+                TEST_ASSERT(audio_ring_get_level(&test_ring) == length);
+                TEST_ASSERT(audio_ring_get_space(&test_ring) == (TEST_CAPACITY - length));
+
+                TEST_ASSERT(audio_ring_read(&test_ring, words, length) == length);
+
+                for (uint32_t i = 0; i < length; i++)
+                {
+                    TEST_ASSERT(words[i] == test_next_read);
+                    test_next_read++;
+                }
+            }
+
+            TEST_ASSERT(test_ring.overruns == 0u);
+            TEST_ASSERT(test_ring.underruns == 0u);
+        }
+    }
+}
+
+/* The blocks stop at the end of the storage: a transfer across the wrap is
+   two blocks, and the words come out in order */
+static void test_blocks_wrap(void)
+{
+    uint32_t *block;
+    uint32_t count;
+
+    test_reset(TEST_SIZE - 2u);
+
+    count = 5u;
+    block = audio_ring_get_write_block(&test_ring, &count);
+    TEST_ASSERT(count == 2u);
+    TEST_ASSERT(block == &test_storage[TEST_SIZE - 2u]);
+    block[0] = 1u;
+    block[1] = 2u;
+    audio_ring_commit_write(&test_ring, count);
+
+    count = 3u;
+    block = audio_ring_get_write_block(&test_ring, &count);
+    TEST_ASSERT(count == 3u);
+    TEST_ASSERT(block == &test_storage[0]);
+    block[0] = 3u;
+    block[1] = 4u;
+    block[2] = 5u;
+    audio_ring_commit_write(&test_ring, count);
+
+    TEST_ASSERT(audio_ring_get_level(&test_ring) == 5u);
+
+    count = 5u;
+    block = audio_ring_get_read_block(&test_ring, &count);
+    TEST_ASSERT(count == 2u);
+    TEST_ASSERT((block[0] == 1u) && (block[1] == 2u));
+    audio_ring_commit_read(&test_ring, count);
+
+    count = 5u;
+    block = audio_ring_get_read_block(&test_ring, &count);
+    TEST_ASSERT(count == 3u);
+    TEST_ASSERT((block[0] == 3u) && (block[1] == 4u) && (block[2] == 5u));
+    audio_ring_commit_read(&test_ring, count);
+
+    TEST_ASSERT(audio_ring_get_level(&test_ring) == 0u);
+}
+
+/* The write block of a full ring is empty, and so is the read block of an
+   empty ring; a partial block is limited by the space or the level */
+static void test_blocks_limits(void)
+{
+    uint32_t words[TEST_CAPACITY] = {0};
+    uint32_t count;
+
+    test_reset(2u);
+
+    audio_ring_write(&test_ring, words, TEST_CAPACITY);
+    count = TEST_SIZE;
+    (void) audio_ring_get_write_block(&test_ring, &count);
+    TEST_ASSERT(count == 0u);
+
+    audio_ring_read(&test_ring, words, 3u);
+    count = TEST_SIZE;
+    (void) audio_ring_get_write_block(&test_ring, &count);
+    TEST_ASSERT(count == 3u);
+
+    audio_ring_read(&test_ring, words, TEST_CAPACITY - 3u);
+    count = TEST_SIZE;
+    (void) audio_ring_get_read_block(&test_ring, &count);
+    TEST_ASSERT(count == 0u);
+
+    TEST_ASSERT(test_ring.overruns == 0u);
+    TEST_ASSERT(test_ring.underruns == 0u);
+}
+
+/* The words that do not fit are dropped and counted, the words written are
+   kept */
+static void test_overrun(void)
+{
+    uint32_t words[TEST_SIZE + 3u];
+
+    test_reset(5u);
+
+    for (uint32_t i = 0; i < (TEST_SIZE + 3u); i++)
+    {
+        words[i] = i;
+    }
+
+    TEST_ASSERT(audio_ring_write(&test_ring, words, TEST_SIZE) == TEST_CAPACITY);
+    TEST_ASSERT(test_ring.overruns == 1u);
+    TEST_ASSERT(audio_ring_get_level(&test_ring) == TEST_CAPACITY);
+
+    TEST_ASSERT(audio_ring_write(&test_ring, words, 3u) == 0u);
+    TEST_ASSERT(test_ring.overruns == 4u);
+
+    TEST_ASSERT(audio_ring_read(&test_ring, words, TEST_CAPACITY) == TEST_CAPACITY);
+    for (uint32_t i = 0; i < TEST_CAPACITY; i++)
+    {
+        TEST_ASSERT(words[i] == i);
+    }
+    TEST_ASSERT(test_ring.underruns == 0u);
+}
+
+/* A read of more words than queued returns what is there and counts the
+   missing words */
+static void test_underrun(void)
+{
+    uint32_t words[5] = {7u, 8u, 0u, 0u, 0u};
+
+    test_reset(6u);
+
+    audio_ring_write(&test_ring, words, 2u);
+    TEST_ASSERT(audio_ring_read(&test_ring, words, 5u) == 2u);
+    TEST_ASSERT((words[0] == 7u) && (words[1] == 8u));
+    TEST_ASSERT(test_ring.underruns == 3u);
+    TEST_ASSERT(audio_ring_get_level(&test_ring) == 0u);
+}
+
+/* A flush empties the ring and keeps the counters */
+static void test_flush(void)
+{
+    uint32_t words[TEST_SIZE] = {0};
+
+    test_reset(3u);
+
+    audio_ring_write(&test_ring, words, TEST_SIZE);
+    audio_ring_flush(&test_ring);
+
+    TEST_ASSERT(audio_ring_get_level(&test_ring) == 0u);
+    TEST_ASSERT(audio_ring_get_space(&test_ring) == TEST_CAPACITY);
+    TEST_ASSERT(test_ring.overruns == 1u);
+}
+
+int main(void)
+{
+    printf("test_audio_ring\n");
+
+    TEST_RUN(test_empty);
+    TEST_RUN(test_copy_wrap);
+    TEST_RUN(test_blocks_wrap);
+    TEST_RUN(test_blocks_limits);
+    TEST_RUN(test_overrun);
+    TEST_RUN(test_underrun);
+    TEST_RUN(test_flush);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,384 @@
+/*******************************************************************************
+* File Name: test_audio_src.c
+*
+* Description: Host tests of the polyphase sample-rate converter: frame
+*  accounting, DC gain, tone accuracy, and saturation, at the rate pairs of
+*  the playback and capture streams.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "audio.h"
+#include "audio_src.h"
+#include "test.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/*******************************************************************************
+* Test Constants
+*******************************************************************************/
+/* Frames of one test signal, 100 ms at the highest rate */
+#define TEST_FRAMES         (9600u)
+
+/* Frames skipped at the start of the output, while the history fills */
+#define TEST_SETTLE         (200u)
+
+/* Test tone, and its level relative to full scale */
+#define TEST_TONE_HZ        (1000.0)
+#define TEST_TONE_LEVEL     (0.5)
+
+/* Minimum ratio of the tone to the error of the output, in dB */
+#define TEST_MIN_SNR_DB     (65.0)
+
+/*******************************************************************************
+* Test Types
+*******************************************************************************/
+typedef struct
+{
+    uint32_t in_rate;
+    uint32_t out_rate;
+} test_rates_t;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static int32_t  test_sample(uint32_t sample);
+static uint32_t test_convert(audio_src_t *src, uint32_t in_frames);
+
+/*******************************************************************************
+* Test Variables
+*******************************************************************************/
+int test_failures;
+
+/* Rate pairs used by the OUT (host to I2S) and IN (I2S to host) streams */
+const test_rates_t test_rates[] =
+{
+    { 44100u, 48000u },
+    { 48000u, 44100u },
+    { 48000u, 16000u },
+    { 48000u, 22050u },
+    { 48000u, 32000u },
+    { 96000u, 16000u },
+    { 88200u, 22050u },
+    { 44100u, 96000u },
+    { 96000u, 44100u },
+};
+
+#define TEST_RATES          (sizeof(test_rates) / sizeof(test_rates[0]))
+
+audio_src_t test_src;
+audio_src_t test_copy;
+uint32_t test_in[AUDIO_SRC_CHANNELS * TEST_FRAMES];
+uint32_t test_out[AUDIO_SRC_CHANNELS * 3u * TEST_FRAMES];
+
+/*******************************************************************************
+* Function Name: test_sample
+********************************************************************************
+* Summary:
+*   Sign extend a 24-bit sample.
+*
+*******************************************************************************/
+static int32_t test_sample(uint32_t sample)
+{
+    return ((int32_t) (sample << 8)) >> 8;
+}
+
+/*******************************************************************************
+* Function Name: test_convert
+********************************************************************************
+* Summary:
+*   Convert the test input in blocks of one 1-ms USB frame, as the endpoint
+*   handlers do. Returns the number of output frames.
+*
+*******************************************************************************/
+static uint32_t test_convert(audio_src_t *src, uint32_t in_frames)
+{
+    uint32_t block = (src->down * 1000u) / (src->up * 20u);
+    uint32_t done = 0;
+    uint32_t out = 0;
+    uint32_t count;
+
+    block = (block == 0u) ? 1u : block;
+
+    while (done < in_frames)
+    {
+        count = ((in_frames - done) < block) ? (in_frames - done) : block;
+
+        out += audio_src_process(src, &test_in[AUDIO_SRC_CHANNELS * done], count,
+                                 &test_out[AUDIO_SRC_CHANNELS * out],
+                                 (sizeof(test_out) / sizeof(test_out[0]) / AUDIO_SRC_CHANNELS) - out);
+        done += count;
+    }
+
+    return out;
+}
+
+/* A ratio without a table is rejected, and the converter is left as it was */
+static void test_reject_ratio(void)
+{
+    TEST_ASSERT(audio_src_init(&test_src, 44100u, 48000u) == true);
+    TEST_ASSERT(audio_src_init(&test_src, 44100u, 47999u) == false);
+    TEST_ASSERT((test_src.up == 160u) && (test_src.down == 147u));
+}
+
+/* Every branch of the tables has a unity DC gain in Q15 and fits the
+   history, and every rate pair of the streams has a table */
+static void test_tables(void)
+{
+    for (uint32_t i = 0; i < audio_src_ratios_number; i++)
+    {
+        const audio_src_ratio_t *ratio = &audio_src_ratios[i];
+
+        TEST_ASSERT(ratio->taps <= AUDIO_SRC_MAX_TAPS);
+        TEST_ASSERT((ratio->taps * ratio->up) <= (AUDIO_SRC_MAX_PHASES * AUDIO_SRC_TAPS));
+
+        for (uint32_t phase = 0; phase < ratio->up; phase++)
+        {
+            int32_t sum = 0;
+
+            for (uint32_t tap = 0; tap < ratio->taps; tap++)
+            {
+                /* The single branch of a decimation only stores its first half */
+                uint32_t index = (tap < (ratio->taps / 2u)) ? tap : (ratio->taps - 1u - tap);
+
+                sum += (1u == ratio->up) ? ratio->coef[index] : ratio->coef[(phase * ratio->taps) + tap];
+            }
+
+            TEST_ASSERT(sum == (1 << 15));
+        }
+    }
+
+    for (uint32_t i = 0; i < TEST_RATES; i++)
+    {
+        TEST_ASSERT(audio_src_init(&test_src, test_rates[i].in_rate, test_rates[i].out_rate));
+    }
+}
+
+/* The input frames reported for a number of output frames are enough to
+   produce them and none is spare, at every phase of the converter */
+static void test_input_frames(void)
+{
+    uint32_t needed;
+    uint32_t produced;
+
+    for (uint32_t i = 0; i < TEST_RATES; i++)
+    {
+        TEST_ASSERT(audio_src_init(&test_src, test_rates[i].in_rate, test_rates[i].out_rate));
+
+        for (uint32_t frames = 1; frames < 100u; frames += 7u)
+        {
+            needed = audio_src_get_input_frames(&test_src, frames);
+            TEST_ASSERT(needed <= TEST_FRAMES);
+
+            if (needed > 0u)
+            {
+                test_copy = test_src;
+                produced = audio_src_process(&test_copy, test_in, needed - 1u, test_out, frames);
+                TEST_ASSERT(produced < frames);
+            }
+
+            produced = audio_src_process(&test_src, test_in, needed, test_out, frames);
+            TEST_ASSERT(produced == frames);
+        }
+    }
+}
+
+/* One second of input gives one second of output */
+static void test_rate_ratio(void)
+{
+    uint32_t total;
+    uint32_t in_left;
+    uint32_t block;
+    uint32_t out;
+
+    for (uint32_t i = 0; i < TEST_RATES; i++)
+    {
+        TEST_ASSERT(audio_src_init(&test_src, test_rates[i].in_rate, test_rates[i].out_rate));
+
+        total   = 0;
+        in_left = test_rates[i].in_rate;
+
+        while (in_left > 0u)
+        {
+            block = (in_left < TEST_FRAMES) ? in_left : TEST_FRAMES;
+            out = audio_src_process(&test_src, test_in, block, test_out,
+                                    sizeof(test_out) / sizeof(test_out[0]) / AUDIO_SRC_CHANNELS);
+            total   += out;
+            in_left -= block;
+        }
+
+        /* Up to one output frame is still pending in the converter */
+        TEST_ASSERT((test_rates[i].out_rate - total) <= 1u);
+    }
+}
+
+/* A constant input gives the same constant at the output, on both channels */
+static void test_dc_gain(void)
+{
+    const int32_t level[AUDIO_SRC_CHANNELS] = { 0x00400000, -0x00200000 };
+    uint32_t out;
+
+    for (uint32_t i = 0; i < TEST_RATES; i++)
+    {
+        TEST_ASSERT(audio_src_init(&test_src, test_rates[i].in_rate, test_rates[i].out_rate));
+
+        for (uint32_t n = 0; n < TEST_FRAMES; n++)
+        {
+            test_in[2u * n]      = (uint32_t) level[0] & 0x00FFFFFFu;
+            test_in[2u * n + 1u] = (uint32_t) level[1] & 0x00FFFFFFu;
+        }
+
+        out = test_convert(&test_src, TEST_FRAMES);
+
+        for (uint32_t n = TEST_SETTLE; n < out; n++)
+        {
+            TEST_ASSERT(abs(test_sample(test_out[2u * n]) - level[0]) <= 2);
+            TEST_ASSERT(abs(test_sample(test_out[2u * n + 1u]) - level[1]) <= 2);
+        }
+    }
+}
+
+/* A tone within the band keeps its level and frequency: the output is
+   compared to the same tone computed at the output rate, with the delay of
+   the filter */
+static void test_tone(void)
+{
+    double amplitude = TEST_TONE_LEVEL * 8388607.0;
+    double signal;
+    double error;
+    double delay;
+    double t;
+    double expected;
+    uint32_t out;
+
+    for (uint32_t i = 0; i < TEST_RATES; i++)
+    {
+        double in_rate  = (double) test_rates[i].in_rate;
+        double out_rate = (double) test_rates[i].out_rate;
+
+        TEST_ASSERT(audio_src_init(&test_src, test_rates[i].in_rate, test_rates[i].out_rate));
+
+        for (uint32_t n = 0; n < TEST_FRAMES; n++)
+        {
+            int32_t sample = (int32_t) lrint(amplitude * sin(2.0 * M_PI * TEST_TONE_HZ * n / in_rate));
+
+            test_in[2u * n]      = (uint32_t) sample & 0x00FFFFFFu;
+            test_in[2u * n + 1u] = (uint32_t) -sample & 0x00FFFFFFu;
+        }
+
+        out = test_convert(&test_src, TEST_FRAMES);
+
+        /* The prototype filter is linear phase, its delay is half its length
+           at the prototype rate */
+        delay = ((double) (test_src.taps * test_src.up) - 1.0) / 2.0 /
+                (in_rate * (double) test_src.up);
+
+        signal = 0.0;
+        error  = 0.0;
+        for (uint32_t n = TEST_SETTLE; n < (out - TEST_SETTLE); n++)
+        {
+            t = ((double) n / out_rate) - delay;
+            expected = amplitude * sin(2.0 * M_PI * TEST_TONE_HZ * t);
+
+            signal += expected * expected;
+            error  += pow(test_sample(test_out[2u * n]) - expected, 2.0);
+            error  += pow(test_sample(test_out[2u * n + 1u]) + expected, 2.0);
+        }
+
+        TEST_ASSERT((10.0 * log10((2.0 * signal) / error)) >= TEST_MIN_SNR_DB);
+    }
+}
+
+/* A full-scale square wave overshoots after filtering: the output saturates
+   instead of wrapping around, so each half period keeps its sign */
+static void test_saturation(void)
+{
+    uint32_t saturated = 0;
+    uint32_t position;
+    int32_t sample;
+    double delay;
+    uint32_t out;
+
+    TEST_ASSERT(audio_src_init(&test_src, 44100u, 48000u));
+
+    for (uint32_t n = 0; n < TEST_FRAMES; n++)
+    {
+        test_in[2u * n]      = ((n / 20u) & 1u) ? 0x00800000u : 0x007FFFFFu;
+        test_in[2u * n + 1u] = test_in[2u * n];
+    }
+
+    out = test_convert(&test_src, TEST_FRAMES);
+
+    delay = ((double) (test_src.taps * test_src.up) - 1.0) / 2.0 / (double) test_src.up;
+
+    for (uint32_t n = TEST_SETTLE; n < out; n++)
+    {
+        TEST_ASSERT((test_out[2u * n] & ~0x00FFFFFFu) == 0u);
+
+        sample = test_sample(test_out[2u * n]);
+        if ((sample == 0x007FFFFF) || (sample == -0x00800000))
+        {
+            saturated++;
+        }
+
+        /* Position in the 40-frame period of the input, at the output time,
+           away from the edges */
+        position = (uint32_t) lround(((double) n * 44100.0 / 48000.0) - delay) % 40u;
+        if ((position >= 3u) && (position <= 17u))
+        {
+            TEST_ASSERT(sample > 0);
+        }
+        else if ((position >= 23u) && (position <= 37u))
+        {
+            TEST_ASSERT(sample < 0);
+        }
+    }
+
+    TEST_ASSERT(saturated > 0u);
+}
+
+int main(void)
+{
+    printf("test_audio_src\n");
+
+    TEST_RUN(test_reject_ratio);
+    TEST_RUN(test_tables);
+    TEST_RUN(test_input_frames);
+    TEST_RUN(test_rate_ratio);
+    TEST_RUN(test_dc_gain);
+    TEST_RUN(test_tone);
+    TEST_RUN(test_saturation);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* [] END OF FILE */
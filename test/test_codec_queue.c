@@ -0,0 +1,341 @@
+/*******************************************************************************
+* File Name: test_codec_queue.c
+*
+* Description: Host tests of the codec command queue, with a transport stub that
+*  records the transfers and completes them at once, with an error, or never.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "codec_queue.h"
+#include "host_rtos.h"
+#include "test.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Test Constants
+*******************************************************************************/
+#define STUB_LOG_SIZE       (32u)
+
+#define REG_LCH_DIG_VOL     (0x13u)
+#define REG_RCH_DIG_VOL     (0x14u)
+
+/*******************************************************************************
+* Test Types
+*******************************************************************************/
+typedef struct
+{
+    uint8_t  buffer[1u + CODEC_QUEUE_BURST_SIZE];
+    uint32_t length;
+} stub_transfer_t;
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static uint32_t stub_start(const uint8_t *buffer, uint32_t length);
+static void     stub_abort(void);
+static void     stub_callback(uint32_t status, void *arg);
+static void     codec_task(void);
+static void     test_reset(void);
+
+/*******************************************************************************
+* Test Variables
+*******************************************************************************/
+int test_failures;
+
+const codec_queue_transport_t stub_transport = {
+    .start = stub_start,
+    .abort = stub_abort
+};
+
+/* Transfers sent, and the behavior of the next ones */
+stub_transfer_t stub_log[STUB_LOG_SIZE];
+uint32_t        stub_count;
+uint32_t        stub_aborts;
+uint32_t        stub_status;
+bool            stub_hang;
+
+/* Completion callbacks: status, and transfers sent when called */
+uint32_t        callback_status[CODEC_QUEUE_SIZE];
+uint32_t        callback_sent[CODEC_QUEUE_SIZE];
+uint32_t        callback_count;
+
+/* Set while the codec task is stalled */
+bool            codec_task_stalled;
+
+/*******************************************************************************
+* Function Name: stub_start
+********************************************************************************
+* Summary:
+*   Transport stub: record the transfer and complete it, unless it hangs.
+*
+*******************************************************************************/
+static uint32_t stub_start(const uint8_t *buffer, uint32_t length)
+{
+    if (stub_count < STUB_LOG_SIZE)
+    {
+        memcpy(stub_log[stub_count].buffer, buffer, length);
+        stub_log[stub_count].length = length;
+    }
+    stub_count++;
+
+    if (stub_hang == false)
+    {
+        codec_queue_complete(stub_status);
+    }
+
+    return 0u;
+}
+
+/*******************************************************************************
+* Function Name: stub_abort
+********************************************************************************
+* Summary:
+*   Transport stub: count the transfers aborted.
+*
+*******************************************************************************/
+static void stub_abort(void)
+{
+    stub_aborts++;
+}
+
+/*******************************************************************************
+* Function Name: stub_callback
+********************************************************************************
+* Summary:
+*   Record a completion callback. The argument is the expected callback index.
+*
+*******************************************************************************/
+static void stub_callback(uint32_t status, void *arg)
+{
+    TEST_ASSERT((uintptr_t) arg == callback_count);
+
+    callback_status[callback_count] = status;
+    callback_sent[callback_count]   = stub_count;
+    callback_count++;
+}
+
+/*******************************************************************************
+* Function Name: codec_task
+********************************************************************************
+* Summary:
+*   Idle hook: the codec task runs one batch while the test task waits.
+*
+*******************************************************************************/
+static void codec_task(void)
+{
+    if (codec_task_stalled == false)
+    {
+        (void) codec_queue_service(0u);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_reset
+********************************************************************************
+* Summary:
+*   Start a test with an empty queue and a transport that succeeds.
+*
+*******************************************************************************/
+static void test_reset(void)
+{
+    codec_queue_init();
+    codec_queue_register_transport(&stub_transport);
+    host_rtos_set_idle_hook(codec_task);
+
+    stub_count         = 0;
+    stub_aborts        = 0;
+    stub_status        = CODEC_QUEUE_SUCCESS;
+    stub_hang          = false;
+    callback_count     = 0;
+    codec_task_stalled = false;
+}
+
+/* Writes to the next registers are merged into one transfer */
+static void test_merge_next_registers(void)
+{
+    const uint8_t left = 0x20u;
+    const uint8_t right = 0x30u;
+
+    test_reset();
+
+    codec_queue_write(REG_LCH_DIG_VOL, &left, 1u, NULL, NULL);
+    codec_queue_write(REG_RCH_DIG_VOL, &right, 1u, NULL, NULL);
+
+    TEST_ASSERT(codec_queue_flush(10u) == CODEC_QUEUE_SUCCESS);
+    TEST_ASSERT(stub_count == 1u);
+    TEST_ASSERT(stub_log[0].length == 3u);
+    TEST_ASSERT(stub_log[0].buffer[0] == REG_LCH_DIG_VOL);
+    TEST_ASSERT(stub_log[0].buffer[1] == left);
+    TEST_ASSERT(stub_log[0].buffer[2] == right);
+}
+
+/* A write to the same register replaces the pending one */
+static void test_replace_same_register(void)
+{
+    const uint8_t both[] = {0x10u, 0x11u};
+    const uint8_t left = 0x40u;
+
+    test_reset();
+
+    codec_queue_write(REG_LCH_DIG_VOL, both, sizeof(both), NULL, NULL);
+    codec_queue_write(REG_LCH_DIG_VOL, &left, 1u, NULL, NULL);
+
+    TEST_ASSERT(codec_queue_flush(10u) == CODEC_QUEUE_SUCCESS);
+    TEST_ASSERT(stub_count == 1u);
+    TEST_ASSERT(stub_log[0].length == 3u);
+    TEST_ASSERT(stub_log[0].buffer[1] == left);
+    TEST_ASSERT(stub_log[0].buffer[2] == both[1]);
+}
+
+/* A write to an earlier register is not merged, the order is kept */
+static void test_keep_order(void)
+{
+    const uint8_t value = 0x01u;
+
+    test_reset();
+
+    codec_queue_write(0x05u, &value, 1u, NULL, NULL);
+    codec_queue_write(0x02u, &value, 1u, NULL, NULL);
+
+    TEST_ASSERT(codec_queue_flush(10u) == CODEC_QUEUE_SUCCESS);
+    TEST_ASSERT(stub_count == 2u);
+    TEST_ASSERT(stub_log[0].buffer[0] == 0x05u);
+    TEST_ASSERT(stub_log[1].buffer[0] == 0x02u);
+}
+
+/* Callbacks run in order, after the transfer of their write */
+static void test_callbacks(void)
+{
+    const uint8_t value = 0x01u;
+
+    test_reset();
+
+    codec_queue_write(0x05u, &value, 1u, stub_callback, (void *) 0);
+    codec_queue_write(0x02u, &value, 1u, stub_callback, (void *) 1);
+
+    TEST_ASSERT(codec_queue_flush(10u) == CODEC_QUEUE_SUCCESS);
+    TEST_ASSERT(callback_count == 2u);
+    TEST_ASSERT(callback_status[0] == CODEC_QUEUE_SUCCESS);
+    TEST_ASSERT(callback_sent[0] == 1u);
+    TEST_ASSERT(callback_sent[1] == 2u);
+}
+
+/* A transfer error is reported by the next flush only */
+static void test_flush_reports_error(void)
+{
+    const uint8_t value = 0x01u;
+
+    test_reset();
+
+    stub_status = CODEC_QUEUE_ERROR_TRANSFER;
+    codec_queue_write(0x05u, &value, 1u, stub_callback, (void *) 0);
+    TEST_ASSERT(codec_queue_flush(10u) == CODEC_QUEUE_ERROR_TRANSFER);
+    TEST_ASSERT(callback_status[0] == CODEC_QUEUE_ERROR_TRANSFER);
+
+    stub_status = CODEC_QUEUE_SUCCESS;
+    codec_queue_write(0x05u, &value, 1u, NULL, NULL);
+    TEST_ASSERT(codec_queue_flush(10u) == CODEC_QUEUE_SUCCESS);
+}
+
+/* A transfer that does not complete is aborted and reported */
+static void test_transfer_timeout(void)
+{
+    const uint8_t value = 0x01u;
+
+    test_reset();
+
+    stub_hang = true;
+    codec_queue_write(0x05u, &value, 1u, NULL, NULL);
+    TEST_ASSERT(codec_queue_flush(100u) == CODEC_QUEUE_ERROR_TIMEOUT);
+    TEST_ASSERT(stub_aborts == 1u);
+}
+
+/* The writes are refused once the queue is full */
+static void test_queue_full(void)
+{
+    const uint8_t value = 0x01u;
+    uint32_t i;
+
+    test_reset();
+
+    for (i = 0; i < CODEC_QUEUE_SIZE; i++)
+    {
+        TEST_ASSERT(codec_queue_write((uint8_t) (2u * i), &value, 1u, NULL, NULL) == CODEC_QUEUE_SUCCESS);
+    }
+    TEST_ASSERT(codec_queue_write(0x7Fu, &value, 1u, NULL, NULL) == CODEC_QUEUE_ERROR_FULL);
+
+    while (codec_queue_service(0u) == true)
+    {
+    }
+    TEST_ASSERT(stub_count == CODEC_QUEUE_SIZE);
+}
+
+/* The barrier of a flush that timed out does not complete the next flush
+   before its own writes are sent */
+static void test_stale_barrier(void)
+{
+    const uint8_t first = 0x01u;
+    const uint8_t second = 0x02u;
+
+    test_reset();
+
+    codec_task_stalled = true;
+    codec_queue_write(0x05u, &first, 1u, NULL, NULL);
+    TEST_ASSERT(codec_queue_flush(10u) == CODEC_QUEUE_ERROR_TIMEOUT);
+    TEST_ASSERT(stub_count == 0u);
+
+    codec_task_stalled = false;
+    codec_queue_write(0x02u, &second, 1u, NULL, NULL);
+    TEST_ASSERT(codec_queue_flush(10u) == CODEC_QUEUE_SUCCESS);
+    TEST_ASSERT(stub_count == 2u);
+    TEST_ASSERT(stub_log[1].buffer[0] == 0x02u);
+    TEST_ASSERT(codec_queue_service(0u) == false);
+}
+
+int main(void)
+{
+    printf("test_codec_queue\n");
+
+    TEST_RUN(test_merge_next_registers);
+    TEST_RUN(test_replace_same_register);
+    TEST_RUN(test_keep_order);
+    TEST_RUN(test_callbacks);
+    TEST_RUN(test_flush_reports_error);
+    TEST_RUN(test_transfer_timeout);
+    TEST_RUN(test_queue_full);
+    TEST_RUN(test_stale_barrier);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* [] END OF FILE */
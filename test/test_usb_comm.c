@@ -0,0 +1,319 @@
+/*******************************************************************************
+* File Name: test_usb_comm.c
+*
+* Description: Host tests of the audio control requests: lookup in the control
+*  map, data stage, on-change hooks and interface selection.
+*
+******************************************************************************
+* (c) 2019-2020, Cypress Semiconductor Corporation. All rights reserved.
+*******************************************************************************
+* This software, including source code, documentation and related materials
+* ("Software"), is owned by Cypress Semiconductor Corporation or one of its
+* subsidiaries ("Cypress") and is protected by and subject to worldwide patent
+* protection (United States and foreign), United States copyright laws and
+* international treaty provisions. Therefore, you may use this Software only
+* as provided in the license agreement accompanying the software package from
+* which you obtained this Software ("EULA").
+*
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software source
+* code solely for use in connection with Cypress's integrated circuit products.
+* Any reproduction, modification, translation, compilation, or representation
+* of this Software except as specified above is prohibited without the express
+* written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer of such
+* system or application assumes all risk of such use and in doing so agrees to
+* indemnify Cypress against all liability.
+*****************************************************************************/
+#include "usb_comm.h"
+#include "host_usb.h"
+#include "rtos.h"
+#include "test.h"
+
+#include <string.h>
+
+/*******************************************************************************
+* Test Constants
+*******************************************************************************/
+/* Size of the data stage buffer of the middleware */
+#define TEST_BUFFER_SIZE    (8u)
+
+/*******************************************************************************
+* Local Functions
+*******************************************************************************/
+static cy_en_usb_dev_status_t test_request(uint8_t type, uint8_t bRequest, uint16_t wIndex,
+                                           uint8_t selector, uint8_t channel);
+static cy_en_usb_dev_status_t test_set(uint8_t bRequest, uint16_t wIndex, uint8_t selector,
+                                       uint8_t channel, const uint8_t *data);
+static void stub_enable_out(void);
+static void stub_enable_in(void);
+static void stub_disable_out(void);
+static void stub_disable_in(void);
+
+/*******************************************************************************
+* Test Variables
+*******************************************************************************/
+int test_failures;
+
+EventGroupHandle_t rtos_events;
+
+cy_stc_usb_dev_control_transfer_t test_transfer;
+uint8_t test_buffer[TEST_BUFFER_SIZE];
+
+/* Calls of the streaming interface functions */
+uint32_t stub_enable_out_count;
+uint32_t stub_enable_in_count;
+uint32_t stub_disable_out_count;
+uint32_t stub_disable_in_count;
+
+usb_comm_interface_t stub_interface = {
+    .enable_out  = stub_enable_out,
+    .enable_in   = stub_enable_in,
+    .disable_out = stub_disable_out,
+    .disable_in  = stub_disable_in,
+};
+
+static void stub_enable_out(void)  { stub_enable_out_count++; }
+static void stub_enable_in(void)   { stub_enable_in_count++; }
+static void stub_disable_out(void) { stub_disable_out_count++; }
+static void stub_disable_in(void)  { stub_disable_in_count++; }
+
+/*******************************************************************************
+* Function Name: test_request
+********************************************************************************
+* Summary:
+*   Run the setup stage of a request, as the middleware calls the request
+*   received callback.
+*
+*******************************************************************************/
+static cy_en_usb_dev_status_t test_request(uint8_t type, uint8_t bRequest, uint16_t wIndex,
+                                           uint8_t selector, uint8_t channel)
+{
+    memset(&test_transfer, 0, sizeof(test_transfer));
+    memset(test_buffer, 0, sizeof(test_buffer));
+
+    test_transfer.setup.bmRequestType.type = type;
+    test_transfer.setup.bRequest = bRequest;
+    test_transfer.setup.wIndex   = wIndex;
+    test_transfer.setup.wValue   = (uint16_t) ((selector << 8) | channel);
+    test_transfer.buffer         = test_buffer;
+
+    return host_usb_request_received(&test_transfer, NULL, NULL);
+}
+
+/*******************************************************************************
+* Function Name: test_set
+********************************************************************************
+* Summary:
+*   Run a SET request: the setup stage, the data stage into the buffer, and
+*   the request completed callback.
+*
+*******************************************************************************/
+static cy_en_usb_dev_status_t test_set(uint8_t bRequest, uint16_t wIndex, uint8_t selector,
+                                       uint8_t channel, const uint8_t *data)
+{
+    cy_en_usb_dev_status_t status;
+
+    status = test_request(CY_USB_DEV_CLASS_TYPE, bRequest, wIndex, selector, channel);
+    if (status != CY_USB_DEV_SUCCESS)
+    {
+        return status;
+    }
+
+    TEST_ASSERT(test_transfer.ptr == test_buffer);
+    TEST_ASSERT(test_transfer.notify == true);
+
+    memcpy(test_transfer.ptr, data, test_transfer.remaining);
+
+    return host_usb_request_completed(&test_transfer, NULL, NULL);
+}
+
+/* The GET requests of the volume point the data stage at the storage of the
+   attribute, for each channel, and signal the audio task */
+static void test_get_volume(void)
+{
+    static const uint8_t requests[] = {CY_USB_DEV_AUDIO_RQST_GET_CUR, CY_USB_DEV_AUDIO_RQST_GET_MIN,
+                                       CY_USB_DEV_AUDIO_RQST_GET_MAX, CY_USB_DEV_AUDIO_RQST_GET_RES};
+
+    for (uint8_t channel = 0; channel < AUDIO_FEATURE_UNIT_CHANNELS; channel++)
+    {
+        const uint8_t *storage[] = {usb_comm_cur_volume[channel], usb_comm_min_volume,
+                                    usb_comm_max_volume, usb_comm_res_volume};
+
+        for (uint32_t i = 0; i < sizeof(requests); i++)
+        {
+            xEventGroupClearBitsFromISR(rtos_events, RTOS_EVENT_USB);
+
+            TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, requests[i], AUDIO_CONTROL_FEATURE_UNIT,
+                                     CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL, channel) == CY_USB_DEV_SUCCESS);
+            TEST_ASSERT(test_transfer.ptr == storage[i]);
+            TEST_ASSERT(test_transfer.remaining == AUDIO_VOLUME_SIZE);
+            TEST_ASSERT(test_transfer.notify == false);
+            TEST_ASSERT((xEventGroupGetBits(rtos_events) & RTOS_EVENT_USB) != 0u);
+        }
+    }
+}
+
+/* A SET_CUR of the volume stores the value of its channel only */
+static void test_set_volume(void)
+{
+    static const uint8_t volume[] = {0x00u, 0xF6u};     /* -10 dB */
+
+    usb_comm_set_volume(usb_comm_cur_volume[0], 0);
+    usb_comm_set_volume(usb_comm_cur_volume[1], 0);
+    usb_comm_set_volume(usb_comm_cur_volume[2], 0);
+
+    TEST_ASSERT(test_set(CY_USB_DEV_AUDIO_RQST_SET_CUR, AUDIO_CONTROL_FEATURE_UNIT,
+                         CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL, AUDIO_FEATURE_UNIT_LEFT_CHANNEL,
+                         volume) == CY_USB_DEV_SUCCESS);
+
+    TEST_ASSERT(usb_comm_get_volume(usb_comm_cur_volume[1]) == -2560);
+    TEST_ASSERT(usb_comm_get_volume(usb_comm_cur_volume[0]) == 0);
+    TEST_ASSERT(usb_comm_get_volume(usb_comm_cur_volume[2]) == 0);
+}
+
+/* The mute supports GET_CUR and SET_CUR only */
+static void test_mute(void)
+{
+    static const uint8_t mute[] = {1u};
+
+    usb_comm_mute[AUDIO_FEATURE_UNIT_MASTER_CHANNEL] = 0u;
+
+    TEST_ASSERT(test_set(CY_USB_DEV_AUDIO_RQST_SET_CUR, AUDIO_CONTROL_FEATURE_UNIT,
+                         CY_USB_DEV_AUDIO_CS_MUTE_CONTROL, AUDIO_FEATURE_UNIT_MASTER_CHANNEL,
+                         mute) == CY_USB_DEV_SUCCESS);
+    TEST_ASSERT(usb_comm_mute[AUDIO_FEATURE_UNIT_MASTER_CHANNEL] == 1u);
+
+    TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, CY_USB_DEV_AUDIO_RQST_GET_CUR,
+                             AUDIO_CONTROL_FEATURE_UNIT, CY_USB_DEV_AUDIO_CS_MUTE_CONTROL,
+                             AUDIO_FEATURE_UNIT_MASTER_CHANNEL) == CY_USB_DEV_SUCCESS);
+    TEST_ASSERT(test_transfer.ptr == &usb_comm_mute[AUDIO_FEATURE_UNIT_MASTER_CHANNEL]);
+    TEST_ASSERT(test_transfer.remaining == 1u);
+
+    TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, CY_USB_DEV_AUDIO_RQST_GET_MIN,
+                             AUDIO_CONTROL_FEATURE_UNIT, CY_USB_DEV_AUDIO_CS_MUTE_CONTROL,
+                             AUDIO_FEATURE_UNIT_MASTER_CHANNEL) == CY_USB_DEV_REQUEST_NOT_HANDLED);
+    TEST_ASSERT(test_transfer.ptr == NULL);
+}
+
+/* A new sampling frequency on either endpoint is decoded by its hook, which
+   clears the sync event, whatever the channel of the request */
+static void test_sample_rate(void)
+{
+    static const uint8_t rate_44k1[] = {0x44u, 0xACu, 0x00u};
+    static const uint8_t rate_16k[]  = {0x80u, 0x3Eu, 0x00u};
+
+    xEventGroupSetBitsFromISR(rtos_events, RTOS_EVENT_SYNC, &(BaseType_t) {pdFALSE});
+
+    TEST_ASSERT(test_set(CY_USB_DEV_AUDIO_RQST_SET_CUR, AUDIO_STREAMING_OUT_ENDPOINT_ADDR,
+                         CY_USB_DEV_AUDIO_CS_SAMPLING_FREQ_CTRL, 0u, rate_44k1) == CY_USB_DEV_SUCCESS);
+    TEST_ASSERT(usb_comm_new_out_sample_rate == 44100u);
+    TEST_ASSERT(usb_comm_get_sample_rate(0u) == 44100u);
+    TEST_ASSERT((xEventGroupGetBits(rtos_events) & RTOS_EVENT_SYNC) == 0u);
+
+    xEventGroupSetBitsFromISR(rtos_events, RTOS_EVENT_SYNC, &(BaseType_t) {pdFALSE});
+
+    TEST_ASSERT(test_set(CY_USB_DEV_AUDIO_RQST_SET_CUR, AUDIO_STREAMING_IN_ENDPOINT_ADDR,
+                         CY_USB_DEV_AUDIO_CS_SAMPLING_FREQ_CTRL, 2u, rate_16k) == CY_USB_DEV_SUCCESS);
+    TEST_ASSERT(usb_comm_new_in_sample_rate == 16000u);
+    TEST_ASSERT(usb_comm_get_sample_rate(1u) == 16000u);
+    TEST_ASSERT(usb_comm_new_out_sample_rate == 44100u);
+    TEST_ASSERT((xEventGroupGetBits(rtos_events) & RTOS_EVENT_SYNC) == 0u);
+
+    TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, CY_USB_DEV_AUDIO_RQST_GET_CUR,
+                             AUDIO_STREAMING_OUT_ENDPOINT_ADDR, CY_USB_DEV_AUDIO_CS_SAMPLING_FREQ_CTRL,
+                             0u) == CY_USB_DEV_SUCCESS);
+    TEST_ASSERT(test_transfer.remaining == AUDIO_SAMPLE_FREQ_SIZE);
+    TEST_ASSERT(memcmp(test_transfer.ptr, rate_44k1, sizeof(rate_44k1)) == 0);
+}
+
+/* Requests out of the control map, or not supported by the control, are
+   left to the middleware and do not touch the storage */
+static void test_unsupported(void)
+{
+    static const uint8_t volume[] = {0x00u, 0x80u};
+
+    usb_comm_set_volume(usb_comm_cur_volume[0], 0);
+
+    /* Unknown entity, control selector and channel */
+    TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, CY_USB_DEV_AUDIO_RQST_GET_CUR, 0x0300u,
+                             CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL, 0u) == CY_USB_DEV_REQUEST_NOT_HANDLED);
+    TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, CY_USB_DEV_AUDIO_RQST_GET_CUR, AUDIO_CONTROL_FEATURE_UNIT,
+                             CY_USB_DEV_AUDIO_CS_BASS_CONTROL, 0u) == CY_USB_DEV_REQUEST_NOT_HANDLED);
+    TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, CY_USB_DEV_AUDIO_RQST_GET_CUR, AUDIO_CONTROL_FEATURE_UNIT,
+                             CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL, AUDIO_FEATURE_UNIT_CHANNELS) ==
+                CY_USB_DEV_REQUEST_NOT_HANDLED);
+
+    /* Requests without an attribute, and a standard request */
+    TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, CY_USB_DEV_AUDIO_RQST_GET_MEM, AUDIO_CONTROL_FEATURE_UNIT,
+                             CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL, 0u) == CY_USB_DEV_REQUEST_NOT_HANDLED);
+    TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, CY_USB_DEV_AUDIO_RQST_GET_STAT, AUDIO_CONTROL_FEATURE_UNIT,
+                             CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL, 0u) == CY_USB_DEV_REQUEST_NOT_HANDLED);
+    TEST_ASSERT(test_request(CY_USB_DEV_STANDARD_TYPE, CY_USB_DEV_AUDIO_RQST_GET_CUR, AUDIO_CONTROL_FEATURE_UNIT,
+                             CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL, 0u) == CY_USB_DEV_REQUEST_NOT_HANDLED);
+    TEST_ASSERT(test_transfer.ptr == NULL);
+
+    /* The data stage of a GET request stores nothing */
+    TEST_ASSERT(test_request(CY_USB_DEV_CLASS_TYPE, CY_USB_DEV_AUDIO_RQST_GET_CUR, AUDIO_CONTROL_FEATURE_UNIT,
+                             CY_USB_DEV_AUDIO_CS_VOLUME_CONTROL, 0u) == CY_USB_DEV_SUCCESS);
+    memcpy(test_buffer, volume, sizeof(volume));
+    TEST_ASSERT(host_usb_request_completed(&test_transfer, NULL, NULL) == CY_USB_DEV_REQUEST_NOT_HANDLED);
+    TEST_ASSERT(usb_comm_get_volume(usb_comm_cur_volume[0]) == 0);
+}
+
+/* Each streaming interface selects the subframe size of its alternate and
+   enables or disables its audio path */
+static void test_interface(void)
+{
+    usb_comm_register_interface(&stub_interface);
+
+    TEST_ASSERT(host_usb_set_interface(AUDIO_STREAMING_OUT_INTERFACE, AUDIO_STREAMING_OUT_ALTERNATE_16BIT,
+                                       NULL, NULL) == CY_USB_DEV_SUCCESS);
+    TEST_ASSERT(usb_comm_out_subframe_size == AUDIO_SAMPLE_DATA_SIZE_16BIT);
+    TEST_ASSERT(usb_comm_enable_out_streaming == true);
+    TEST_ASSERT(stub_enable_out_count == 1u);
+
+    TEST_ASSERT(host_usb_set_interface(AUDIO_STREAMING_IN_INTERFACE, AUDIO_STREAMING_IN_ALTERNATE,
+                                       NULL, NULL) == CY_USB_DEV_SUCCESS);
+    TEST_ASSERT(usb_comm_in_subframe_size == AUDIO_SAMPLE_DATA_SIZE);
+    TEST_ASSERT(usb_comm_enable_in_streaming == true);
+    TEST_ASSERT(stub_enable_in_count == 1u);
+
+    TEST_ASSERT(host_usb_set_interface(AUDIO_STREAMING_OUT_INTERFACE, 0u, NULL, NULL) == CY_USB_DEV_SUCCESS);
+    TEST_ASSERT(usb_comm_out_subframe_size == AUDIO_SAMPLE_DATA_SIZE);
+    TEST_ASSERT(usb_comm_enable_out_streaming == false);
+    TEST_ASSERT(stub_disable_out_count == 1u);
+    TEST_ASSERT(usb_comm_enable_in_streaming == true);
+    TEST_ASSERT(stub_disable_in_count == 0u);
+}
+
+int main(void)
+{
+    printf("test_usb_comm\n");
+
+    rtos_events = xEventGroupCreate();
+
+    usb_comm_init();
+    usb_comm_register_usb_callbacks();
+
+    TEST_RUN(test_get_volume);
+    TEST_RUN(test_set_volume);
+    TEST_RUN(test_mute);
+    TEST_RUN(test_sample_rate);
+    TEST_RUN(test_unsupported);
+    TEST_RUN(test_interface);
+
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* [] END OF FILE */